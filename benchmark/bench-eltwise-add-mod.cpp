@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "eltwise/eltwise-add-mod-avx2.hpp"
 #include "eltwise/eltwise-add-mod-avx512.hpp"
 #include "eltwise/eltwise-add-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-add-mod.hpp"
@@ -63,6 +64,32 @@ BENCHMARK(BM_EltwiseVectorVectorAddModAVX512)
     ->Args({16384});
 #endif
 
+//=================================================================
+
+#ifdef HEXL_HAS_AVX256
+// state[0] is the degree
+static void BM_EltwiseVectorVectorAddModAVX2(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t modulus = 1152921504606877697;
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseAddModAVX2(output.data(), input1.data(), input2.data(), input_size,
+                      modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseVectorVectorAddModAVX2)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
 //=================================================================
 // state[0] is the degree
 static void BM_EltwiseVectorScalarAddModNative(
@@ -112,5 +139,55 @@ BENCHMARK(BM_EltwiseVectorScalarAddModAVX512)
     ->Args({16384});
 #endif
 
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseVectorVectorAddModU32Native(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseAddModNative(output.data(), input1.data(), input2.data(), input_size,
+                        modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseVectorVectorAddModU32Native)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+static void BM_EltwiseVectorVectorAddModU32AVX512(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseAddModAVX512(output.data(), input1.data(), input2.data(), input_size,
+                        modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseVectorVectorAddModU32AVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
 }  // namespace hexl
 }  // namespace intel
@@ -0,0 +1,122 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "eltwise/eltwise-double-word-avx512.hpp"
+#include "eltwise/eltwise-double-word-internal.hpp"
+#include "hexl/eltwise/eltwise-double-word.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_EltwiseAddModDoubleWord(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWordModulus modulus(GeneratePrimesDoubleWord(1, bit_size - 1)[0]);
+
+  AlignedVector64<DoubleWord> input1(input_size, DoubleWord{1, 0});
+  AlignedVector64<DoubleWord> input2(input_size, DoubleWord{2, 0});
+  AlignedVector64<DoubleWord> output(input_size);
+
+  for (auto _ : state) {
+    EltwiseAddModDoubleWord(output.data(), input1.data(), input2.data(),
+                            input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseAddModDoubleWord)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_EltwiseSubModDoubleWord(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWordModulus modulus(GeneratePrimesDoubleWord(1, bit_size - 1)[0]);
+
+  AlignedVector64<DoubleWord> input1(input_size, DoubleWord{1, 0});
+  AlignedVector64<DoubleWord> input2(input_size, DoubleWord{2, 0});
+  AlignedVector64<DoubleWord> output(input_size);
+
+  for (auto _ : state) {
+    EltwiseSubModDoubleWord(output.data(), input1.data(), input2.data(),
+                            input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseSubModDoubleWord)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_EltwiseMultModDoubleWordNative(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWordModulus modulus(GeneratePrimesDoubleWord(1, bit_size - 1)[0]);
+
+  AlignedVector64<DoubleWord> input1(input_size, DoubleWord{1, 1});
+  AlignedVector64<DoubleWord> input2(input_size, DoubleWord{2, 3});
+  AlignedVector64<DoubleWord> output(input_size);
+
+  for (auto _ : state) {
+    EltwiseMultModDoubleWordNative(output.data(), input1.data(),
+                                   input2.data(), input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModDoubleWordNative)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100})
+    ->Args({16384, 125});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512IFMA
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_EltwiseMultModDoubleWordAVX512(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWordModulus modulus(GeneratePrimesDoubleWord(1, bit_size - 1)[0]);
+
+  AlignedVector64<DoubleWord> input1(input_size, DoubleWord{1, 1});
+  AlignedVector64<DoubleWord> input2(input_size, DoubleWord{2, 3});
+  AlignedVector64<DoubleWord> output(input_size);
+
+  for (auto _ : state) {
+    EltwiseMultModDoubleWordAVX512(output.data(), input1.data(),
+                                   input2.data(), input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModDoubleWordAVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100})
+    ->Args({16384, 125});
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "eltwise/eltwise-fma-mod-avx2.hpp"
 #include "eltwise/eltwise-fma-mod-avx512.hpp"
 #include "eltwise/eltwise-fma-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-fma-mod.hpp"
@@ -88,5 +89,78 @@ BENCHMARK(BM_EltwiseFMAModAVX512IFMA)
     ->Args({16384});
 #endif
 
+#ifdef HEXL_HAS_AVX256
+// state[0] is the degree
+static void BM_EltwiseFMAModAVX2(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t modulus = 100;
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  uint64_t input2 = 3;
+  AlignedVector64<uint64_t> input3(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseFMAModAVX2<1>(input1.data(), input1.data(), input2, input3.data(),
+                         input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseFMAModAVX2)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
+//=================================================================
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseFMAModU32Native(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  uint32_t input2 = 3;
+  AlignedVector64<uint32_t> input3(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseFMAModNative<1>(input1.data(), input1.data(), input2, input3.data(),
+                           input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseFMAModU32Native)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+static void BM_EltwiseFMAModU32AVX512(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  uint32_t input2 = 3;
+  AlignedVector64<uint32_t> input3(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseFMAModAVX512U32<1>(input1.data(), input1.data(), input2,
+                              input3.data(), input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseFMAModU32AVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
 }  // namespace hexl
 }  // namespace intel
@@ -0,0 +1,178 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "eltwise/eltwise-goldilocks-avx512.hpp"
+#include "eltwise/eltwise-goldilocks-internal.hpp"
+#include "hexl/eltwise/eltwise-fma-mod.hpp"
+#include "hexl/eltwise/eltwise-goldilocks.hpp"
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+// Goldilocks kernels, compared against the generic kernels with a 62-bit
+// modulus, the widest EltwiseMultMod supports
+
+// state[0] is the degree
+static void BM_EltwiseAddModGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseAddModGoldilocks(output.data(), input1.data(), input2.data(),
+                            input_size);
+  }
+}
+
+BENCHMARK(BM_EltwiseAddModGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseSubModGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseSubModGoldilocks(output.data(), input1.data(), input2.data(),
+                            input_size);
+  }
+}
+
+BENCHMARK(BM_EltwiseSubModGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseMultModGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+
+  AlignedVector64<uint64_t> input1(input_size, kGoldilocksModulus - 1);
+  AlignedVector64<uint64_t> input2(input_size, kGoldilocksModulus - 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultModGoldilocks(output.data(), input1.data(), input2.data(),
+                             input_size);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseMultModGoldilocksNative(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+
+  AlignedVector64<uint64_t> input1(input_size, kGoldilocksModulus - 1);
+  AlignedVector64<uint64_t> input2(input_size, kGoldilocksModulus - 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultModGoldilocksNative(output.data(), input1.data(),
+                                   input2.data(), input_size);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModGoldilocksNative)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseMultModGeneric62(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = GeneratePrimes(1, 61, 1024)[0];
+
+  AlignedVector64<uint64_t> input1(input_size, modulus - 1);
+  AlignedVector64<uint64_t> input2(input_size, modulus - 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultMod(output.data(), input1.data(), input2.data(), input_size,
+                   modulus, 1);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModGeneric62)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseFMAModGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+
+  AlignedVector64<uint64_t> input1(input_size, kGoldilocksModulus - 1);
+  AlignedVector64<uint64_t> input3(input_size, kGoldilocksModulus - 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseFMAModGoldilocks(output.data(), input1.data(), 3, input3.data(),
+                            input_size);
+  }
+}
+
+BENCHMARK(BM_EltwiseFMAModGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseFMAModGeneric61(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = GeneratePrimes(1, 60, 1024)[0];
+
+  AlignedVector64<uint64_t> input1(input_size, modulus - 1);
+  AlignedVector64<uint64_t> input3(input_size, modulus - 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseFMAMod(output.data(), input1.data(), 3, input3.data(), input_size,
+                  modulus, 1);
+  }
+}
+
+BENCHMARK(BM_EltwiseFMAModGeneric61)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+}  // namespace hexl
+}  // namespace intel
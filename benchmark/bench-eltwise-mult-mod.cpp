@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "eltwise/eltwise-mult-mod-avx2.hpp"
 #include "eltwise/eltwise-mult-mod-avx512.hpp"
 #include "eltwise/eltwise-mult-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-mult-mod.hpp"
@@ -36,7 +37,7 @@ static void BM_EltwiseMultMod(benchmark::State& state) {  //  NOLINT
 
 BENCHMARK(BM_EltwiseMultMod)
     ->Unit(benchmark::kMicrosecond)
-    ->ArgsProduct({{1024, 8192, 16384}, {48, 60}, {1, 2, 4}});
+    ->ArgsProduct({{1024, 8192, 16384}, {48, 50, 60}, {1, 2, 4}});
 
 //=================================================================
 
@@ -153,5 +154,230 @@ BENCHMARK(BM_EltwiseMultModAVX512Int)
 
 //=================================================================
 
+#ifdef HEXL_HAS_AVX512IFMA
+// state[0] is the degree
+// state[1] is the bit-width of the modulus
+// state[2] is the input_mod_factor
+static void BM_EltwiseMultModAVX512IFMA(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_width = state.range(1);
+  size_t input_mod_factor = state.range(2);
+  uint64_t modulus = GeneratePrimes(1, bit_width, 1024)[0];
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 3);
+
+  for (auto _ : state) {
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX512IFMA<1>(output.data(), input1.data(),
+                                    input2.data(), input_size, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX512IFMA<2>(output.data(), input1.data(),
+                                    input2.data(), input_size, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX512IFMA<4>(output.data(), input1.data(),
+                                    input2.data(), input_size, modulus);
+        break;
+    }
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModAVX512IFMA)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 4096, 16384}, {40, 50}, {1, 2, 4}});
+#endif
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX256
+// state[0] is the degree
+// state[1] is the input_mod_factor
+static void BM_EltwiseMultModAVX2Int32(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t input_mod_factor = state.range(1);
+  size_t modulus = 1073479681;
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 3);
+
+  for (auto _ : state) {
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX2Int32<1>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX2Int32<2>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX2Int32<4>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+    }
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModAVX2Int32)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 2})
+    ->Args({1024, 4})
+    ->Args({4096, 1})
+    ->Args({4096, 2})
+    ->Args({4096, 4})
+    ->Args({16384, 1})
+    ->Args({16384, 2})
+    ->Args({16384, 4});
+#endif
+
+//=================================================================
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseMultModU32Native(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 3);
+
+  for (auto _ : state) {
+    EltwiseMultModNative<1>(output.data(), input1.data(), input2.data(),
+                            input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModU32Native)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+// state[1] is the input_mod_factor
+static void BM_EltwiseMultModU32AVX512(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t input_mod_factor = state.range(1);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 3);
+
+  for (auto _ : state) {
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX512U32<1>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX512U32<2>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX512U32<4>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+        break;
+    }
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModU32AVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 2})
+    ->Args({1024, 4})
+    ->Args({4096, 1})
+    ->Args({4096, 2})
+    ->Args({4096, 4})
+    ->Args({16384, 1})
+    ->Args({16384, 2})
+    ->Args({16384, 4});
+#endif
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the bit-width of the modulus
+static void BM_EltwiseMultModMontgomery(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_width = state.range(1);
+  uint64_t modulus = (1ULL << bit_width) + 7;
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultModMontgomery(output.data(), input1.data(), input2.data(),
+                             input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModMontgomery)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 8192, 16384}, {48, 60}});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the bit-width of the modulus
+static void BM_EltwiseMultModSpecialNative(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_width = state.range(1);
+  SpecialFormModulus modulus(
+      GeneratePrimes(1, bit_width - 1, 1024, true)[0]);
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultModSpecialNative<1>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModSpecialNative)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 4096, 16384}, {55, 60, 62}});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+// state[1] is the bit-width of the modulus
+static void BM_EltwiseMultModAVX512Special(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  size_t bit_width = state.range(1);
+  SpecialFormModulus modulus(
+      GeneratePrimes(1, bit_width - 1, 1024, true)[0]);
+
+  AlignedVector64<uint64_t> input1(input_size, 1);
+  AlignedVector64<uint64_t> input2(input_size, 2);
+  AlignedVector64<uint64_t> output(input_size, 2);
+
+  for (auto _ : state) {
+    EltwiseMultModAVX512Special<1>(output.data(), input1.data(), input2.data(),
+                                   input_size, modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseMultModAVX512Special)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 4096, 16384}, {55, 60, 62}});
+#endif
+
 }  // namespace hexl
 }  // namespace intel
@@ -111,5 +111,55 @@ BENCHMARK(BM_EltwiseReduceModAVX512)
 
 //=================================================================
 
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseReduceModU32Native(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  const uint64_t input_mod_factor = 0;
+  const uint64_t output_mod_factor = 1;
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseReduceModNative(output.data(), input1.data(), input_size, modulus,
+                           input_mod_factor, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_EltwiseReduceModU32Native)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+static void BM_EltwiseReduceModU32AVX512(benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  const uint64_t input_mod_factor = 0;
+  const uint64_t output_mod_factor = 1;
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseReduceModAVX512(output.data(), input1.data(), input_size, modulus,
+                           input_mod_factor, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_EltwiseReduceModU32AVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
 }  // namespace hexl
 }  // namespace intel
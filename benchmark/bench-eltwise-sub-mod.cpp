@@ -112,5 +112,55 @@ BENCHMARK(BM_EltwiseVectorScalarSubModAVX512)
     ->Args({16384});
 #endif
 
+//=================================================================
+
+// state[0] is the degree
+static void BM_EltwiseVectorVectorSubModU32Native(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseSubModNative(output.data(), input1.data(), input2.data(), input_size,
+                        modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseVectorVectorSubModU32Native)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+static void BM_EltwiseVectorVectorSubModU32AVX512(
+    benchmark::State& state) {  //  NOLINT
+  size_t input_size = state.range(0);
+  uint64_t modulus = 1073741789;
+
+  AlignedVector64<uint32_t> input1(input_size, 1);
+  AlignedVector64<uint32_t> input2(input_size, 2);
+  AlignedVector64<uint32_t> output(input_size, 0);
+
+  for (auto _ : state) {
+    EltwiseSubModAVX512(output.data(), input1.data(), input2.data(), input_size,
+                        modulus);
+  }
+}
+
+BENCHMARK(BM_EltwiseVectorVectorSubModU32AVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+#endif
+
 }  // namespace hexl
 }  // namespace intel
@@ -5,13 +5,23 @@
 
 #include <vector>
 
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
 #include "hexl/logging/logging.hpp"
+#include "hexl/ntt/double-word-ntt.hpp"
+#include "hexl/ntt/goldilocks-ntt.hpp"
 #include "hexl/ntt/ntt.hpp"
+#include "hexl/ntt/rns-ntt.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "hexl/util/aligned-allocator.hpp"
+#include "ntt/bit-reverse-avx512.hpp"
+#include "ntt/bit-reverse-internal.hpp"
+#include "ntt/double-word-ntt-internal.hpp"
+#include "ntt/fwd-ntt-avx2.hpp"
 #include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx2.hpp"
 #include "ntt/inv-ntt-avx512.hpp"
 #include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-radix.hpp"
 
 namespace intel {
 namespace hexl {
@@ -30,7 +40,8 @@ static void BM_FwdNTTNative(benchmark::State& state) {  //  NOLINT
 
   for (auto _ : state) {
     ForwardTransformToBitReverse64(
-        input.data(), ntt_size, modulus, ntt.GetRootOfUnityPowers().data(),
+        input.data(), input.data(), ntt_size, modulus,
+        ntt.GetRootOfUnityPowers().data(),
         ntt.GetPrecon64RootOfUnityPowers().data(), 2, 1);
   }
 }
@@ -42,6 +53,36 @@ BENCHMARK(BM_FwdNTTNative)
     ->Args({16384});
 //=================================================================
 
+// state[0] is the degree
+// state[1] is the radix
+static void BM_FwdNTTNativeRadix(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t radix = state.range(1);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    if (radix == 4) {
+      ForwardTransformToBitReverseRadix<2>(
+          input.data(), input.data(), ntt_size, modulus,
+          ntt.GetRootOfUnityPowers().data(),
+          ntt.GetPrecon64RootOfUnityPowers().data(), 2, 1);
+    } else {
+      ForwardTransformToBitReverseRadix<3>(
+          input.data(), input.data(), ntt_size, modulus,
+          ntt.GetRootOfUnityPowers().data(),
+          ntt.GetPrecon64RootOfUnityPowers().data(), 2, 1);
+    }
+  }
+}
+
+BENCHMARK(BM_FwdNTTNativeRadix)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 4096, 16384}, {4, 8}});
+//=================================================================
+
 #ifdef HEXL_HAS_AVX512IFMA
 // state[0] is the degree
 static void BM_FwdNTT_AVX512IFMA(benchmark::State& state) {  //  NOLINT
@@ -59,7 +100,7 @@ static void BM_FwdNTT_AVX512IFMA(benchmark::State& state) {  //  NOLINT
 
   for (auto _ : state) {
     ForwardTransformToBitReverseAVX512<NTT::s_ifma_shift_bits>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 2, 1);
   }
 }
@@ -88,7 +129,7 @@ static void BM_FwdNTT_AVX512IFMALazy(benchmark::State& state) {  //  NOLINT
 
   for (auto _ : state) {
     ForwardTransformToBitReverseAVX512<NTT::s_ifma_shift_bits>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 4, 4);
   }
 }
@@ -123,7 +164,7 @@ static void BM_FwdNTT_AVX512DQ_32(benchmark::State& state) {  //  NOLINT
       ntt.GetAVX512Precon32RootOfUnityPowers();
   for (auto _ : state) {
     ForwardTransformToBitReverseAVX512<32>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 4, output_mod_factor);
   }
 }
@@ -154,7 +195,7 @@ static void BM_FwdNTT_AVX512DQ_64(benchmark::State& state) {  //  NOLINT
       ntt.GetAVX512Precon64RootOfUnityPowers();
   for (auto _ : state) {
     ForwardTransformToBitReverseAVX512<64>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 4, output_mod_factor);
   }
 }
@@ -168,6 +209,97 @@ BENCHMARK(BM_FwdNTT_AVX512DQ_64)
     ->Args({16384, 1})
     ->Args({16384, 4});
 
+// state[0] is the degree
+// state[1] is the base NTT size
+static void BM_FwdNTT_AVX512DQ_64BaseSize(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t base_ntt_size = state.range(1);
+  size_t modulus_bits = 55;
+  size_t modulus = GeneratePrimes(1, modulus_bits, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity =
+      ntt.GetAVX512RootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetAVX512Precon64RootOfUnityPowers();
+  for (auto _ : state) {
+    ForwardTransformToBitReverseAVX512<64>(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), 4, 1, 0, 0, base_ntt_size);
+  }
+}
+
+BENCHMARK(BM_FwdNTT_AVX512DQ_64BaseSize)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{16384, 1 << 17}, {256, 1024, 4096, 16384}});
+
+#endif
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX256
+// state[0] is the degree
+// state[1] is the output modulus factor
+static void BM_FwdNTT_AVX2_32(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  uint64_t output_mod_factor = state.range(1);
+  size_t modulus_bits = 29;
+  size_t modulus = GeneratePrimes(1, modulus_bits, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity = ntt.GetRootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetPrecon32RootOfUnityPowers();
+  for (auto _ : state) {
+    ForwardTransformToBitReverseAVX2<32>(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), 4, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_FwdNTT_AVX2_32)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 4})
+    ->Args({4096, 1})
+    ->Args({4096, 4})
+    ->Args({16384, 1})
+    ->Args({16384, 4});
+
+// state[0] is the degree
+// state[1] is the output modulus factor
+static void BM_FwdNTT_AVX2_64(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  uint64_t output_mod_factor = state.range(1);
+  size_t modulus_bits = 55;
+  size_t modulus = GeneratePrimes(1, modulus_bits, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity = ntt.GetRootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetPrecon64RootOfUnityPowers();
+  for (auto _ : state) {
+    ForwardTransformToBitReverseAVX2<NTT::s_default_shift_bits>(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), 4, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_FwdNTT_AVX2_64)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 4})
+    ->Args({4096, 1})
+    ->Args({4096, 4})
+    ->Args({16384, 1})
+    ->Args({16384, 4});
+
 #endif
 
 //=================================================================
@@ -215,6 +347,116 @@ BENCHMARK(BM_FwdNTTCopy)
 
 //=================================================================
 
+// state[0] is the degree
+// state[1] is the number of polynomials, stored column-wise
+static void BM_FwdNTTStrided(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t batch_size = state.range(1);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size * batch_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForwardStrided(input.data(), input.data(), batch_size,
+                              batch_size, 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTStrided)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 8})
+    ->Args({1024, 64})
+    ->Args({4096, 8})
+    ->Args({4096, 64});
+
+//=================================================================
+
+// Same as BM_FwdNTTStrided, but transposes each column into a contiguous
+// polynomial and back around ComputeForward
+// state[0] is the degree
+// state[1] is the number of polynomials, stored column-wise
+static void BM_FwdNTTTransposed(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t batch_size = state.range(1);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size * batch_size, 1);
+  AlignedVector64<uint64_t> column(ntt_size, 0);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    for (size_t j = 0; j < batch_size; ++j) {
+      for (size_t i = 0; i < ntt_size; ++i) {
+        column[i] = input[i * batch_size + j];
+      }
+      ntt.ComputeForward(column.data(), column.data(), 1, 1);
+      for (size_t i = 0; i < ntt_size; ++i) {
+        input[i * batch_size + j] = column[i];
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_FwdNTTTransposed)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 8})
+    ->Args({1024, 64})
+    ->Args({4096, 8})
+    ->Args({4096, 64});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of polynomials, stored contiguously
+static void BM_FwdNTTBatch(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t batch_size = state.range(1);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size * batch_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForwardBatch(input.data(), input.data(), batch_size, 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTBatch)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4, 1024})
+    ->Args({8, 1024})
+    ->Args({16, 1024});
+
+//=================================================================
+
+// Same as BM_FwdNTTBatch, but calls ComputeForward on each polynomial
+// state[0] is the degree
+// state[1] is the number of polynomials, stored contiguously
+static void BM_FwdNTTBatchLoop(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t batch_size = state.range(1);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size * batch_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    for (size_t b = 0; b < batch_size; ++b) {
+      uint64_t* poly = input.data() + b * ntt_size;
+      ntt.ComputeForward(poly, poly, 1, 1);
+    }
+  }
+}
+
+BENCHMARK(BM_FwdNTTBatchLoop)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4, 1024})
+    ->Args({8, 1024})
+    ->Args({16, 1024});
+
+//=================================================================
+
 // Inverse transforms
 
 // state[0] is the degree
@@ -229,9 +471,9 @@ static void BM_InvNTTNative(benchmark::State& state) {  //  NOLINT
   const AlignedVector64<uint64_t> precon_root_of_unity =
       ntt.GetPrecon64InvRootOfUnityPowers();
   for (auto _ : state) {
-    InverseTransformFromBitReverse64(input.data(), ntt_size, modulus,
-                                     root_of_unity.data(),
-                                     precon_root_of_unity.data(), 1, 1);
+    InverseTransformFromBitReverse64(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), 1, 1);
   }
 }
 
@@ -243,6 +485,38 @@ BENCHMARK(BM_InvNTTNative)
 
 //=================================================================
 
+// state[0] is the degree
+// state[1] is the radix
+static void BM_InvNTTNativeRadix(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t radix = state.range(1);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity = ntt.GetInvRootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetPrecon64InvRootOfUnityPowers();
+  for (auto _ : state) {
+    if (radix == 4) {
+      InverseTransformFromBitReverseRadix<2>(
+          input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+          precon_root_of_unity.data(), 1, 1);
+    } else {
+      InverseTransformFromBitReverseRadix<3>(
+          input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+          precon_root_of_unity.data(), 1, 1);
+    }
+  }
+}
+
+BENCHMARK(BM_InvNTTNativeRadix)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({{1024, 4096, 16384}, {4, 8}});
+
+//=================================================================
+
 #ifdef HEXL_HAS_AVX512IFMA
 // state[0] is the degree
 static void BM_InvNTT_AVX512IFMA(benchmark::State& state) {  //  NOLINT
@@ -257,7 +531,7 @@ static void BM_InvNTT_AVX512IFMA(benchmark::State& state) {  //  NOLINT
       ntt.GetPrecon52InvRootOfUnityPowers();
   for (auto _ : state) {
     InverseTransformFromBitReverseAVX512<NTT::s_ifma_shift_bits>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 1, 1);
   }
 }
@@ -283,7 +557,7 @@ static void BM_InvNTT_AVX512IFMALazy(benchmark::State& state) {  //  NOLINT
       ntt.GetPrecon52InvRootOfUnityPowers();
   for (auto _ : state) {
     InverseTransformFromBitReverseAVX512<NTT::s_ifma_shift_bits>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), 2, 2);
   }
 }
@@ -314,7 +588,7 @@ static void BM_InvNTT_AVX512DQ_32(benchmark::State& state) {  //  NOLINT
 
   for (auto _ : state) {
     InverseTransformFromBitReverseAVX512<32>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), output_mod_factor, output_mod_factor);
   }
 }
@@ -342,7 +616,7 @@ static void BM_InvNTT_AVX512DQ_64(benchmark::State& state) {  //  NOLINT
 
   for (auto _ : state) {
     InverseTransformFromBitReverseAVX512<NTT::s_default_shift_bits>(
-        input.data(), ntt_size, modulus, root_of_unity.data(),
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
         precon_root_of_unity.data(), output_mod_factor, output_mod_factor);
   }
 }
@@ -359,5 +633,794 @@ BENCHMARK(BM_InvNTT_AVX512DQ_64)
 
 //=================================================================
 
+#ifdef HEXL_HAS_AVX256
+// state[0] is the degree
+// state[1] is the output modulus factor
+static void BM_InvNTT_AVX2_32(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  uint64_t output_mod_factor = state.range(1);
+  size_t modulus = GeneratePrimes(1, 29, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity = ntt.GetInvRootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetPrecon32InvRootOfUnityPowers();
+
+  for (auto _ : state) {
+    InverseTransformFromBitReverseAVX2<32>(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), output_mod_factor, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_InvNTT_AVX2_32)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 2})
+    ->Args({4096, 1})
+    ->Args({4096, 2})
+    ->Args({16384, 1})
+    ->Args({16384, 2});
+
+static void BM_InvNTT_AVX2_64(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  uint64_t output_mod_factor = state.range(1);
+  size_t modulus = GeneratePrimes(1, 55, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  const AlignedVector64<uint64_t> root_of_unity = ntt.GetInvRootOfUnityPowers();
+  const AlignedVector64<uint64_t> precon_root_of_unity =
+      ntt.GetPrecon64InvRootOfUnityPowers();
+
+  for (auto _ : state) {
+    InverseTransformFromBitReverseAVX2<NTT::s_default_shift_bits>(
+        input.data(), input.data(), ntt_size, modulus, root_of_unity.data(),
+        precon_root_of_unity.data(), output_mod_factor, output_mod_factor);
+  }
+}
+
+BENCHMARK(BM_InvNTT_AVX2_64)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 1})
+    ->Args({1024, 2})
+    ->Args({4096, 1})
+    ->Args({4096, 2})
+    ->Args({16384, 1})
+    ->Args({16384, 2});
+#endif
+
+//=================================================================
+
+// RNS transforms
+
+// state[0] is the degree
+// state[1] is the number of moduli
+// state[2] is the number of interleaved rows; 1 transforms each row on its own
+static void BM_FwdRNSNTT(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_moduli = state.range(1);
+  std::vector<uint64_t> moduli = GeneratePrimes(num_moduli, 49, ntt_size);
+
+  AlignedVector64<uint64_t> input(ntt_size * num_moduli, 1);
+  AlignedVector64<uint64_t> output(ntt_size * num_moduli, 1);
+  RNSNTT rns_ntt(ntt_size, moduli);
+  rns_ntt.SetNumInterleavedRows(state.range(2));
+
+  for (auto _ : state) {
+    rns_ntt.ComputeForward(output.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdRNSNTT)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4096, 10, 1})
+    ->Args({4096, 10, 2})
+    ->Args({4096, 10, 4})
+    ->Args({4096, 40, 1})
+    ->Args({4096, 40, 2})
+    ->Args({4096, 40, 4})
+    ->Args({16384, 10, 1})
+    ->Args({16384, 10, 2})
+    ->Args({16384, 10, 4})
+    ->Args({16384, 40, 1})
+    ->Args({16384, 40, 2})
+    ->Args({16384, 40, 4});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of moduli
+// state[2] is the number of interleaved rows; 1 transforms each row on its own
+static void BM_InvRNSNTT(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_moduli = state.range(1);
+  std::vector<uint64_t> moduli = GeneratePrimes(num_moduli, 49, ntt_size);
+
+  AlignedVector64<uint64_t> input(ntt_size * num_moduli, 1);
+  AlignedVector64<uint64_t> output(ntt_size * num_moduli, 1);
+  RNSNTT rns_ntt(ntt_size, moduli);
+  rns_ntt.SetNumInterleavedRows(state.range(2));
+
+  for (auto _ : state) {
+    rns_ntt.ComputeInverse(output.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvRNSNTT)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4096, 10, 1})
+    ->Args({4096, 10, 2})
+    ->Args({4096, 10, 4})
+    ->Args({4096, 40, 1})
+    ->Args({4096, 40, 2})
+    ->Args({4096, 40, 4})
+    ->Args({16384, 10, 1})
+    ->Args({16384, 10, 2})
+    ->Args({16384, 10, 4})
+    ->Args({16384, 40, 1})
+    ->Args({16384, 40, 2})
+    ->Args({16384, 40, 4});
+
+// Cyclic and twisted transforms
+
+// state[0] is the degree
+static void BM_FwdNTTCyclic(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt = NTT::CreateCyclic(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTCyclic)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_InvNTTCyclic(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt = NTT::CreateCyclic(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvNTTCyclic)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_FwdNTTTwisted(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt = NTT::CreateTwisted(ntt_size, modulus, 3);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTTwisted)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// 32-bit coefficients
+
+// state[0] is the degree
+static void BM_FwdNTT32(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 29, ntt_size)[0];
+
+  AlignedVector64<uint32_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTT32)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_InvNTT32(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 29, ntt_size)[0];
+
+  AlignedVector64<uint32_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvNTT32)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// Goldilocks field, compared against the generic transform with a 62-bit
+// modulus, the widest it supports
+
+// state[0] is the degree
+static void BM_FwdNTTGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  GoldilocksNTT ntt(ntt_size);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data());
+  }
+}
+
+BENCHMARK(BM_FwdNTTGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 20});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_InvNTTGoldilocks(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  GoldilocksNTT ntt(ntt_size);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data());
+  }
+}
+
+BENCHMARK(BM_InvNTTGoldilocks)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 20});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_FwdNTTGeneric62(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTGeneric62)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 20});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_InvNTTGeneric62(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 61, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvNTTGeneric62)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 20});
+
+//=================================================================
+
+// Double-word moduli above 62 bits. One 125-bit transform replaces two 62-bit
+// transforms of the same degree.
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_FwdNTTDoubleWord(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWord modulus = GeneratePrimesDoubleWord(1, bit_size - 1, ntt_size)[0];
+
+  AlignedVector64<DoubleWord> input(ntt_size, DoubleWord{1, 0});
+  DoubleWordNTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data());
+  }
+}
+
+BENCHMARK(BM_FwdNTTDoubleWord)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100})
+    ->Args({16384, 125});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_FwdNTTDoubleWordNative(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWord q = GeneratePrimesDoubleWord(1, bit_size - 1, ntt_size)[0];
+  DoubleWordModulus modulus(q);
+
+  AlignedVector64<DoubleWord> input(ntt_size, DoubleWord{1, 0});
+  DoubleWordNTT ntt(ntt_size, q);
+
+  for (auto _ : state) {
+    ForwardTransformToBitReverseDoubleWord(
+        input.data(), ntt_size, ntt.GetRootOfUnityPowers().data(), modulus);
+  }
+}
+
+BENCHMARK(BM_FwdNTTDoubleWordNative)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100})
+    ->Args({16384, 125});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of bits in the modulus
+static void BM_InvNTTDoubleWord(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t bit_size = state.range(1);
+  DoubleWord modulus = GeneratePrimesDoubleWord(1, bit_size - 1, ntt_size)[0];
+
+  AlignedVector64<DoubleWord> input(ntt_size, DoubleWord{1, 0});
+  DoubleWordNTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data());
+  }
+}
+
+BENCHMARK(BM_InvNTTDoubleWord)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024, 100})
+    ->Args({4096, 100})
+    ->Args({16384, 100})
+    ->Args({16384, 125});
+
+//=================================================================
+
+// Bit-reversal permutation
+
+// state[0] is the degree
+static void BM_BitReversePermuteReference(benchmark::State& state) {  //  NOLINT
+  size_t n = state.range(0);
+  uint64_t log_n = Log2(n);
+  AlignedVector64<uint64_t> input(n, 1);
+  AlignedVector64<uint64_t> output(n);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) {
+      output[ReverseBits(i, log_n)] = input[i];
+    }
+    benchmark::DoNotOptimize(output.data());
+  }
+}
+
+BENCHMARK(BM_BitReversePermuteReference)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 17});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_BitReversePermuteNative(benchmark::State& state) {  //  NOLINT
+  size_t n = state.range(0);
+  AlignedVector64<uint64_t> input(n, 1);
+  AlignedVector64<uint64_t> output(n);
+
+  for (auto _ : state) {
+    BitReversePermuteNative(output.data(), input.data(), n);
+  }
+}
+
+BENCHMARK(BM_BitReversePermuteNative)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 17});
+
+//=================================================================
+
+#ifdef HEXL_HAS_AVX512DQ
+// state[0] is the degree
+static void BM_BitReversePermuteAVX512(benchmark::State& state) {  //  NOLINT
+  size_t n = state.range(0);
+  AlignedVector64<uint64_t> input(n, 1);
+  AlignedVector64<uint64_t> output(n);
+
+  for (auto _ : state) {
+    BitReversePermuteAVX512(output.data(), input.data(), n);
+  }
+}
+
+BENCHMARK(BM_BitReversePermuteAVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 17});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_BitReversePermuteInPlaceAVX512(  //  NOLINT
+    benchmark::State& state) {
+  size_t n = state.range(0);
+  AlignedVector64<uint64_t> input(n, 1);
+
+  for (auto _ : state) {
+    BitReversePermuteInPlaceAVX512(input.data(), n);
+  }
+}
+
+BENCHMARK(BM_BitReversePermuteInPlaceAVX512)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({1 << 17});
+#endif
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_FwdNTTNaturalOrder(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1,
+                       NTT::Ordering::kNatural);
+  }
+}
+
+BENCHMARK(BM_FwdNTTNaturalOrder)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384});
+
+//=================================================================
+
+// Construction
+
+// state[0] is the degree
+static void BM_NTTConstructor(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 50, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+
+  // Includes the first forward and inverse transforms, which compute the
+  // tables used by the selected implementation
+  for (auto _ : state) {
+    NTT ntt(ntt_size, modulus);
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_NTTConstructor)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4096})
+    ->Args({8192})
+    ->Args({16384})
+    ->Args({32768})
+    ->Args({65536})
+    ->Args({131072});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_NTTConstructorAllTables(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 50, ntt_size)[0];
+
+  for (auto _ : state) {
+    NTT ntt(ntt_size, modulus);
+    benchmark::DoNotOptimize(ntt.GetPrecon32RootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetPrecon64RootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetAVX512Precon32RootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetAVX512Precon52RootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetAVX512Precon64RootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetPrecon32InvRootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetPrecon52InvRootOfUnityPowers().data());
+    benchmark::DoNotOptimize(ntt.GetPrecon64InvRootOfUnityPowers().data());
+  }
+}
+
+BENCHMARK(BM_NTTConstructorAllTables)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({4096})
+    ->Args({8192})
+    ->Args({16384})
+    ->Args({32768})
+    ->Args({65536})
+    ->Args({131072});
+
+//=================================================================
+
+// Multi-threaded transforms
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of threads
+static void BM_FwdNTTThreads(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_threads = state.range(1);
+  size_t modulus = GeneratePrimes(1, 49, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+  ntt.SetNumThreads(num_threads);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTThreads)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime()
+    ->Args({32768, 1})
+    ->Args({32768, 2})
+    ->Args({32768, 4})
+    ->Args({32768, 8})
+    ->Args({32768, 16})
+    ->Args({32768, 32})
+    ->Args({65536, 1})
+    ->Args({65536, 2})
+    ->Args({65536, 4})
+    ->Args({65536, 8})
+    ->Args({65536, 16})
+    ->Args({65536, 32})
+    ->Args({131072, 1})
+    ->Args({131072, 2})
+    ->Args({131072, 4})
+    ->Args({131072, 8})
+    ->Args({131072, 16})
+    ->Args({131072, 32});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of threads
+static void BM_InvNTTThreads(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_threads = state.range(1);
+  size_t modulus = GeneratePrimes(1, 49, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+  ntt.SetNumThreads(num_threads);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvNTTThreads)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime()
+    ->Args({32768, 1})
+    ->Args({32768, 2})
+    ->Args({32768, 4})
+    ->Args({32768, 8})
+    ->Args({32768, 16})
+    ->Args({32768, 32})
+    ->Args({65536, 1})
+    ->Args({65536, 2})
+    ->Args({65536, 4})
+    ->Args({65536, 8})
+    ->Args({65536, 16})
+    ->Args({65536, 32})
+    ->Args({131072, 1})
+    ->Args({131072, 2})
+    ->Args({131072, 4})
+    ->Args({131072, 8})
+    ->Args({131072, 16})
+    ->Args({131072, 32});
+
+//=================================================================
+
+// Large transforms, computed with the four-step decomposition
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of threads
+static void BM_FwdNTTLarge(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_threads = state.range(1);
+  size_t modulus = GeneratePrimes(1, 55, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+  ntt.SetNumThreads(num_threads);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_FwdNTTLarge)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgsProduct({{1 << 20, 1 << 22, 1 << 24, 1 << 26}, {1, 8}});
+
+//=================================================================
+
+// state[0] is the degree
+// state[1] is the number of threads
+static void BM_InvNTTLarge(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t num_threads = state.range(1);
+  size_t modulus = GeneratePrimes(1, 55, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input(ntt_size, 1);
+  NTT ntt(ntt_size, modulus);
+  ntt.SetNumThreads(num_threads);
+
+  for (auto _ : state) {
+    ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_InvNTTLarge)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgsProduct({{1 << 20, 1 << 22, 1 << 24, 1 << 26}, {1, 8}});
+
+//=================================================================
+
+// Polynomial multiplication
+
+// state[0] is the degree
+static void BM_PolyMulMod(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input1(ntt_size, 1);
+  AlignedVector64<uint64_t> input2(ntt_size, 2);
+  AlignedVector64<uint64_t> output(ntt_size, 0);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.PolyMulMod(output.data(), input1.data(), input2.data());
+  }
+}
+
+BENCHMARK(BM_PolyMulMod)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({65536});
+
+//=================================================================
+
+// Unfused reference for BM_PolyMulMod
+// state[0] is the degree
+static void BM_PolyMulModUnfused(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input1(ntt_size, 1);
+  AlignedVector64<uint64_t> input2(ntt_size, 2);
+  AlignedVector64<uint64_t> scratch(ntt_size, 0);
+  AlignedVector64<uint64_t> output(ntt_size, 0);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.ComputeForward(output.data(), input1.data(), 1, 4);
+    ntt.ComputeForward(scratch.data(), input2.data(), 1, 4);
+    EltwiseMultMod(output.data(), output.data(), scratch.data(), ntt_size,
+                   modulus, 4);
+    ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+  }
+}
+
+BENCHMARK(BM_PolyMulModUnfused)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({65536});
+
+//=================================================================
+
+// state[0] is the degree
+static void BM_PolyMulModNTT(benchmark::State& state) {  //  NOLINT
+  size_t ntt_size = state.range(0);
+  size_t modulus = GeneratePrimes(1, 45, ntt_size)[0];
+
+  AlignedVector64<uint64_t> input1(ntt_size, 1);
+  AlignedVector64<uint64_t> input2_ntt(ntt_size, 2);
+  AlignedVector64<uint64_t> output(ntt_size, 0);
+  NTT ntt(ntt_size, modulus);
+
+  for (auto _ : state) {
+    ntt.PolyMulModNTT(output.data(), input1.data(), input2_ntt.data());
+  }
+}
+
+BENCHMARK(BM_PolyMulModNTT)
+    ->Unit(benchmark::kMicrosecond)
+    ->Args({1024})
+    ->Args({4096})
+    ->Args({16384})
+    ->Args({65536});
+
+//=================================================================
+
 }  // namespace hexl
 }  // namespace intel
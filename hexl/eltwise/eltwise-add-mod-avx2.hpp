@@ -0,0 +1,18 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+void EltwiseAddModAVX2(uint64_t* result, const uint64_t* operand1,
+                       const uint64_t* operand2, uint64_t n, uint64_t modulus);
+
+void EltwiseAddModAVX2(uint64_t* result, const uint64_t* operand1,
+                       uint64_t operand2, uint64_t n, uint64_t modulus);
+
+}  // namespace hexl
+}  // namespace intel
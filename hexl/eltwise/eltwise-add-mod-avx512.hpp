@@ -15,5 +15,12 @@ void EltwiseAddModAVX512(uint64_t* result, const uint64_t* operand1,
 void EltwiseAddModAVX512(uint64_t* result, const uint64_t* operand1,
                          const uint64_t operand2, uint64_t n, uint64_t modulus);
 
+void EltwiseAddModAVX512(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus);
+
+void EltwiseAddModAVX512(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
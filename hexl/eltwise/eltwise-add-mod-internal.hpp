@@ -29,5 +29,26 @@ void EltwiseAddModNative(uint64_t* result, const uint64_t* operand1,
 void EltwiseAddModNative(uint64_t* result, const uint64_t* operand1,
                          uint64_t operand2, uint64_t n, uint64_t modulus);
 
+/// @brief Adds two vectors of 32-bit elements elementwise with modular
+/// reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to add
+/// @param[in] operand2 Vector of elements to add
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction
+void EltwiseAddModNative(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus);
+
+/// @brief Adds a vector of 32-bit elements and scalar elementwise with
+/// modular reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to add
+/// @param[in] operand2 Scalar add
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction
+void EltwiseAddModNative(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
@@ -3,6 +3,7 @@
 
 #include "hexl/eltwise/eltwise-add-mod.hpp"
 
+#include "eltwise/eltwise-add-mod-avx2.hpp"
 #include "eltwise/eltwise-add-mod-avx512.hpp"
 #include "eltwise/eltwise-add-mod-internal.hpp"
 #include "hexl/logging/logging.hpp"
@@ -87,6 +88,13 @@ void EltwiseAddMod(uint64_t* result, const uint64_t* operand1,
   }
 #endif
 
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseAddModAVX2(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
   HEXL_VLOG(3, "Calling EltwiseAddModNative");
   EltwiseAddModNative(result, operand1, operand2, n, modulus);
 }
@@ -101,6 +109,112 @@ void EltwiseAddMod(uint64_t* result, const uint64_t* operand1,
                     "pre-add value in operand1 exceeds bound " << modulus);
   HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
 
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    EltwiseAddModAVX512(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseAddModAVX2(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseAddModNative");
+  EltwiseAddModNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseAddModNative(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-add value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "pre-add value in operand2 exceeds bound " << modulus);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    uint32_t sum = *operand1 + *operand2;
+    if (sum >= modulus) {
+      *result = static_cast<uint32_t>(sum - modulus);
+    } else {
+      *result = sum;
+    }
+
+    ++operand1;
+    ++operand2;
+    ++result;
+  }
+}
+
+void EltwiseAddModNative(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-add value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
+
+  uint32_t diff = static_cast<uint32_t>(modulus - operand2);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    if (*operand1 >= diff) {
+      *result = *operand1 - diff;
+    } else {
+      *result = *operand1 + operand2;
+    }
+
+    ++operand1;
+    ++result;
+  }
+}
+
+void EltwiseAddMod(uint32_t* result, const uint32_t* operand1,
+                   const uint32_t* operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-add value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "pre-add value in operand2 exceeds bound " << modulus);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    EltwiseAddModAVX512(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseAddModNative");
+  EltwiseAddModNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseAddMod(uint32_t* result, const uint32_t* operand1,
+                   uint32_t operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-add value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
+
 #ifdef HEXL_HAS_AVX512DQ
   if (has_avx512dq) {
     EltwiseAddModAVX512(result, operand1, operand2, n, modulus);
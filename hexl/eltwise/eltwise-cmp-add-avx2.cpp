@@ -0,0 +1,49 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "eltwise/eltwise-cmp-add-avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "eltwise/eltwise-cmp-add-internal.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/util.hpp"
+#include "util/avx2-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+void EltwiseCmpAddAVX2(uint64_t* result, const uint64_t* operand1, uint64_t n,
+                       CMPINT cmp, uint64_t bound, uint64_t diff) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(diff != 0, "Require diff != 0");
+
+  uint64_t n_mod_4 = n % 4;
+  if (n_mod_4 != 0) {
+    EltwiseCmpAddNative(result, operand1, n_mod_4, cmp, bound, diff);
+    operand1 += n_mod_4;
+    result += n_mod_4;
+    n -= n_mod_4;
+  }
+
+  __m256i v_bound = _mm256_set1_epi64x(static_cast<int64_t>(bound));
+  const __m256i* v_op_ptr = reinterpret_cast<const __m256i*>(operand1);
+  __m256i* v_result_ptr = reinterpret_cast<__m256i*>(result);
+  for (size_t i = n / 4; i > 0; --i) {
+    __m256i v_op = _mm256_loadu_si256(v_op_ptr);
+    __m256i v_add_diff = _mm256_hexl_cmp_epi64(v_op, v_bound, cmp, diff);
+    v_op = _mm256_add_epi64(v_op, v_add_diff);
+    _mm256_storeu_si256(v_result_ptr, v_op);
+
+    ++v_result_ptr;
+    ++v_op_ptr;
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
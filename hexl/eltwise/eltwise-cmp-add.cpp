@@ -3,6 +3,7 @@
 
 #include "hexl/eltwise/eltwise-cmp-add.hpp"
 
+#include "eltwise/eltwise-cmp-add-avx2.hpp"
 #include "eltwise/eltwise-cmp-add-avx512.hpp"
 #include "eltwise/eltwise-cmp-add-internal.hpp"
 #include "hexl/logging/logging.hpp"
@@ -26,6 +27,13 @@ void EltwiseCmpAdd(uint64_t* result, const uint64_t* operand1, uint64_t n,
     return;
   }
 #endif
+
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseCmpAddAVX2(result, operand1, n, cmp, bound, diff);
+    return;
+  }
+#endif
   EltwiseCmpAddNative(result, operand1, n, cmp, bound, diff);
 }
 
@@ -0,0 +1,18 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/util/util.hpp"
+
+namespace intel {
+namespace hexl {
+
+void EltwiseCmpSubModAVX2(uint64_t* result, const uint64_t* operand1,
+                          uint64_t n, uint64_t modulus, CMPINT cmp,
+                          uint64_t bound, uint64_t diff);
+
+}  // namespace hexl
+}  // namespace intel
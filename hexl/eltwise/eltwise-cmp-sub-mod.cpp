@@ -3,6 +3,7 @@
 
 #include "hexl/eltwise/eltwise-cmp-sub-mod.hpp"
 
+#include "eltwise/eltwise-cmp-sub-mod-avx2.hpp"
 #include "eltwise/eltwise-cmp-sub-mod-avx512.hpp"
 #include "eltwise/eltwise-cmp-sub-mod-internal.hpp"
 #include "hexl/logging/logging.hpp"
@@ -30,6 +31,13 @@ void EltwiseCmpSubMod(uint64_t* result, const uint64_t* operand1, uint64_t n,
     return;
   }
 #endif
+
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseCmpSubModAVX2(result, operand1, n, modulus, cmp, bound, diff);
+    return;
+  }
+#endif
   EltwiseCmpSubModNative(result, operand1, n, modulus, cmp, bound, diff);
 }
 
@@ -0,0 +1,80 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "eltwise/eltwise-double-word-avx512.hpp"
+
+#include <immintrin.h>
+
+#include "eltwise/eltwise-double-word-internal.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "util/avx512-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512IFMA
+
+void EltwiseMultModDoubleWordAVX512(DoubleWord* result,
+                                    const DoubleWord* operand1,
+                                    const DoubleWord* operand2, uint64_t n,
+                                    const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseMultModDoubleWordNative(result, operand1, operand2, n_mod_8,
+                                   modulus);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+  if (n == 0) {
+    return;
+  }
+
+  const uint64_t mask52 = (1ULL << 52) - 1;
+  const DoubleWord q = modulus.Modulus();
+  // The Montgomery product of x * y * 2^{-156} and 2^312 mod q is x * y mod q
+  const DoubleWord r2 = PowModDoubleWord(DoubleWord{2, 0}, DoubleWord{312, 0},
+                                         modulus);
+  __m512i v_q[3];
+  _mm512_hexl_dw_split_epu64(_mm512_set1_epi64(static_cast<int64_t>(q.lo)),
+                             _mm512_set1_epi64(static_cast<int64_t>(q.hi)),
+                             v_q);
+  __m512i v_r2[3];
+  _mm512_hexl_dw_split_epu64(_mm512_set1_epi64(static_cast<int64_t>(r2.lo)),
+                             _mm512_set1_epi64(static_cast<int64_t>(r2.hi)),
+                             v_r2);
+  __m512i v_q_inv =
+      _mm512_set1_epi64(static_cast<int64_t>(modulus.NegInverse().lo & mask52));
+
+  const uint64_t* op1 = reinterpret_cast<const uint64_t*>(operand1);
+  const uint64_t* op2 = reinterpret_cast<const uint64_t*>(operand2);
+  uint64_t* out = reinterpret_cast<uint64_t*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_x[3];
+    __m512i v_y[3];
+    __m512i v_z[3];
+    _mm512_hexl_dw_loadu_epu64(op1, v_x);
+    _mm512_hexl_dw_loadu_epu64(op2, v_y);
+    _mm512_hexl_dw_montmul_epu52(v_z, v_x, v_y, v_q, v_q_inv);
+    _mm512_hexl_dw_montmul_epu52(v_z, v_z, v_r2, v_q, v_q_inv);
+    _mm512_hexl_dw_storeu_epu64(out, v_z);
+    op1 += 16;
+    op2 += 16;
+    out += 16;
+  }
+}
+
+#endif  // HEXL_HAS_AVX512IFMA
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,23 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/double-word.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512IFMA
+
+void EltwiseMultModDoubleWordAVX512(DoubleWord* result,
+                                    const DoubleWord* operand1,
+                                    const DoubleWord* operand2, uint64_t n,
+                                    const DoubleWordModulus& modulus);
+
+#endif  // HEXL_HAS_AVX512IFMA
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,70 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Adds two vectors elementwise modulo a double-word modulus
+/// @details See EltwiseAddModDoubleWord
+inline void EltwiseAddModDoubleWordNative(DoubleWord* result,
+                                          const DoubleWord* operand1,
+                                          const DoubleWord* operand2,
+                                          uint64_t n,
+                                          const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = AddModDoubleWord(operand1[i], operand2[i], modulus);
+  }
+}
+
+/// @brief Subtracts two vectors elementwise modulo a double-word modulus
+/// @details See EltwiseSubModDoubleWord
+inline void EltwiseSubModDoubleWordNative(DoubleWord* result,
+                                          const DoubleWord* operand1,
+                                          const DoubleWord* operand2,
+                                          uint64_t n,
+                                          const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = SubModDoubleWord(operand1[i], operand2[i], modulus);
+  }
+}
+
+/// @brief Multiplies two vectors elementwise modulo a double-word modulus
+/// @details See EltwiseMultModDoubleWord
+inline void EltwiseMultModDoubleWordNative(DoubleWord* result,
+                                           const DoubleWord* operand1,
+                                           const DoubleWord* operand2,
+                                           uint64_t n,
+                                           const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = MultiplyModDoubleWord(operand1[i], operand2[i], modulus);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,61 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/eltwise/eltwise-double-word.hpp"
+
+#include "eltwise/eltwise-double-word-avx512.hpp"
+#include "eltwise/eltwise-double-word-internal.hpp"
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/util/check.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+void EltwiseAddModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                             const DoubleWord* operand2, uint64_t n,
+                             const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_VLOG(3, "Calling EltwiseAddModDoubleWordNative");
+  EltwiseAddModDoubleWordNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseSubModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                             const DoubleWord* operand2, uint64_t n,
+                             const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_VLOG(3, "Calling EltwiseSubModDoubleWordNative");
+  EltwiseSubModDoubleWordNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseMultModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                              const DoubleWord* operand2, uint64_t n,
+                              const DoubleWordModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+#ifdef HEXL_HAS_AVX512IFMA
+  if (has_avx512ifma) {
+    HEXL_VLOG(3, "Calling EltwiseMultModDoubleWordAVX512");
+    EltwiseMultModDoubleWordAVX512(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseMultModDoubleWordNative");
+  EltwiseMultModDoubleWordNative(result, operand1, operand2, n, modulus);
+}
+
+}  // namespace hexl
+}  // namespace intel
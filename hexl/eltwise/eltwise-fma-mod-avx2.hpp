@@ -0,0 +1,23 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "eltwise/eltwise-fma-mod-internal.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Shoup multiplication with 32x32-bit products. Requires modulus < 2^32.
+template <int InputModFactor>
+void EltwiseFMAModAVX2(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
+                       const uint64_t* arg3, uint64_t n, uint64_t modulus);
+
+#endif
+
+}  // namespace hexl
+}  // namespace intel
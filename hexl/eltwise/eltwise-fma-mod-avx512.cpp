@@ -41,6 +41,22 @@ template void EltwiseFMAModAVX512<64, 4>(uint64_t* result, const uint64_t* arg1,
 template void EltwiseFMAModAVX512<64, 8>(uint64_t* result, const uint64_t* arg1,
                                          uint64_t arg2, const uint64_t* arg3,
                                          uint64_t n, uint64_t modulus);
+template void EltwiseFMAModAVX512U32<1>(uint32_t* result,
+                                            const uint32_t* arg1, uint32_t arg2,
+                                            const uint32_t* arg3, uint64_t n,
+                                            uint64_t modulus);
+template void EltwiseFMAModAVX512U32<2>(uint32_t* result,
+                                            const uint32_t* arg1, uint32_t arg2,
+                                            const uint32_t* arg3, uint64_t n,
+                                            uint64_t modulus);
+template void EltwiseFMAModAVX512U32<4>(uint32_t* result,
+                                            const uint32_t* arg1, uint32_t arg2,
+                                            const uint32_t* arg3, uint64_t n,
+                                            uint64_t modulus);
+template void EltwiseFMAModAVX512U32<8>(uint32_t* result,
+                                            const uint32_t* arg1, uint32_t arg2,
+                                            const uint32_t* arg3, uint64_t n,
+                                            uint64_t modulus);
 
 #endif
 
@@ -144,6 +160,88 @@ void EltwiseFMAModAVX512(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
   }
 }
 
+template <int InputModFactor>
+void EltwiseFMAModAVX512U32(uint32_t* result, const uint32_t* arg1,
+                            uint32_t arg2, const uint32_t* arg3, uint64_t n,
+                            uint64_t modulus) {
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+
+  HEXL_CHECK(arg1, "arg1 == nullptr");
+  HEXL_CHECK(result, "result == nullptr");
+
+  HEXL_CHECK_BOUNDS(arg1, n, InputModFactor * modulus,
+                    "arg1 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK_BOUNDS(&arg2, 1, InputModFactor * modulus,
+                    "arg2 exceeds bound " << (InputModFactor * modulus));
+
+  uint64_t n_mod_16 = n % 16;
+  if (n_mod_16 != 0) {
+    EltwiseFMAModNative<InputModFactor>(result, arg1, arg2, arg3, n_mod_16,
+                                        modulus);
+    arg1 += n_mod_16;
+    if (arg3 != nullptr) {
+      arg3 += n_mod_16;
+    }
+    result += n_mod_16;
+    n -= n_mod_16;
+  }
+
+  uint64_t twice_modulus = 2 * modulus;
+  uint64_t four_times_modulus = 4 * modulus;
+  uint64_t arg2_val = ReduceMod<InputModFactor>(arg2, modulus, &twice_modulus,
+                                                &four_times_modulus);
+  uint64_t arg2_precon = MultiplyFactor(arg2_val, 32, modulus).BarrettFactor();
+
+  __m512i varg2 = _mm512_set1_epi32(static_cast<int>(arg2_val));
+  __m512i varg2_precon = _mm512_set1_epi32(static_cast<int>(arg2_precon));
+  __m512i vmodulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i v2_modulus = _mm512_set1_epi32(static_cast<int>(twice_modulus));
+  __m512i v4_modulus = _mm512_set1_epi32(static_cast<int>(four_times_modulus));
+  const __m512i* vp_arg1 = reinterpret_cast<const __m512i*>(arg1);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  // The lazy Shoup multiplication accepts any 32-bit arg1, so arg1 needs no
+  // reduction
+  if (arg3) {
+    const __m512i* vp_arg3 = reinterpret_cast<const __m512i*>(arg3);
+    HEXL_LOOP_UNROLL_4
+    for (size_t i = n / 16; i > 0; --i) {
+      __m512i varg1 = _mm512_loadu_si512(vp_arg1);
+      __m512i varg3 = _mm512_loadu_si512(vp_arg3);
+      varg3 = _mm512_hexl_small_mod_epu32<InputModFactor>(
+          varg3, vmodulus, &v2_modulus, &v4_modulus);
+
+      __m512i vq =
+          _mm512_hexl_mulmod_lazy_epu32(varg1, varg2, varg2_precon, vmodulus);
+      vq = _mm512_hexl_small_mod_epu32(vq, vmodulus);
+
+      // vq + arg3 < 2q < 2^32
+      vq = _mm512_add_epi32(vq, varg3);
+      vq = _mm512_hexl_small_mod_epu32(vq, vmodulus);
+
+      _mm512_storeu_si512(vp_result, vq);
+
+      ++vp_arg1;
+      ++vp_result;
+      ++vp_arg3;
+    }
+  } else {  // arg3 == nullptr
+    HEXL_LOOP_UNROLL_4
+    for (size_t i = n / 16; i > 0; --i) {
+      __m512i varg1 = _mm512_loadu_si512(vp_arg1);
+
+      __m512i vq =
+          _mm512_hexl_mulmod_lazy_epu32(varg1, varg2, varg2_precon, vmodulus);
+      vq = _mm512_hexl_small_mod_epu32(vq, vmodulus);
+      _mm512_storeu_si512(vp_result, vq);
+
+      ++vp_arg1;
+      ++vp_result;
+    }
+  }
+}
+
 #endif
 
 }  // namespace hexl
@@ -16,6 +16,11 @@ template <int BitShift, int InputModFactor>
 void EltwiseFMAModAVX512(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
                          const uint64_t* arg3, uint64_t n, uint64_t modulus);
 
+template <int InputModFactor>
+void EltwiseFMAModAVX512U32(uint32_t* result, const uint32_t* arg1,
+                            uint32_t arg2, const uint32_t* arg3, uint64_t n,
+                            uint64_t modulus);
+
 #endif
 
 }  // namespace hexl
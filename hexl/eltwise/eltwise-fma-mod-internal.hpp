@@ -38,5 +38,28 @@ void EltwiseFMAModNative(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
   }
 }
 
+template <int InputModFactor>
+void EltwiseFMAModNative(uint32_t* result, const uint32_t* arg1, uint32_t arg2,
+                         const uint32_t* arg3, uint64_t n, uint64_t modulus) {
+  uint64_t twice_modulus = 2 * modulus;
+  uint64_t four_times_modulus = 4 * modulus;
+  uint64_t arg2_val = ReduceMod<InputModFactor>(arg2, modulus, &twice_modulus,
+                                                &four_times_modulus);
+
+  // The lazy Shoup multiplication accepts any 32-bit arg1, so arg1 needs no
+  // reduction
+  uint64_t arg2_precon = MultiplyFactor(arg2_val, 32, modulus).BarrettFactor();
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t result_val = ReduceMod<2>(
+        MultiplyModLazy<32>(*arg1++, arg2_val, arg2_precon, modulus), modulus);
+    if (arg3) {
+      uint64_t arg3_val = ReduceMod<InputModFactor>(
+          *arg3++, modulus, &twice_modulus, &four_times_modulus);
+      result_val = AddUIntMod(result_val, arg3_val, modulus);
+    }
+    *result++ = static_cast<uint32_t>(result_val);
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 
+#include "eltwise/eltwise-fma-mod-avx2.hpp"
 #include "eltwise/eltwise-fma-mod-avx512.hpp"
 #include "eltwise/eltwise-fma-mod-internal.hpp"
 #include "hexl/logging/logging.hpp"
@@ -83,6 +84,111 @@ void EltwiseFMAMod(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
   }
 #endif
 
+#ifdef HEXL_HAS_AVX256
+  // AVX2 lacks 64-bit multiplications, so only moduli below 2^32 use AVX2
+  if (has_avx2 && modulus < (1ULL << 32)) {
+    HEXL_VLOG(3, "Calling EltwiseFMAModAVX2");
+
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseFMAModAVX2<1>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 2:
+        EltwiseFMAModAVX2<2>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 4:
+        EltwiseFMAModAVX2<4>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 8:
+        EltwiseFMAModAVX2<8>(result, arg1, arg2, arg3, n, modulus);
+        break;
+    }
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseFMAModNative");
+  switch (input_mod_factor) {
+    case 1:
+      EltwiseFMAModNative<1>(result, arg1, arg2, arg3, n, modulus);
+      break;
+    case 2:
+      EltwiseFMAModNative<2>(result, arg1, arg2, arg3, n, modulus);
+      break;
+    case 4:
+      EltwiseFMAModNative<4>(result, arg1, arg2, arg3, n, modulus);
+      break;
+    case 8:
+      EltwiseFMAModNative<8>(result, arg1, arg2, arg3, n, modulus);
+      break;
+  }
+}
+
+void EltwiseFMAModMontgomery(uint64_t* result, const uint64_t* arg1,
+                             uint64_t arg2, const uint64_t* arg3, uint64_t n,
+                             uint64_t modulus) {
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(arg2 < modulus,
+             "arg2 " << arg2 << " exceeds bound " << modulus);
+
+  // arg1 * arg2 * 2^{-64} is the standard product of arg1 with the value
+  // whose Montgomery form is arg2, so the scalar is converted once and the
+  // Shoup multiplication of EltwiseFMAMod does the rest
+  uint64_t arg2_standard =
+      FromMontgomery(arg2, modulus, MontgomeryNegInverse(modulus));
+  EltwiseFMAMod(result, arg1, arg2_standard, arg3, n, modulus, 1);
+}
+
+void EltwiseFMAMod(uint32_t* result, const uint32_t* arg1, uint32_t arg2,
+                   const uint32_t* arg3, uint64_t n, uint64_t modulus,
+                   uint64_t input_mod_factor) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(arg1 != nullptr, "Require arg1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0")
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4 ||
+          input_mod_factor == 8,
+      "input_mod_factor must be 1, 2, 4, or 8. Got " << input_mod_factor);
+  HEXL_CHECK(input_mod_factor * modulus <= (1ULL << 32),
+             "Require input_mod_factor * modulus <= (1ULL << 32)");
+  HEXL_CHECK(
+      arg2 < input_mod_factor * modulus,
+      "arg2 " << arg2 << " exceeds bound " << (input_mod_factor * modulus));
+
+  HEXL_CHECK_BOUNDS(arg1, n, input_mod_factor * modulus,
+                    "arg1 value " << (*std::max_element(arg1, arg1 + n))
+                                  << " in EltwiseFMAMod exceeds bound "
+                                  << (input_mod_factor * modulus));
+  HEXL_CHECK(arg3 == nullptr || (*std::max_element(arg3, arg3 + n) <
+                                 (input_mod_factor * modulus)),
+             "arg3 value in EltwiseFMAMod exceeds bound "
+                 << (input_mod_factor * modulus));
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseFMAModAVX512U32");
+
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseFMAModAVX512U32<1>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 2:
+        EltwiseFMAModAVX512U32<2>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 4:
+        EltwiseFMAModAVX512U32<4>(result, arg1, arg2, arg3, n, modulus);
+        break;
+      case 8:
+        EltwiseFMAModAVX512U32<8>(result, arg1, arg2, arg3, n, modulus);
+        break;
+    }
+    return;
+  }
+#endif
+
   HEXL_VLOG(3, "Calling EltwiseFMAModNative");
   switch (input_mod_factor) {
     case 1:
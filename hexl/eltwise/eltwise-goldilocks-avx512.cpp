@@ -0,0 +1,201 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "eltwise/eltwise-goldilocks-avx512.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "eltwise/eltwise-goldilocks-internal.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "util/avx512-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+void EltwiseAddModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                   const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK_BOUNDS(operand1, n, kGoldilocksModulus,
+                    "pre-add value in operand1 exceeds bound "
+                        << kGoldilocksModulus);
+  HEXL_CHECK_BOUNDS(operand2, n, kGoldilocksModulus,
+                    "pre-add value in operand2 exceeds bound "
+                        << kGoldilocksModulus);
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseAddModGoldilocksNative(result, operand1, operand2, n_mod_8);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_operand2 = _mm512_loadu_si512(vp_operand2);
+
+    __m512i v_result = _mm512_hexl_goldilocks_add_epu64(v_operand1, v_operand2);
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_result;
+    ++vp_operand1;
+    ++vp_operand2;
+  }
+}
+
+void EltwiseSubModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                   const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK_BOUNDS(operand1, n, kGoldilocksModulus,
+                    "pre-sub value in operand1 exceeds bound "
+                        << kGoldilocksModulus);
+  HEXL_CHECK_BOUNDS(operand2, n, kGoldilocksModulus,
+                    "pre-sub value in operand2 exceeds bound "
+                        << kGoldilocksModulus);
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseSubModGoldilocksNative(result, operand1, operand2, n_mod_8);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_operand2 = _mm512_loadu_si512(vp_operand2);
+
+    __m512i v_result = _mm512_hexl_goldilocks_sub_epu64(v_operand1, v_operand2);
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_result;
+    ++vp_operand1;
+    ++vp_operand2;
+  }
+}
+
+void EltwiseMultModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                    const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseMultModGoldilocksNative(result, operand1, operand2, n_mod_8);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_operand2 = _mm512_loadu_si512(vp_operand2);
+
+    __m512i v_result =
+        _mm512_hexl_goldilocks_mul_epu64(v_operand1, v_operand2);
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_result;
+    ++vp_operand1;
+    ++vp_operand2;
+  }
+}
+
+void EltwiseFMAModGoldilocksAVX512(uint64_t* result, const uint64_t* arg1,
+                                   uint64_t arg2, const uint64_t* arg3,
+                                   uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(arg1 != nullptr, "Require arg1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseFMAModGoldilocksNative(result, arg1, arg2, arg3, n_mod_8);
+    arg1 += n_mod_8;
+    if (arg3 != nullptr) {
+      arg3 += n_mod_8;
+    }
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  __m512i v_arg2 = _mm512_set1_epi64(static_cast<int64_t>(arg2));
+  const __m512i* vp_arg1 = reinterpret_cast<const __m512i*>(arg1);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  if (arg3 == nullptr) {
+    HEXL_LOOP_UNROLL_4
+    for (size_t i = n / 8; i > 0; --i) {
+      __m512i v_arg1 = _mm512_loadu_si512(vp_arg1);
+      _mm512_storeu_si512(vp_result,
+                          _mm512_hexl_goldilocks_mul_epu64(v_arg1, v_arg2));
+      ++vp_arg1;
+      ++vp_result;
+    }
+    return;
+  }
+
+  const __m512i* vp_arg3 = reinterpret_cast<const __m512i*>(arg3);
+  __m512i v_one = _mm512_set1_epi64(1);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_arg1 = _mm512_loadu_si512(vp_arg1);
+    __m512i v_arg3 = _mm512_loadu_si512(vp_arg3);
+
+    __m512i v_prod_hi;
+    __m512i v_prod_lo;
+    _mm512_hexl_mul_wide_epu64(v_arg1, v_arg2, &v_prod_hi, &v_prod_lo);
+    // The high word of a 64 x 64-bit product is at most 2^64 - 2, so the
+    // carry cannot overflow
+    v_prod_lo = _mm512_add_epi64(v_prod_lo, v_arg3);
+    __mmask8 carry = _mm512_cmplt_epu64_mask(v_prod_lo, v_arg3);
+    v_prod_hi = _mm512_mask_add_epi64(v_prod_hi, carry, v_prod_hi, v_one);
+
+    _mm512_storeu_si512(vp_result, _mm512_hexl_goldilocks_reduce_epu64(
+                                       v_prod_hi, v_prod_lo));
+
+    ++vp_arg1;
+    ++vp_arg3;
+    ++vp_result;
+  }
+}
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,29 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+void EltwiseAddModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                   const uint64_t* operand2, uint64_t n);
+
+void EltwiseSubModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                   const uint64_t* operand2, uint64_t n);
+
+void EltwiseMultModGoldilocksAVX512(uint64_t* result, const uint64_t* operand1,
+                                    const uint64_t* operand2, uint64_t n);
+
+void EltwiseFMAModGoldilocksAVX512(uint64_t* result, const uint64_t* arg1,
+                                   uint64_t arg2, const uint64_t* arg3,
+                                   uint64_t n);
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,107 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Adds two vectors elementwise modulo the Goldilocks prime
+/// @details See EltwiseAddModGoldilocks
+inline void EltwiseAddModGoldilocksNative(uint64_t* result,
+                                          const uint64_t* operand1,
+                                          const uint64_t* operand2,
+                                          uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK_BOUNDS(operand1, n, kGoldilocksModulus,
+                    "pre-add value in operand1 exceeds bound "
+                        << kGoldilocksModulus);
+  HEXL_CHECK_BOUNDS(operand2, n, kGoldilocksModulus,
+                    "pre-add value in operand2 exceeds bound "
+                        << kGoldilocksModulus);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = AddModGoldilocks(operand1[i], operand2[i]);
+  }
+}
+
+/// @brief Subtracts two vectors elementwise modulo the Goldilocks prime
+/// @details See EltwiseSubModGoldilocks
+inline void EltwiseSubModGoldilocksNative(uint64_t* result,
+                                          const uint64_t* operand1,
+                                          const uint64_t* operand2,
+                                          uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK_BOUNDS(operand1, n, kGoldilocksModulus,
+                    "pre-sub value in operand1 exceeds bound "
+                        << kGoldilocksModulus);
+  HEXL_CHECK_BOUNDS(operand2, n, kGoldilocksModulus,
+                    "pre-sub value in operand2 exceeds bound "
+                        << kGoldilocksModulus);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = SubModGoldilocks(operand1[i], operand2[i]);
+  }
+}
+
+/// @brief Multiplies two vectors elementwise modulo the Goldilocks prime
+/// @details See EltwiseMultModGoldilocks
+inline void EltwiseMultModGoldilocksNative(uint64_t* result,
+                                           const uint64_t* operand1,
+                                           const uint64_t* operand2,
+                                           uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = MultiplyModGoldilocks(operand1[i], operand2[i]);
+  }
+}
+
+/// @brief Computes fused multiply-add modulo the Goldilocks prime
+/// @details See EltwiseFMAModGoldilocks
+inline void EltwiseFMAModGoldilocksNative(uint64_t* result,
+                                          const uint64_t* arg1, uint64_t arg2,
+                                          const uint64_t* arg3, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(arg1 != nullptr, "Require arg1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+  if (arg3 == nullptr) {
+    HEXL_LOOP_UNROLL_4
+    for (size_t i = 0; i < n; ++i) {
+      result[i] = MultiplyModGoldilocks(arg1[i], arg2);
+    }
+    return;
+  }
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t prod_hi;
+    uint64_t prod_lo;
+    MultiplyUInt64(arg1[i], arg2, &prod_hi, &prod_lo);
+    // prod_hi <= 2^64 - 2, so the carry cannot overflow
+    prod_hi += AddUInt64(prod_lo, arg3[i], &prod_lo);
+    result[i] = ReduceGoldilocks(prod_hi, prod_lo);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,92 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/eltwise/eltwise-goldilocks.hpp"
+
+#include "eltwise/eltwise-goldilocks-avx512.hpp"
+#include "eltwise/eltwise-goldilocks-internal.hpp"
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+void EltwiseAddModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseAddModGoldilocksAVX512");
+    EltwiseAddModGoldilocksAVX512(result, operand1, operand2, n);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseAddModGoldilocksNative");
+  EltwiseAddModGoldilocksNative(result, operand1, operand2, n);
+}
+
+void EltwiseSubModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseSubModGoldilocksAVX512");
+    EltwiseSubModGoldilocksAVX512(result, operand1, operand2, n);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseSubModGoldilocksNative");
+  EltwiseSubModGoldilocksNative(result, operand1, operand2, n);
+}
+
+void EltwiseMultModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseMultModGoldilocksAVX512");
+    EltwiseMultModGoldilocksAVX512(result, operand1, operand2, n);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseMultModGoldilocksNative");
+  EltwiseMultModGoldilocksNative(result, operand1, operand2, n);
+}
+
+void EltwiseFMAModGoldilocks(uint64_t* result, const uint64_t* arg1,
+                             uint64_t arg2, const uint64_t* arg3, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(arg1 != nullptr, "Require arg1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseFMAModGoldilocksAVX512");
+    EltwiseFMAModGoldilocksAVX512(result, arg1, arg2, arg3, n);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseFMAModGoldilocksNative");
+  EltwiseFMAModGoldilocksNative(result, arg1, arg2, arg3, n);
+}
+
+}  // namespace hexl
+}  // namespace intel
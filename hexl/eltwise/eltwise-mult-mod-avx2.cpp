@@ -0,0 +1,104 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "eltwise/eltwise-mult-mod-avx2.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "eltwise/eltwise-mult-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "util/avx2-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+template void EltwiseMultModAVX2Int32<1>(uint64_t* result,
+                                         const uint64_t* operand1,
+                                         const uint64_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+template void EltwiseMultModAVX2Int32<2>(uint64_t* result,
+                                         const uint64_t* operand1,
+                                         const uint64_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+template void EltwiseMultModAVX2Int32<4>(uint64_t* result,
+                                         const uint64_t* operand1,
+                                         const uint64_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+
+template <int InputModFactor>
+void EltwiseMultModAVX2Int32(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n,
+                             uint64_t modulus) {
+  HEXL_CHECK(InputModFactor == 1 || InputModFactor == 2 || InputModFactor == 4,
+             "Require InputModFactor = 1, 2, or 4")
+  HEXL_CHECK(modulus < (1ULL << 30), "Require modulus < (1ULL << 30)");
+  HEXL_CHECK_BOUNDS(operand1, n, InputModFactor * modulus,
+                    "operand1 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK_BOUNDS(operand2, n, InputModFactor * modulus,
+                    "operand2 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+
+  uint64_t n_mod_4 = n % 4;
+  if (n_mod_4 != 0) {
+    EltwiseMultModNative<InputModFactor>(result, operand1, operand2, n_mod_4,
+                                         modulus);
+    operand1 += n_mod_4;
+    operand2 += n_mod_4;
+    result += n_mod_4;
+    n -= n_mod_4;
+  }
+
+  // modulus < 2**N, so mu = floor(2^{2N} / q) <= 2^{N + 1} <= 2^31, and
+  // every factor below fits in 32 bits
+  const uint64_t N = MSB(modulus) + 1;
+  uint64_t mu = (uint64_t(1) << (2 * N)) / modulus;
+
+  const __m128i v_shift_lo = _mm_cvtsi64_si128(static_cast<int64_t>(N - 1));
+  const __m128i v_shift_hi = _mm_cvtsi64_si128(static_cast<int64_t>(N + 1));
+
+  __m256i v_mu = _mm256_set1_epi64x(static_cast<int64_t>(mu));
+  __m256i v_modulus = _mm256_set1_epi64x(static_cast<int64_t>(modulus));
+  __m256i v_twice_mod = _mm256_set1_epi64x(static_cast<int64_t>(2 * modulus));
+  const __m256i* vp_operand1 = reinterpret_cast<const __m256i*>(operand1);
+  const __m256i* vp_operand2 = reinterpret_cast<const __m256i*>(operand2);
+  __m256i* vp_result = reinterpret_cast<__m256i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 4; i > 0; --i) {
+    __m256i v_op1 = _mm256_loadu_si256(vp_operand1);
+    __m256i v_op2 = _mm256_loadu_si256(vp_operand2);
+    v_op1 = _mm256_hexl_small_mod_epu64<InputModFactor>(v_op1, v_modulus,
+                                                        &v_twice_mod);
+    v_op2 = _mm256_hexl_small_mod_epu64<InputModFactor>(v_op2, v_modulus,
+                                                        &v_twice_mod);
+
+    // prod < q^2 < 2^{2N}
+    __m256i v_prod = _mm256_mul_epu32(v_op1, v_op2);
+
+    // Quotient estimate floor(floor(prod / 2^{N - 1}) * mu / 2^{N + 1}),
+    // which is at most 2 less than floor(prod / q)
+    __m256i c1 = _mm256_srl_epi64(v_prod, v_shift_lo);
+    __m256i c3 = _mm256_srl_epi64(_mm256_mul_epu32(c1, v_mu), v_shift_hi);
+
+    // prod - c3 * q is in [0, 3q)
+    __m256i v_rem = _mm256_sub_epi64(v_prod, _mm256_mul_epu32(c3, v_modulus));
+    v_rem = _mm256_hexl_small_mod_epu64<4>(v_rem, v_modulus, &v_twice_mod);
+
+    _mm256_storeu_si256(vp_result, v_rem);
+
+    ++vp_operand1;
+    ++vp_operand2;
+    ++vp_result;
+  }
+}
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,28 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "eltwise/eltwise-mult-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Barrett reduction of Algorithm 14.42 of the Handbook of Applied
+// Cryptography, for moduli small enough that all products fit in 32x32-bit
+// multiplications. Requires modulus < 2^30.
+template <int InputModFactor>
+void EltwiseMultModAVX2Int32(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n,
+                             uint64_t modulus);
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
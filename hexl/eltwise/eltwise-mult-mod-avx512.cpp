@@ -6,6 +6,7 @@
 #include <immintrin.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <limits>
 
 #include "eltwise/eltwise-mult-mod-internal.hpp"
@@ -46,6 +47,44 @@ template void EltwiseMultModAVX512Int<4>(uint64_t* result,
                                          const uint64_t* operand2, uint64_t n,
                                          uint64_t modulus);
 
+template void EltwiseMultModAVX512Special<1>(
+    uint64_t* result, const uint64_t* operand1, const uint64_t* operand2,
+    uint64_t n, const SpecialFormModulus& modulus);
+template void EltwiseMultModAVX512Special<2>(
+    uint64_t* result, const uint64_t* operand1, const uint64_t* operand2,
+    uint64_t n, const SpecialFormModulus& modulus);
+template void EltwiseMultModAVX512Special<4>(
+    uint64_t* result, const uint64_t* operand1, const uint64_t* operand2,
+    uint64_t n, const SpecialFormModulus& modulus);
+
+template void EltwiseMultModAVX512U32<1>(uint32_t* result,
+                                         const uint32_t* operand1,
+                                         const uint32_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+template void EltwiseMultModAVX512U32<2>(uint32_t* result,
+                                         const uint32_t* operand1,
+                                         const uint32_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+template void EltwiseMultModAVX512U32<4>(uint32_t* result,
+                                         const uint32_t* operand1,
+                                         const uint32_t* operand2, uint64_t n,
+                                         uint64_t modulus);
+
+#endif
+
+#ifdef HEXL_HAS_AVX512IFMA
+template void EltwiseMultModAVX512IFMA<1>(uint64_t* result,
+                                          const uint64_t* operand1,
+                                          const uint64_t* operand2, uint64_t n,
+                                          uint64_t modulus);
+template void EltwiseMultModAVX512IFMA<2>(uint64_t* result,
+                                          const uint64_t* operand1,
+                                          const uint64_t* operand2, uint64_t n,
+                                          uint64_t modulus);
+template void EltwiseMultModAVX512IFMA<4>(uint64_t* result,
+                                          const uint64_t* operand1,
+                                          const uint64_t* operand2, uint64_t n,
+                                          uint64_t modulus);
 #endif
 
 #ifdef HEXL_HAS_AVX512DQ
@@ -831,7 +870,339 @@ void EltwiseMultModAVX512Float(uint64_t* result, const uint64_t* operand1,
   HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
 }
 
+template <int InputModFactor>
+void EltwiseMultModAVX512U32(uint32_t* result, const uint32_t* operand1,
+                             const uint32_t* operand2, uint64_t n,
+                             uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK_BOUNDS(operand1, n, InputModFactor * modulus,
+                    "operand1 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK_BOUNDS(operand2, n, InputModFactor * modulus,
+                    "operand2 exceeds bound " << (InputModFactor * modulus));
+
+  uint64_t n_mod_16 = n % 16;
+  if (n_mod_16 != 0) {
+    EltwiseMultModNative<InputModFactor>(result, operand1, operand2, n_mod_16,
+                                         modulus);
+    operand1 += n_mod_16;
+    operand2 += n_mod_16;
+    result += n_mod_16;
+    n -= n_mod_16;
+  }
+
+  const unsigned int N = static_cast<unsigned int>(MSB(modulus) + 1);
+  const uint64_t mu = BarrettFactor32(modulus);
+
+  // Inputs are reduced on 32-bit lanes; the products and remainders live on
+  // the 64-bit lanes of the even and odd inputs
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi32(static_cast<int>(2 * modulus));
+  __m512i v_mu = _mm512_set1_epi64(static_cast<int64_t>(mu));
+  __m512i v_modulus_64 = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_twice_mod_64 = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  auto barrett_reduce = [&](__m512i v_prod) {
+    // Quotient estimate floor(floor(prod / 2^{N - 1}) * mu / 2^{N + 1}),
+    // which is at most 2 less than floor(prod / q)
+    __m512i c1 = _mm512_srli_epi64(v_prod, N - 1);
+    __m512i c3 = _mm512_srli_epi64(_mm512_mul_epu32(c1, v_mu), N + 1);
+    // prod - c3 * q is in [0, 3q), which may exceed 32 bits; subtracting 2q
+    // where possible leaves [0, 2q)
+    __m512i v_rem =
+        _mm512_sub_epi64(v_prod, _mm512_mul_epu32(c3, v_modulus_64));
+    return _mm512_min_epu64(v_rem, _mm512_sub_epi64(v_rem, v_twice_mod_64));
+  };
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 16; i > 0; --i) {
+    __m512i v_op1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_op2 = _mm512_loadu_si512(vp_operand2);
+    v_op1 = _mm512_hexl_small_mod_epu32<InputModFactor>(v_op1, v_modulus,
+                                                        &v_twice_mod);
+    v_op2 = _mm512_hexl_small_mod_epu32<InputModFactor>(v_op2, v_modulus,
+                                                        &v_twice_mod);
+
+    // prod < q^2 < 2^{2N}
+    __m512i v_prod_even = _mm512_mul_epu32(v_op1, v_op2);
+    __m512i v_prod_odd = _mm512_mul_epu32(_mm512_srli_epi64(v_op1, 32),
+                                          _mm512_srli_epi64(v_op2, 32));
+
+    __m512i v_rem_even = barrett_reduce(v_prod_even);
+    __m512i v_rem_odd = barrett_reduce(v_prod_odd);
+    __m512i v_result = _mm512_mask_blend_epi32(
+        0xAAAA, v_rem_even, _mm512_slli_epi64(v_rem_odd, 32));
+    v_result = _mm512_hexl_small_mod_epu32(v_result, v_modulus);
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_operand1;
+    ++vp_operand2;
+    ++vp_result;
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+}
+
+// Folds x = hi * 2^k + lo to lo + hi * c * 2^m - hi, which is congruent to x
+// modulo q = 2^k - c * 2^m + 1. Multiplications by c are skipped if HasC is
+// false, i.e. c == 1.
+template <int InputModFactor, bool HasC>
+void EltwiseMultModAVX512SpecialLoop(__m512i* vp_result,
+                                     const __m512i* vp_operand1,
+                                     const __m512i* vp_operand2, uint64_t n,
+                                     const SpecialFormModulus& modulus) {
+  // Per-lane shift counts; _mm512_sllv_epi64 is cheaper than _mm512_sll_epi64
+  const __m512i v_k = _mm512_set1_epi64(static_cast<int64_t>(modulus.K()));
+  const __m512i v_64mk =
+      _mm512_set1_epi64(static_cast<int64_t>(64 - modulus.K()));
+  const __m512i v_m = _mm512_set1_epi64(static_cast<int64_t>(modulus.M()));
+  const __m512i v_64mm =
+      _mm512_set1_epi64(static_cast<int64_t>(64 - modulus.M()));
+  const __m512i v_mask =
+      _mm512_set1_epi64(static_cast<int64_t>((1ULL << modulus.K()) - 1));
+  const __m512i v_c = _mm512_set1_epi64(static_cast<int64_t>(modulus.C()));
+  const __m512i v_modulus =
+      _mm512_set1_epi64(static_cast<int64_t>(modulus.Modulus()));
+  __m512i v_twice_mod =
+      _mm512_set1_epi64(static_cast<int64_t>(2 * modulus.Modulus()));
+  const __m512i v_one = _mm512_set1_epi64(1);
+  (void)v_c;  // Avoid unused variable
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_op1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_op2 = _mm512_loadu_si512(vp_operand2);
+    v_op1 = _mm512_hexl_small_mod_epu64<InputModFactor>(v_op1, v_modulus,
+                                                        &v_twice_mod);
+    v_op2 = _mm512_hexl_small_mod_epu64<InputModFactor>(v_op2, v_modulus,
+                                                        &v_twice_mod);
+
+    __m512i v_prod_hi;
+    __m512i v_prod_lo;
+    _mm512_hexl_mul_wide_epu64(v_op1, v_op2, &v_prod_hi, &v_prod_lo);
+
+    // First fold, into 128 bits
+    __m512i v_hi = _mm512_or_si512(_mm512_sllv_epi64(v_prod_hi, v_64mk),
+                                   _mm512_srlv_epi64(v_prod_lo, v_k));
+    __m512i v_hi_c = HasC ? _mm512_mullo_epi64(v_hi, v_c) : v_hi;
+    __m512i v_sum_hi = _mm512_srlv_epi64(v_hi_c, v_64mm);
+    __m512i v_lo = _mm512_and_si512(v_prod_lo, v_mask);
+    __m512i v_sum_lo = _mm512_add_epi64(_mm512_sllv_epi64(v_hi_c, v_m), v_lo);
+    __mmask8 carry = _mm512_cmplt_epu64_mask(v_sum_lo, v_lo);
+    v_sum_hi = _mm512_mask_add_epi64(v_sum_hi, carry, v_sum_hi, v_one);
+    __mmask8 borrow = _mm512_cmplt_epu64_mask(v_sum_lo, v_hi);
+    v_sum_lo = _mm512_sub_epi64(v_sum_lo, v_hi);
+    v_sum_hi = _mm512_mask_sub_epi64(v_sum_hi, borrow, v_sum_hi, v_one);
+
+    // Second fold, in 64 bits, to [0, 2q)
+    v_hi = _mm512_or_si512(_mm512_sllv_epi64(v_sum_hi, v_64mk),
+                           _mm512_srlv_epi64(v_sum_lo, v_k));
+    v_hi_c = HasC ? _mm512_mullo_epi64(v_hi, v_c) : v_hi;
+    __m512i v_result = _mm512_add_epi64(_mm512_and_si512(v_sum_lo, v_mask),
+                                        _mm512_sllv_epi64(v_hi_c, v_m));
+    v_result = _mm512_sub_epi64(v_result, v_hi);
+    v_result = _mm512_hexl_small_mod_epu64(v_result, v_modulus);
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_operand1;
+    ++vp_operand2;
+    ++vp_result;
+  }
+}
+
+template <int InputModFactor>
+void EltwiseMultModAVX512Special(uint64_t* result, const uint64_t* operand1,
+                                 const uint64_t* operand2, uint64_t n,
+                                 const SpecialFormModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(InputModFactor == 1 || InputModFactor == 2 || InputModFactor == 4,
+             "Require InputModFactor = 1, 2, or 4")
+  HEXL_CHECK(modulus.IsSpecialForm(), "Require special-form modulus");
+  HEXL_CHECK_BOUNDS(
+      operand1, n, InputModFactor * modulus.Modulus(),
+      "operand1 exceeds bound " << (InputModFactor * modulus.Modulus()));
+  HEXL_CHECK_BOUNDS(
+      operand2, n, InputModFactor * modulus.Modulus(),
+      "operand2 exceeds bound " << (InputModFactor * modulus.Modulus()));
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseMultModSpecialNative<InputModFactor>(result, operand1, operand2,
+                                                n_mod_8, modulus);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  if (modulus.C() == 1) {
+    EltwiseMultModAVX512SpecialLoop<InputModFactor, false>(
+        vp_result, vp_operand1, vp_operand2, n, modulus);
+  } else {
+    EltwiseMultModAVX512SpecialLoop<InputModFactor, true>(
+        vp_result, vp_operand1, vp_operand2, n, modulus);
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus.Modulus(),
+                    "result exceeds bound " << modulus.Modulus());
+}
+
+void EltwiseMultModMontgomeryAVX512(uint64_t* result, const uint64_t* operand1,
+                                    const uint64_t* operand2, uint64_t n,
+                                    uint64_t modulus, uint64_t neg_inv_modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(modulus < (1ULL << 62), "Require modulus < (1ULL << 62)");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "operand2 exceeds bound " << modulus);
+
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseMultModMontgomeryNative(result, operand1, operand2, n_mod_8,
+                                   modulus, neg_inv_modulus);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_inv_modulus =
+      _mm512_set1_epi64(static_cast<int64_t>(neg_inv_modulus));
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_op1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_op2 = _mm512_loadu_si512(vp_operand2);
+
+    __m512i v_result = _mm512_hexl_montgomery_mul_lazy_epu64(
+        v_op1, v_op2, v_modulus, v_neg_inv_modulus);
+    v_result = _mm512_hexl_small_mod_epu64(v_result, v_modulus);
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_operand1;
+    ++vp_operand2;
+    ++vp_result;
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+}
+
 #endif  // HEXL_HAS_AVX512DQ
 
+#ifdef HEXL_HAS_AVX512IFMA
+
+// Barrett reduction with 52-bit limbs. For modulus q with N bits, let the
+// product d = x * y < q^2 and mu = floor(2^(N + 51) / q) < 2^52. Then
+// c1 = floor(d / 2^(N - 1)) < 2q < 2^52, so Q = floor(c1 * mu / 2^52) is a
+// single madd52hi. Q underestimates floor(d / q) by at most 2, so
+// r = d - Q * q < 3q < 2^53 is exact in 64 bits.
+template <int InputModFactor>
+void EltwiseMultModAVX512IFMA(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n,
+                              uint64_t modulus) {
+  HEXL_CHECK(InputModFactor == 1 || InputModFactor == 2 || InputModFactor == 4,
+             "Require InputModFactor = 1, 2, or 4")
+  HEXL_CHECK(modulus < (1ULL << 51), "Require modulus < (1ULL << 51)");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK_BOUNDS(operand1, n, InputModFactor * modulus,
+                    "operand1 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK_BOUNDS(operand2, n, InputModFactor * modulus,
+                    "operand2 exceeds bound " << (InputModFactor * modulus));
+  uint64_t n_mod_8 = n % 8;
+  if (n_mod_8 != 0) {
+    EltwiseMultModNative<InputModFactor>(result, operand1, operand2, n_mod_8,
+                                         modulus);
+    operand1 += n_mod_8;
+    operand2 += n_mod_8;
+    result += n_mod_8;
+    n -= n_mod_8;
+  }
+
+  // modulus < 2**N
+  const uint64_t N = MSB(modulus) + 1;
+  const uint64_t L = N + 51;
+  uint64_t op_hi = (L >= 64) ? uint64_t(1) << (L - 64) : 0;
+  uint64_t op_lo = (L >= 64) ? 0 : uint64_t(1) << L;
+  uint64_t mu = DivideUInt128UInt64Lo(op_hi, op_lo, modulus);
+  // mu == 2^52 only if modulus is a power of two. Rounding it down keeps the
+  // quotient error within 3.
+  mu = std::min(mu, MaximumValue(52));
+
+  __m512i v_mu = _mm512_set1_epi64(static_cast<int64_t>(mu));
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  __m512i v_zero = _mm512_setzero_si512();
+  const unsigned int shift_lo = static_cast<unsigned int>(N - 1);
+  const unsigned int shift_hi = static_cast<unsigned int>(53 - N);
+
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 8; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+    v_operand1 = _mm512_hexl_small_mod_epu64<InputModFactor>(
+        v_operand1, v_modulus, &v_twice_mod);
+    __m512i v_operand2 = _mm512_loadu_si512(vp_operand2);
+    v_operand2 = _mm512_hexl_small_mod_epu64<InputModFactor>(
+        v_operand2, v_modulus, &v_twice_mod);
+
+    // d_hi = floor(d / 2^52); d = d mod 2^64
+    __m512i d_hi = _mm512_madd52hi_epu64(v_zero, v_operand1, v_operand2);
+    __m512i d = _mm512_madd52lo_epu64(_mm512_slli_epi64(d_hi, 52), v_operand1,
+                                      v_operand2);
+
+    // c1 = floor(d / 2^(N - 1)); bits 52 to 63 of d agree in both terms
+    __m512i c1 = _mm512_or_si512(_mm512_srli_epi64(d, shift_lo),
+                                 _mm512_slli_epi64(d_hi, shift_hi));
+    __m512i q_est = _mm512_madd52hi_epu64(v_zero, c1, v_mu);
+
+    // (q_est * q) mod 2^64
+    __m512i qq_hi = _mm512_madd52hi_epu64(v_zero, q_est, v_modulus);
+    __m512i qq = _mm512_madd52lo_epu64(_mm512_slli_epi64(qq_hi, 52), q_est,
+                                       v_modulus);
+
+    // r = d - q_est * q in [0, 4q)
+    __m512i v_result = _mm512_sub_epi64(d, qq);
+    v_result = _mm512_hexl_small_mod_epu64<4>(v_result, v_modulus,
+                                              &v_twice_mod);
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_operand1;
+    ++vp_operand2;
+    ++vp_result;
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+}
+
+#endif  // HEXL_HAS_AVX512IFMA
+
 }  // namespace hexl
 }  // namespace intel
@@ -28,7 +28,37 @@ void EltwiseMultModAVX512Float(uint64_t* result, const uint64_t* operand1,
                                const uint64_t* operand2, uint64_t n,
                                uint64_t modulus);
 
+// Shift-and-add folding by a special-form modulus; see ReduceSpecialForm
+template <int InputModFactor>
+void EltwiseMultModAVX512Special(uint64_t* result, const uint64_t* operand1,
+                                 const uint64_t* operand2, uint64_t n,
+                                 const SpecialFormModulus& modulus);
+
+// Barrett reduction of Algorithm 14.42 of the Handbook of Applied
+// Cryptography on sixteen 32-bit lanes. Requires modulus < 2^31.
+template <int InputModFactor>
+void EltwiseMultModAVX512U32(uint32_t* result, const uint32_t* operand1,
+                             const uint32_t* operand2, uint64_t n,
+                             uint64_t modulus);
+
+// Montgomery multiplication with R = 2^64. Requires modulus odd and less than
+// 2^62.
+void EltwiseMultModMontgomeryAVX512(uint64_t* result, const uint64_t* operand1,
+                                    const uint64_t* operand2, uint64_t n,
+                                    uint64_t modulus, uint64_t neg_inv_modulus);
+
 #endif  // HEXL_HAS_AVX512DQ
 
+#ifdef HEXL_HAS_AVX512IFMA
+
+// Barrett reduction of the 104-bit product formed by the 52-bit multipliers.
+// Requires modulus < 2^51.
+template <int InputModFactor>
+void EltwiseMultModAVX512IFMA(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n,
+                              uint64_t modulus);
+
+#endif  // HEXL_HAS_AVX512IFMA
+
 }  // namespace hexl
 }  // namespace intel
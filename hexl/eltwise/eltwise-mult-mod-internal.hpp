@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "eltwise/eltwise-mult-mod-internal.hpp"
@@ -85,5 +86,147 @@ void EltwiseMultModNative(uint64_t* result, const uint64_t* operand1,
   }
 }
 
+/// @brief Multiplies two vectors elementwise with modular reduction by a
+/// special-form modulus
+/// @param[in] result Result of element-wise multiplication
+/// @param[in] operand1 Vector of elements to multiply
+/// @param[in] operand2 Vector of elements to multiply
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Special-form modulus with which to perform modular
+/// reduction
+/// @details Reduces each product by shift-and-add folding; see
+/// ReduceSpecialForm. Handles the n % 8 leading elements of
+/// EltwiseMultModAVX512Special. EltwiseMultMod does not call it directly,
+/// since EltwiseMultModNative is about 1.6x faster on the same moduli.
+template <int InputModFactor>
+void EltwiseMultModSpecialNative(uint64_t* result, const uint64_t* operand1,
+                                 const uint64_t* operand2, uint64_t n,
+                                 const SpecialFormModulus& modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus.IsSpecialForm(), "Require special-form modulus");
+  const uint64_t q = modulus.Modulus();
+  HEXL_CHECK_BOUNDS(operand1, n, InputModFactor * q,
+                    "operand1 exceeds bound " << (InputModFactor * q));
+  HEXL_CHECK_BOUNDS(operand2, n, InputModFactor * q,
+                    "operand2 exceeds bound " << (InputModFactor * q));
+
+  const uint64_t twice_modulus = 2 * q;
+  // A local copy lets the fields stay in registers despite stores to result
+  const SpecialFormModulus special_modulus = modulus;
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t x = ReduceMod<InputModFactor>(*operand1, q, &twice_modulus);
+    uint64_t y = ReduceMod<InputModFactor>(*operand2, q, &twice_modulus);
+    *result = MultiplyModSpecialForm(x, y, special_modulus);
+
+    ++operand1;
+    ++operand2;
+    ++result;
+  }
+}
+
+/// @brief Multiplies two vectors of elements in Montgomery form elementwise
+/// @param[in] result Result of element-wise multiplication, in Montgomery form
+/// @param[in] operand1 Vector of elements to multiply. Each element must be
+/// less than the modulus.
+/// @param[in] operand2 Vector of elements to multiply. Each element must be
+/// less than the modulus.
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// odd and less than 2^62.
+/// @param[in] neg_inv_modulus MontgomeryNegInverse(modulus)
+/// @details Computes \p result[i] = (\p operand1[i] * \p operand2[i] *
+/// 2^{-64}) mod \p modulus for i=0, ..., \p n - 1
+inline void EltwiseMultModMontgomeryNative(uint64_t* result,
+                                           const uint64_t* operand1,
+                                           const uint64_t* operand2, uint64_t n,
+                                           uint64_t modulus,
+                                           uint64_t neg_inv_modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(modulus < (1ULL << 62), "Require modulus < (1ULL << 62)");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "operand2 exceeds bound " << modulus);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    *result = MontgomeryMultiply(*operand1, *operand2, modulus,
+                                 neg_inv_modulus);
+
+    ++operand1;
+    ++operand2;
+    ++result;
+  }
+}
+
+/// @brief Returns the Barrett factor mu = floor(2^{2N} / modulus) of
+/// Algorithm 14.42 of the Handbook of Applied Cryptography, where modulus <
+/// 2^N. Requires modulus < 2^31.
+/// @details mu < 2^32 unless modulus = 2^30, for which the clamped mu =
+/// 2^32 - 1 still leaves the remainder in [0, 2 * modulus)
+inline uint64_t BarrettFactor32(uint64_t modulus) {
+  const uint64_t N = MSB(modulus) + 1;
+  uint64_t mu = (uint64_t(1) << (2 * N)) / modulus;
+  return std::min(mu, uint64_t(0xFFFFFFFF));
+}
+
+/// @brief Multiplies two vectors of 32-bit elements elementwise with modular
+/// reduction
+/// @param[in] result Result of element-wise multiplication
+/// @param[in] operand1 Vector of elements to multiply
+/// @param[in] operand2 Vector of elements to multiply
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// less than 2^31.
+/// @details Barrett reduction of Algorithm 14.42 of the Handbook of Applied
+/// Cryptography, with every factor in 32 bits
+template <int InputModFactor>
+void EltwiseMultModNative(uint32_t* result, const uint32_t* operand1,
+                          const uint32_t* operand2, uint64_t n,
+                          uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK_BOUNDS(operand1, n, InputModFactor * modulus,
+                    "operand1 exceeds bound " << (InputModFactor * modulus));
+  HEXL_CHECK_BOUNDS(operand2, n, InputModFactor * modulus,
+                    "operand2 exceeds bound " << (InputModFactor * modulus));
+
+  const uint64_t N = MSB(modulus) + 1;
+  const uint64_t mu = BarrettFactor32(modulus);
+  const uint64_t twice_modulus = 2 * modulus;
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t x = ReduceMod<InputModFactor>(*operand1, modulus, &twice_modulus);
+    uint64_t y = ReduceMod<InputModFactor>(*operand2, modulus, &twice_modulus);
+
+    // prod < q^2 < 2^{2N}, so c1 < 2^{N + 1} <= 2^32
+    uint64_t prod = x * y;
+    uint64_t c1 = prod >> (N - 1);
+    uint64_t c3 = (c1 * mu) >> (N + 1);
+
+    // prod - c3 * q is in [0, 3q)
+    *result = static_cast<uint32_t>(
+        ReduceMod<4>(prod - c3 * modulus, modulus, &twice_modulus));
+
+    ++operand1;
+    ++operand2;
+    ++result;
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
@@ -3,6 +3,7 @@
 
 #include "hexl/eltwise/eltwise-mult-mod.hpp"
 
+#include "eltwise/eltwise-mult-mod-avx2.hpp"
 #include "eltwise/eltwise-mult-mod-avx512.hpp"
 #include "eltwise/eltwise-mult-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-reduce-mod.hpp"
@@ -48,20 +49,81 @@ void EltwiseMultMod(uint64_t* result, const uint64_t* operand1,
           break;
       }
       return;
-    } else {
+    }
+#ifdef HEXL_HAS_AVX512IFMA
+    // Below 2^50, the floating-point kernel beats the 52-bit multipliers. Up
+    // to 2^51, they beat both the special-form and the 64-bit integer kernels
+    // by 1.5-2.5x.
+    if (has_avx512ifma && modulus < (1ULL << 51)) {
+      HEXL_VLOG(3, "Calling EltwiseMultModAVX512IFMA");
       switch (input_mod_factor) {
         case 1:
-          EltwiseMultModAVX512Int<1>(result, operand1, operand2, n, modulus);
+          EltwiseMultModAVX512IFMA<1>(result, operand1, operand2, n, modulus);
           break;
         case 2:
-          EltwiseMultModAVX512Int<2>(result, operand1, operand2, n, modulus);
+          EltwiseMultModAVX512IFMA<2>(result, operand1, operand2, n, modulus);
           break;
         case 4:
-          EltwiseMultModAVX512Int<4>(result, operand1, operand2, n, modulus);
+          EltwiseMultModAVX512IFMA<4>(result, operand1, operand2, n, modulus);
           break;
       }
       return;
     }
+#endif
+    // Folding by q = 2^k - 2^m + 1 needs no multiplications besides the
+    // product itself, and beats Barrett reduction. With c != 1, the two
+    // 64-bit multiplications by c make it slower than Barrett reduction.
+    SpecialFormModulus special_modulus(modulus);
+    if (special_modulus.IsSpecialForm() && special_modulus.C() == 1) {
+      HEXL_VLOG(3, "Calling EltwiseMultModAVX512Special");
+      switch (input_mod_factor) {
+        case 1:
+          EltwiseMultModAVX512Special<1>(result, operand1, operand2, n,
+                                         special_modulus);
+          break;
+        case 2:
+          EltwiseMultModAVX512Special<2>(result, operand1, operand2, n,
+                                         special_modulus);
+          break;
+        case 4:
+          EltwiseMultModAVX512Special<4>(result, operand1, operand2, n,
+                                         special_modulus);
+          break;
+      }
+      return;
+    }
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX512Int<1>(result, operand1, operand2, n, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX512Int<2>(result, operand1, operand2, n, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX512Int<4>(result, operand1, operand2, n, modulus);
+        break;
+    }
+    return;
+  }
+#endif
+
+#ifdef HEXL_HAS_AVX256
+  // Emulating 128-bit products with 32-bit multiplications costs as much as
+  // the native scalar multiplication, so only small moduli use AVX2
+  if (has_avx2 && modulus < (1ULL << 30)) {
+    HEXL_VLOG(3, "Calling EltwiseMultModAVX2Int32");
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX2Int32<1>(result, operand1, operand2, n, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX2Int32<2>(result, operand1, operand2, n, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX2Int32<4>(result, operand1, operand2, n, modulus);
+        break;
+    }
+    return;
   }
 #endif
 
@@ -79,5 +141,86 @@ void EltwiseMultMod(uint64_t* result, const uint64_t* operand1,
   }
   return;
 }
+
+void EltwiseMultMod(uint32_t* result, const uint32_t* operand1,
+                    const uint32_t* operand2, uint64_t n, uint64_t modulus,
+                    uint64_t input_mod_factor) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(input_mod_factor * modulus <= (1ULL << 32),
+             "Require input_mod_factor * modulus <= (1ULL << 32)");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "Require input_mod_factor = 1, 2, or 4")
+  HEXL_CHECK_BOUNDS(operand1, n, input_mod_factor * modulus,
+                    "operand1 exceeds bound " << (input_mod_factor * modulus))
+  HEXL_CHECK_BOUNDS(operand2, n, input_mod_factor * modulus,
+                    "operand2 exceeds bound " << (input_mod_factor * modulus))
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseMultModAVX512U32");
+    switch (input_mod_factor) {
+      case 1:
+        EltwiseMultModAVX512U32<1>(result, operand1, operand2, n, modulus);
+        break;
+      case 2:
+        EltwiseMultModAVX512U32<2>(result, operand1, operand2, n, modulus);
+        break;
+      case 4:
+        EltwiseMultModAVX512U32<4>(result, operand1, operand2, n, modulus);
+        break;
+    }
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseMultModNative");
+  switch (input_mod_factor) {
+    case 1:
+      EltwiseMultModNative<1>(result, operand1, operand2, n, modulus);
+      break;
+    case 2:
+      EltwiseMultModNative<2>(result, operand1, operand2, n, modulus);
+      break;
+    case 4:
+      EltwiseMultModNative<4>(result, operand1, operand2, n, modulus);
+      break;
+  }
+}
+
+void EltwiseMultModMontgomery(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n,
+                              uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(modulus < (1ULL << 62), "Require modulus < (1ULL << 62)");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus, "operand1 exceeds bound " << modulus)
+  HEXL_CHECK_BOUNDS(operand2, n, modulus, "operand2 exceeds bound " << modulus)
+
+  uint64_t neg_inv_modulus = MontgomeryNegInverse(modulus);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling EltwiseMultModMontgomeryAVX512");
+    EltwiseMultModMontgomeryAVX512(result, operand1, operand2, n, modulus,
+                                   neg_inv_modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseMultModMontgomeryNative");
+  EltwiseMultModMontgomeryNative(result, operand1, operand2, n, modulus,
+                                 neg_inv_modulus);
+}
+
 }  // namespace hexl
 }  // namespace intel
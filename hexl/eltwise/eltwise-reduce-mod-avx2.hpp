@@ -0,0 +1,15 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+void EltwiseReduceModAVX2(uint64_t* result, const uint64_t* operand, uint64_t n,
+                          uint64_t modulus, uint64_t input_mod_factor,
+                          uint64_t output_mod_factor);
+
+}  // namespace hexl
+}  // namespace intel
@@ -106,6 +106,90 @@ void EltwiseReduceModAVX512(uint64_t* result, const uint64_t* operand,
   }
 }
 
+void EltwiseReduceModAVX512(uint32_t* result, const uint32_t* operand,
+                            uint64_t n, uint64_t modulus,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor) {
+  HEXL_CHECK(operand != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(
+      input_mod_factor == 0 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 0 or 2 or 4" << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2 " << output_mod_factor);
+  HEXL_CHECK(input_mod_factor != output_mod_factor,
+             "input_mod_factor must not be equal to output_mod_factor ");
+
+  // Deals with n not divisible by 16
+  uint64_t n_mod_16 = n % 16;
+  if (n_mod_16 != 0) {
+    EltwiseReduceModNative(result, operand, n_mod_16, modulus,
+                           input_mod_factor, output_mod_factor);
+    operand += n_mod_16;
+    result += n_mod_16;
+    n -= n_mod_16;
+  }
+
+  uint64_t barrett_factor = MultiplyFactor(1, 32, modulus).BarrettFactor();
+  uint64_t twice_mod = modulus << 1;
+  const __m512i* v_operand = reinterpret_cast<const __m512i*>(operand);
+  __m512i* v_result = reinterpret_cast<__m512i*>(result);
+  __m512i v_bf = _mm512_set1_epi32(static_cast<int>(barrett_factor));
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi32(static_cast<int>(twice_mod));
+
+  switch (input_mod_factor) {
+    case 0:
+      for (size_t i = 0; i < n; i += 16) {
+        __m512i v_op = _mm512_loadu_si512(v_operand);
+        // x - floor(x * floor(2^32 / q) / 2^32) * q is in [0, 2q)
+        __m512i v_q = _mm512_hexl_mulhi_epu32(v_op, v_bf);
+        v_op = _mm512_sub_epi32(v_op, _mm512_mullo_epi32(v_q, v_modulus));
+        v_op = _mm512_hexl_small_mod_epu32(v_op, v_modulus);
+        _mm512_storeu_si512(v_result, v_op);
+        ++v_operand;
+        ++v_result;
+      }
+      break;
+
+    case 2:
+      for (size_t i = 0; i < n; i += 16) {
+        __m512i v_op = _mm512_loadu_si512(v_operand);
+        v_op = _mm512_hexl_small_mod_epu32(v_op, v_modulus);
+        _mm512_storeu_si512(v_result, v_op);
+        ++v_operand;
+        ++v_result;
+      }
+      break;
+
+    case 4:
+      if (output_mod_factor == 1) {
+        for (size_t i = 0; i < n; i += 16) {
+          __m512i v_op = _mm512_loadu_si512(v_operand);
+          v_op = _mm512_hexl_small_mod_epu32<4>(v_op, v_modulus, &v_twice_mod);
+          _mm512_storeu_si512(v_result, v_op);
+          ++v_operand;
+          ++v_result;
+        }
+      }
+      if (output_mod_factor == 2) {
+        for (size_t i = 0; i < n; i += 16) {
+          __m512i v_op = _mm512_loadu_si512(v_operand);
+          v_op = _mm512_hexl_small_mod_epu32(v_op, v_twice_mod);
+          _mm512_storeu_si512(v_result, v_op);
+          ++v_operand;
+          ++v_result;
+        }
+      }
+      break;
+  }
+  HEXL_CHECK_BOUNDS(result, n, output_mod_factor * modulus,
+                    "result exceeds bound " << (output_mod_factor * modulus));
+}
+
 #endif
 
 }  // namespace hexl
@@ -12,5 +12,10 @@ void EltwiseReduceModAVX512(uint64_t* result, const uint64_t* operand,
                             uint64_t input_mod_factor,
                             uint64_t output_mod_factor);
 
+void EltwiseReduceModAVX512(uint32_t* result, const uint32_t* operand,
+                            uint64_t n, uint64_t modulus,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor);
+
 }  // namespace hexl
 }  // namespace intel
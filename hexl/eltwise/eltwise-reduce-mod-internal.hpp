@@ -22,5 +22,19 @@ void EltwiseReduceModNative(uint64_t* result, const uint64_t* operand,
                             uint64_t n, uint64_t modulus,
                             uint64_t input_mod_factor,
                             uint64_t output_mod_factor);
+
+// @brief Performs elementwise modular reduction on 32-bit elements
+// @param[out] result Stores result
+// @param[in] operand Vector of elements
+// @param[in] n Number of elements in operand
+// @param[in] modulus Modulus with which to perform modular reduction. Must be
+// less than 2^31.
+// @param[in] input_mod_factor Must be 0, 2 or 4, as for the 64-bit overload
+// @param[in] output_mod_factor Must be 1 or 2, as for the 64-bit overload
+void EltwiseReduceModNative(uint32_t* result, const uint32_t* operand,
+                            uint64_t n, uint64_t modulus,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor);
+
 }  // namespace hexl
 }  // namespace intel
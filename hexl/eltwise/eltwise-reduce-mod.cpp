@@ -3,8 +3,10 @@
 
 #include "hexl/eltwise/eltwise-reduce-mod.hpp"
 
+#include "eltwise/eltwise-reduce-mod-avx2.hpp"
 #include "eltwise/eltwise-reduce-mod-avx512.hpp"
 #include "eltwise/eltwise-reduce-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-fma-mod.hpp"
 #include "hexl/logging/logging.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "hexl/util/check.hpp"
@@ -70,6 +72,65 @@ void EltwiseReduceModNative(uint64_t* result, const uint64_t* operand,
   }
 }
 
+void EltwiseReduceModNative(uint32_t* result, const uint32_t* operand,
+                            uint64_t n, uint64_t modulus,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor) {
+  HEXL_CHECK(operand != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(
+      input_mod_factor == 0 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 0 or 2 or 4" << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2 " << output_mod_factor);
+  HEXL_CHECK(input_mod_factor != output_mod_factor,
+             "input_mod_factor must not be equal to output_mod_factor ");
+
+  // x - floor(x * floor(2^32 / q) / 2^32) * q is in [0, 2q) for any 32-bit x
+  uint64_t barrett_factor = MultiplyFactor(1, 32, modulus).BarrettFactor();
+
+  uint64_t twice_modulus = modulus << 1;
+  switch (input_mod_factor) {
+    case 0:
+      for (size_t i = 0; i < n; ++i) {
+        result[i] = static_cast<uint32_t>(ReduceMod<2>(
+            MultiplyModLazy<32>(operand[i], 1, barrett_factor, modulus),
+            modulus));
+      }
+      HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+      break;
+
+    case 2:
+      for (size_t i = 0; i < n; ++i) {
+        result[i] = static_cast<uint32_t>(ReduceMod<2>(operand[i], modulus));
+      }
+      HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+      break;
+
+    case 4:
+      if (output_mod_factor == 1) {
+        for (size_t i = 0; i < n; ++i) {
+          result[i] = static_cast<uint32_t>(
+              ReduceMod<4>(operand[i], modulus, &twice_modulus));
+        }
+        HEXL_CHECK_BOUNDS(result, n, modulus,
+                          "result exceeds bound " << modulus);
+      }
+      if (output_mod_factor == 2) {
+        for (size_t i = 0; i < n; ++i) {
+          result[i] =
+              static_cast<uint32_t>(ReduceMod<2>(operand[i], twice_modulus));
+        }
+        HEXL_CHECK_BOUNDS(result, n, twice_modulus,
+                          "result exceeds bound " << twice_modulus);
+      }
+      break;
+  }
+}
+
 void EltwiseReduceMod(uint64_t* result, const uint64_t* operand, uint64_t n,
                       uint64_t modulus, uint64_t input_mod_factor,
                       uint64_t output_mod_factor) {
@@ -95,10 +156,96 @@ void EltwiseReduceMod(uint64_t* result, const uint64_t* operand, uint64_t n,
                            output_mod_factor);
     return;
   }
+#endif
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseReduceModAVX2(result, operand, n, modulus, input_mod_factor,
+                         output_mod_factor);
+    return;
+  }
 #endif
   HEXL_VLOG(3, "Calling EltwiseReduceModNative");
   EltwiseReduceModNative(result, operand, n, modulus, input_mod_factor,
                          output_mod_factor);
 }
+void EltwiseReduceMod(uint32_t* result, const uint32_t* operand, uint64_t n,
+                      uint64_t modulus, uint64_t input_mod_factor,
+                      uint64_t output_mod_factor) {
+  HEXL_CHECK(operand != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < (1ULL << 31)");
+  HEXL_CHECK(
+      input_mod_factor == 0 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 0 or 2 or 4" << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2 " << output_mod_factor);
+
+  if (input_mod_factor == output_mod_factor && (operand != result)) {
+    for (size_t i = 0; i < n; ++i) {
+      result[i] = operand[i];
+    }
+    return;
+  }
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    EltwiseReduceModAVX512(result, operand, n, modulus, input_mod_factor,
+                           output_mod_factor);
+    return;
+  }
+#endif
+  HEXL_VLOG(3, "Calling EltwiseReduceModNative");
+  EltwiseReduceModNative(result, operand, n, modulus, input_mod_factor,
+                         output_mod_factor);
+}
+namespace {
+
+// Multiplies each element by a scalar constant, with the Shoup
+// multiplication of EltwiseFMAMod where the modulus allows
+void EltwiseMultModScalar(uint64_t* result, const uint64_t* operand,
+                          uint64_t scalar, uint64_t n, uint64_t modulus) {
+  if (modulus < (1ULL << 61)) {
+    EltwiseFMAMod(result, operand, scalar, nullptr, n, modulus, 1);
+    return;
+  }
+  uint64_t scalar_precon = MultiplyFactor(scalar, 64, modulus).BarrettFactor();
+  for (size_t i = 0; i < n; ++i) {
+    result[i] = MultiplyMod(operand[i], scalar, scalar_precon, modulus);
+  }
+}
+
+}  // namespace
+
+void EltwiseToMontgomery(uint64_t* result, const uint64_t* operand,
+                         uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(modulus < (1ULL << 62), "Require modulus < (1ULL << 62)");
+  HEXL_CHECK_BOUNDS(operand, n, modulus, "operand exceeds bound " << modulus);
+
+  // Multiplication by the constant 2^64 mod modulus
+  EltwiseMultModScalar(result, operand, ToMontgomery(1, modulus), n, modulus);
+}
+
+void EltwiseFromMontgomery(uint64_t* result, const uint64_t* operand,
+                           uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus % 2 == 1, "Require modulus odd");
+  HEXL_CHECK(modulus < (1ULL << 62), "Require modulus < (1ULL << 62)");
+  HEXL_CHECK_BOUNDS(operand, n, modulus, "operand exceeds bound " << modulus);
+
+  // Multiplication by the constant 2^{-64} mod modulus
+  uint64_t inv_r =
+      FromMontgomery(1, modulus, MontgomeryNegInverse(modulus));
+  EltwiseMultModScalar(result, operand, inv_r, n, modulus);
+}
+
 }  // namespace hexl
 }  // namespace intel
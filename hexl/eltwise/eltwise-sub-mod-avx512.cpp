@@ -102,6 +102,95 @@ void EltwiseSubModAVX512(uint64_t* result, const uint64_t* operand1,
   HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
 }
 
+void EltwiseSubModAVX512(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "pre-sub value in operand2 exceeds bound " << modulus);
+
+  uint64_t n_mod_16 = n % 16;
+  if (n_mod_16 != 0) {
+    EltwiseSubModNative(result, operand1, operand2, n_mod_16, modulus);
+    operand1 += n_mod_16;
+    operand2 += n_mod_16;
+    result += n_mod_16;
+    n -= n_mod_16;
+  }
+
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i* vp_operand2 = reinterpret_cast<const __m512i*>(operand2);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 16; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+    __m512i v_operand2 = _mm512_loadu_si512(vp_operand2);
+
+    // x - y wraps around to at least 2^32 - q when x < y
+    __m512i v_diff = _mm512_sub_epi32(v_operand1, v_operand2);
+    __m512i v_result =
+        _mm512_min_epu32(v_diff, _mm512_add_epi32(v_diff, v_modulus));
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_result;
+    ++vp_operand1;
+    ++vp_operand2;
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+}
+
+void EltwiseSubModAVX512(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
+
+  uint64_t n_mod_16 = n % 16;
+  if (n_mod_16 != 0) {
+    EltwiseSubModNative(result, operand1, operand2, n_mod_16, modulus);
+    operand1 += n_mod_16;
+    result += n_mod_16;
+    n -= n_mod_16;
+  }
+
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i* vp_result = reinterpret_cast<__m512i*>(result);
+  const __m512i* vp_operand1 = reinterpret_cast<const __m512i*>(operand1);
+  const __m512i v_operand2 = _mm512_set1_epi32(static_cast<int>(operand2));
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = n / 16; i > 0; --i) {
+    __m512i v_operand1 = _mm512_loadu_si512(vp_operand1);
+
+    __m512i v_diff = _mm512_sub_epi32(v_operand1, v_operand2);
+    __m512i v_result =
+        _mm512_min_epu32(v_diff, _mm512_add_epi32(v_diff, v_modulus));
+
+    _mm512_storeu_si512(vp_result, v_result);
+
+    ++vp_result;
+    ++vp_operand1;
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+}
+
 }  // namespace hexl
 }  // namespace intel
 
@@ -32,5 +32,26 @@ void EltwiseSubModNative(uint64_t* result, const uint64_t* operand1,
 void EltwiseSubModNative(uint64_t* result, const uint64_t* operand1,
                          uint64_t operand2, uint64_t n, uint64_t modulus);
 
+/// @brief Subtracts two vectors of 32-bit elements elementwise with modular
+/// reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to subtract from
+/// @param[in] operand2 Vector of elements to subtract
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction
+void EltwiseSubModNative(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus);
+
+/// @brief Subtracts a scalar from a vector of 32-bit elements elementwise
+/// with modular reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to subtract from
+/// @param[in] operand2 Scalar to subtract
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction
+void EltwiseSubModNative(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
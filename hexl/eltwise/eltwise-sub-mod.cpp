@@ -1,6 +1,7 @@
 // Copyright (C) 2020-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include "eltwise/eltwise-sub-mod-avx2.hpp"
 #include "eltwise/eltwise-sub-mod-avx512.hpp"
 #include "eltwise/eltwise-sub-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-add-mod.hpp"
@@ -83,6 +84,13 @@ void EltwiseSubMod(uint64_t* result, const uint64_t* operand1,
   }
 #endif
 
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseSubModAVX2(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
   HEXL_VLOG(3, "Calling EltwiseSubModNative");
   EltwiseSubModNative(result, operand1, operand2, n, modulus);
 }
@@ -97,6 +105,109 @@ void EltwiseSubMod(uint64_t* result, const uint64_t* operand1,
                     "pre-sub value in operand1 exceeds bound " << modulus);
   HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
 
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    EltwiseSubModAVX512(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+#ifdef HEXL_HAS_AVX256
+  if (has_avx2) {
+    EltwiseSubModAVX2(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseSubModNative");
+  EltwiseSubModNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseSubModNative(uint32_t* result, const uint32_t* operand1,
+                         const uint32_t* operand2, uint64_t n,
+                         uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "pre-sub value in operand2 exceeds bound " << modulus);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    if (*operand1 >= *operand2) {
+      *result = *operand1 - *operand2;
+    } else {
+      *result = static_cast<uint32_t>(*operand1 + modulus - *operand2);
+    }
+
+    ++operand1;
+    ++operand2;
+    ++result;
+  }
+}
+
+void EltwiseSubModNative(uint32_t* result, const uint32_t* operand1,
+                         uint32_t operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < n; ++i) {
+    if (*operand1 >= operand2) {
+      *result = *operand1 - operand2;
+    } else {
+      *result = static_cast<uint32_t>(*operand1 + modulus - operand2);
+    }
+
+    ++operand1;
+    ++result;
+  }
+}
+
+void EltwiseSubMod(uint32_t* result, const uint32_t* operand1,
+                   const uint32_t* operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(operand2 != nullptr, "Require operand2 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK_BOUNDS(operand2, n, modulus,
+                    "pre-sub value in operand2 exceeds bound " << modulus);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    EltwiseSubModAVX512(result, operand1, operand2, n, modulus);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling EltwiseSubModNative");
+  EltwiseSubModNative(result, operand1, operand2, n, modulus);
+}
+
+void EltwiseSubMod(uint32_t* result, const uint32_t* operand1,
+                   uint32_t operand2, uint64_t n, uint64_t modulus) {
+  HEXL_CHECK(operand1 != nullptr, "Require operand1 != nullptr");
+  HEXL_CHECK(n != 0, "Require n != 0");
+  HEXL_CHECK(modulus > 1, "Require modulus > 1");
+  HEXL_CHECK(modulus < (1ULL << 31), "Require modulus < 2**31");
+  HEXL_CHECK_BOUNDS(operand1, n, modulus,
+                    "pre-sub value in operand1 exceeds bound " << modulus);
+  HEXL_CHECK(operand2 < modulus, "Require operand2 < modulus");
+
 #ifdef HEXL_HAS_AVX512DQ
   if (has_avx512dq) {
     EltwiseSubModAVX512(result, operand1, operand2, n, modulus);
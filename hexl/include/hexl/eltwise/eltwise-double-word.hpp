@@ -0,0 +1,59 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/double-word.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Adds two vectors elementwise modulo a double-word modulus
+/// @param[out] result Stores the result
+/// @param[in] operand1 Vector of elements to add. Each element must be less
+/// than the modulus
+/// @param[in] operand2 Vector of elements to add. Each element must be less
+/// than the modulus
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus q < 2^126 with which to perform the addition
+/// @details Computes \f$ result[i] = (operand1[i] + operand2[i]) \mod q \f$
+/// for \f$ i=0, ..., n-1\f$.
+void EltwiseAddModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                             const DoubleWord* operand2, uint64_t n,
+                             const DoubleWordModulus& modulus);
+
+/// @brief Subtracts two vectors elementwise modulo a double-word modulus
+/// @param[out] result Stores the result
+/// @param[in] operand1 Vector of elements to subtract from. Each element must
+/// be less than the modulus
+/// @param[in] operand2 Vector of elements to subtract. Each element must be
+/// less than the modulus
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus q < 2^126 with which to perform the subtraction
+/// @details Computes \f$ result[i] = (operand1[i] - operand2[i]) \mod q \f$
+/// for \f$ i=0, ..., n-1\f$.
+void EltwiseSubModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                             const DoubleWord* operand2, uint64_t n,
+                             const DoubleWordModulus& modulus);
+
+/// @brief Multiplies two vectors elementwise modulo a double-word modulus
+/// @param[out] result Stores the result
+/// @param[in] operand1 Vector of elements to multiply. Each element must be
+/// less than the modulus
+/// @param[in] operand2 Vector of elements to multiply. Each element must be
+/// less than the modulus
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus q < 2^126 with which to perform the
+/// multiplication
+/// @details Computes \f$ result[i] = (operand1[i] * operand2[i]) \mod q \f$
+/// for \f$ i=0, ..., n-1\f$. The native implementation forms the 256-bit
+/// products from 64-bit words and applies Barrett reduction; the AVX512-IFMA
+/// implementation applies Montgomery multiplication to three 52-bit limbs.
+void EltwiseMultModDoubleWord(DoubleWord* result, const DoubleWord* operand1,
+                              const DoubleWord* operand2, uint64_t n,
+                              const DoubleWordModulus& modulus);
+
+}  // namespace hexl
+}  // namespace intel
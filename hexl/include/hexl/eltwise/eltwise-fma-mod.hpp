@@ -23,5 +23,39 @@ void EltwiseFMAMod(uint64_t* result, const uint64_t* arg1, uint64_t arg2,
                    const uint64_t* arg3, uint64_t n, uint64_t modulus,
                    uint64_t input_mod_factor);
 
+/// @brief Computes fused multiply-add (\p arg1 * \p arg2 + \p arg3) mod \p
+/// modulus element-wise on 32-bit elements, broadcasting scalars to vectors.
+/// @param[out] result Stores the result
+/// @param[in] arg1 Vector to multiply
+/// @param[in] arg2 Scalar to multiply
+/// @param[in] arg3 Vector to add. Will not add if \p arg3 == nullptr
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// in the range \f$ [2, 2^{31} - 1]\f$
+/// @param[in] input_mod_factor Assumes input elements are in [0,
+/// input_mod_factor * modulus). Must be 1, 2, 4, or 8, with input_mod_factor *
+/// modulus at most 2^32.
+void EltwiseFMAMod(uint32_t* result, const uint32_t* arg1, uint32_t arg2,
+                   const uint32_t* arg3, uint64_t n, uint64_t modulus,
+                   uint64_t input_mod_factor);
+
+/// @brief Computes fused multiply-add (\p arg1 * \p arg2 + \p arg3) mod \p
+/// modulus element-wise on elements in Montgomery form, broadcasting scalars
+/// to vectors.
+/// @param[out] result Stores the result, in Montgomery form
+/// @param[in] arg1 Vector to multiply, in Montgomery form
+/// @param[in] arg2 Scalar to multiply, in Montgomery form
+/// @param[in] arg3 Vector to add, in Montgomery form. Will not add if \p arg3
+/// == nullptr
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// odd and less than 2^61.
+/// @details Elements must be less than \p modulus. Computes \p result[i] =
+/// (\p arg1[i] * \p arg2 * 2^{-64} + \p arg3[i]) mod \p modulus for i=0,
+/// ..., \p n - 1. See EltwiseMultModMontgomery.
+void EltwiseFMAModMontgomery(uint64_t* result, const uint64_t* arg1,
+                             uint64_t arg2, const uint64_t* arg3, uint64_t n,
+                             uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
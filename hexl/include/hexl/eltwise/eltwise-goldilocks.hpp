@@ -0,0 +1,68 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Adds two vectors elementwise modulo the Goldilocks prime
+/// kGoldilocksModulus = 2^64 - 2^32 + 1
+/// @param[out] result Stores the result
+/// @param[in] operand1 Vector of elements to add. Each element must be less
+/// than kGoldilocksModulus
+/// @param[in] operand2 Vector of elements to add. Each element must be less
+/// than kGoldilocksModulus
+/// @param[in] n Number of elements in each vector
+/// @details Computes \f$ result[i] = (operand1[i] + operand2[i]) \mod p \f$
+/// for \f$ i=0, ..., n-1\f$.
+void EltwiseAddModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n);
+
+/// @brief Subtracts two vectors elementwise modulo the Goldilocks prime
+/// kGoldilocksModulus = 2^64 - 2^32 + 1
+/// @param[out] result Stores the result
+/// @param[in] operand1 Vector of elements to subtract from. Each element must
+/// be less than kGoldilocksModulus
+/// @param[in] operand2 Vector of elements to subtract. Each element must be
+/// less than kGoldilocksModulus
+/// @param[in] n Number of elements in each vector
+/// @details Computes \f$ result[i] = (operand1[i] - operand2[i]) \mod p \f$
+/// for \f$ i=0, ..., n-1\f$.
+void EltwiseSubModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                             const uint64_t* operand2, uint64_t n);
+
+/// @brief Multiplies two vectors elementwise modulo the Goldilocks prime
+/// kGoldilocksModulus = 2^64 - 2^32 + 1
+/// @param[out] result Stores the result, with each element less than
+/// kGoldilocksModulus
+/// @param[in] operand1 Vector of elements to multiply. Elements may take any
+/// 64-bit value
+/// @param[in] operand2 Vector of elements to multiply. Elements may take any
+/// 64-bit value
+/// @param[in] n Number of elements in each vector
+/// @details Computes \f$ result[i] = (operand1[i] * operand2[i]) \mod p \f$
+/// for \f$ i=0, ..., n-1\f$. The 128-bit products are reduced with shifts and
+/// additions only, using \f$ 2^{64} = 2^{32} - 1 \mod p \f$, rather than with
+/// the Barrett reduction of EltwiseMultMod, which requires moduli below 2^62.
+void EltwiseMultModGoldilocks(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n);
+
+/// @brief Computes fused multiply-add modulo the Goldilocks prime
+/// kGoldilocksModulus = 2^64 - 2^32 + 1
+/// @param[out] result Stores the result
+/// @param[in] arg1 Vector to multiply. Elements may take any 64-bit value
+/// @param[in] arg2 Scalar to multiply. May take any 64-bit value
+/// @param[in] arg3 Vector to add. Elements may take any 64-bit value. Will
+/// not add any terms if arg3 == nullptr
+/// @param[in] n Number of elements in each vector
+/// @details Computes \f$ result[i] = (arg1[i] * arg2 + arg3[i]) \mod p \f$ for
+/// \f$ i=0, ..., n-1\f$. The sum is formed in 128 bits, so each element needs
+/// a single reduction.
+void EltwiseFMAModGoldilocks(uint64_t* result, const uint64_t* arg1,
+                             uint64_t arg2, const uint64_t* arg3, uint64_t n);
+
+}  // namespace hexl
+}  // namespace intel
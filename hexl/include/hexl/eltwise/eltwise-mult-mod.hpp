@@ -19,10 +19,51 @@ namespace hexl {
 /// @param[in] input_mod_factor Assumes input elements are in [0,
 /// input_mod_factor * p) Must be 1, 2 or 4.
 /// @details Computes \p result[i] = (\p operand1[i] * \p operand2[i]) mod \p
-/// modulus for i=0, ..., \p n - 1
+/// modulus for i=0, ..., \p n - 1. On AVX512DQ hardware, moduli of the form
+/// 2^k - 2^m + 1 (see SpecialFormModulus) too large for the floating-point and
+/// IFMA kernels are reduced by shift-and-add folding. Scalar folding is slower
+/// than Barrett reduction, so other hardware and EltwiseFMAMod do not
+/// special-case these moduli.
 void EltwiseMultMod(uint64_t* result, const uint64_t* operand1,
                     const uint64_t* operand2, uint64_t n, uint64_t modulus,
                     uint64_t input_mod_factor);
 
+/// @brief Multiplies two vectors of 32-bit elements elementwise with modular
+/// reduction
+/// @param[in] result Result of element-wise multiplication
+/// @param[in] operand1 Vector of elements to multiply. Each element must be
+/// less than input_mod_factor * modulus.
+/// @param[in] operand2 Vector of elements to multiply. Each element must be
+/// less than input_mod_factor * modulus.
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// in the range \f$[2, 2^{31} - 1]\f$
+/// @param[in] input_mod_factor Assumes input elements are in [0,
+/// input_mod_factor * p) Must be 1, 2 or 4, with input_mod_factor * modulus
+/// at most 2^32.
+/// @details Computes \p result[i] = (\p operand1[i] * \p operand2[i]) mod \p
+/// modulus for i=0, ..., \p n - 1
+void EltwiseMultMod(uint32_t* result, const uint32_t* operand1,
+                    const uint32_t* operand2, uint64_t n, uint64_t modulus,
+                    uint64_t input_mod_factor);
+
+/// @brief Multiplies two vectors of elements in Montgomery form elementwise
+/// @param[in] result Result of element-wise multiplication, in Montgomery form
+/// @param[in] operand1 Vector of elements to multiply, in Montgomery form. Each
+/// element must be less than the modulus.
+/// @param[in] operand2 Vector of elements to multiply, in Montgomery form. Each
+/// element must be less than the modulus.
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// odd and less than 2^62.
+/// @details Computes \p result[i] = (\p operand1[i] * \p operand2[i] *
+/// 2^{-64}) mod \p modulus for i=0, ..., \p n - 1. Where x * 2^64 mod
+/// modulus is the Montgomery form of x, the result is the Montgomery form of
+/// the product, so chains of products need no Barrett factors. See
+/// EltwiseToMontgomery and EltwiseFromMontgomery.
+void EltwiseMultModMontgomery(uint64_t* result, const uint64_t* operand1,
+                              const uint64_t* operand2, uint64_t n,
+                              uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
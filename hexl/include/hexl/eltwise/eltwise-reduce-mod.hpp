@@ -25,5 +25,49 @@ void EltwiseReduceMod(uint64_t* result, const uint64_t* operand, uint64_t n,
                       uint64_t modulus, uint64_t input_mod_factor,
                       uint64_t output_mod_factor);
 
+/// @brief Performs elementwise modular reduction on 32-bit elements
+/// @param[out] result Stores the result
+/// @param[in] operand Data on which to compute the elementwise modular
+/// reduction
+/// @param[in] n Number of elements in operand
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// in the range \f$ [2, 2^{31} - 1]\f$
+/// @param[in] input_mod_factor Assumes input elements are in [0,
+/// input_mod_factor * p) Must be 0, 1, 2 or 4. input_mod_factor=0 means, no
+/// knowledge of input range. Barrett reduction will be used in this case.
+/// input_mod_factor >= output_mod_factor unless input_mod_factor == 0
+/// @param[in] output_mod_factor output elements will be in [0,
+/// output_mod_factor * modulus) Must be 1 or 2. For input_mod_factor=0,
+/// output_mod_factor will be set to 1.
+void EltwiseReduceMod(uint32_t* result, const uint32_t* operand, uint64_t n,
+                      uint64_t modulus, uint64_t input_mod_factor,
+                      uint64_t output_mod_factor);
+
+/// @brief Converts elements to Montgomery form, for use with
+/// EltwiseMultModMontgomery
+/// @param[out] result Stores the result
+/// @param[in] operand Vector of elements to convert. Each element must be less
+/// than the modulus
+/// @param[in] n Number of elements in operand
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// odd and less than 2^62.
+/// @details Computes \p result[i] = (\p operand[i] * 2^64) mod \p modulus for
+/// i=0, ..., \p n - 1
+void EltwiseToMontgomery(uint64_t* result, const uint64_t* operand,
+                         uint64_t n, uint64_t modulus);
+
+/// @brief Converts elements from Montgomery form, inverting
+/// EltwiseToMontgomery
+/// @param[out] result Stores the result
+/// @param[in] operand Vector of elements in Montgomery form. Each element must
+/// be less than the modulus
+/// @param[in] n Number of elements in operand
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// odd and less than 2^62.
+/// @details Computes \p result[i] = (\p operand[i] * 2^{-64}) mod \p modulus
+/// for i=0, ..., \p n - 1
+void EltwiseFromMontgomery(uint64_t* result, const uint64_t* operand,
+                           uint64_t n, uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
@@ -36,5 +36,34 @@ void EltwiseSubMod(uint64_t* result, const uint64_t* operand1,
 void EltwiseSubMod(uint64_t* result, const uint64_t* operand1,
                    uint64_t operand2, uint64_t n, uint64_t modulus);
 
+/// @brief Subtracts two vectors of 32-bit elements elementwise with modular
+/// reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to subtract from. Each element must
+/// be less than the modulus
+/// @param[in] operand2 Vector of elements to subtract. Each element must be
+/// less than the modulus
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// in the range \f$[2, 2^{31} - 1]\f$
+/// @details Computes \f$ operand1[i] = (operand1[i] - operand2[i]) \mod modulus
+/// \f$ for \f$ i=0, ..., n-1\f$.
+void EltwiseSubMod(uint32_t* result, const uint32_t* operand1,
+                   const uint32_t* operand2, uint64_t n, uint64_t modulus);
+
+/// @brief Subtracts a scalar from a vector of 32-bit elements elementwise
+/// with modular reduction
+/// @param[out] result Stores result
+/// @param[in] operand1 Vector of elements to subtract from. Each element must
+/// be less than the modulus
+/// @param[in] operand2 Scalar to subtract. Must be less than the modulus
+/// @param[in] n Number of elements in each vector
+/// @param[in] modulus Modulus with which to perform modular reduction. Must be
+/// in the range \f$[2, 2^{31} - 1]\f$
+/// @details Computes \f$ operand1[i] = (operand1[i] - operand2) \mod modulus
+/// \f$ for \f$ i=0, ..., n-1\f$.
+void EltwiseSubMod(uint32_t* result, const uint32_t* operand1,
+                   uint32_t operand2, uint64_t n, uint64_t modulus);
+
 }  // namespace hexl
 }  // namespace intel
@@ -6,12 +6,19 @@
 #include "hexl/eltwise/eltwise-add-mod.hpp"
 #include "hexl/eltwise/eltwise-cmp-add.hpp"
 #include "hexl/eltwise/eltwise-cmp-sub-mod.hpp"
+#include "hexl/eltwise/eltwise-double-word.hpp"
 #include "hexl/eltwise/eltwise-fma-mod.hpp"
+#include "hexl/eltwise/eltwise-goldilocks.hpp"
 #include "hexl/eltwise/eltwise-mult-mod.hpp"
 #include "hexl/eltwise/eltwise-reduce-mod.hpp"
 #include "hexl/eltwise/eltwise-sub-mod.hpp"
 #include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
+#include "hexl/ntt/double-word-ntt.hpp"
+#include "hexl/ntt/goldilocks-ntt.hpp"
 #include "hexl/ntt/ntt.hpp"
+#include "hexl/ntt/rns-ntt.hpp"
+#include "hexl/number-theory/double-word.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "hexl/util/check.hpp"
 #include "hexl/util/compiler.hpp"
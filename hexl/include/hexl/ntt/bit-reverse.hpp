@@ -0,0 +1,36 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Permutes a vector into bit-reversed order
+/// @param[out] result Stores the result
+/// @param[in] operand Vector to permute
+/// @param[in] n Number of elements in \p operand. Must be a power of two
+/// @details Computes result[ReverseBits(i, log2(n))] = operand[i] for all
+/// \f$i=0, ..., n-1\f$. The permutation is its own inverse, so it also
+/// converts from bit-reversed to natural order. \p result may equal \p
+/// operand; otherwise the two must not overlap.
+void BitReversePermute(uint64_t* result, const uint64_t* operand, uint64_t n);
+
+/// @brief Permutes a vector into bit-reversed order in-place
+/// @param[in, out] operand Vector to permute. Overwritten with the result
+/// @param[in] n Number of elements in \p operand. Must be a power of two
+void BitReversePermuteInPlace(uint64_t* operand, uint64_t n);
+
+/// @brief Permutes a vector of 32-bit elements into bit-reversed order
+/// @details See the 64-bit overload. \p result may equal \p operand;
+/// otherwise the two must not overlap.
+void BitReversePermute(uint32_t* result, const uint32_t* operand, uint64_t n);
+
+/// @brief Permutes a vector of 32-bit elements into bit-reversed order
+/// in-place
+void BitReversePermuteInPlace(uint32_t* operand, uint64_t n);
+
+}  // namespace hexl
+}  // namespace intel
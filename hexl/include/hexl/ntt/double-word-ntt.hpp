@@ -0,0 +1,119 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+#include "hexl/util/allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Performs negacyclic forward and inverse number-theoretic transforms
+/// modulo a double-word prime q < 2^126
+/// @details The NTT class requires moduli below 2^62. DoubleWordNTT supports
+/// primes of up to 125 bits, so fewer RNS limbs cover a given ciphertext
+/// modulus. Every value stays in [0, q). The native butterflies multiply by
+/// twiddle factors in Montgomery form with R = 2^128; the AVX512-IFMA
+/// butterflies hold each value in three 52-bit limbs and use R = 2^156.
+class DoubleWordNTT {
+ public:
+  /// @brief Initializes an empty DoubleWordNTT object
+  DoubleWordNTT() = default;
+
+  /// @brief Initializes a DoubleWordNTT object with degree \p degree and
+  /// modulus \p q
+  /// @param[in] degree also known as N. Size of the NTT transform. Must be a
+  /// power of 2
+  /// @param[in] q Prime modulus. Must satisfy q == 1 mod 2N and q < 2^126
+  /// @param[in] alloc_ptr Custom memory allocator used for the root of unity
+  /// tables
+  /// @details Uses the primitive 2N'th root of unity returned by
+  /// GeneratePrimitiveRootDoubleWord
+  DoubleWordNTT(uint64_t degree, DoubleWord q,
+                std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Initializes a DoubleWordNTT object with degree \p degree and
+  /// modulus \p q
+  /// @param[in] degree also known as N. Size of the NTT transform. Must be a
+  /// power of 2
+  /// @param[in] q Prime modulus. Must satisfy q == 1 mod 2N and q < 2^126
+  /// @param[in] root_of_unity 2N'th root of unity in \f$ \mathbb{Z_q} \f$
+  /// @param[in] alloc_ptr Custom memory allocator used for the root of unity
+  /// tables
+  DoubleWordNTT(uint64_t degree, DoubleWord q, DoubleWord root_of_unity,
+                std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Compute forward NTT. Results are bit-reversed by default.
+  /// @param[out] result Stores the result
+  /// @param[in] operand Data on which to compute the NTT. Each element must be
+  /// less than q
+  /// @param[in] output_order Order of the evaluations in \p result
+  /// @details \p result may equal \p operand; otherwise the two must not
+  /// overlap. Results are less than q.
+  void ComputeForward(
+      DoubleWord* result, const DoubleWord* operand,
+      NTT::Ordering output_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Compute inverse NTT. Inputs are bit-reversed by default.
+  /// @param[out] result Stores the result
+  /// @param[in] operand Data on which to compute the NTT. Each element must be
+  /// less than q
+  /// @param[in] input_order Order of the evaluations in \p operand
+  /// @details \p result may equal \p operand; otherwise the two must not
+  /// overlap. Results are less than q.
+  void ComputeInverse(DoubleWord* result, const DoubleWord* operand,
+                      NTT::Ordering input_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Returns the degree N
+  uint64_t GetDegree() const { return m_degree; }
+
+  /// @brief Returns the modulus q
+  DoubleWord GetModulus() const { return m_modulus.Modulus(); }
+
+  /// @brief Returns the primitive 2N'th root of unity
+  DoubleWord GetMinimalRootOfUnity() const { return m_w; }
+
+  /// @brief Returns the root of unity powers in bit-reversed order and
+  /// Montgomery form, w^j * 2^128 mod q. Entry m + i is the twiddle factor of
+  /// group i in the stage with m groups.
+  const AlignedVector64<DoubleWord>& GetRootOfUnityPowers() const {
+    return m_root_of_unity_powers;
+  }
+
+  /// @brief Returns the inverses of the root of unity powers, in the form of
+  /// GetRootOfUnityPowers()
+  const AlignedVector64<DoubleWord>& GetInvRootOfUnityPowers() const {
+    return m_inv_root_of_unity_powers;
+  }
+
+ private:
+  void ComputeRootOfUnityPowers();
+
+  uint64_t m_degree{0};  // N: size of NTT transform, should be power of 2
+  DoubleWordModulus m_modulus;
+  DoubleWord m_w{0, 0};           // primitive 2N'th root of unity
+  DoubleWord m_inv_degree{0, 0};  // N^{-1} * 2^128 mod q
+
+  std::shared_ptr<AllocatorBase> m_alloc;
+  AlignedAllocator<DoubleWord, 64> m_aligned_alloc;
+  AlignedAllocator<uint64_t, 64> m_aligned_limb_alloc;
+
+  AlignedVector64<DoubleWord> m_root_of_unity_powers;
+  AlignedVector64<DoubleWord> m_inv_root_of_unity_powers;
+
+  // The same twiddle factors as w^j * 2^156 mod q, split into three planes of
+  // 52-bit limbs for the AVX512-IFMA transforms
+  AlignedVector64<uint64_t> m_avx512_root_of_unity_powers;
+  AlignedVector64<uint64_t> m_avx512_inv_root_of_unity_powers;
+  DoubleWord m_avx512_inv_degree{0, 0};  // N^{-1} * 2^156 mod q
+};
+
+}  // namespace hexl
+}  // namespace intel
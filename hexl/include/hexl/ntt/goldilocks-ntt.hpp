@@ -0,0 +1,101 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+#include "hexl/util/allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Performs forward and inverse number-theoretic transforms over the
+/// Goldilocks field \f$ \mathbb{Z}_p \f$, \f$ p = 2^{64} - 2^{32} + 1 \f$
+/// @details The NTT class requires moduli below 2^62, since its butterflies
+/// keep values in [0, 4q). GoldilocksNTT instead keeps every value in [0, p)
+/// and reduces each product with shifts and additions only, using \f$ 2^{64}
+/// = 2^{32} - 1 \mod p \f$. The multiplicative group of \f$ \mathbb{Z}_p \f$
+/// has order divisible by 2^32, so negacyclic transforms support degrees up to
+/// 2^31 and cyclic transforms up to 2^32.
+class GoldilocksNTT {
+ public:
+  /// @brief Initializes an empty GoldilocksNTT object
+  GoldilocksNTT() = default;
+
+  /// @brief Initializes a GoldilocksNTT object with degree \p degree
+  /// @param[in] degree also known as N. Size of the NTT transform. Must be a
+  /// power of 2
+  /// @param[in] mode Polynomial ring of the transform. Must be
+  /// NTT::Mode::kNegacyclic or NTT::Mode::kCyclic
+  /// @param[in] alloc_ptr Custom memory allocator used for the root of unity
+  /// tables
+  /// @details Uses the primitive roots of unity generated by 7, the minimal
+  /// generator of the multiplicative group of \f$ \mathbb{Z}_p \f$
+  GoldilocksNTT(uint64_t degree, NTT::Mode mode = NTT::Mode::kNegacyclic,
+                std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Compute forward NTT. Results are bit-reversed by default.
+  /// @param[out] result Stores the result
+  /// @param[in] operand Data on which to compute the NTT. Each element must be
+  /// less than kGoldilocksModulus
+  /// @param[in] output_order Order of the evaluations in \p result
+  /// @details \p result may equal \p operand; otherwise the two must not
+  /// overlap. Results are less than kGoldilocksModulus.
+  void ComputeForward(
+      uint64_t* result, const uint64_t* operand,
+      NTT::Ordering output_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Compute inverse NTT. Inputs are bit-reversed by default.
+  /// @param[out] result Stores the result
+  /// @param[in] operand Data on which to compute the NTT. Each element must be
+  /// less than kGoldilocksModulus
+  /// @param[in] input_order Order of the evaluations in \p operand
+  /// @details \p result may equal \p operand; otherwise the two must not
+  /// overlap. Results are less than kGoldilocksModulus.
+  void ComputeInverse(uint64_t* result, const uint64_t* operand,
+                      NTT::Ordering input_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Returns the degree N
+  uint64_t GetDegree() const { return m_degree; }
+
+  /// @brief Returns the mode of the transform
+  NTT::Mode GetMode() const { return m_mode; }
+
+  /// @brief Returns the primitive N'th root of unity of the cyclic transform
+  /// or the primitive 2N'th root of unity of the negacyclic transform
+  uint64_t GetRootOfUnity() const { return m_root_of_unity; }
+
+  /// @brief Returns the root of unity powers in bit-reversed order. Entry m +
+  /// i is the twiddle factor of group i in the stage with m groups.
+  const AlignedVector64<uint64_t>& GetRootOfUnityPowers() const {
+    return m_root_of_unity_powers;
+  }
+
+  /// @brief Returns the inverses of GetRootOfUnityPowers()
+  const AlignedVector64<uint64_t>& GetInvRootOfUnityPowers() const {
+    return m_inv_root_of_unity_powers;
+  }
+
+  /// @brief Generator of the multiplicative group of \f$ \mathbb{Z}_p \f$
+  static const uint64_t s_generator{7};
+
+ private:
+  uint64_t m_degree{0};  // N: size of NTT transform, should be power of 2
+  NTT::Mode m_mode{NTT::Mode::kNegacyclic};
+  uint64_t m_root_of_unity{0};
+  uint64_t m_inv_degree{0};  // N^{-1} mod p
+
+  std::shared_ptr<AllocatorBase> m_alloc;
+  AlignedAllocator<uint64_t, 64> m_aligned_alloc;
+
+  AlignedVector64<uint64_t> m_root_of_unity_powers;
+  AlignedVector64<uint64_t> m_inv_root_of_unity_powers;
+};
+
+}  // namespace hexl
+}  // namespace intel
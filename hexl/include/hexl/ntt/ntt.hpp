@@ -5,7 +5,9 @@
 
 #include <stdint.h>
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "hexl/util/aligned-allocator.hpp"
@@ -14,13 +16,25 @@
 namespace intel {
 namespace hexl {
 
+class ThreadPool;
+class NTTTables;
+
 /// @brief Performs negacyclic forward and inverse number-theoretic transform
 /// (NTT), commonly used in RLWE cryptography.
 /// @details The number-theoretic transform (NTT) specializes the discrete
 /// Fourier transform (DFT) to the finite field \f$ \mathbb{Z}_q[X] / (X^N + 1)
-/// \f$.
+/// \f$. Cyclic and twisted transforms are created with CreateCyclic and
+/// CreateTwisted.
 class NTT {
  public:
+  /// @brief Polynomial ring whose multiplication the transform diagonalizes
+  enum class Mode {
+    kNegacyclic,  ///< \f$ \mathbb{Z}_q[X] / (X^N + 1) \f$
+    kCyclic,      ///< \f$ \mathbb{Z}_q[X] / (X^N - 1) \f$
+    kTwisted      ///< \f$ \mathbb{Z}_q[X] / (X^N - \zeta^N) \f$ for a twist
+                  ///< \f$ \zeta \f$
+  };
+
   /// @brief Helper class for custom memory allocation
   template <class Adaptee, class... Args>
   struct AllocatorAdapter
@@ -83,29 +97,313 @@ class NTT {
                 std::make_shared<AllocatorAdapter<Allocator, AllocatorArgs...>>(
                     std::move(a), std::forward<AllocatorArgs>(args)...))) {}
 
-  /// @brief Compute forward NTT. Results are bit-reversed.
+  /// @brief Returns an NTT object computing cyclic transforms, i.e.
+  /// evaluations at the powers of a primitive N'th root of unity
+  /// @param[in] degree also known as N. Size of the NTT transform. Must be a
+  /// power of 2
+  /// @param[in] q Prime modulus. Must satisfy \f$ q == 1 \mod N \f$
+  /// @param[in] alloc_ptr Custom memory allocator used for intermediate
+  /// calculations
+  /// @details Uses the minimal primitive N'th root of unity
+  static NTT CreateCyclic(uint64_t degree, uint64_t q,
+                          std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Returns an NTT object computing cyclic transforms with the
+  /// primitive N'th root of unity \p root_of_unity
+  static NTT CreateCyclic(uint64_t degree, uint64_t q, uint64_t root_of_unity,
+                          std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Returns an NTT object computing twisted transforms, i.e.
+  /// evaluations at \p twist times the powers of a primitive N'th root of
+  /// unity
+  /// @param[in] degree also known as N. Size of the NTT transform. Must be a
+  /// power of 2
+  /// @param[in] q Prime modulus. Must satisfy \f$ q == 1 \mod N \f$
+  /// @param[in] twist Non-zero element \f$ \zeta \f$ of \f$ \mathbb{Z}_q
+  /// \f$. The forward transform of a(X) is the cyclic transform of a(\f$
+  /// \zeta \f$ X); multiplying by the powers of \f$ \zeta \f$ is merged into
+  /// the butterflies, so it costs nothing extra.
+  /// @param[in] alloc_ptr Custom memory allocator used for intermediate
+  /// calculations
+  /// @details Uses the minimal primitive N'th root of unity
+  static NTT CreateTwisted(uint64_t degree, uint64_t q, uint64_t twist,
+                           std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Returns an NTT object computing twisted transforms with twist \p
+  /// twist and primitive N'th root of unity \p root_of_unity
+  static NTT CreateTwisted(uint64_t degree, uint64_t q, uint64_t twist,
+                           uint64_t root_of_unity,
+                           std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Order of the evaluations of a polynomial in the NTT domain
+  enum class Ordering {
+    kBitReversed,  ///< Evaluation i is stored at index ReverseBits(i, log2(N))
+    kNatural       ///< Evaluation i is stored at index i
+  };
+
+  /// @brief Compute forward NTT. Results are bit-reversed by default.
   /// @param[out] result Stores the result
   /// @param[in] operand Data on which to compute the NTT
   /// @param[in] input_mod_factor Assume input \p operand are in [0,
   /// input_mod_factor * q). Must be 1, 2 or 4.
   /// @param[in] output_mod_factor Returns output \p result in [0,
   /// output_mod_factor * q). Must be 1 or 4.
+  /// @param[in] output_order Order of the evaluations in \p result. Natural
+  /// order costs an extra BitReversePermute pass.
+  /// @details The transform is linear, so the NTT of coefficients in
+  /// Montgomery form is the Montgomery form of the NTT; see
+  /// EltwiseMultModMontgomery. The same holds for ComputeInverse.
   void ComputeForward(uint64_t* result, const uint64_t* operand,
-                      uint64_t input_mod_factor, uint64_t output_mod_factor);
+                      uint64_t input_mod_factor, uint64_t output_mod_factor,
+                      Ordering output_order = Ordering::kBitReversed);
 
-  /// Compute inverse NTT. Results are bit-reversed.
+  /// Compute inverse NTT. Inputs are bit-reversed by default.
   /// @param[out] result Stores the result
   /// @param[in] operand Data on which to compute the NTT
   /// @param[in] input_mod_factor Assume input \p operand are in [0,
   /// input_mod_factor * q). Must be 1 or 2.
   /// @param[in] output_mod_factor Returns output \p result in [0,
   /// output_mod_factor * q). Must be 1 or 2.
+  /// @param[in] input_order Order of the evaluations in \p operand. Natural
+  /// order costs an extra BitReversePermute pass.
   void ComputeInverse(uint64_t* result, const uint64_t* operand,
-                      uint64_t input_mod_factor, uint64_t output_mod_factor);
+                      uint64_t input_mod_factor, uint64_t output_mod_factor,
+                      Ordering input_order = Ordering::kBitReversed);
+
+  /// @brief Computes the forward NTT of 32-bit coefficients. Results are
+  /// bit-reversed by default.
+  /// @details Same as the 64-bit overload, but requires q <
+  /// s_max_fwd_32_modulus, so values in [0, 4q) fit in 32 bits. Uses separate
+  /// 32-bit root of unity tables, and the AVX512 implementation processes 16
+  /// coefficients per vector.
+  void ComputeForward(uint32_t* result, const uint32_t* operand,
+                      uint64_t input_mod_factor, uint64_t output_mod_factor,
+                      Ordering output_order = Ordering::kBitReversed);
+
+  /// @brief Computes the inverse NTT of 32-bit coefficients. Inputs are
+  /// bit-reversed by default.
+  /// @details Same as the 64-bit overload, but requires q <
+  /// s_max_fwd_32_modulus
+  void ComputeInverse(uint32_t* result, const uint32_t* operand,
+                      uint64_t input_mod_factor, uint64_t output_mod_factor,
+                      Ordering input_order = Ordering::kBitReversed);
+
+  /// @brief Computes the forward NTT of \p batch_size polynomials stored
+  /// column-wise, i.e. with coefficient i of polynomial j at index i * \p
+  /// stride + j. Results are bit-reversed by default.
+  /// @param[out] result Stores the evaluations in the same layout. May equal
+  /// \p operand; otherwise must not overlap it.
+  /// @param[in] operand Coefficients on which to compute the NTT
+  /// @param[in] batch_size Number of polynomials, at least 1
+  /// @param[in] stride Distance between consecutive coefficients of a
+  /// polynomial, at least \p batch_size
+  /// @param[in] input_mod_factor Assume input \p operand are in [0,
+  /// input_mod_factor * q). Must be 1, 2 or 4.
+  /// @param[in] output_mod_factor Returns output \p result in [0,
+  /// output_mod_factor * q). Must be 1 or 4.
+  /// @param[in] output_order Order of the evaluations along the rows of \p
+  /// result
+  /// @details Computes the same result as ComputeForward on each column,
+  /// without transposing. Each butterfly combines two rows with a single root
+  /// of unity, so the AVX512 implementation transforms 8 polynomials per
+  /// vector with one broadcast root.
+  void ComputeForwardStrided(uint64_t* result, const uint64_t* operand,
+                             uint64_t batch_size, uint64_t stride,
+                             uint64_t input_mod_factor,
+                             uint64_t output_mod_factor,
+                             Ordering output_order = Ordering::kBitReversed);
+
+  /// @brief Computes the inverse NTT of \p batch_size polynomials stored
+  /// column-wise, see ComputeForwardStrided. Inputs are bit-reversed by
+  /// default.
+  /// @param[out] result Stores the coefficients in the same layout. May equal
+  /// \p operand; otherwise must not overlap it.
+  /// @param[in] operand Evaluations on which to compute the inverse NTT
+  /// @param[in] batch_size Number of polynomials, at least 1
+  /// @param[in] stride Distance between consecutive evaluations of a
+  /// polynomial, at least \p batch_size
+  /// @param[in] input_mod_factor Assume input \p operand are in [0,
+  /// input_mod_factor * q). Must be 1 or 2.
+  /// @param[in] output_mod_factor Returns output \p result in [0,
+  /// output_mod_factor * q). Must be 1 or 2.
+  /// @param[in] input_order Order of the evaluations along the rows of \p
+  /// operand
+  void ComputeInverseStrided(uint64_t* result, const uint64_t* operand,
+                             uint64_t batch_size, uint64_t stride,
+                             uint64_t input_mod_factor,
+                             uint64_t output_mod_factor,
+                             Ordering input_order = Ordering::kBitReversed);
+
+  /// @brief Computes the forward NTT of \p batch_size polynomials stored
+  /// contiguously, i.e. with coefficient i of polynomial j at index j * N + i.
+  /// Results are bit-reversed by default.
+  /// @param[out] result Stores the evaluations in the same layout. May equal
+  /// \p operand; otherwise must not overlap it.
+  /// @param[in] operand Coefficients on which to compute the NTT
+  /// @param[in] batch_size Number of polynomials, at least 1
+  /// @param[in] input_mod_factor Assume input \p operand are in [0,
+  /// input_mod_factor * q). Must be 1, 2 or 4.
+  /// @param[in] output_mod_factor Returns output \p result in [0,
+  /// output_mod_factor * q). Must be 1 or 4.
+  /// @param[in] output_order Order of the evaluations of each polynomial
+  /// @details Computes the same result as ComputeForward on each polynomial,
+  /// with the argument checks done once per batch. For N <= 16, the AVX512
+  /// implementation transforms 8 polynomials at a time with one polynomial
+  /// per lane, which avoids the per-call overhead that dominates single small
+  /// transforms.
+  void ComputeForwardBatch(uint64_t* result, const uint64_t* operand,
+                           uint64_t batch_size, uint64_t input_mod_factor,
+                           uint64_t output_mod_factor,
+                           Ordering output_order = Ordering::kBitReversed);
+
+  /// @brief Computes the inverse NTT of \p batch_size polynomials stored
+  /// contiguously, see ComputeForwardBatch. Inputs are bit-reversed by
+  /// default.
+  /// @param[out] result Stores the coefficients in the same layout. May equal
+  /// \p operand; otherwise must not overlap it.
+  /// @param[in] operand Evaluations on which to compute the inverse NTT
+  /// @param[in] batch_size Number of polynomials, at least 1
+  /// @param[in] input_mod_factor Assume input \p operand are in [0,
+  /// input_mod_factor * q). Must be 1 or 2.
+  /// @param[in] output_mod_factor Returns output \p result in [0,
+  /// output_mod_factor * q). Must be 1 or 2.
+  /// @param[in] input_order Order of the evaluations of each polynomial
+  void ComputeInverseBatch(uint64_t* result, const uint64_t* operand,
+                           uint64_t batch_size, uint64_t input_mod_factor,
+                           uint64_t output_mod_factor,
+                           Ordering input_order = Ordering::kBitReversed);
+
+  /// @brief Multiplies two polynomials in the ring of the transform, i.e.
+  /// modulo \f$ X^N + 1 \f$ for negacyclic transforms, \f$ X^N - 1 \f$ for
+  /// cyclic transforms and \f$ X^N - \zeta^N \f$ for twisted transforms with
+  /// twist \f$ \zeta \f$.
+  /// @param[out] result Stores the product, in [0, q). May alias either
+  /// operand.
+  /// @param[in] operand1 Coefficients of the first polynomial, in [0, q)
+  /// @param[in] operand2 Coefficients of the second polynomial, in [0, q)
+  /// @details Computes the same result as ComputeForward on both operands,
+  /// EltwiseMultMod and ComputeInverse. On AVX512, the transform is split
+  /// into cache-sized blocks, and the last forward stages, the dyadic product
+  /// and the first inverse stages of each block run back to back while the
+  /// block is in the L1 cache. Intermediate values stay in [0, 4q).
+  void PolyMulMod(uint64_t* result, const uint64_t* operand1,
+                  const uint64_t* operand2);
+
+  /// @brief Multiplies two polynomials in the ring of the transform, with the
+  /// second polynomial given in the NTT domain
+  /// @param[out] result Stores the product, in [0, q). May alias either
+  /// operand.
+  /// @param[in] operand1 Coefficients of the first polynomial, in [0, q)
+  /// @param[in] operand2_ntt Forward transform of the second polynomial,
+  /// in bit-reversed order and in [0, q), as returned by ComputeForward with
+  /// output_mod_factor 1
+  /// @details Saves one forward transform over PolyMulMod when the same
+  /// polynomial is multiplied many times.
+  void PolyMulModNTT(uint64_t* result, const uint64_t* operand1,
+                     const uint64_t* operand2_ntt);
+
+  /// @brief Sets the number of threads used by the forward and inverse
+  /// transforms
+  /// @param[in] num_threads Number of threads, including the calling thread.
+  /// The default of 1 runs the transforms on the calling thread.
+  /// @details Multi-threading applies to the AVX512 transforms with degree at
+  /// least s_min_parallel_degree. The transform is split into P independent
+  /// parts, where P is the largest power of two at most \p num_threads.
+  void SetNumThreads(size_t num_threads);
+
+  /// @brief Returns the number of threads used by the forward and inverse
+  /// transforms
+  size_t GetNumThreads() const;
+
+  /// @brief Sets the radix of the native transforms, which run when no AVX512
+  /// or AVX2 transform applies
+  /// @param[in] radix 2, 4 or 8. Radix 2^k computes k stages per pass over the
+  /// data, keeping the intermediate values in registers.
+  void SetNativeRadix(size_t radix);
+
+  /// @brief Returns the radix of the native transforms
+  size_t GetNativeRadix() const { return m_native_radix; }
+
+  /// @brief Sets the size below which the AVX512 transforms switch from
+  /// depth-first recursion to breadth-first stages
+  /// @param[in] base_ntt_size Power of two, at least 16. Larger sizes make
+  /// fewer recursive calls, smaller sizes keep each breadth-first transform in
+  /// a smaller cache level.
+  void SetBaseNTTSize(size_t base_ntt_size);
+
+  /// @brief Returns the size below which the AVX512 transforms run
+  /// breadth-first, see SetBaseNTTSize
+  size_t GetBaseNTTSize() const { return m_base_ntt_size; }
+
+  /// @brief Times the forward and inverse transforms for each candidate
+  /// breadth-first size and keeps the fastest, see SetBaseNTTSize
+  /// @return The selected size
+  /// @details The winner is cached per process for each degree, modulus bit
+  /// width and number of threads, so only the first call for given parameters
+  /// runs the measurements. Has no effect if the AVX512 transforms don't
+  /// apply.
+  size_t TuneBaseNTTSize();
+
+  /// @brief Statistics of the process-wide cache of pre-computed root of
+  /// unity tables
+  struct CacheStats {
+    uint64_t hits{0};          // Constructions reusing resident tables
+    uint64_t misses{0};        // Constructions computing new tables
+    size_t num_entries{0};     // Number of resident tables
+    size_t resident_bytes{0};  // Total size of the resident tables
+  };
 
-  /// @brief Returns the minimal 2N'th root of unity
+  /// @brief Returns statistics of the process-wide table cache
+  /// @details NTT objects with the same degree, modulus and root of unity
+  /// share a single copy of their pre-computed tables, so constructing or
+  /// copying an NTT with resident parameters takes O(1) time and memory.
+  /// Tables are freed once the last NTT object using them is destroyed. NTT
+  /// objects with a custom allocator don't use the cache.
+  static CacheStats GetCacheStats();
+
+  /// @brief Resets the hit and miss counters of the table cache to zero
+  static void ResetCacheStats();
+
+  /// @brief Returns the number of bytes held by each pre-computed table,
+  /// keyed by table name
+  /// @details Tables are computed on first use by the forward and inverse
+  /// transforms or the table getters. Tables which have not been computed
+  /// report 0 bytes. Tables shared with other NTT objects are counted in full.
+  std::map<std::string, size_t> GetMemoryFootprint() const;
+
+  /// @brief Writes the pre-computed tables of \p ntts to the file \p filename
+  /// @details Writes the tables read by the forward and inverse transforms
+  /// dispatched on this CPU, computing them if needed, and any other table
+  /// already computed. The remaining tables are computed on first use after
+  /// loading. The file format is versioned, see s_tables_file_version, and
+  /// uses the native byte order. Throws std::runtime_error if the file can't
+  /// be written.
+  static void SaveTables(const std::string& filename,
+                         const std::vector<NTT>& ntts);
+
+  /// @brief Returns NTT objects using the tables stored in \p filename by
+  /// SaveTables
+  /// @details On POSIX systems the file is memory-mapped read-only and the
+  /// transforms read the tables directly from the mapping, so processes
+  /// loading the same file share its physical pages through the page cache.
+  /// The loaded tables are added to the process-wide table cache, so NTT
+  /// objects constructed later with the same parameters reuse them. Throws
+  /// std::runtime_error if the file can't be read or is not a valid tables
+  /// file.
+  static std::vector<NTT> LoadTables(const std::string& filename);
+
+  /// @brief Returns the root of unity: a 2N'th root of unity for negacyclic
+  /// transforms, an N'th root of unity otherwise. Minimal unless specified on
+  /// construction.
   uint64_t GetMinimalRootOfUnity() const { return m_w; }
 
+  /// @brief Returns the polynomial ring of the transform
+  Mode GetMode() const { return m_mode; }
+
+  /// @brief Returns the twist: the root of unity for negacyclic transforms, 1
+  /// for cyclic transforms
+  uint64_t GetTwist() const { return m_twist; }
+
   /// @brief Returns the degree N
   uint64_t GetDegree() const { return m_degree; }
 
@@ -113,53 +411,37 @@ class NTT {
   uint64_t GetModulus() const { return m_q; }
 
   /// @brief Returns the root of unity powers in bit-reversed order
-  const AlignedVector64<uint64_t>& GetRootOfUnityPowers() const {
-    return m_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetRootOfUnityPowers() const;
 
   /// @brief Returns the root of unity power at bit-reversed index i.
   uint64_t GetRootOfUnityPower(size_t i) { return GetRootOfUnityPowers()[i]; }
 
   /// @brief Returns 32-bit pre-conditioned root of unity powers in
   /// bit-reversed order
-  const AlignedVector64<uint64_t>& GetPrecon32RootOfUnityPowers() const {
-    return m_precon32_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetPrecon32RootOfUnityPowers() const;
 
   /// @brief Returns 64-bit pre-conditioned root of unity powers in
   /// bit-reversed order
-  const AlignedVector64<uint64_t>& GetPrecon64RootOfUnityPowers() const {
-    return m_precon64_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetPrecon64RootOfUnityPowers() const;
 
   /// @brief Returns the root of unity powers in bit-reversed order with
   /// modifications for use by AVX512 implementation
-  const AlignedVector64<uint64_t>& GetAVX512RootOfUnityPowers() const {
-    return m_avx512_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetAVX512RootOfUnityPowers() const;
 
   /// @brief Returns 32-bit pre-conditioned AVX512 root of unity powers in
   /// bit-reversed order
-  const AlignedVector64<uint64_t>& GetAVX512Precon32RootOfUnityPowers() const {
-    return m_avx512_precon32_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetAVX512Precon32RootOfUnityPowers() const;
 
   /// @brief Returns 52-bit pre-conditioned AVX512 root of unity powers in
   /// bit-reversed order
-  const AlignedVector64<uint64_t>& GetAVX512Precon52RootOfUnityPowers() const {
-    return m_avx512_precon52_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetAVX512Precon52RootOfUnityPowers() const;
 
   /// @brief Returns 64-bit pre-conditioned AVX512 root of unity powers in
   /// bit-reversed order
-  const AlignedVector64<uint64_t>& GetAVX512Precon64RootOfUnityPowers() const {
-    return m_avx512_precon64_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetAVX512Precon64RootOfUnityPowers() const;
 
   /// @brief Returns the inverse root of unity powers in bit-reversed order
-  const AlignedVector64<uint64_t>& GetInvRootOfUnityPowers() const {
-    return m_inv_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetInvRootOfUnityPowers() const;
 
   /// @brief Returns the inverse root of unity power at bit-reversed index i.
   uint64_t GetInvRootOfUnityPower(size_t i) {
@@ -169,26 +451,42 @@ class NTT {
   /// @brief Returns the vector of 32-bit pre-conditioned pre-computed root of
   /// unity
   // powers for the modulus and root of unity.
-  const AlignedVector64<uint64_t>& GetPrecon32InvRootOfUnityPowers() const {
-    return m_precon32_inv_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetPrecon32InvRootOfUnityPowers() const;
 
   /// @brief Returns the vector of 52-bit pre-conditioned pre-computed root of
   /// unity
   // powers for the modulus and root of unity.
-  const AlignedVector64<uint64_t>& GetPrecon52InvRootOfUnityPowers() const {
-    return m_precon52_inv_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetPrecon52InvRootOfUnityPowers() const;
 
   /// @brief Returns the vector of 64-bit pre-conditioned pre-computed root of
   /// unity
   // powers for the modulus and root of unity.
-  const AlignedVector64<uint64_t>& GetPrecon64InvRootOfUnityPowers() const {
-    return m_precon64_inv_root_of_unity_powers;
-  }
+  const AlignedVector64<uint64_t>& GetPrecon64InvRootOfUnityPowers() const;
+
+  /// @brief Version of the file format written by SaveTables
+  static const uint64_t s_tables_file_version{2};
+
+  /// @brief Minimum degree for which the transforms use multiple threads
+  static const size_t s_min_parallel_degree{1ULL << 15};
+
+  /// @brief Default radix of the native transforms, see SetNativeRadix
+  static const size_t s_default_native_radix{4};
+
+  /// @brief Default size below which the AVX512 transforms run breadth-first,
+  /// see SetBaseNTTSize
+  static const size_t s_default_base_ntt_size{1024};
+
+  /// @brief Minimum degree for which the AVX512 transforms use the four-step
+  /// decomposition: column transforms, then row transforms of
+  /// s_four_step_block_size elements, so each pass fits in the L2 cache
+  static const size_t s_min_four_step_degree{1ULL << 20};
+
+  /// @brief Size of the row transforms of the four-step decomposition, see
+  /// s_min_four_step_degree
+  static const size_t s_four_step_block_size{1ULL << 16};
 
   /// @brief Maximum power of 2 in degree
-  static const size_t s_max_degree_bits{20};
+  static const size_t s_max_degree_bits{26};
 
   /// @brief Maximum number of bits in modulus;
   static const size_t s_max_modulus_bits{62};
@@ -217,45 +515,93 @@ class NTT {
   static const size_t s_max_inv_ifma_modulus{1ULL << (s_ifma_shift_bits - 1)};
 
  private:
-  void ComputeRootOfUnityPowers();
+  // Reads the root of unity tables of each row for the multi-row transforms
+  friend class RNSNTT;
+
+  NTT(Mode mode, uint64_t degree, uint64_t q, uint64_t root_of_unity,
+      uint64_t twist, std::shared_ptr<AllocatorBase> alloc_ptr);
+
+  // Computes the forward transform of operand into result, with bit-reversed
+  // output. result may equal operand; otherwise they must not overlap.
+  void ForwardToBitReverse(uint64_t* result, const uint64_t* operand,
+                           uint64_t input_mod_factor,
+                           uint64_t output_mod_factor);
+
+  // Computes the inverse transform of operand into result, with bit-reversed
+  // input. result may equal operand; otherwise they must not overlap.
+  void InverseFromBitReverse(uint64_t* result, const uint64_t* operand,
+                             uint64_t input_mod_factor,
+                             uint64_t output_mod_factor);
+
+  // 32-bit versions of ForwardToBitReverse and InverseFromBitReverse
+  void ForwardToBitReverse(uint32_t* result, const uint32_t* operand,
+                           uint64_t input_mod_factor,
+                           uint64_t output_mod_factor);
+  void InverseFromBitReverse(uint32_t* result, const uint32_t* operand,
+                             uint64_t input_mod_factor,
+                             uint64_t output_mod_factor);
+
+  // Column-wise batched versions of ForwardToBitReverse and
+  // InverseFromBitReverse, see ComputeForwardStrided
+  void ForwardToBitReverseStrided(uint64_t* result, const uint64_t* operand,
+                                  uint64_t batch_size, uint64_t stride,
+                                  uint64_t input_mod_factor,
+                                  uint64_t output_mod_factor);
+  void InverseFromBitReverseStrided(uint64_t* result, const uint64_t* operand,
+                                    uint64_t batch_size, uint64_t stride,
+                                    uint64_t input_mod_factor,
+                                    uint64_t output_mod_factor);
+
+  // Batched versions of ForwardToBitReverse and InverseFromBitReverse on
+  // contiguous polynomials, see ComputeForwardBatch
+  void ForwardToBitReverseBatch(uint64_t* result, const uint64_t* operand,
+                                uint64_t batch_size, uint64_t input_mod_factor,
+                                uint64_t output_mod_factor);
+  void InverseFromBitReverseBatch(uint64_t* result, const uint64_t* operand,
+                                  uint64_t batch_size,
+                                  uint64_t input_mod_factor,
+                                  uint64_t output_mod_factor);
+
+  // Stores in result the product of operand1 with a second polynomial, given
+  // either by its coefficients operand2 or by its forward transform
+  // operand2_ntt; the other pointer is nullptr. The forward transform of
+  // operand1 is computed in X, which may alias result or operand1, and that
+  // of operand2 in Y, which must not alias anything else. If result aliases
+  // operand2 or operand2_ntt, X must not alias result.
+  void PolyMulModImpl(uint64_t* result, const uint64_t* operand1, uint64_t* X,
+                      const uint64_t* operand2, uint64_t* Y,
+                      const uint64_t* operand2_ntt);
+
+  Mode m_mode{Mode::kNegacyclic};
 
   uint64_t m_degree;  // N: size of NTT transform, should be power of 2
-  uint64_t m_q;       // prime modulus. Must satisfy q == 1 mod 2n
+  uint64_t m_q;       // prime modulus. Must satisfy q == 1 mod 2n, or
+                      // q == 1 mod n for cyclic and twisted transforms
 
   uint64_t m_degree_bits;  // log_2(m_degree)
 
   uint64_t m_winv;  // Inverse of minimal root of unity
-  uint64_t m_w;     // A 2N'th root of unity
+  uint64_t m_w;     // A 2N'th root of unity, or N'th root of unity for
+                    // cyclic and twisted transforms
+  uint64_t m_twist;  // Twist of the transform, see GetTwist
 
   std::shared_ptr<AllocatorBase> m_alloc;
 
   AlignedAllocator<uint64_t, 64> m_aligned_alloc;
 
-  // powers of the minimal root of unity
-  AlignedVector64<uint64_t> m_root_of_unity_powers;
-  // vector of floor(W * 2**32 / m_q), with W the root of unity powers
-  AlignedVector64<uint64_t> m_precon32_root_of_unity_powers;
-  // vector of floor(W * 2**64 / m_q), with W the root of unity powers
-  AlignedVector64<uint64_t> m_precon64_root_of_unity_powers;
-
-  // powers of the minimal root of unity adjusted for use in AVX512
-  // implementations
-  AlignedVector64<uint64_t> m_avx512_root_of_unity_powers;
-  // vector of floor(W * 2**32 / m_q), with W the AVX512 root of unity powers
-  AlignedVector64<uint64_t> m_avx512_precon32_root_of_unity_powers;
-  // vector of floor(W * 2**52 / m_q), with W the AVX512 root of unity powers
-  AlignedVector64<uint64_t> m_avx512_precon52_root_of_unity_powers;
-  // vector of floor(W * 2**64 / m_q), with W the AVX512 root of unity powers
-  AlignedVector64<uint64_t> m_avx512_precon64_root_of_unity_powers;
-
-  // vector of floor(W * 2**32 / m_q), with W the inverse root of unity powers
-  AlignedVector64<uint64_t> m_precon32_inv_root_of_unity_powers;
-  // vector of floor(W * 2**52 / m_q), with W the inverse root of unity powers
-  AlignedVector64<uint64_t> m_precon52_inv_root_of_unity_powers;
-  // vector of floor(W * 2**64 / m_q), with W the inverse root of unity powers
-  AlignedVector64<uint64_t> m_precon64_inv_root_of_unity_powers;
-
-  AlignedVector64<uint64_t> m_inv_root_of_unity_powers;
+  // Radix of the native transforms, see SetNativeRadix
+  size_t m_native_radix{s_default_native_radix};
+
+  // Size below which the AVX512 transforms run breadth-first, see
+  // SetBaseNTTSize
+  size_t m_base_ntt_size{s_default_base_ntt_size};
+
+  // Worker threads for multi-threaded transforms; nullptr if single-threaded
+  std::shared_ptr<ThreadPool> m_thread_pool;
+
+  // Pre-computed root of unity tables, possibly shared with other NTT
+  // objects
+  std::shared_ptr<const NTTTables> m_tables;
 };
 
 }  // namespace hexl
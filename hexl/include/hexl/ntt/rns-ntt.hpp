@@ -0,0 +1,124 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/util/allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Performs negacyclic forward and inverse number-theoretic transforms
+/// on polynomials in residue number system (RNS) representation.
+/// @details An RNS polynomial with L moduli is stored as an L x N row-major
+/// matrix, where row i holds the coefficients modulo the i'th modulus. A
+/// single call transforms every row, avoiding the per-row dispatch and copy
+/// overhead of looping over separate NTT objects. On AVX512, the transforms of
+/// several rows may be interleaved, see SetNumInterleavedRows.
+class RNSNTT {
+ public:
+  /// @brief Initializes an empty RNSNTT object
+  RNSNTT() = default;
+
+  /// @brief Initializes an RNSNTT object with degree \p degree and moduli \p
+  /// moduli.
+  /// @param[in] degree also known as N. Size of each NTT transform. Must be a
+  /// power of 2
+  /// @param[in] moduli Prime moduli. Each modulus q must satisfy \f$ q == 1
+  /// \mod 2N \f$
+  /// @param[in] alloc_ptr Custom memory allocator used for intermediate
+  /// calculations
+  /// @details Performs pre-computation necessary for forward and inverse
+  /// transforms
+  RNSNTT(uint64_t degree, const std::vector<uint64_t>& moduli,
+         std::shared_ptr<AllocatorBase> alloc_ptr = {});
+
+  /// @brief Compute forward NTT of each row. Results are bit-reversed by
+  /// default.
+  /// @param[out] result Stores the result as GetNumModuli() rows of
+  /// GetDegree() elements
+  /// @param[in] operand Data on which to compute the NTT, stored as
+  /// GetNumModuli() rows of GetDegree() elements
+  /// @param[in] input_mod_factor Assume row i of \p operand is in [0,
+  /// input_mod_factor * q_i). Must be 1, 2 or 4.
+  /// @param[in] output_mod_factor Returns row i of \p result in [0,
+  /// output_mod_factor * q_i). Must be 1 or 4.
+  /// @param[in] output_order Order of the evaluations in each row of \p
+  /// result
+  void ComputeForward(
+      uint64_t* result, const uint64_t* operand, uint64_t input_mod_factor,
+      uint64_t output_mod_factor,
+      NTT::Ordering output_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Compute inverse NTT of each row. Inputs are bit-reversed by
+  /// default.
+  /// @param[out] result Stores the result as GetNumModuli() rows of
+  /// GetDegree() elements
+  /// @param[in] operand Data on which to compute the NTT, stored as
+  /// GetNumModuli() rows of GetDegree() elements
+  /// @param[in] input_mod_factor Assume row i of \p operand is in [0,
+  /// input_mod_factor * q_i). Must be 1 or 2.
+  /// @param[in] output_mod_factor Returns row i of \p result in [0,
+  /// output_mod_factor * q_i). Must be 1 or 2.
+  /// @param[in] input_order Order of the evaluations in each row of \p
+  /// operand
+  void ComputeInverse(
+      uint64_t* result, const uint64_t* operand, uint64_t input_mod_factor,
+      uint64_t output_mod_factor,
+      NTT::Ordering input_order = NTT::Ordering::kBitReversed);
+
+  /// @brief Returns the degree N
+  uint64_t GetDegree() const { return m_degree; }
+
+  /// @brief Returns the number of moduli L
+  size_t GetNumModuli() const { return m_ntts.size(); }
+
+  /// @brief Returns the prime moduli
+  const std::vector<uint64_t>& GetModuli() const { return m_moduli; }
+
+  /// @brief Returns the NTT object for the i'th modulus
+  NTT& GetNTT(size_t i) { return m_ntts[i]; }
+
+  /// @brief Sets the number of rows whose AVX512 transforms are interleaved,
+  /// i.e. computed together one vector of butterflies per row at a time
+  /// @param[in] num_rows 1, 2 or 4. The default of 1 transforms each row on
+  /// its own.
+  /// @details Applies to consecutive rows whose moduli take the same
+  /// single-threaded AVX512 kernel, with the same breadth-first size.
+  /// Interleaving overlaps the multiplier latency of the rows, but multiplies
+  /// the working set of each stage by \p num_rows, so the fastest value
+  /// depends on the processor and the kernel; see BM_FwdRNSNTT.
+  void SetNumInterleavedRows(size_t num_rows);
+
+  /// @brief Returns the number of rows whose AVX512 transforms are
+  /// interleaved, see SetNumInterleavedRows
+  size_t GetNumInterleavedRows() const { return m_num_interleaved_rows; }
+
+ private:
+  // Computes the interleaved forward transforms of the rows starting at row
+  // first, with bit-reversed output. Returns the number of rows transformed,
+  // which is 0 if row first is to be transformed on its own.
+  size_t ForwardRowsAVX512(uint64_t* result, const uint64_t* operand,
+                           size_t first, uint64_t input_mod_factor,
+                           uint64_t output_mod_factor);
+
+  // Inverse counterpart of ForwardRowsAVX512, with bit-reversed input
+  size_t InverseRowsAVX512(uint64_t* result, const uint64_t* operand,
+                           size_t first, uint64_t input_mod_factor,
+                           uint64_t output_mod_factor);
+
+  uint64_t m_degree{0};  // N: size of each NTT transform
+  std::vector<uint64_t> m_moduli;
+  std::vector<NTT> m_ntts;
+  // Rows interleaved by the AVX512 transforms, see SetNumInterleavedRows
+  size_t m_num_interleaved_rows{1};
+};
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,261 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <iostream>
+#include <vector>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Unsigned 128-bit integer hi * 2^64 + lo
+/// @details Arrays of DoubleWord store the low word of each element first, so
+/// they have the same layout as arrays of uint128_t on little-endian targets
+struct DoubleWord {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+inline bool operator==(DoubleWord x, DoubleWord y) {
+  return x.lo == y.lo && x.hi == y.hi;
+}
+
+inline bool operator!=(DoubleWord x, DoubleWord y) { return !(x == y); }
+
+inline bool operator<(DoubleWord x, DoubleWord y) {
+  return x.hi < y.hi || (x.hi == y.hi && x.lo < y.lo);
+}
+
+inline bool operator>=(DoubleWord x, DoubleWord y) { return !(x < y); }
+
+inline std::ostream& operator<<(std::ostream& os, DoubleWord x) {
+  std::ios_base::fmtflags flags = os.flags();
+  os << "0x" << std::hex << x.hi << ":" << x.lo;
+  os.flags(flags);
+  return os;
+}
+
+/// @brief Returns x + y mod 2^128, and sets *carry to the carry out
+inline DoubleWord AddDoubleWord(DoubleWord x, DoubleWord y,
+                                unsigned char* carry = nullptr) {
+  DoubleWord sum;
+  unsigned char c = AddUInt64(x.lo, y.lo, &sum.lo);
+  uint64_t hi = x.hi + y.hi;
+  sum.hi = hi + c;
+  if (carry != nullptr) {
+    *carry = static_cast<unsigned char>((hi < x.hi) || (sum.hi < hi));
+  }
+  return sum;
+}
+
+/// @brief Returns x - y mod 2^128
+inline DoubleWord SubDoubleWord(DoubleWord x, DoubleWord y) {
+  DoubleWord diff;
+  diff.lo = x.lo - y.lo;
+  diff.hi = x.hi - y.hi - (x.lo < y.lo);
+  return diff;
+}
+
+/// @brief Returns x >> shift, for shift < 128
+inline DoubleWord ShiftRightDoubleWord(DoubleWord x, uint64_t shift) {
+  HEXL_CHECK(shift < 128, "shift " << shift << " too large");
+  if (shift == 0) {
+    return x;
+  }
+  if (shift >= 64) {
+    return DoubleWord{x.hi >> (shift - 64), 0};
+  }
+  return DoubleWord{(x.lo >> shift) | (x.hi << (64 - shift)), x.hi >> shift};
+}
+
+/// @brief Returns x << shift mod 2^128, for shift < 128
+inline DoubleWord ShiftLeftDoubleWord(DoubleWord x, uint64_t shift) {
+  HEXL_CHECK(shift < 128, "shift " << shift << " too large");
+  if (shift == 0) {
+    return x;
+  }
+  if (shift >= 64) {
+    return DoubleWord{0, x.lo << (shift - 64)};
+  }
+  return DoubleWord{x.lo << shift, (x.hi << shift) | (x.lo >> (64 - shift))};
+}
+
+/// @brief Computes the 256-bit product x * y
+/// @param[in] x
+/// @param[in] y
+/// @param[out] prod_hi Stores the high 128 bits of the product
+/// @param[out] prod_lo Stores the low 128 bits of the product
+inline void MultiplyDoubleWord(DoubleWord x, DoubleWord y, DoubleWord* prod_hi,
+                               DoubleWord* prod_lo) {
+  uint64_t p00_hi, p00_lo, p01_hi, p01_lo, p10_hi, p10_lo, p11_hi, p11_lo;
+  MultiplyUInt64(x.lo, y.lo, &p00_hi, &p00_lo);
+  MultiplyUInt64(x.lo, y.hi, &p01_hi, &p01_lo);
+  MultiplyUInt64(x.hi, y.lo, &p10_hi, &p10_lo);
+  MultiplyUInt64(x.hi, y.hi, &p11_hi, &p11_lo);
+
+  uint64_t w1;
+  uint64_t c1 = AddUInt64(p00_hi, p01_lo, &w1);
+  c1 += AddUInt64(w1, p10_lo, &w1);
+
+  uint64_t w2;
+  uint64_t c2 = AddUInt64(p01_hi, p10_hi, &w2);
+  c2 += AddUInt64(w2, p11_lo, &w2);
+  c2 += AddUInt64(w2, c1, &w2);
+
+  *prod_lo = DoubleWord{p00_lo, w1};
+  *prod_hi = DoubleWord{w2, p11_hi + c2};
+}
+
+/// @brief Returns x * y mod 2^128
+inline DoubleWord MultiplyDoubleWordLo(DoubleWord x, DoubleWord y) {
+  uint64_t hi, lo;
+  MultiplyUInt64(x.lo, y.lo, &hi, &lo);
+  hi += x.lo * y.hi + x.hi * y.lo;
+  return DoubleWord{lo, hi};
+}
+
+/// @brief Pre-computes the factors of Barrett and Montgomery reduction by a
+/// double-word modulus q
+/// @details Requires q odd and 3 <= q < 2^126, which leaves room for the
+/// intermediate values in [0, 3q) of Barrett reduction
+class DoubleWordModulus {
+ public:
+  DoubleWordModulus() = default;
+
+  /// @brief Computes the reduction factors of \p modulus
+  explicit DoubleWordModulus(DoubleWord modulus);
+
+  /// @brief Returns the modulus q
+  DoubleWord Modulus() const { return m_modulus; }
+
+  /// @brief Returns k, the bit-width of q
+  uint64_t BitLength() const { return m_bit_length; }
+
+  /// @brief Returns floor(2^(2k) / q), the factor of Barrett reduction
+  DoubleWord BarrettFactor() const { return m_barrett_factor; }
+
+  /// @brief Returns -q^{-1} mod 2^128, the factor of Montgomery reduction
+  DoubleWord NegInverse() const { return m_neg_inverse; }
+
+ private:
+  DoubleWord m_modulus{0, 0};
+  uint64_t m_bit_length{0};
+  DoubleWord m_barrett_factor{0, 0};
+  DoubleWord m_neg_inverse{0, 0};
+};
+
+/// @brief Returns (x + y) mod q
+/// @details Assumes x, y < q
+inline DoubleWord AddModDoubleWord(DoubleWord x, DoubleWord y,
+                                   const DoubleWordModulus& modulus) {
+  // q < 2^126, so the sum does not overflow
+  DoubleWord sum = AddDoubleWord(x, y);
+  return (sum >= modulus.Modulus()) ? SubDoubleWord(sum, modulus.Modulus())
+                                    : sum;
+}
+
+/// @brief Returns (x - y) mod q
+/// @details Assumes x, y < q
+inline DoubleWord SubModDoubleWord(DoubleWord x, DoubleWord y,
+                                   const DoubleWordModulus& modulus) {
+  DoubleWord diff = SubDoubleWord(x, y);
+  return (x < y) ? AddDoubleWord(diff, modulus.Modulus()) : diff;
+}
+
+/// @brief Returns (x_hi * 2^128 + x_lo) mod q, via Algorithm 14.42 of the
+/// Handbook of Applied Cryptography
+/// @details Requires the input less than 2^(2k), e.g. the product of two values
+/// in [0, q)
+inline DoubleWord BarrettReduceDoubleWord(DoubleWord x_hi, DoubleWord x_lo,
+                                          const DoubleWordModulus& modulus) {
+  const uint64_t k = modulus.BitLength();
+  const DoubleWord q = modulus.Modulus();
+
+  // q1 = x >> (k - 1) < 2^(k + 1)
+  DoubleWord q1 = ShiftRightDoubleWord(x_lo, k - 1);
+  DoubleWord x_hi_shifted = ShiftLeftDoubleWord(x_hi, 129 - k);
+  q1 = DoubleWord{q1.lo | x_hi_shifted.lo, q1.hi | x_hi_shifted.hi};
+
+  // q3 = (q1 * mu) >> (k + 1) < 2^(k + 1)
+  DoubleWord q2_hi, q2_lo;
+  MultiplyDoubleWord(q1, modulus.BarrettFactor(), &q2_hi, &q2_lo);
+  DoubleWord q3 = ShiftRightDoubleWord(q2_lo, k + 1);
+  DoubleWord q2_hi_shifted = ShiftLeftDoubleWord(q2_hi, 127 - k);
+  q3 = DoubleWord{q3.lo | q2_hi_shifted.lo, q3.hi | q2_hi_shifted.hi};
+
+  // r = x - q3 * q is in [0, 3q)
+  DoubleWord r = SubDoubleWord(x_lo, MultiplyDoubleWordLo(q3, q));
+  if (r >= q) {
+    r = SubDoubleWord(r, q);
+  }
+  if (r >= q) {
+    r = SubDoubleWord(r, q);
+  }
+  return r;
+}
+
+/// @brief Returns (x * y) mod q
+/// @details Assumes x, y < q
+inline DoubleWord MultiplyModDoubleWord(DoubleWord x, DoubleWord y,
+                                        const DoubleWordModulus& modulus) {
+  DoubleWord prod_hi, prod_lo;
+  MultiplyDoubleWord(x, y, &prod_hi, &prod_lo);
+  return BarrettReduceDoubleWord(prod_hi, prod_lo, modulus);
+}
+
+/// @brief Returns x * y * 2^{-128} mod q, the Montgomery product of x and y
+/// @details Assumes x, y < q
+inline DoubleWord MontgomeryMultiplyDoubleWord(
+    DoubleWord x, DoubleWord y, const DoubleWordModulus& modulus) {
+  DoubleWord t_hi, t_lo;
+  MultiplyDoubleWord(x, y, &t_hi, &t_lo);
+  DoubleWord m = MultiplyDoubleWordLo(t_lo, modulus.NegInverse());
+  DoubleWord mq_hi, mq_lo;
+  MultiplyDoubleWord(m, modulus.Modulus(), &mq_hi, &mq_lo);
+  // t + m * q = 0 mod 2^128, so its low half carries iff t_lo != 0
+  DoubleWord u = AddDoubleWord(t_hi, mq_hi);
+  u = AddDoubleWord(u, DoubleWord{(t_lo.lo | t_lo.hi) != 0, 0});
+  return (u >= modulus.Modulus()) ? SubDoubleWord(u, modulus.Modulus()) : u;
+}
+
+/// @brief Returns base^exp mod q
+DoubleWord PowModDoubleWord(DoubleWord base, DoubleWord exp,
+                            const DoubleWordModulus& modulus);
+
+/// @brief Returns x^{-1} mod q
+/// @details Requires q prime and x % q != 0
+DoubleWord InverseModDoubleWord(DoubleWord x, const DoubleWordModulus& modulus);
+
+/// @brief Returns whether or not the input is prime
+/// @details Uses the Miller-Rabin test with the first 20 primes as bases,
+/// which is exact below 2^64 and fails with probability below 2^-40 above.
+/// Requires n < 2^126.
+bool IsPrimeDoubleWord(DoubleWord n);
+
+/// @brief Generates a list of num_primes primes in the range [2^bit_size,
+/// 2^(bit_size+1)], such that each prime q satisfies q % (2 * ntt_size) == 1
+/// @param[in] num_primes Number of primes to generate
+/// @param[in] bit_size Bit size of each prime. Must be less than 126
+/// @param[in] ntt_size N such that each prime q satisfies q % (2N) == 1. N must
+/// be a power of two
+std::vector<DoubleWord> GeneratePrimesDoubleWord(size_t num_primes,
+                                                 size_t bit_size,
+                                                 size_t ntt_size = 1);
+
+/// @brief Returns a primitive degree'th root of unity mod q
+/// @param[in] degree Must be a power of two dividing q - 1
+/// @param[in] modulus Must be prime
+/// @details Returns g^((q - 1) / degree) for the smallest g = 2, 3, ... for
+/// which this power is primitive
+DoubleWord GeneratePrimitiveRootDoubleWord(uint64_t degree,
+                                           const DoubleWordModulus& modulus);
+
+}  // namespace hexl
+}  // namespace intel
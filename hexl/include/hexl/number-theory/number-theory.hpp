@@ -165,6 +165,123 @@ inline uint64_t MultiplyModLazy(uint64_t x, uint64_t y, uint64_t modulus) {
   return MultiplyModLazy<BitShift>(x, y, y_barrett, modulus);
 }
 
+/// @brief Returns -modulus^{-1} mod 2^64, the factor of Montgomery reduction
+/// with R = 2^64
+/// @details Requires modulus odd
+uint64_t MontgomeryNegInverse(uint64_t modulus);
+
+/// @brief Computes (x_hi * 2^64 + x_lo) * 2^{-64} mod modulus, except that the
+/// output is in [0, 2 * modulus)
+/// @param[in] x_hi High 64 bits of the input. Must be less than modulus
+/// @param[in] x_lo Low 64 bits of the input
+/// @param[in] modulus Must be odd and less than 2^63
+/// @param[in] neg_inv_modulus MontgomeryNegInverse(modulus)
+inline uint64_t MontgomeryReduceLazy(uint64_t x_hi, uint64_t x_lo,
+                                     uint64_t modulus,
+                                     uint64_t neg_inv_modulus) {
+  HEXL_CHECK(x_hi < modulus,
+             "x_hi " << x_hi << " must be less than modulus " << modulus);
+  HEXL_CHECK(modulus < (1ULL << 63), "modulus " << modulus << " too large");
+  // x + m * modulus = 0 mod 2^64, so its low word carries iff x_lo != 0
+  uint64_t m = x_lo * neg_inv_modulus;
+  return x_hi + MultiplyUInt64Hi<64>(m, modulus) + (x_lo != 0);
+}
+
+/// @brief Returns x * y * 2^{-64} mod modulus, the Montgomery product of x and
+/// y
+/// @param[in] x Must be less than modulus
+/// @param[in] y Must be less than modulus
+/// @param[in] modulus Must be odd and less than 2^63
+/// @param[in] neg_inv_modulus MontgomeryNegInverse(modulus)
+inline uint64_t MontgomeryMultiply(uint64_t x, uint64_t y, uint64_t modulus,
+                                   uint64_t neg_inv_modulus) {
+  uint64_t prod_hi;
+  uint64_t prod_lo;
+  MultiplyUInt64(x, y, &prod_hi, &prod_lo);
+  uint64_t result =
+      MontgomeryReduceLazy(prod_hi, prod_lo, modulus, neg_inv_modulus);
+  return (result >= modulus) ? result - modulus : result;
+}
+
+/// @brief Returns x * 2^64 mod modulus, the Montgomery form of x
+inline uint64_t ToMontgomery(uint64_t x, uint64_t modulus) {
+  return BarrettReduce128(x, 0, modulus);
+}
+
+/// @brief Returns x * 2^{-64} mod modulus, the value with Montgomery form x
+/// @param[in] x Must be less than modulus
+/// @param[in] modulus Must be odd and less than 2^63
+/// @param[in] neg_inv_modulus MontgomeryNegInverse(modulus)
+inline uint64_t FromMontgomery(uint64_t x, uint64_t modulus,
+                               uint64_t neg_inv_modulus) {
+  uint64_t result = MontgomeryReduceLazy(0, x, modulus, neg_inv_modulus);
+  return (result >= modulus) ? result - modulus : result;
+}
+
+/// @brief The Goldilocks prime 2^64 - 2^32 + 1
+constexpr uint64_t kGoldilocksModulus = 0xFFFFFFFF00000001ULL;
+
+/// @brief Returns (x_hi * 2^64 + x_lo) mod kGoldilocksModulus
+/// @details Uses 2^64 = 2^32 - 1 and 2^96 = -1 mod kGoldilocksModulus, so the
+/// reduction needs only shifts, additions and subtractions. Accepts any
+/// 128-bit input.
+inline uint64_t ReduceGoldilocks(uint64_t x_hi, uint64_t x_lo) {
+  const uint64_t epsilon = 0xFFFFFFFFULL;  // 2^64 mod kGoldilocksModulus
+  uint64_t x_hi_hi = x_hi >> 32;
+  uint64_t x_hi_lo = x_hi & epsilon;
+
+  // x_lo - x_hi_hi * 2^96 = x_lo - x_hi_hi; a borrow subtracts 2^64
+  uint64_t t0 = x_lo - x_hi_hi;
+  if (x_lo < x_hi_hi) {
+    t0 -= epsilon;
+  }
+  // x_hi_lo * 2^64 = x_hi_lo * (2^32 - 1)
+  uint64_t t1 = (x_hi_lo << 32) - x_hi_lo;
+  // A carry adds 2^64
+  uint64_t t2 = t0 + t1;
+  if (t2 < t1) {
+    t2 += epsilon;
+  }
+  return (t2 >= kGoldilocksModulus) ? t2 - kGoldilocksModulus : t2;
+}
+
+/// @brief Returns (x * y) mod kGoldilocksModulus. Accepts any 64-bit x and y
+inline uint64_t MultiplyModGoldilocks(uint64_t x, uint64_t y) {
+  uint64_t prod_hi;
+  uint64_t prod_lo;
+  MultiplyUInt64(x, y, &prod_hi, &prod_lo);
+  return ReduceGoldilocks(prod_hi, prod_lo);
+}
+
+/// @brief Returns (x + y) mod kGoldilocksModulus
+/// @details Assumes x, y < kGoldilocksModulus
+inline uint64_t AddModGoldilocks(uint64_t x, uint64_t y) {
+  HEXL_CHECK(x < kGoldilocksModulus, "x " << x << " >= modulus");
+  HEXL_CHECK(y < kGoldilocksModulus, "y " << y << " >= modulus");
+  uint64_t sum = x + y;
+  // A carry adds 2^64 = 2^32 - 1
+  if (sum < x) {
+    sum += 0xFFFFFFFFULL;
+  }
+  return (sum >= kGoldilocksModulus) ? sum - kGoldilocksModulus : sum;
+}
+
+/// @brief Returns (x - y) mod kGoldilocksModulus
+/// @details Assumes x, y < kGoldilocksModulus
+inline uint64_t SubModGoldilocks(uint64_t x, uint64_t y) {
+  HEXL_CHECK(x < kGoldilocksModulus, "x " << x << " >= modulus");
+  HEXL_CHECK(y < kGoldilocksModulus, "y " << y << " >= modulus");
+  uint64_t diff = x - y;
+  // A borrow subtracts 2^64 = 2^32 - 1
+  if (x < y) {
+    diff -= 0xFFFFFFFFULL;
+  }
+  return diff;
+}
+
+/// @brief Returns base^exp mod kGoldilocksModulus
+uint64_t PowModGoldilocks(uint64_t base, uint64_t exp);
+
 /// @brief Adds two unsigned 64-bit integers
 /// @param operand1 Number to add
 /// @param operand2 Number to add
@@ -176,6 +293,87 @@ inline unsigned char AddUInt64(uint64_t operand1, uint64_t operand2,
   return static_cast<unsigned char>(*result < operand1);
 }
 
+/// @brief Detects whether a modulus q has the special form q = 2^k - c * 2^m +
+/// 1, for which reduction by shift-and-add folding beats Barrett reduction
+/// @details Folding uses 2^k = d mod q, for d = 2^k - q = c * 2^m - 1. Two
+/// folds bring a product of two values in [0, q) to [0, 2q), provided d <
+/// 2^((k - 2) / 2) and c * 2^k <= 2^64. This covers NTT-friendly primes with
+/// small d, and pseudo-Mersenne primes 2^k - d. If c == 1, folding needs no
+/// multiplications at all.
+class SpecialFormModulus {
+ public:
+  SpecialFormModulus() = default;
+
+  /// @brief Detects the special form of \p modulus
+  /// @param[in] modulus Odd modulus less than 2^62
+  explicit SpecialFormModulus(uint64_t modulus);
+
+  /// @brief Returns whether or not the modulus has special form
+  bool IsSpecialForm() const { return m_special_form; }
+
+  /// @brief Returns the modulus q
+  uint64_t Modulus() const { return m_modulus; }
+
+  /// @brief Returns k, the bit-width of the modulus
+  uint64_t K() const { return m_k; }
+
+  /// @brief Returns c, the odd part of 2^k - q + 1
+  uint64_t C() const { return m_c; }
+
+  /// @brief Returns m, the number of trailing zeros of 2^k - q + 1
+  uint64_t M() const { return m_m; }
+
+ private:
+  uint64_t m_modulus{0};
+  uint64_t m_k{0};
+  uint64_t m_c{0};
+  uint64_t m_m{0};
+  bool m_special_form{false};
+};
+
+/// @brief Returns (x_hi * 2^64 + x_lo) mod q, computed by shift-and-add
+/// folding
+/// @param[in] x_hi High 64 bits of the input
+/// @param[in] x_lo Low 64 bits of the input
+/// @param[in] modulus Special-form modulus q. The input must be less than
+/// 2^(2k), e.g. the product of two values in [0, q)
+inline uint64_t ReduceSpecialForm(uint64_t x_hi, uint64_t x_lo,
+                                  const SpecialFormModulus& modulus) {
+  HEXL_CHECK(modulus.IsSpecialForm(),
+             "modulus " << modulus.Modulus() << " is not of special form");
+  const uint64_t k = modulus.K();
+  const uint64_t c = modulus.C();
+  const uint64_t m = modulus.M();
+  const uint64_t mask = (1ULL << k) - 1;
+  HEXL_CHECK((2 * k >= 64) ? (x_hi >> (2 * k - 64)) == 0
+                            : (x_hi == 0 && (x_lo >> (2 * k)) == 0),
+             "input exceeds 2^(2k)");
+
+  // x = hi * 2^k + lo = lo + hi * c * 2^m - hi, formed in 128 bits
+  uint64_t hi = (x_hi << (64 - k)) | (x_lo >> k);
+  uint64_t hi_c = hi * c;
+  uint64_t sum_hi = hi_c >> (64 - m);
+  uint64_t sum_lo;
+  sum_hi += AddUInt64(hi_c << m, x_lo & mask, &sum_lo);
+  sum_hi -= (sum_lo < hi);
+  sum_lo -= hi;
+
+  // The second fold fits in 64 bits, and yields a value in [0, 2q)
+  hi = (sum_hi << (64 - k)) | (sum_lo >> k);
+  uint64_t result = (sum_lo & mask) + ((hi * c) << m) - hi;
+  return (result >= modulus.Modulus()) ? result - modulus.Modulus() : result;
+}
+
+/// @brief Returns (x * y) mod q for a special-form modulus q
+/// @details Assumes x, y < q
+inline uint64_t MultiplyModSpecialForm(uint64_t x, uint64_t y,
+                                       const SpecialFormModulus& modulus) {
+  uint64_t prod_hi;
+  uint64_t prod_lo;
+  MultiplyUInt64(x, y, &prod_hi, &prod_lo);
+  return ReduceSpecialForm(prod_hi, prod_lo, modulus);
+}
+
 /// @brief Returns whether or not the input is prime
 bool IsPrime(uint64_t n);
 
@@ -186,8 +384,12 @@ bool IsPrime(uint64_t n);
 /// @param[in] bit_size Bit size of each prime
 /// @param[in] ntt_size N such that each prime q satisfies q % (2N) == 1. N must
 /// be a power of two
+/// @param[in] special_form If true, generates only primes with special form
+/// (see SpecialFormModulus), searching downwards from 2^(bit_size+1). Requires
+/// bit_size < 62
 std::vector<uint64_t> GeneratePrimes(size_t num_primes, size_t bit_size,
-                                     size_t ntt_size = 1);
+                                     size_t ntt_size = 1,
+                                     bool special_form = false);
 
 /// @brief Returns input mod modulus, computed via 64-bit Barrett reduction
 /// @param[in] input
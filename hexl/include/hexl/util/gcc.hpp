@@ -56,7 +56,7 @@ inline uint64_t MultiplyUInt64Hi(uint64_t x, uint64_t y) {
 
 // Returns most-significant bit of the input
 inline uint64_t MSB(uint64_t input) {
-  return static_cast<uint64_t>(std::log2l(input));
+  return static_cast<uint64_t>(63 - __builtin_clzll(input));
 }
 
 #define HEXL_LOOP_UNROLL_4 _Pragma("GCC unroll 4")
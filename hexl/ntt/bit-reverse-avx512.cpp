@@ -0,0 +1,125 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/bit-reverse-avx512.hpp"
+
+#include <immintrin.h>
+#include <stdint.h>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/bit-reverse-internal.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+namespace {
+
+// ReverseBits(i, 3) for i in [0, 8)
+const uint64_t s_reverse3[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+// Loads the 8 x 8 tile whose rows start at tile and are spaced stride apart.
+// Row ReverseBits(j, 3) is loaded into rows[j], so that after transposing,
+// each column is already in bit-reversed order.
+inline void LoadTileReversed(const uint64_t* tile, uint64_t stride,
+                             __m512i* rows) {
+  for (size_t j = 0; j < s_bit_reverse_tile; ++j) {
+    rows[j] = _mm512_loadu_si512(tile + s_reverse3[j] * stride);
+  }
+}
+
+// Transposes the 8 x 8 matrix of 64-bit elements in rows
+inline void Transpose8x8(__m512i* rows) {
+  // Interleave pairs of rows
+  __m512i t0 = _mm512_unpacklo_epi64(rows[0], rows[1]);
+  __m512i t1 = _mm512_unpackhi_epi64(rows[0], rows[1]);
+  __m512i t2 = _mm512_unpacklo_epi64(rows[2], rows[3]);
+  __m512i t3 = _mm512_unpackhi_epi64(rows[2], rows[3]);
+  __m512i t4 = _mm512_unpacklo_epi64(rows[4], rows[5]);
+  __m512i t5 = _mm512_unpackhi_epi64(rows[4], rows[5]);
+  __m512i t6 = _mm512_unpacklo_epi64(rows[6], rows[7]);
+  __m512i t7 = _mm512_unpackhi_epi64(rows[6], rows[7]);
+
+  // Gather even and odd 128-bit lanes of pairs of interleaved rows
+  __m512i u0 = _mm512_shuffle_i64x2(t0, t2, 0x88);
+  __m512i u1 = _mm512_shuffle_i64x2(t1, t3, 0x88);
+  __m512i u2 = _mm512_shuffle_i64x2(t0, t2, 0xdd);
+  __m512i u3 = _mm512_shuffle_i64x2(t1, t3, 0xdd);
+  __m512i u4 = _mm512_shuffle_i64x2(t4, t6, 0x88);
+  __m512i u5 = _mm512_shuffle_i64x2(t5, t7, 0x88);
+  __m512i u6 = _mm512_shuffle_i64x2(t4, t6, 0xdd);
+  __m512i u7 = _mm512_shuffle_i64x2(t5, t7, 0xdd);
+
+  rows[0] = _mm512_shuffle_i64x2(u0, u4, 0x88);
+  rows[1] = _mm512_shuffle_i64x2(u1, u5, 0x88);
+  rows[2] = _mm512_shuffle_i64x2(u2, u6, 0x88);
+  rows[3] = _mm512_shuffle_i64x2(u3, u7, 0x88);
+  rows[4] = _mm512_shuffle_i64x2(u0, u4, 0xdd);
+  rows[5] = _mm512_shuffle_i64x2(u1, u5, 0xdd);
+  rows[6] = _mm512_shuffle_i64x2(u2, u6, 0xdd);
+  rows[7] = _mm512_shuffle_i64x2(u3, u7, 0xdd);
+}
+
+// Stores column c of the transposed tile to row ReverseBits(c, 3) of tile
+inline void StoreTileReversed(const __m512i* cols, uint64_t stride,
+                              uint64_t* tile) {
+  for (size_t c = 0; c < s_bit_reverse_tile; ++c) {
+    _mm512_storeu_si512(tile + s_reverse3[c] * stride, cols[c]);
+  }
+}
+
+}  // namespace
+
+// See bit-reverse.cpp for a description of the tiling
+void BitReversePermuteAVX512(uint64_t* result, const uint64_t* operand,
+                             uint64_t n) {
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  HEXL_CHECK(n >= s_bit_reverse_tile * s_bit_reverse_tile,
+             "n " << n << " too small");
+
+  const uint64_t stride = n / s_bit_reverse_tile;
+  const uint64_t num_tiles = stride / s_bit_reverse_tile;
+  const uint64_t tile_bits = Log2(n) - 6;
+  __m512i rows[s_bit_reverse_tile];
+  for (size_t b = 0; b < num_tiles; ++b) {
+    uint64_t rev_b = ReverseBits(b, tile_bits);
+    LoadTileReversed(operand + b * s_bit_reverse_tile, stride, rows);
+    Transpose8x8(rows);
+    StoreTileReversed(rows, stride, result + rev_b * s_bit_reverse_tile);
+  }
+}
+
+void BitReversePermuteInPlaceAVX512(uint64_t* operand, uint64_t n) {
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  HEXL_CHECK(n >= s_bit_reverse_tile * s_bit_reverse_tile,
+             "n " << n << " too small");
+
+  const uint64_t stride = n / s_bit_reverse_tile;
+  const uint64_t num_tiles = stride / s_bit_reverse_tile;
+  const uint64_t tile_bits = Log2(n) - 6;
+  __m512i rows1[s_bit_reverse_tile];
+  __m512i rows2[s_bit_reverse_tile];
+  for (size_t b = 0; b < num_tiles; ++b) {
+    uint64_t rev_b = ReverseBits(b, tile_bits);
+    if (rev_b < b) {
+      continue;  // Swapped with tile rev_b already
+    }
+    uint64_t* tile_b = operand + b * s_bit_reverse_tile;
+    uint64_t* tile_rev_b = operand + rev_b * s_bit_reverse_tile;
+    LoadTileReversed(tile_b, stride, rows1);
+    Transpose8x8(rows1);
+    if (rev_b != b) {
+      LoadTileReversed(tile_rev_b, stride, rows2);
+      Transpose8x8(rows2);
+      StoreTileReversed(rows2, stride, tile_b);
+    }
+    StoreTileReversed(rows1, stride, tile_rev_b);
+  }
+}
+
+#endif
+
+}  // namespace hexl
+}  // namespace intel
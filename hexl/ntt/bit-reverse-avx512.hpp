@@ -0,0 +1,29 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+/// @brief AVX512 implementation of BitReversePermute. \p result and \p
+/// operand must not overlap.
+/// @param[out] result Stores the result
+/// @param[in] operand Vector to permute
+/// @param[in] n Number of elements in \p operand. Must be a power of two, at
+/// least 64
+void BitReversePermuteAVX512(uint64_t* result, const uint64_t* operand,
+                             uint64_t n);
+
+/// @brief AVX512 implementation of BitReversePermuteInPlace
+/// @param[in, out] operand Vector to permute. Overwritten with the result
+/// @param[in] n Number of elements in \p operand. Must be a power of two, at
+/// least 64
+void BitReversePermuteInPlaceAVX512(uint64_t* operand, uint64_t n);
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,39 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Bit-reversal permutations are blocked into tiles of
+/// s_bit_reverse_tile x s_bit_reverse_tile elements; smaller vectors are
+/// permuted element by element
+const uint64_t s_bit_reverse_tile = 8;
+
+/// @brief Permutes \p operand into bit-reversed order. \p result and \p
+/// operand must not overlap.
+/// @param[out] result Stores the result
+/// @param[in] operand Vector to permute
+/// @param[in] n Number of elements in \p operand. Must be a power of two
+void BitReversePermuteNative(uint64_t* result, const uint64_t* operand,
+                             uint64_t n);
+
+/// @brief Permutes \p operand of 32-bit elements into bit-reversed order. \p
+/// result and \p operand must not overlap.
+void BitReversePermuteNative(uint32_t* result, const uint32_t* operand,
+                             uint64_t n);
+
+/// @brief Permutes \p operand into bit-reversed order in-place
+/// @param[in, out] operand Vector to permute. Overwritten with the result
+/// @param[in] n Number of elements in \p operand. Must be a power of two
+void BitReversePermuteInPlaceNative(uint64_t* operand, uint64_t n);
+
+/// @brief Permutes \p operand of 32-bit elements into bit-reversed order
+/// in-place
+void BitReversePermuteInPlaceNative(uint32_t* operand, uint64_t n);
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,192 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/ntt/bit-reverse.hpp"
+
+#include <utility>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/bit-reverse-avx512.hpp"
+#include "ntt/bit-reverse-internal.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Writing an index as (a, b, c), where a and c have 3 bits each and b has the
+// remaining bits, its bit-reversal is (rev(c), rev(b), rev(a)). So the tile of
+// elements sharing the same b maps onto the tile of elements sharing rev(b),
+// with rows and columns swapped. Moving one tile at a time reads and writes
+// whole cache lines, rather than scattering single elements across memory.
+
+// ReverseBits(i, 3) for i in [0, 8)
+const uint64_t s_reverse3[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+
+// Sets dst[rev(c) * dst_stride + rev(a)] = src[a * src_stride + c] for a, c
+// in [0, 8)
+template <typename T>
+inline void PermuteTile(const T* src, uint64_t src_stride, T* dst,
+                        uint64_t dst_stride) {
+  for (size_t a = 0; a < s_bit_reverse_tile; ++a) {
+    const T* src_row = src + a * src_stride;
+    T* dst_col = dst + s_reverse3[a];
+    for (size_t c = 0; c < s_bit_reverse_tile; ++c) {
+      dst_col[s_reverse3[c] * dst_stride] = src_row[c];
+    }
+  }
+}
+
+// Copies the 8 rows of 8 elements at src, spaced src_stride apart, to dst
+template <typename T>
+inline void CopyTile(const T* src, uint64_t src_stride, T* dst) {
+  for (size_t a = 0; a < s_bit_reverse_tile; ++a) {
+    for (size_t c = 0; c < s_bit_reverse_tile; ++c) {
+      dst[a * s_bit_reverse_tile + c] = src[a * src_stride + c];
+    }
+  }
+}
+
+// Implements BitReversePermuteNative for elements of type T
+template <typename T>
+void BitReversePermuteTiled(T* result, const T* operand, uint64_t n) {
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  uint64_t log_n = Log2(n);
+
+  if (n < s_bit_reverse_tile * s_bit_reverse_tile) {
+    for (size_t i = 0; i < n; ++i) {
+      result[ReverseBits(i, log_n)] = operand[i];
+    }
+    return;
+  }
+
+  const uint64_t stride = n / s_bit_reverse_tile;
+  const uint64_t num_tiles = stride / s_bit_reverse_tile;
+  const uint64_t tile_bits = log_n - 6;
+  for (size_t b = 0; b < num_tiles; ++b) {
+    uint64_t rev_b = ReverseBits(b, tile_bits);
+    PermuteTile(operand + b * s_bit_reverse_tile, stride,
+                result + rev_b * s_bit_reverse_tile, stride);
+  }
+}
+
+// Implements BitReversePermuteInPlaceNative for elements of type T
+template <typename T>
+void BitReversePermuteInPlaceTiled(T* operand, uint64_t n) {
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  uint64_t log_n = Log2(n);
+
+  if (n < s_bit_reverse_tile * s_bit_reverse_tile) {
+    for (size_t i = 0; i < n; ++i) {
+      uint64_t rev_i = ReverseBits(i, log_n);
+      if (i < rev_i) {
+        std::swap(operand[i], operand[rev_i]);
+      }
+    }
+    return;
+  }
+
+  const uint64_t stride = n / s_bit_reverse_tile;
+  const uint64_t num_tiles = stride / s_bit_reverse_tile;
+  const uint64_t tile_bits = log_n - 6;
+  T tile1[s_bit_reverse_tile * s_bit_reverse_tile];
+  T tile2[s_bit_reverse_tile * s_bit_reverse_tile];
+  for (size_t b = 0; b < num_tiles; ++b) {
+    uint64_t rev_b = ReverseBits(b, tile_bits);
+    if (rev_b < b) {
+      continue;  // Swapped with tile rev_b already
+    }
+    T* tile_b = operand + b * s_bit_reverse_tile;
+    T* tile_rev_b = operand + rev_b * s_bit_reverse_tile;
+    CopyTile(tile_b, stride, tile1);
+    if (rev_b != b) {
+      CopyTile(tile_rev_b, stride, tile2);
+      PermuteTile(tile2, s_bit_reverse_tile, tile_b, stride);
+    }
+    PermuteTile(tile1, s_bit_reverse_tile, tile_rev_b, stride);
+  }
+}
+
+}  // namespace
+
+void BitReversePermute(uint64_t* result, const uint64_t* operand, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (result == operand) {
+    BitReversePermuteInPlace(result, n);
+    return;
+  }
+  HEXL_CHECK(result + n <= operand || operand + n <= result,
+             "result and operand overlap");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && n >= s_bit_reverse_tile * s_bit_reverse_tile) {
+    HEXL_VLOG(3, "Calling BitReversePermuteAVX512");
+    BitReversePermuteAVX512(result, operand, n);
+    return;
+  }
+#endif
+  HEXL_VLOG(3, "Calling BitReversePermuteNative");
+  BitReversePermuteNative(result, operand, n);
+}
+
+void BitReversePermuteInPlace(uint64_t* operand, uint64_t n) {
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && n >= s_bit_reverse_tile * s_bit_reverse_tile) {
+    HEXL_VLOG(3, "Calling BitReversePermuteInPlaceAVX512");
+    BitReversePermuteInPlaceAVX512(operand, n);
+    return;
+  }
+#endif
+  HEXL_VLOG(3, "Calling BitReversePermuteInPlaceNative");
+  BitReversePermuteInPlaceNative(operand, n);
+}
+
+void BitReversePermute(uint32_t* result, const uint32_t* operand, uint64_t n) {
+  HEXL_CHECK(result != nullptr, "Require result != nullptr");
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (result == operand) {
+    BitReversePermuteInPlace(result, n);
+    return;
+  }
+  HEXL_CHECK(result + n <= operand || operand + n <= result,
+             "result and operand overlap");
+  BitReversePermuteNative(result, operand, n);
+}
+
+void BitReversePermuteInPlace(uint32_t* operand, uint64_t n) {
+  HEXL_CHECK(operand != nullptr, "Require operand != nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  BitReversePermuteInPlaceNative(operand, n);
+}
+
+void BitReversePermuteNative(uint64_t* result, const uint64_t* operand,
+                             uint64_t n) {
+  BitReversePermuteTiled(result, operand, n);
+}
+
+void BitReversePermuteNative(uint32_t* result, const uint32_t* operand,
+                             uint64_t n) {
+  BitReversePermuteTiled(result, operand, n);
+}
+
+void BitReversePermuteInPlaceNative(uint64_t* operand, uint64_t n) {
+  BitReversePermuteInPlaceTiled(operand, n);
+}
+
+void BitReversePermuteInPlaceNative(uint32_t* operand, uint64_t n) {
+  BitReversePermuteInPlaceTiled(operand, n);
+}
+
+}  // namespace hexl
+}  // namespace intel
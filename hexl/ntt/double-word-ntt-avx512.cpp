@@ -0,0 +1,255 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/double-word-ntt-avx512.hpp"
+
+#include <immintrin.h>
+
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "ntt/ntt-avx512-util.hpp"
+#include "util/avx512-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512IFMA
+
+namespace {
+
+// Cooley-Tukey butterfly: X, Y -> X + W * Y, X - W * Y
+inline void DoubleWordFwdButterfly(__m512i* X, __m512i* Y, const __m512i* W,
+                                   const __m512i* q, __m512i q_inv) {
+  __m512i T[3];
+  _mm512_hexl_dw_montmul_epu52(T, W, Y, q, q_inv);
+  _mm512_hexl_dw_sub_mod_epu52(Y, X, T, q);
+  _mm512_hexl_dw_add_mod_epu52(X, X, T, q);
+}
+
+// Gentleman-Sande butterfly: X, Y -> X + Y, W * (X - Y)
+inline void DoubleWordInvButterfly(__m512i* X, __m512i* Y, const __m512i* W,
+                                   const __m512i* q, __m512i q_inv) {
+  __m512i T[3];
+  _mm512_hexl_dw_sub_mod_epu52(T, X, Y, q);
+  _mm512_hexl_dw_add_mod_epu52(X, X, Y, q);
+  _mm512_hexl_dw_montmul_epu52(Y, W, T, q, q_inv);
+}
+
+// Broadcasts the double-word value x into limbs
+inline void DoubleWordSet1(DoubleWord x, __m512i* v) {
+  _mm512_hexl_dw_split_epu64(_mm512_set1_epi64(static_cast<int64_t>(x.lo)),
+                             _mm512_set1_epi64(static_cast<int64_t>(x.hi)), v);
+}
+
+// Broadcasts entry j of the limb-planar table W with planes of n limbs
+inline void DoubleWordBroadcastTwiddle(const uint64_t* W, uint64_t n, size_t j,
+                                       __m512i* v) {
+  for (size_t l = 0; l < 3; ++l) {
+    v[l] = _mm512_set1_epi64(static_cast<int64_t>(W[l * n + j]));
+  }
+}
+
+// Copies the n double-word values in operand into three planes of n limbs
+inline void DoubleWordToPlanes(const DoubleWord* operand, uint64_t n,
+                               uint64_t* planes) {
+  const uint64_t* words = reinterpret_cast<const uint64_t*>(operand);
+  for (size_t j = 0; j < n; j += 8) {
+    __m512i v[3];
+    _mm512_hexl_dw_loadu_epu64(words + 2 * j, v);
+    for (size_t l = 0; l < 3; ++l) {
+      _mm512_storeu_si512(planes + l * n + j, v[l]);
+    }
+  }
+}
+
+// Inverse of DoubleWordToPlanes
+inline void DoubleWordFromPlanes(const uint64_t* planes, uint64_t n,
+                                 DoubleWord* operand) {
+  uint64_t* words = reinterpret_cast<uint64_t*>(operand);
+  for (size_t j = 0; j < n; j += 8) {
+    __m512i v[3];
+    for (size_t l = 0; l < 3; ++l) {
+      v[l] = _mm512_loadu_si512(planes + l * n + j);
+    }
+    _mm512_hexl_dw_storeu_epu64(words + 2 * j, v);
+  }
+}
+
+// Stage with butterfly distance t >= 8 on the limb planes of length n
+template <bool Inverse>
+inline void DoubleWordBroadcastStage(uint64_t* planes, uint64_t n, size_t m,
+                                     size_t t, const uint64_t* W,
+                                     const __m512i* q, __m512i q_inv) {
+  size_t j1 = 0;
+  for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+    __m512i v_W[3];
+    DoubleWordBroadcastTwiddle(W, n, m + i, v_W);
+
+    HEXL_LOOP_UNROLL_4
+    for (size_t j = j1; j < j1 + t; j += 8) {
+      __m512i v_X[3];
+      __m512i v_Y[3];
+      for (size_t l = 0; l < 3; ++l) {
+        v_X[l] = _mm512_loadu_si512(planes + l * n + j);
+        v_Y[l] = _mm512_loadu_si512(planes + l * n + j + t);
+      }
+      if (Inverse) {
+        DoubleWordInvButterfly(v_X, v_Y, v_W, q, q_inv);
+      } else {
+        DoubleWordFwdButterfly(v_X, v_Y, v_W, q, q_inv);
+      }
+      for (size_t l = 0; l < 3; ++l) {
+        _mm512_storeu_si512(planes + l * n + j, v_X[l]);
+        _mm512_storeu_si512(planes + l * n + j + t, v_Y[l]);
+      }
+    }
+  }
+}
+
+// Stage with butterfly distance T on the 16 coefficients held in limbs v1, v2,
+// using the twiddle factors of their groups in the limb-planar table W
+template <int T, bool Inverse>
+inline void DoubleWordRegisterStage(__m512i* v1, __m512i* v2, const uint64_t* W,
+                                    uint64_t n, const __m512i* q,
+                                    __m512i q_inv) {
+  __m512i X[3];
+  __m512i Y[3];
+  __m512i v_W[3];
+  for (size_t l = 0; l < 3; ++l) {
+    SplitButterflyOperands<T>(v1[l], v2[l], &X[l], &Y[l]);
+    v_W[l] = LoadButterflyTwiddles<T>(W + l * n);
+  }
+  if (Inverse) {
+    DoubleWordInvButterfly(X, Y, v_W, q, q_inv);
+  } else {
+    DoubleWordFwdButterfly(X, Y, v_W, q, q_inv);
+  }
+  for (size_t l = 0; l < 3; ++l) {
+    MergeButterflyOperands<T>(X[l], Y[l], &v1[l], &v2[l]);
+  }
+}
+
+}  // namespace
+
+void ForwardTransformToBitReverseDoubleWordAVX512(
+    DoubleWord* operand, uint64_t n, const uint64_t* root_of_unity_powers,
+    const DoubleWordModulus& modulus) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  HEXL_CHECK(n >= 16, "n " << n << " is less than 16");
+
+  __m512i v_q[3];
+  DoubleWordSet1(modulus.Modulus(), v_q);
+  __m512i v_q_inv = _mm512_set1_epi64(
+      static_cast<int64_t>(modulus.NegInverse().lo & ((1ULL << 52) - 1)));
+
+  AlignedVector64<uint64_t> planes(3 * n);
+  DoubleWordToPlanes(operand, n, planes.data());
+
+  size_t m = 1;
+  for (size_t t = (n >> 1); t >= 8; m <<= 1, t >>= 1) {
+    DoubleWordBroadcastStage<false>(planes.data(), n, m, t,
+                                    root_of_unity_powers, v_q, v_q_inv);
+  }
+
+  // The last three stages, with n / 8, n / 4 and n / 2 groups
+  const uint64_t* W4 = root_of_unity_powers + (n >> 3);
+  const uint64_t* W2 = root_of_unity_powers + (n >> 2);
+  const uint64_t* W1 = root_of_unity_powers + (n >> 1);
+  for (size_t j = 0; j < n; j += 16) {
+    __m512i v1[3];
+    __m512i v2[3];
+    for (size_t l = 0; l < 3; ++l) {
+      v1[l] = _mm512_loadu_si512(planes.data() + l * n + j);
+      v2[l] = _mm512_loadu_si512(planes.data() + l * n + j + 8);
+    }
+    DoubleWordRegisterStage<4, false>(v1, v2, W4 + j / 8, n, v_q, v_q_inv);
+    DoubleWordRegisterStage<2, false>(v1, v2, W2 + j / 4, n, v_q, v_q_inv);
+    DoubleWordRegisterStage<1, false>(v1, v2, W1 + j / 2, n, v_q, v_q_inv);
+    for (size_t l = 0; l < 3; ++l) {
+      _mm512_storeu_si512(planes.data() + l * n + j, v1[l]);
+      _mm512_storeu_si512(planes.data() + l * n + j + 8, v2[l]);
+    }
+  }
+
+  DoubleWordFromPlanes(planes.data(), n, operand);
+}
+
+void InverseTransformFromBitReverseDoubleWordAVX512(
+    DoubleWord* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    const DoubleWordModulus& modulus, DoubleWord inv_n) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+  HEXL_CHECK(n >= 16, "n " << n << " is less than 16");
+
+  __m512i v_q[3];
+  DoubleWordSet1(modulus.Modulus(), v_q);
+  __m512i v_q_inv = _mm512_set1_epi64(
+      static_cast<int64_t>(modulus.NegInverse().lo & ((1ULL << 52) - 1)));
+
+  AlignedVector64<uint64_t> planes(3 * n);
+  DoubleWordToPlanes(operand, n, planes.data());
+
+  // The first three stages, with n / 2, n / 4 and n / 8 groups
+  const uint64_t* W1 = inv_root_of_unity_powers + (n >> 1);
+  const uint64_t* W2 = inv_root_of_unity_powers + (n >> 2);
+  const uint64_t* W4 = inv_root_of_unity_powers + (n >> 3);
+  for (size_t j = 0; j < n; j += 16) {
+    __m512i v1[3];
+    __m512i v2[3];
+    for (size_t l = 0; l < 3; ++l) {
+      v1[l] = _mm512_loadu_si512(planes.data() + l * n + j);
+      v2[l] = _mm512_loadu_si512(planes.data() + l * n + j + 8);
+    }
+    DoubleWordRegisterStage<1, true>(v1, v2, W1 + j / 2, n, v_q, v_q_inv);
+    DoubleWordRegisterStage<2, true>(v1, v2, W2 + j / 4, n, v_q, v_q_inv);
+    DoubleWordRegisterStage<4, true>(v1, v2, W4 + j / 8, n, v_q, v_q_inv);
+    for (size_t l = 0; l < 3; ++l) {
+      _mm512_storeu_si512(planes.data() + l * n + j, v1[l]);
+      _mm512_storeu_si512(planes.data() + l * n + j + 8, v2[l]);
+    }
+  }
+
+  size_t t = 8;
+  for (size_t m = (n >> 4); m > 1; m >>= 1, t <<= 1) {
+    DoubleWordBroadcastStage<true>(planes.data(), n, m, t,
+                                   inv_root_of_unity_powers, v_q, v_q_inv);
+  }
+
+  // Final stage, merging the multiplication by n^{-1}
+  __m512i v_inv_n[3];
+  DoubleWordSet1(inv_n, v_inv_n);
+  __m512i v_W[3];
+  DoubleWordBroadcastTwiddle(inv_root_of_unity_powers, n, 1, v_W);
+  _mm512_hexl_dw_montmul_epu52(v_W, v_W, v_inv_n, v_q, v_q_inv);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t j = 0; j < t; j += 8) {
+    __m512i v_X[3];
+    __m512i v_Y[3];
+    for (size_t l = 0; l < 3; ++l) {
+      v_X[l] = _mm512_loadu_si512(planes.data() + l * n + j);
+      v_Y[l] = _mm512_loadu_si512(planes.data() + l * n + j + t);
+    }
+    DoubleWordInvButterfly(v_X, v_Y, v_W, v_q, v_q_inv);
+    _mm512_hexl_dw_montmul_epu52(v_X, v_X, v_inv_n, v_q, v_q_inv);
+    for (size_t l = 0; l < 3; ++l) {
+      _mm512_storeu_si512(planes.data() + l * n + j, v_X[l]);
+      _mm512_storeu_si512(planes.data() + l * n + j + t, v_Y[l]);
+    }
+  }
+
+  DoubleWordFromPlanes(planes.data(), n, operand);
+}
+
+#endif  // HEXL_HAS_AVX512IFMA
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,48 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/double-word.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512IFMA
+
+/// @brief AVX512-IFMA implementation of the forward NTT modulo a double-word
+/// prime
+/// @param[in, out] operand Input data, each less than q. Overwritten with the
+/// bit-reversed NTT output
+/// @param[in] n Size of the transform. Must be a power of two, at least 16.
+/// @param[in] root_of_unity_powers Powers of the root of unity in bit-reversed
+/// order, as w^j * 2^156 mod q split into three planes of n 52-bit limbs
+/// @param[in] modulus Modulus q
+/// @details The transform runs on a copy of the operand with each limb in its
+/// own plane, so every vector holds the same limb of 8 coefficients. Stages
+/// with butterfly distance 8 or more broadcast one twiddle factor per group;
+/// the last three stages permute pairs of registers as in the Goldilocks
+/// transform.
+void ForwardTransformToBitReverseDoubleWordAVX512(
+    DoubleWord* operand, uint64_t n, const uint64_t* root_of_unity_powers,
+    const DoubleWordModulus& modulus);
+
+/// @brief AVX512-IFMA implementation of the inverse NTT modulo a double-word
+/// prime
+/// @param[in, out] operand Input data in bit-reversed order, each less than q.
+/// Overwritten with the inverse NTT output
+/// @param[in] n Size of the transform. Must be a power of two, at least 16.
+/// @param[in] inv_root_of_unity_powers Inverse powers of the root of unity in
+/// the layout of ForwardTransformToBitReverseDoubleWordAVX512
+/// @param[in] modulus Modulus q
+/// @param[in] inv_n n^{-1} * 2^156 mod q. Merged into the last stage
+void InverseTransformFromBitReverseDoubleWordAVX512(
+    DoubleWord* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    const DoubleWordModulus& modulus, DoubleWord inv_n);
+
+#endif  // HEXL_HAS_AVX512IFMA
+
+}  // namespace hexl
+}  // namespace intel
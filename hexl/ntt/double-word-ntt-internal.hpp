@@ -0,0 +1,39 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include "hexl/number-theory/double-word.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Radix-2 native forward NTT modulo a double-word prime
+/// @param[in, out] operand Input data, each less than q. Overwritten with the
+/// bit-reversed NTT output
+/// @param[in] n Size of the transform, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] root_of_unity_powers Powers of the root of unity in bit-reversed
+/// order and Montgomery form, w^j * 2^128 mod q
+/// @param[in] modulus Modulus q
+void ForwardTransformToBitReverseDoubleWord(
+    DoubleWord* operand, uint64_t n, const DoubleWord* root_of_unity_powers,
+    const DoubleWordModulus& modulus);
+
+/// @brief Radix-2 native inverse NTT modulo a double-word prime
+/// @param[in, out] operand Input data in bit-reversed order, each less than q.
+/// Overwritten with the inverse NTT output
+/// @param[in] n Size of the transform, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] inv_root_of_unity_powers Inverse powers of the root of unity in
+/// bit-reversed order and Montgomery form
+/// @param[in] modulus Modulus q
+/// @param[in] inv_n n^{-1} * 2^128 mod q. Merged into the last stage
+void InverseTransformFromBitReverseDoubleWord(
+    DoubleWord* operand, uint64_t n, const DoubleWord* inv_root_of_unity_powers,
+    const DoubleWordModulus& modulus, DoubleWord inv_n);
+
+}  // namespace hexl
+}  // namespace intel
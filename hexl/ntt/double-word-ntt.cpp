@@ -0,0 +1,258 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/ntt/double-word-ntt.hpp"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "ntt/double-word-ntt-avx512.hpp"
+#include "ntt/double-word-ntt-internal.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+void BitReversePermuteInPlace(DoubleWord* operand, uint64_t n) {
+  uint64_t log_n = Log2(n);
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t j = ReverseBits(i, log_n);
+    if (i < j) {
+      std::swap(operand[i], operand[j]);
+    }
+  }
+}
+
+// Returns 2^exp mod q
+DoubleWord PowerOfTwoMod(uint64_t exp, const DoubleWordModulus& modulus) {
+  return PowModDoubleWord(DoubleWord{2, 0}, DoubleWord{exp, 0}, modulus);
+}
+
+}  // namespace
+
+DoubleWordNTT::DoubleWordNTT(uint64_t degree, DoubleWord q,
+                             std::shared_ptr<AllocatorBase> alloc_ptr)
+    : DoubleWordNTT(
+          degree, q,
+          GeneratePrimitiveRootDoubleWord(2 * degree, DoubleWordModulus(q)),
+          alloc_ptr) {}
+
+DoubleWordNTT::DoubleWordNTT(uint64_t degree, DoubleWord q,
+                             DoubleWord root_of_unity,
+                             std::shared_ptr<AllocatorBase> alloc_ptr)
+    : m_degree(degree),
+      m_modulus(q),
+      m_w(root_of_unity),
+      m_alloc(alloc_ptr),
+      m_aligned_alloc(AlignedAllocator<DoubleWord, 64>(m_alloc)),
+      m_aligned_limb_alloc(AlignedAllocator<uint64_t, 64>(m_alloc)),
+      m_root_of_unity_powers(m_aligned_alloc),
+      m_inv_root_of_unity_powers(m_aligned_alloc),
+      m_avx512_root_of_unity_powers(m_aligned_limb_alloc),
+      m_avx512_inv_root_of_unity_powers(m_aligned_limb_alloc) {
+  HEXL_CHECK(IsPowerOfTwo(degree),
+             "degree " << degree << " is not a power of 2");
+  HEXL_CHECK((q.lo % (2 * degree)) == 1, "modulus " << q << " mod 2N != 1");
+  HEXL_CHECK(root_of_unity < q, "root_of_unity " << root_of_unity
+                                                 << " exceeds modulus " << q);
+  HEXL_CHECK(PowModDoubleWord(root_of_unity, DoubleWord{degree, 0},
+                              m_modulus) == SubDoubleWord(q, DoubleWord{1, 0}),
+             "root_of_unity " << root_of_unity
+                              << " is not a primitive 2N'th root of unity");
+
+  ComputeRootOfUnityPowers();
+}
+
+void DoubleWordNTT::ComputeRootOfUnityPowers() {
+  const uint64_t n = m_degree;
+  const DoubleWord q = m_modulus.Modulus();
+
+  // Powers w^j for j = 0, ..., n - 1
+  std::vector<DoubleWord> powers(n, DoubleWord{1, 0});
+  for (size_t j = 1; j < n; ++j) {
+    powers[j] = MultiplyModDoubleWord(powers[j - 1], m_w, m_modulus);
+  }
+
+  // Entry j of the bit-reversed tables is w^ReverseBits(j) and its inverse
+  // w^(-ReverseBits(j)) = -w^(n - ReverseBits(j)), since w^n = -1
+  const DoubleWord r128 = PowerOfTwoMod(128, m_modulus);
+  const uint64_t log_n = Log2(n);
+  m_root_of_unity_powers.resize(n);
+  m_inv_root_of_unity_powers.resize(n);
+  std::vector<DoubleWord> inv_powers(n);
+  for (size_t j = 0; j < n; ++j) {
+    uint64_t k = ReverseBits(j, log_n);
+    DoubleWord inv_power =
+        (k == 0) ? DoubleWord{1, 0} : SubDoubleWord(q, powers[n - k]);
+    inv_powers[j] = inv_power;
+    m_root_of_unity_powers[j] =
+        MultiplyModDoubleWord(powers[k], r128, m_modulus);
+    m_inv_root_of_unity_powers[j] =
+        MultiplyModDoubleWord(inv_power, r128, m_modulus);
+  }
+  DoubleWord inv_degree = InverseModDoubleWord(DoubleWord{n, 0}, m_modulus);
+  m_inv_degree = MultiplyModDoubleWord(inv_degree, r128, m_modulus);
+
+#ifdef HEXL_HAS_AVX512IFMA
+  if (has_avx512ifma && n >= 16) {
+    const uint64_t mask52 = (1ULL << 52) - 1;
+    const DoubleWord r156 = PowerOfTwoMod(156, m_modulus);
+    m_avx512_root_of_unity_powers.resize(3 * n);
+    m_avx512_inv_root_of_unity_powers.resize(3 * n);
+    for (size_t j = 0; j < n; ++j) {
+      DoubleWord w = MultiplyModDoubleWord(powers[ReverseBits(j, log_n)],
+                                           r156, m_modulus);
+      DoubleWord inv_w = MultiplyModDoubleWord(inv_powers[j], r156, m_modulus);
+      m_avx512_root_of_unity_powers[j] = w.lo & mask52;
+      m_avx512_root_of_unity_powers[n + j] =
+          ((w.lo >> 52) | (w.hi << 12)) & mask52;
+      m_avx512_root_of_unity_powers[2 * n + j] = w.hi >> 40;
+      m_avx512_inv_root_of_unity_powers[j] = inv_w.lo & mask52;
+      m_avx512_inv_root_of_unity_powers[n + j] =
+          ((inv_w.lo >> 52) | (inv_w.hi << 12)) & mask52;
+      m_avx512_inv_root_of_unity_powers[2 * n + j] = inv_w.hi >> 40;
+    }
+    m_avx512_inv_degree = MultiplyModDoubleWord(inv_degree, r156, m_modulus);
+  }
+#endif
+}
+
+void DoubleWordNTT::ComputeForward(DoubleWord* result,
+                                   const DoubleWord* operand,
+                                   NTT::Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+
+  if (result != operand) {
+    std::memcpy(result, operand, m_degree * sizeof(DoubleWord));
+  }
+
+#ifdef HEXL_HAS_AVX512IFMA
+  if (!m_avx512_root_of_unity_powers.empty()) {
+    HEXL_VLOG(3, "Calling DoubleWord AVX512 FwdNTT");
+    ForwardTransformToBitReverseDoubleWordAVX512(
+        result, m_degree, m_avx512_root_of_unity_powers.data(), m_modulus);
+  } else {
+#endif
+    HEXL_VLOG(3, "Calling DoubleWord native FwdNTT");
+    ForwardTransformToBitReverseDoubleWord(
+        result, m_degree, m_root_of_unity_powers.data(), m_modulus);
+#ifdef HEXL_HAS_AVX512IFMA
+  }
+#endif
+
+  if (output_order == NTT::Ordering::kNatural) {
+    BitReversePermuteInPlace(result, m_degree);
+  }
+}
+
+void DoubleWordNTT::ComputeInverse(DoubleWord* result,
+                                   const DoubleWord* operand,
+                                   NTT::Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+
+  if (result != operand) {
+    std::memcpy(result, operand, m_degree * sizeof(DoubleWord));
+  }
+  if (input_order == NTT::Ordering::kNatural) {
+    BitReversePermuteInPlace(result, m_degree);
+  }
+
+#ifdef HEXL_HAS_AVX512IFMA
+  if (!m_avx512_inv_root_of_unity_powers.empty()) {
+    HEXL_VLOG(3, "Calling DoubleWord AVX512 InvNTT");
+    InverseTransformFromBitReverseDoubleWordAVX512(
+        result, m_degree, m_avx512_inv_root_of_unity_powers.data(), m_modulus,
+        m_avx512_inv_degree);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling DoubleWord native InvNTT");
+  InverseTransformFromBitReverseDoubleWord(
+      result, m_degree, m_inv_root_of_unity_powers.data(), m_modulus,
+      m_inv_degree);
+}
+
+void ForwardTransformToBitReverseDoubleWord(
+    DoubleWord* operand, uint64_t n, const DoubleWord* root_of_unity_powers,
+    const DoubleWordModulus& modulus) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  size_t t = (n >> 1);
+  for (size_t m = 1; m < n; m <<= 1, t >>= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      const DoubleWord W = root_of_unity_powers[m + i];
+      DoubleWord* X = operand + j1;
+      DoubleWord* Y = X + t;
+
+      for (size_t j = 0; j < t; j++) {
+        DoubleWord tx = X[j];
+        DoubleWord ty = MontgomeryMultiplyDoubleWord(W, Y[j], modulus);
+        X[j] = AddModDoubleWord(tx, ty, modulus);
+        Y[j] = SubModDoubleWord(tx, ty, modulus);
+      }
+    }
+  }
+}
+
+void InverseTransformFromBitReverseDoubleWord(
+    DoubleWord* operand, uint64_t n, const DoubleWord* inv_root_of_unity_powers,
+    const DoubleWordModulus& modulus, DoubleWord inv_n) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (n == 1) {
+    return;
+  }
+
+  size_t t = 1;
+  for (size_t m = (n >> 1); m > 1; m >>= 1, t <<= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      const DoubleWord W = inv_root_of_unity_powers[m + i];
+      DoubleWord* X = operand + j1;
+      DoubleWord* Y = X + t;
+
+      for (size_t j = 0; j < t; j++) {
+        DoubleWord tx = X[j];
+        DoubleWord ty = Y[j];
+        X[j] = AddModDoubleWord(tx, ty, modulus);
+        Y[j] = MontgomeryMultiplyDoubleWord(
+            W, SubModDoubleWord(tx, ty, modulus), modulus);
+      }
+    }
+  }
+
+  // Final stage, merging the multiplication by n^{-1}
+  const DoubleWord W =
+      MontgomeryMultiplyDoubleWord(inv_root_of_unity_powers[1], inv_n, modulus);
+  DoubleWord* X = operand;
+  DoubleWord* Y = X + t;
+  for (size_t j = 0; j < t; j++) {
+    DoubleWord tx = X[j];
+    DoubleWord ty = Y[j];
+    X[j] = MontgomeryMultiplyDoubleWord(AddModDoubleWord(tx, ty, modulus),
+                                        inv_n, modulus);
+    Y[j] = MontgomeryMultiplyDoubleWord(W, SubModDoubleWord(tx, ty, modulus),
+                                        modulus);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,176 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/fwd-ntt-avx2.hpp"
+
+#include <immintrin.h>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "util/avx2-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+template void ForwardTransformToBitReverseAVX2<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void ForwardTransformToBitReverseAVX2<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+/// @brief The Harvey butterfly: assume \p X, \p Y in [0, 4q), and return X', Y'
+/// in [0, 4q) such that X', Y' = X + WY, X - WY (mod q).
+template <int BitShift>
+inline void FwdButterflyAVX2(__m256i* X, __m256i* Y, __m256i W_op,
+                             __m256i W_precon, __m256i modulus,
+                             __m256i twice_modulus) {
+  *X = _mm256_hexl_small_mod_epu64(*X, twice_modulus);
+  __m256i T = _mm256_hexl_mulmod_lazy_epi64<BitShift>(*Y, W_op, W_precon,
+                                                      modulus, twice_modulus);
+  *Y = _mm256_add_epi64(*X, _mm256_sub_epi64(twice_modulus, T));
+  *X = _mm256_add_epi64(*X, T);
+}
+
+template <int BitShift>
+void ForwardTransformToBitReverseAVX2(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(n >= 8,
+             "ForwardTransformToBitReverseAVX2 doesn't support small "
+             "transforms. Need n >= 8, got n = "
+                 << n);
+  HEXL_CHECK(BitShift == 64 || modulus < NTT::s_max_fwd_32_modulus,
+             "modulus " << modulus << " too large for BitShift " << BitShift);
+  HEXL_CHECK_BOUNDS(operand, n, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  __m256i v_modulus = _mm256_set1_epi64x(static_cast<int64_t>(modulus));
+  __m256i v_twice_mod = _mm256_set1_epi64x(static_cast<int64_t>(modulus << 1));
+
+  size_t t = (n >> 1);
+  size_t m = 1;
+
+  // t >= 4: each vector holds four X or four Y inputs sharing one root. The
+  // first stage reads from operand, the others from result.
+  const uint64_t* input = operand;
+  for (; t >= 4; t >>= 1, m <<= 1, input = result) {
+    for (size_t i = 0; i < m; i++) {
+      __m256i v_W_op =
+          _mm256_set1_epi64x(static_cast<int64_t>(root_of_unity_powers[m + i]));
+      __m256i v_W_precon = _mm256_set1_epi64x(
+          static_cast<int64_t>(precon_root_of_unity_powers[m + i]));
+
+      const __m256i* v_X_op_pt =
+          reinterpret_cast<const __m256i*>(input + 2 * t * i);
+      const __m256i* v_Y_op_pt =
+          reinterpret_cast<const __m256i*>(input + 2 * t * i + t);
+      __m256i* v_X_pt = reinterpret_cast<__m256i*>(result + 2 * t * i);
+      __m256i* v_Y_pt = reinterpret_cast<__m256i*>(result + 2 * t * i + t);
+      for (size_t j = t / 4; j > 0; --j) {
+        __m256i v_X = _mm256_loadu_si256(v_X_op_pt++);
+        __m256i v_Y = _mm256_loadu_si256(v_Y_op_pt++);
+
+        FwdButterflyAVX2<BitShift>(&v_X, &v_Y, v_W_op, v_W_precon, v_modulus,
+                                   v_twice_mod);
+
+        _mm256_storeu_si256(v_X_pt++, v_X);
+        _mm256_storeu_si256(v_Y_pt++, v_Y);
+      }
+    }
+  }
+
+  // t = 2: loads X0 X1 Y0 Y1 | X2 X3 Y2 Y3 and transposes the 128-bit halves
+  {
+    const uint64_t* W_op = root_of_unity_powers + m;
+    const uint64_t* W_precon = precon_root_of_unity_powers + m;
+    __m256i* v_pt = reinterpret_cast<__m256i*>(result);
+    for (size_t i = 0; i < m; i += 2) {
+      __m256i v_0 = _mm256_loadu_si256(v_pt);
+      __m256i v_1 = _mm256_loadu_si256(v_pt + 1);
+      __m256i v_X = _mm256_permute2x128_si256(v_0, v_1, 0x20);
+      __m256i v_Y = _mm256_permute2x128_si256(v_0, v_1, 0x31);
+
+      // W_0 W_0 W_1 W_1
+      __m256i v_W_op = _mm256_permute4x64_epi64(
+          _mm256_castsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(W_op + i))),
+          0x50);
+      __m256i v_W_precon = _mm256_permute4x64_epi64(
+          _mm256_castsi128_si256(
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(W_precon + i))),
+          0x50);
+
+      FwdButterflyAVX2<BitShift>(&v_X, &v_Y, v_W_op, v_W_precon, v_modulus,
+                                 v_twice_mod);
+
+      _mm256_storeu_si256(v_pt++, _mm256_permute2x128_si256(v_X, v_Y, 0x20));
+      _mm256_storeu_si256(v_pt++, _mm256_permute2x128_si256(v_X, v_Y, 0x31));
+    }
+    m <<= 1;
+  }
+
+  // t = 1: loads X0 Y0 X1 Y1 | X2 Y2 X3 Y3 and unpacks into X0 X2 X1 X3 and
+  // Y0 Y2 Y1 Y3
+  {
+    const uint64_t* W_op = root_of_unity_powers + m;
+    const uint64_t* W_precon = precon_root_of_unity_powers + m;
+    __m256i* v_pt = reinterpret_cast<__m256i*>(result);
+    for (size_t i = 0; i < m; i += 4) {
+      __m256i v_0 = _mm256_loadu_si256(v_pt);
+      __m256i v_1 = _mm256_loadu_si256(v_pt + 1);
+      __m256i v_X = _mm256_unpacklo_epi64(v_0, v_1);
+      __m256i v_Y = _mm256_unpackhi_epi64(v_0, v_1);
+
+      // W_0 W_2 W_1 W_3
+      __m256i v_W_op = _mm256_permute4x64_epi64(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(W_op + i)),
+          0xd8);
+      __m256i v_W_precon = _mm256_permute4x64_epi64(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(W_precon + i)),
+          0xd8);
+
+      FwdButterflyAVX2<BitShift>(&v_X, &v_Y, v_W_op, v_W_precon, v_modulus,
+                                 v_twice_mod);
+
+      _mm256_storeu_si256(v_pt++, _mm256_unpacklo_epi64(v_X, v_Y));
+      _mm256_storeu_si256(v_pt++, _mm256_unpackhi_epi64(v_X, v_Y));
+    }
+  }
+
+  if (output_mod_factor == 1) {
+    // Reduce from [0, 4q) to [0, q)
+    __m256i* v_X_pt = reinterpret_cast<__m256i*>(result);
+    for (size_t i = 0; i < n; i += 4) {
+      __m256i v_X = _mm256_loadu_si256(v_X_pt);
+      v_X = _mm256_hexl_small_mod_epu64(v_X, v_twice_mod);
+      v_X = _mm256_hexl_small_mod_epu64(v_X, v_modulus);
+      _mm256_storeu_si256(v_X_pt++, v_X);
+    }
+    HEXL_CHECK_BOUNDS(result, n, modulus,
+                      "Incorrect modulus reduction in NTT");
+  }
+}
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
@@ -3,6 +3,7 @@
 
 #include "ntt/fwd-ntt-avx512.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <vector>
 
@@ -18,27 +19,173 @@ namespace hexl {
 
 #ifdef HEXL_HAS_AVX512IFMA
 template void ForwardTransformToBitReverseAVX512<NTT::s_ifma_shift_bits>(
-    uint64_t* operand, uint64_t degree, uint64_t mod,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
     const uint64_t* root_of_unity_powers,
     const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth,
-    uint64_t recursion_half);
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512FirstStages<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t num_blocks,
+    uint64_t slice);
+
+template void
+ForwardTransformToBitReverseAVX512Rows<NTT::s_ifma_shift_bits, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512Rows<NTT::s_ifma_shift_bits, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512Parallel<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512FourStep<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
 #endif
 
 #ifdef HEXL_HAS_AVX512DQ
 template void ForwardTransformToBitReverseAVX512<32>(
-    uint64_t* operand, uint64_t degree, uint64_t mod,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
     const uint64_t* root_of_unity_powers,
     const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth,
-    uint64_t recursion_half);
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void ForwardTransformToBitReverseAVX512FirstStages<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t num_blocks,
+    uint64_t slice);
+
+template void ForwardTransformToBitReverseAVX512Rows<32, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void ForwardTransformToBitReverseAVX512Rows<32, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void ForwardTransformToBitReverseAVX512Parallel<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void ForwardTransformToBitReverseAVX512FourStep<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void ForwardTransformToBitReverseStridedAVX512<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t stride, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void ForwardTransformToBitReverseBatchAVX512<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t mod, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
 
 template void ForwardTransformToBitReverseAVX512<NTT::s_default_shift_bits>(
-    uint64_t* operand, uint64_t degree, uint64_t mod,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
     const uint64_t* root_of_unity_powers,
     const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth,
-    uint64_t recursion_half);
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512FirstStages<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t num_blocks,
+    uint64_t slice);
+
+template void
+ForwardTransformToBitReverseAVX512Rows<NTT::s_default_shift_bits, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512Rows<NTT::s_default_shift_bits, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512Parallel<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseAVX512FourStep<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+ForwardTransformToBitReverseStridedAVX512<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t stride, uint64_t mod,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void
+ForwardTransformToBitReverseBatchAVX512<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t mod, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
 #endif
 
 #ifdef HEXL_HAS_AVX512DQ
@@ -81,130 +228,334 @@ inline void FwdButterfly(__m512i* X, __m512i* Y, __m512i W_op, __m512i W_precon,
   *X = _mm512_add_epi64(*X, T);
 }
 
-template <int BitShift>
-void FwdT1(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t m, const uint64_t* W_op, const uint64_t* W_precon) {
-  const __m512i* v_W_op_pt = reinterpret_cast<const __m512i*>(W_op);
-  const __m512i* v_W_precon_pt = reinterpret_cast<const __m512i*>(W_precon);
+/// @brief Computes the forward stage of m groups of butterflies on elements t
+/// apart, reading from \p operand and writing to \p result, which may be
+/// equal
+template <int BitShift, bool InputLessThanMod>
+void FwdT8(uint64_t* result, const uint64_t* operand, __m512i v_neg_modulus,
+           __m512i v_twice_mod, uint64_t t, uint64_t m, const uint64_t* W_op,
+           const uint64_t* W_precon) {
   size_t j1 = 0;
 
-  // 8 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_8
-  for (size_t i = m / 8; i > 0; --i) {
-    uint64_t* X = operand + j1;
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < m; i++) {
+    const uint64_t* X_op = operand + j1;
+    const uint64_t* Y_op = X_op + t;
+    uint64_t* X_r = result + j1;
+    uint64_t* Y_r = X_r + t;
+
+    __m512i v_W_op = _mm512_set1_epi64(static_cast<int64_t>(*W_op++));
+    __m512i v_W_precon = _mm512_set1_epi64(static_cast<int64_t>(*W_precon++));
 
-    __m512i v_X;
-    __m512i v_Y;
-    LoadFwdInterleavedT1(X, &v_X, &v_Y);
-    __m512i v_W_op = _mm512_loadu_si512(v_W_op_pt++);
-    __m512i v_W_precon = _mm512_loadu_si512(v_W_precon_pt++);
+    const __m512i* v_X_op_pt = reinterpret_cast<const __m512i*>(X_op);
+    const __m512i* v_Y_op_pt = reinterpret_cast<const __m512i*>(Y_op);
+    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X_r);
+    __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y_r);
 
-    FwdButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon, v_neg_modulus,
-                                  v_twice_mod);
-    WriteFwdInterleavedT1(v_X, v_Y, v_X_pt);
+    // assume 8 | t
+    for (size_t j = t / 8; j > 0; --j) {
+      __m512i v_X = _mm512_loadu_si512(v_X_op_pt++);
+      __m512i v_Y = _mm512_loadu_si512(v_Y_op_pt++);
+
+      FwdButterfly<BitShift, InputLessThanMod>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                               v_neg_modulus, v_twice_mod);
 
-    j1 += 16;
+      _mm512_storeu_si512(v_X_pt++, v_X);
+      _mm512_storeu_si512(v_Y_pt++, v_Y);
+    }
+    j1 += (t << 1);
   }
 }
 
-template <int BitShift>
-void FwdT2(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t m, const uint64_t* W_op, const uint64_t* W_precon) {
-  const __m512i* v_W_op_pt = reinterpret_cast<const __m512i*>(W_op);
-  const __m512i* v_W_precon_pt = reinterpret_cast<const __m512i*>(W_precon);
+/// @brief Computes the forward stage of m groups of butterflies on elements t
+/// apart on NumRows rows at once, with row r reading from \p operand[r] and
+/// writing to \p result[r], which may be equal
+/// @param[in] v_neg_modulus Negative modulus of each row
+/// @param[in] v_twice_mod Twice the modulus of each row
+/// @param[in] W_op Roots of unity of each row for this stage
+/// @param[in] W_precon Pre-conditioned roots of unity of each row for this
+/// stage
+/// @details Each inner iteration computes one vector of butterflies on every
+/// row, so the butterflies of different rows are independent and fill the
+/// multiplier latency of each other.
+template <int BitShift, bool InputLessThanMod, size_t NumRows>
+void FwdT8Rows(uint64_t* const* result, const uint64_t* const* operand,
+               const __m512i* v_neg_modulus, const __m512i* v_twice_mod,
+               uint64_t t, uint64_t m, const uint64_t* const* W_op,
+               const uint64_t* const* W_precon) {
+  // Local copies of the row pointers and moduli, which the stores can't
+  // alias, so they stay in registers
+  uint64_t* X_r[NumRows];
+  const uint64_t* X_op[NumRows];
+  __m512i v_neg_mod[NumRows];
+  __m512i v_twice_q[NumRows];
+  for (size_t r = 0; r < NumRows; ++r) {
+    X_r[r] = result[r];
+    X_op[r] = operand[r];
+    v_neg_mod[r] = v_neg_modulus[r];
+    v_twice_q[r] = v_twice_mod[r];
+  }
 
   size_t j1 = 0;
-  // 4 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = m / 4; i > 0; --i) {
-    uint64_t* X = operand + j1;
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
-
-    __m512i v_X;
-    __m512i v_Y;
-    LoadFwdInterleavedT2(X, &v_X, &v_Y);
-
-    __m512i v_W_op = _mm512_loadu_si512(v_W_op_pt++);
-    __m512i v_W_precon = _mm512_loadu_si512(v_W_precon_pt++);
-
-    HEXL_CHECK(ExtractValues(v_W_op)[0] == ExtractValues(v_W_op)[1],
-               "bad v_W_op " << ExtractValues(v_W_op));
-    HEXL_CHECK(ExtractValues(v_W_precon)[0] == ExtractValues(v_W_precon)[1],
-               "bad v_W_precon " << ExtractValues(v_W_precon));
-    FwdButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon, v_neg_modulus,
-                                  v_twice_mod);
-
-    _mm512_storeu_si512(v_X_pt++, v_X);
-    _mm512_storeu_si512(v_X_pt, v_Y);
+  for (size_t i = 0; i < m; i++) {
+    __m512i v_W_op[NumRows];
+    __m512i v_W_precon[NumRows];
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRows; ++r) {
+      v_W_op[r] = _mm512_set1_epi64(static_cast<int64_t>(W_op[r][i]));
+      v_W_precon[r] = _mm512_set1_epi64(static_cast<int64_t>(W_precon[r][i]));
+    }
 
-    j1 += 16;
+    // assume 8 | t
+    for (size_t j = j1; j < j1 + t; j += 8) {
+      // The rows are a multiple of 4KB apart, so all the loads are issued
+      // before any store, which would falsely alias the next row's loads
+      __m512i v_X[NumRows];
+      __m512i v_Y[NumRows];
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        v_X[r] = _mm512_loadu_si512(X_op[r] + j);
+        v_Y[r] = _mm512_loadu_si512(X_op[r] + j + t);
+      }
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        FwdButterfly<BitShift, InputLessThanMod>(&v_X[r], &v_Y[r], v_W_op[r],
+                                                 v_W_precon[r],
+                                                 v_neg_mod[r], v_twice_q[r]);
+      }
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        _mm512_storeu_si512(X_r[r] + j, v_X[r]);
+        _mm512_storeu_si512(X_r[r] + j + t, v_Y[r]);
+      }
+    }
+    j1 += (t << 1);
   }
 }
 
-template <int BitShift>
-void FwdT4(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t m, const uint64_t* W_op, const uint64_t* W_precon) {
-  size_t j1 = 0;
-  const __m512i* v_W_op_pt = reinterpret_cast<const __m512i*>(W_op);
-  const __m512i* v_W_precon_pt = reinterpret_cast<const __m512i*>(W_precon);
+/// @brief Computes the last log2(8 * NumRegs) stages of the forward NTT,
+/// i.e. t = 4 * NumRegs, ..., 2, 1, on blocks of 8 * NumRegs coefficients.
+/// Each block is loaded into NumRegs registers once and shuffled in registers
+/// between the stages, rather than stored and re-loaded after every stage.
+/// @param[in] W_op Roots of unity for each stage. The first log2(NumRegs)
+/// stages broadcast one root per group; the stages t = 4, 2, 1 load one vector
+/// of roots per 16 coefficients, in the AVX512 root of unity layout.
+/// @param[in] W_precon Pre-conditioned roots of unity for each stage
+/// @param[in] reduce_output If true, reduces the output from [0, 4q) to [0, q)
+/// @param InputLessThanMod If true, assumes the input to the first stage is
+/// in [0, 2q)
+/// @details Loads each block from \p operand and stores it to \p result,
+/// which may be equal.
+template <int BitShift, int NumRegs, bool InputLessThanMod>
+void FwdLastStages(uint64_t* result, const uint64_t* operand, uint64_t n,
+                   __m512i v_modulus, __m512i v_neg_modulus,
+                   __m512i v_twice_mod, const uint64_t* const* W_op,
+                   const uint64_t* const* W_precon, bool reduce_output) {
+  static_assert(NumRegs == 2 || NumRegs == 4 || NumRegs == 8,
+                "NumRegs must be 2, 4, or 8");
+  const size_t num_bcast_stages = (NumRegs == 8) ? 3 : (NumRegs == 4) ? 2 : 1;
+  const size_t block_size = 8 * NumRegs;
+  const __m512i* v_W_op_T4 = reinterpret_cast<const __m512i*>(
+      W_op[num_bcast_stages]);
+  const __m512i* v_W_precon_T4 = reinterpret_cast<const __m512i*>(
+      W_precon[num_bcast_stages]);
+  const __m512i* v_W_op_T2 = reinterpret_cast<const __m512i*>(
+      W_op[num_bcast_stages + 1]);
+  const __m512i* v_W_precon_T2 = reinterpret_cast<const __m512i*>(
+      W_precon[num_bcast_stages + 1]);
+  const __m512i* v_W_op_T1 = reinterpret_cast<const __m512i*>(
+      W_op[num_bcast_stages + 2]);
+  const __m512i* v_W_precon_T1 = reinterpret_cast<const __m512i*>(
+      W_precon[num_bcast_stages + 2]);
 
-  // 2 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = m / 2; i > 0; --i) {
-    uint64_t* X = operand + j1;
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+  for (size_t b = 0; b < n / block_size; ++b) {
+    const __m512i* v_X_op_pt =
+        reinterpret_cast<const __m512i*>(operand + b * block_size);
+    __m512i* v_X_pt = reinterpret_cast<__m512i*>(result + b * block_size);
+    __m512i v_X[NumRegs];
+    HEXL_LOOP_UNROLL_8
+    for (size_t r = 0; r < NumRegs; ++r) {
+      v_X[r] = _mm512_loadu_si512(v_X_op_pt + r);
+    }
 
-    __m512i v_X;
-    __m512i v_Y;
-    LoadFwdInterleavedT4(X, &v_X, &v_Y);
+    // Stage s has 2^s groups of butterflies on registers NumRegs / 2^(s+1)
+    // apart
+    HEXL_LOOP_UNROLL_4
+    for (size_t s = 0; s < num_bcast_stages; ++s) {
+      const size_t half = NumRegs >> (s + 1);
+      const size_t num_groups = 1ULL << s;
+      HEXL_LOOP_UNROLL_4
+      for (size_t g = 0; g < num_groups; ++g) {
+        const size_t W_idx = b * num_groups + g;
+        __m512i v_W_op =
+            _mm512_set1_epi64(static_cast<int64_t>(W_op[s][W_idx]));
+        __m512i v_W_precon =
+            _mm512_set1_epi64(static_cast<int64_t>(W_precon[s][W_idx]));
+        HEXL_LOOP_UNROLL_4
+        for (size_t r = 2 * half * g; r < 2 * half * g + half; ++r) {
+          if (InputLessThanMod && s == 0) {
+            FwdButterfly<BitShift, true>(&v_X[r], &v_X[r + half], v_W_op,
+                                         v_W_precon, v_neg_modulus,
+                                         v_twice_mod);
+          } else {
+            FwdButterfly<BitShift, false>(&v_X[r], &v_X[r + half], v_W_op,
+                                          v_W_precon, v_neg_modulus,
+                                          v_twice_mod);
+          }
+        }
+      }
+    }
 
-    __m512i v_W_op = _mm512_loadu_si512(v_W_op_pt++);
-    __m512i v_W_precon = _mm512_loadu_si512(v_W_precon_pt++);
-    FwdButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon, v_neg_modulus,
-                                  v_twice_mod);
+    // Stages t = 4, 2, 1 on each 16 coefficients. Each stage runs on all the
+    // registers before the next one, so independent butterflies are adjacent
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      FwdInterleavedT4(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      FwdButterfly<BitShift, false>(
+          &v_X[r], &v_X[r + 1], _mm512_loadu_si512(v_W_op_T4 + W_idx),
+          _mm512_loadu_si512(v_W_precon_T4 + W_idx), v_neg_modulus,
+          v_twice_mod);
+    }
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      FwdInterleavedT2(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      FwdButterfly<BitShift, false>(
+          &v_X[r], &v_X[r + 1], _mm512_loadu_si512(v_W_op_T2 + W_idx),
+          _mm512_loadu_si512(v_W_precon_T2 + W_idx), v_neg_modulus,
+          v_twice_mod);
+    }
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      FwdInterleavedT1(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      FwdButterfly<BitShift, false>(
+          &v_X[r], &v_X[r + 1], _mm512_loadu_si512(v_W_op_T1 + W_idx),
+          _mm512_loadu_si512(v_W_precon_T1 + W_idx), v_neg_modulus,
+          v_twice_mod);
+      FwdDeinterleavedT1(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+    }
 
-    _mm512_storeu_si512(v_X_pt++, v_X);
-    _mm512_storeu_si512(v_X_pt, v_Y);
+    if (reduce_output) {
+      // Reduce from [0, 4q) to [0, q)
+      HEXL_LOOP_UNROLL_8
+      for (size_t r = 0; r < NumRegs; ++r) {
+        v_X[r] = _mm512_hexl_small_mod_epu64(v_X[r], v_twice_mod);
+        v_X[r] = _mm512_hexl_small_mod_epu64(v_X[r], v_modulus);
+      }
+    }
 
-    j1 += 16;
+    HEXL_LOOP_UNROLL_8
+    for (size_t r = 0; r < NumRegs; ++r) {
+      _mm512_storeu_si512(v_X_pt + r, v_X[r]);
+    }
   }
 }
 
-template <int BitShift, bool InputLessThanMod>
-void FwdT8(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t t, uint64_t m, const uint64_t* W_op,
-           const uint64_t* W_precon) {
-  size_t j1 = 0;
-
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = 0; i < m; i++) {
-    uint64_t* X = operand + j1;
-    uint64_t* Y = X + t;
-
-    __m512i v_W_op = _mm512_set1_epi64(static_cast<int64_t>(*W_op++));
-    __m512i v_W_precon = _mm512_set1_epi64(static_cast<int64_t>(*W_precon++));
+/// @brief Computes the stages t = block_size / 2, ..., 2, 1 of the
+/// breadth-first forward NTT with FwdLastStages, where block_size = min(n, 64)
+/// @param[in] W_idx Index of the roots of unity for the stage t =
+/// block_size / 2
+/// @param[in] recursion_depth Depth of the recursive call computing this
+/// transform of size \p n
+/// @param[in] first_stage_in_regs If true, the stage t = block_size / 2 is the
+/// first stage of the transform and its input is in [0, 2q)
+/// @param[in] reduce_output If true, reduces the output from [0, 4q) to [0, q)
+template <int BitShift>
+void FwdBaseLastStages(uint64_t* result, const uint64_t* input, uint64_t n,
+                       uint64_t modulus, const uint64_t* root_of_unity_powers,
+                       const uint64_t* precon_root_of_unity_powers,
+                       size_t W_idx, uint64_t recursion_depth,
+                       bool first_stage_in_regs, bool reduce_output) {
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(modulus << 1));
+  const size_t block_size = std::min(n, static_cast<uint64_t>(64));
+  size_t t = block_size / 2;
 
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
-    __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y);
+  // Correction step needed due to extra copies of roots of unity in the
+  // AVX512 vectors loaded for the stages t = 4, 2, 1
+  auto compute_new_W_idx = [&](size_t idx) {
+    // Originally, from root of unity vector index to loop:
+    // [0, N/8) => FwdT8
+    // [N/8, N/4) => FwdT4
+    // [N/4, N/2) => FwdT2
+    // [N/2, N) => FwdT1
+    // The new mapping from AVX512 root of unity vector index to loop:
+    // [0, N/8) => FwdT8
+    // [N/8, 5N/8) => FwdT4
+    // [5N/8, 9N/8) => FwdT2
+    // [9N/8, 13N/8) => FwdT1
+    size_t N = n << recursion_depth;
 
-    // assume 8 | t
-    for (size_t j = t / 8; j > 0; --j) {
-      __m512i v_X = _mm512_loadu_si512(v_X_pt);
-      __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+    // FwdT8 range
+    if (idx <= N / 8) {
+      return idx;
+    }
+    // FwdT4 range
+    if (idx <= N / 4) {
+      return (idx - N / 8) * 4 + (N / 8);
+    }
+    // FwdT2 range
+    if (idx <= N / 2) {
+      return (idx - N / 4) * 2 + (5 * N / 8);
+    }
+    // FwdT1 range
+    return idx + (5 * N / 8);
+  };
 
-      FwdButterfly<BitShift, InputLessThanMod>(&v_X, &v_Y, v_W_op, v_W_precon,
-                                               v_neg_modulus, v_twice_mod);
+  // Roots of unity for each of the remaining stages
+  const uint64_t* W_op[6];
+  const uint64_t* W_precon[6];
+  size_t num_stages = 0;
+  for (; t > 4; t >>= 1, W_idx <<= 1, ++num_stages) {
+    W_op[num_stages] = &root_of_unity_powers[W_idx];
+    W_precon[num_stages] = &precon_root_of_unity_powers[W_idx];
+  }
+  for (; t > 0; t >>= 1, W_idx <<= 1, ++num_stages) {
+    size_t new_W_idx = compute_new_W_idx(W_idx);
+    W_op[num_stages] = &root_of_unity_powers[new_W_idx];
+    W_precon[num_stages] = &precon_root_of_unity_powers[new_W_idx];
+  }
 
-      _mm512_storeu_si512(v_X_pt++, v_X);
-      _mm512_storeu_si512(v_Y_pt++, v_Y);
+  if (block_size == 64) {
+    if (first_stage_in_regs) {
+      FwdLastStages<BitShift, 8, true>(result, input, n, v_modulus,
+                                       v_neg_modulus, v_twice_mod, W_op,
+                                       W_precon, reduce_output);
+    } else {
+      FwdLastStages<BitShift, 8, false>(result, input, n, v_modulus,
+                                        v_neg_modulus, v_twice_mod, W_op,
+                                        W_precon, reduce_output);
+    }
+  } else if (block_size == 32) {
+    if (first_stage_in_regs) {
+      FwdLastStages<BitShift, 4, true>(result, input, n, v_modulus,
+                                       v_neg_modulus, v_twice_mod, W_op,
+                                       W_precon, reduce_output);
+    } else {
+      FwdLastStages<BitShift, 4, false>(result, input, n, v_modulus,
+                                        v_neg_modulus, v_twice_mod, W_op,
+                                        W_precon, reduce_output);
+    }
+  } else {
+    if (first_stage_in_regs) {
+      FwdLastStages<BitShift, 2, true>(result, input, n, v_modulus,
+                                       v_neg_modulus, v_twice_mod, W_op,
+                                       W_precon, reduce_output);
+    } else {
+      FwdLastStages<BitShift, 2, false>(result, input, n, v_modulus,
+                                        v_neg_modulus, v_twice_mod, W_op,
+                                        W_precon, reduce_output);
     }
-    j1 += (t << 1);
   }
 }
 
 /// @brief AVX512 implementation of the forward NTT
-/// @param[in, out] operand Input data. Overwritten with NTT output
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
 /// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
 /// power of two.
 /// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
@@ -227,11 +578,11 @@ void FwdT8(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
 /// performance on larger transform sizes.
 template <int BitShift>
 void ForwardTransformToBitReverseAVX512(
-    uint64_t* operand, uint64_t n, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* root_of_unity_powers,
     const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth,
-    uint64_t recursion_half) {
+    uint64_t recursion_half, uint64_t base_ntt_size) {
   HEXL_CHECK(CheckNTTArguments(n, modulus), "");
   HEXL_CHECK(modulus < MaximumValue(BitShift) / 4,
              "modulus " << modulus << " too large for BitShift " << BitShift
@@ -254,7 +605,6 @@ void ForwardTransformToBitReverseAVX512(
 
   uint64_t twice_mod = modulus << 1;
 
-  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
   __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
   __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(twice_mod));
 
@@ -265,129 +615,523 @@ void ForwardTransformToBitReverseAVX512(
                 precon_root_of_unity_powers, precon_root_of_unity_powers + n));
   HEXL_VLOG(5, "operand " << std::vector<uint64_t>(operand, operand + n));
 
-  static const size_t base_ntt_size = 1024;
-
   if (n <= base_ntt_size) {  // Perform breadth-first NTT
+    // The first stage reads from operand, the others from result
+    const uint64_t* input = operand;
     size_t t = (n >> 1);
     size_t m = 1;
     size_t W_idx = (m << recursion_depth) + (recursion_half * m);
+    // The last log2(block_size) stages run in registers, on blocks of
+    // block_size coefficients
+    const size_t block_size = std::min(n, static_cast<uint64_t>(64));
+    // Inputs of recursive calls are outputs of the parent stage, in [0, 4q)
+    const bool input_less_than_mod =
+        (recursion_depth == 0) && (input_mod_factor <= 2);
     // First iteration assumes input in [0,p)
-    if (m < (n >> 3)) {
+    if (t > block_size / 2) {
       const uint64_t* W_op = &root_of_unity_powers[W_idx];
       const uint64_t* W_precon = &precon_root_of_unity_powers[W_idx];
 
-      if (input_mod_factor <= 2) {
-        FwdT8<BitShift, true>(operand, v_neg_modulus, v_twice_mod, t, m, W_op,
-                              W_precon);
+      if (input_less_than_mod) {
+        FwdT8<BitShift, true>(result, input, v_neg_modulus, v_twice_mod, t, m,
+                              W_op, W_precon);
       } else {
-        FwdT8<BitShift, false>(operand, v_neg_modulus, v_twice_mod, t, m, W_op,
-                               W_precon);
+        FwdT8<BitShift, false>(result, input, v_neg_modulus, v_twice_mod, t,
+                               m, W_op, W_precon);
       }
 
       t >>= 1;
       m <<= 1;
       W_idx <<= 1;
+      input = result;
     }
-    for (; m < (n >> 3); m <<= 1) {
+    for (; t > block_size / 2; m <<= 1) {
       const uint64_t* W_op = &root_of_unity_powers[W_idx];
       const uint64_t* W_precon = &precon_root_of_unity_powers[W_idx];
-      FwdT8<BitShift, false>(operand, v_neg_modulus, v_twice_mod, t, m, W_op,
-                             W_precon);
+      FwdT8<BitShift, false>(result, result, v_neg_modulus, v_twice_mod, t, m,
+                             W_op, W_precon);
       t >>= 1;
       W_idx <<= 1;
     }
 
-    // Do T=4, T=2, T=1 separately
-    {
-      // Correction step needed due to extra copies of roots of unity in the
-      // AVX512 vectors loaded for FwdT2 and FwdT4
-      auto compute_new_W_idx = [&](size_t idx) {
-        // Originally, from root of unity vector index to loop:
-        // [0, N/8) => FwdT8
-        // [N/8, N/4) => FwdT4
-        // [N/4, N/2) => FwdT2
-        // [N/2, N) => FwdT1
-        // The new mapping from AVX512 root of unity vector index to loop:
-        // [0, N/8) => FwdT8
-        // [N/8, 5N/8) => FwdT4
-        // [5N/8, 9N/8) => FwdT2
-        // [9N/8, 13N/8) => FwdT1
-        size_t N = n << recursion_depth;
-
-        // FwdT8 range
-        if (idx <= N / 8) {
-          return idx;
-        }
-        // FwdT4 range
-        if (idx <= N / 4) {
-          return (idx - N / 8) * 4 + (N / 8);
-        }
-        // FwdT2 range
-        if (idx <= N / 2) {
-          return (idx - N / 4) * 2 + (5 * N / 8);
-        }
-        // FwdT1 range
-        return idx + (5 * N / 8);
-      };
+    const bool reduce_output = (output_mod_factor == 1);
+    // The stages in registers include the first stage only for n <= 64
+    const bool first_stage_in_regs = (n <= 64) && input_less_than_mod;
+    FwdBaseLastStages<BitShift>(result, input, n, modulus,
+                                root_of_unity_powers,
+                                precon_root_of_unity_powers, W_idx,
+                                recursion_depth, first_stage_in_regs,
+                                reduce_output);
 
-      size_t new_W_idx = compute_new_W_idx(W_idx);
-      const uint64_t* W_op = &root_of_unity_powers[new_W_idx];
-      const uint64_t* W_precon = &precon_root_of_unity_powers[new_W_idx];
-      FwdT4<BitShift>(operand, v_neg_modulus, v_twice_mod, m, W_op, W_precon);
+    if (reduce_output) {
+      HEXL_CHECK_BOUNDS(result, n, modulus,
+                        "result exceeds bound " << modulus);
+    }
+  } else {
+    // Perform depth-first NTT via recursive call
+    size_t t = (n >> 1);
+    size_t W_idx = (1 << recursion_depth) + recursion_half;
+    const uint64_t* W_op = &root_of_unity_powers[W_idx];
+    const uint64_t* W_precon = &precon_root_of_unity_powers[W_idx];
 
-      m <<= 1;
-      W_idx <<= 1;
-      new_W_idx = compute_new_W_idx(W_idx);
-      W_op = &root_of_unity_powers[new_W_idx];
-      W_precon = &precon_root_of_unity_powers[new_W_idx];
-      FwdT2<BitShift>(operand, v_neg_modulus, v_twice_mod, m, W_op, W_precon);
+    FwdT8<BitShift, false>(result, operand, v_neg_modulus, v_twice_mod, t, 1,
+                           W_op, W_precon);
 
-      m <<= 1;
-      W_idx <<= 1;
-      new_W_idx = compute_new_W_idx(W_idx);
-      W_op = &root_of_unity_powers[new_W_idx];
-      W_precon = &precon_root_of_unity_powers[new_W_idx];
-      FwdT1<BitShift>(operand, v_neg_modulus, v_twice_mod, m, W_op, W_precon);
-    }
+    ForwardTransformToBitReverseAVX512<BitShift>(
+        result, result, n / 2, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, recursion_half * 2, base_ntt_size);
 
-    if (output_mod_factor == 1) {
-      // n power of two at least 8 => n divisible by 8
-      HEXL_CHECK(n % 8 == 0, "n " << n << " not a power of 2");
-      __m512i* v_X_pt = reinterpret_cast<__m512i*>(operand);
-      for (size_t i = 0; i < n; i += 8) {
-        __m512i v_X = _mm512_loadu_si512(v_X_pt);
+    ForwardTransformToBitReverseAVX512<BitShift>(
+        &result[n / 2], &result[n / 2], n / 2, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, recursion_half * 2 + 1, base_ntt_size);
+  }
+}
 
-        // Reduce from [0, 4q) to [0, q)
-        v_X = _mm512_hexl_small_mod_epu64(v_X, v_twice_mod);
-        v_X = _mm512_hexl_small_mod_epu64(v_X, v_modulus);
+template <int BitShift, size_t NumRows>
+void ForwardTransformToBitReverseAVX512Rows(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t n,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size) {
+  HEXL_CHECK(n >= 16,
+             "Don't support small transforms. Need n >= 16, got n = " << n);
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
 
-        HEXL_CHECK_BOUNDS(ExtractValues(v_X).data(), 8, modulus,
-                          "v_X exceeds bound " << modulus);
+  __m512i v_neg_modulus[NumRows];
+  __m512i v_twice_mod[NumRows];
+  for (size_t r = 0; r < NumRows; ++r) {
+    HEXL_CHECK(CheckNTTArguments(n, moduli[r]), "");
+    HEXL_CHECK(moduli[r] < MaximumValue(BitShift) / 4,
+               "modulus " << moduli[r] << " too large for BitShift "
+                          << BitShift);
+    // Skip input bound checking for recursive steps
+    HEXL_CHECK_BOUNDS(operand[r], (recursion_depth == 0) ? n : 0,
+                      input_mod_factor * moduli[r],
+                      "operand larger than input_mod_factor * modulus ("
+                          << input_mod_factor << " * " << moduli[r] << ")");
+    v_neg_modulus[r] = _mm512_set1_epi64(-static_cast<int64_t>(moduli[r]));
+    v_twice_mod[r] = _mm512_set1_epi64(static_cast<int64_t>(moduli[r] << 1));
+  }
 
-        _mm512_storeu_si512(v_X_pt, v_X);
+  const uint64_t* W_op[NumRows];
+  const uint64_t* W_precon[NumRows];
+  // Offsets the root of unity tables of each row by W_idx
+  auto set_roots = [&](size_t W_idx) {
+    for (size_t r = 0; r < NumRows; ++r) {
+      W_op[r] = &root_of_unity_powers[r][W_idx];
+      W_precon[r] = &precon_root_of_unity_powers[r][W_idx];
+    }
+  };
 
-        ++v_X_pt;
+  if (n <= base_ntt_size) {  // Perform breadth-first NTT
+    // The first stage reads from operand, the others from result
+    const uint64_t* const* input = operand;
+    size_t t = (n >> 1);
+    size_t m = 1;
+    size_t W_idx = (m << recursion_depth) + (recursion_half * m);
+    const size_t block_size = std::min(n, static_cast<uint64_t>(64));
+    // Inputs of recursive calls are outputs of the parent stage, in [0, 4q)
+    const bool input_less_than_mod =
+        (recursion_depth == 0) && (input_mod_factor <= 2);
+    if (t > block_size / 2) {
+      set_roots(W_idx);
+      if (input_less_than_mod) {
+        FwdT8Rows<BitShift, true, NumRows>(result, input, v_neg_modulus,
+                                           v_twice_mod, t, m, W_op, W_precon);
+      } else {
+        FwdT8Rows<BitShift, false, NumRows>(result, input, v_neg_modulus,
+                                            v_twice_mod, t, m, W_op, W_precon);
       }
+
+      t >>= 1;
+      m <<= 1;
+      W_idx <<= 1;
+      input = result;
+    }
+    for (; t > block_size / 2; m <<= 1) {
+      set_roots(W_idx);
+      FwdT8Rows<BitShift, false, NumRows>(result, result, v_neg_modulus,
+                                          v_twice_mod, t, m, W_op, W_precon);
+      t >>= 1;
+      W_idx <<= 1;
+    }
+
+    // Each row's block of the stages in registers already uses all the
+    // registers, so these run one row at a time
+    const bool reduce_output = (output_mod_factor == 1);
+    const bool first_stage_in_regs = (n <= 64) && input_less_than_mod;
+    for (size_t r = 0; r < NumRows; ++r) {
+      FwdBaseLastStages<BitShift>(
+          result[r], input[r], n, moduli[r], root_of_unity_powers[r],
+          precon_root_of_unity_powers[r], W_idx, recursion_depth,
+          first_stage_in_regs, reduce_output);
     }
   } else {
     // Perform depth-first NTT via recursive call
     size_t t = (n >> 1);
-    size_t W_idx = (1 << recursion_depth) + recursion_half;
-    const uint64_t* W_op = &root_of_unity_powers[W_idx];
-    const uint64_t* W_precon = &precon_root_of_unity_powers[W_idx];
+    set_roots((1 << recursion_depth) + recursion_half);
+    FwdT8Rows<BitShift, false, NumRows>(result, operand, v_neg_modulus,
+                                        v_twice_mod, t, 1, W_op, W_precon);
 
-    FwdT8<BitShift, false>(operand, v_neg_modulus, v_twice_mod, t, 1, W_op,
-                           W_precon);
+    uint64_t* result_hi[NumRows];
+    for (size_t r = 0; r < NumRows; ++r) {
+      result_hi[r] = result[r] + n / 2;
+    }
+    ForwardTransformToBitReverseAVX512Rows<BitShift, NumRows>(
+        result, result, n / 2, moduli, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, recursion_half * 2, base_ntt_size);
+    ForwardTransformToBitReverseAVX512Rows<BitShift, NumRows>(
+        result_hi, result_hi, n / 2, moduli, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, recursion_half * 2 + 1, base_ntt_size);
+  }
+}
 
-    ForwardTransformToBitReverseAVX512<BitShift>(
-        operand, n / 2, modulus, root_of_unity_powers,
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512FirstStages(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t num_blocks,
+    uint64_t slice) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(slice < num_blocks,
+             "slice " << slice << " >= num_blocks " << num_blocks);
+
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(modulus << 1));
+
+  size_t block_size = n / num_blocks;
+  size_t slice_size = block_size / num_blocks;
+  HEXL_CHECK(slice_size % 8 == 0,
+             "slice_size " << slice_size << " not a multiple of 8");
+
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
+  size_t t = (n >> 1);
+  for (size_t m = 1; m < num_blocks; m <<= 1, input = result) {
+    for (size_t i = 0; i < m; i++) {
+      __m512i v_W_op =
+          _mm512_set1_epi64(static_cast<int64_t>(root_of_unity_powers[m + i]));
+      __m512i v_W_precon = _mm512_set1_epi64(
+          static_cast<int64_t>(precon_root_of_unity_powers[m + i]));
+
+      for (size_t j1 = 0; j1 < t; j1 += block_size) {
+        size_t offset = 2 * t * i + j1 + slice * slice_size;
+        const __m512i* v_X_op_pt =
+            reinterpret_cast<const __m512i*>(input + offset);
+        const __m512i* v_Y_op_pt =
+            reinterpret_cast<const __m512i*>(input + offset + t);
+        __m512i* v_X_pt = reinterpret_cast<__m512i*>(result + offset);
+        __m512i* v_Y_pt = reinterpret_cast<__m512i*>(result + offset + t);
+
+        for (size_t j = slice_size / 8; j > 0; --j) {
+          __m512i v_X = _mm512_loadu_si512(v_X_op_pt++);
+          __m512i v_Y = _mm512_loadu_si512(v_Y_op_pt++);
+
+          FwdButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                        v_neg_modulus, v_twice_mod);
+
+          _mm512_storeu_si512(v_X_pt++, v_X);
+          _mm512_storeu_si512(v_Y_pt++, v_Y);
+        }
+      }
+    }
+    t >>= 1;
+  }
+}
+
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512Parallel(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size) {
+  // Transforms too large for the cache use the four-step decomposition,
+  // whose row transforms and column slices fit in the L2 cache
+  if (n >= NTT::s_min_four_step_degree) {
+    HEXL_VLOG(4, "Calling four-step FwdNTT");
+    ForwardTransformToBitReverseAVX512FourStep<BitShift>(
+        result, operand, n, modulus, root_of_unity_powers,
         precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
-        recursion_depth + 1, recursion_half * 2);
+        FourStepBlockSize(n), thread_pool, base_ntt_size);
+    return;
+  }
+
+  // Each block must take the recursive path, and each column slice must hold
+  // a whole number of SIMD vectors
+  size_t num_blocks = 1;
+  while (thread_pool != nullptr &&
+         2 * num_blocks <= thread_pool->NumThreads()) {
+    size_t block_size = n / (2 * num_blocks);
+    if (block_size < base_ntt_size || block_size < 8 * (2 * num_blocks)) {
+      break;
+    }
+    num_blocks *= 2;
+  }
+  if (num_blocks == 1) {
+    ForwardTransformToBitReverseAVX512<BitShift>(
+        result, operand, n, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor, 0, 0,
+        base_ntt_size);
+    return;
+  }
+
+  HEXL_VLOG(4, "Calling FwdNTT on " << num_blocks << " threads");
+  ForwardTransformToBitReverseAVX512FourStep<BitShift>(
+      result, operand, n, modulus, root_of_unity_powers,
+      precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+      n / num_blocks, thread_pool, base_ntt_size);
+}
+
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512FourStep(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(IsPowerOfTwo(block_size) && block_size <= n,
+             "block_size " << block_size << " not a power of two at most n");
+  HEXL_CHECK(block_size * block_size >= 8 * n,
+             "block_size " << block_size << " too small for n " << n);
+  HEXL_CHECK_BOUNDS(operand, n, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+
+  size_t num_blocks = n / block_size;
+  if (num_blocks == 1) {
+    ForwardTransformToBitReverseAVX512<BitShift>(
+        result, operand, n, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor, 0, 0,
+        base_ntt_size);
+    return;
+  }
 
+  auto parallel_for = [thread_pool](size_t num_tasks,
+                                    const std::function<void(size_t)>& task) {
+    if (thread_pool == nullptr) {
+      for (size_t i = 0; i < num_tasks; ++i) {
+        task(i);
+      }
+    } else {
+      thread_pool->ParallelFor(num_tasks, task);
+    }
+  };
+
+  // Column transforms: the first log2(num_blocks) stages, split by column
+  // slice. Each slice holds block_size elements, so its stages stay in cache.
+  parallel_for(num_blocks, [&](size_t slice) {
+    ForwardTransformToBitReverseAVX512FirstStages<BitShift>(
+        result, operand, n, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, num_blocks, slice);
+  });
+
+  // Row transforms: the remaining stages, as independent subtransforms. The
+  // twiddle factors of the four-step algorithm are merged into their roots of
+  // unity, and the bit-reversed output order makes the transposes
+  // unnecessary.
+  uint64_t recursion_depth = Log2(num_blocks);
+  parallel_for(num_blocks, [&](size_t block) {
+    uint64_t* X = result + block * block_size;
     ForwardTransformToBitReverseAVX512<BitShift>(
-        &operand[n / 2], n / 2, modulus, root_of_unity_powers,
+        X, X, block_size, modulus, root_of_unity_powers,
         precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
-        recursion_depth + 1, recursion_half * 2 + 1);
+        recursion_depth, block, base_ntt_size);
+  });
+}
+
+template <int BitShift>
+void ForwardTransformToBitReverseStridedAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(modulus < MaximumValue(BitShift) / 4,
+             "modulus " << modulus << " too large for BitShift " << BitShift
+                        << " => maximum value " << MaximumValue(BitShift) / 4);
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  const __mmask8 tail_mask =
+      static_cast<__mmask8>((1U << (batch_size % 8)) - 1);
+
+  size_t t = (n >> 1);
+
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
+  for (size_t m = 1; m < n; m <<= 1) {
+    for (size_t i = 0; i < m; i++) {
+      __m512i v_W_op =
+          _mm512_set1_epi64(static_cast<int64_t>(root_of_unity_powers[m + i]));
+      __m512i v_W_precon = _mm512_set1_epi64(
+          static_cast<int64_t>(precon_root_of_unity_powers[m + i]));
+
+      for (size_t j = 2 * i * t; j < (2 * i + 1) * t; j++) {
+        const uint64_t* X_op = input + j * stride;
+        const uint64_t* Y_op = X_op + t * stride;
+        uint64_t* X_r = result + j * stride;
+        uint64_t* Y_r = X_r + t * stride;
+
+        for (size_t k = 0; k < batch_size; k += 8) {
+          __mmask8 mask = (k + 8 <= batch_size) ? 0xff : tail_mask;
+          __m512i v_X = _mm512_maskz_loadu_epi64(mask, X_op + k);
+          __m512i v_Y = _mm512_maskz_loadu_epi64(mask, Y_op + k);
+
+          FwdButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                        v_neg_modulus, v_twice_mod);
+
+          _mm512_mask_storeu_epi64(X_r + k, mask, v_X);
+          _mm512_mask_storeu_epi64(Y_r + k, mask, v_Y);
+        }
+      }
+    }
+    t >>= 1;
+    input = result;
+  }
+
+  // Reduce to [0, q), or copy the input if no stage ran, i.e. n == 1
+  if (output_mod_factor == 1 || input != result) {
+    for (size_t i = 0; i < n; ++i) {
+      const uint64_t* X_op = input + i * stride;
+      uint64_t* X_r = result + i * stride;
+      for (size_t k = 0; k < batch_size; k += 8) {
+        __mmask8 mask = (k + 8 <= batch_size) ? 0xff : tail_mask;
+        __m512i v_X = _mm512_maskz_loadu_epi64(mask, X_op + k);
+        if (output_mod_factor == 1) {
+          v_X = _mm512_hexl_small_mod_epu64<4>(v_X, v_modulus, &v_twice_mod);
+        }
+        _mm512_mask_storeu_epi64(X_r + k, mask, v_X);
+      }
+    }
+  }
+}
+
+/// @brief Computes the forward transforms of the polynomials of degree N
+/// stored contiguously in \p operand, 8 at a time with one polynomial per
+/// lane. Polynomials are gathered from \p operand and scattered to \p
+/// result, which may be equal.
+/// @param[in] v_W_op Broadcast roots of unity in bit-reversed order
+/// @param[in] v_W_precon Broadcast pre-conditioned roots of unity
+template <int BitShift, size_t N>
+void FwdBatchLanes(uint64_t* result, const uint64_t* operand,
+                   uint64_t batch_size, const __m512i* v_W_op,
+                   const __m512i* v_W_precon, __m512i v_modulus,
+                   __m512i v_neg_modulus, __m512i v_twice_mod,
+                   bool reduce_output) {
+  const int64_t n = static_cast<int64_t>(N);
+  const __m512i v_index =
+      _mm512_set_epi64(7 * n, 6 * n, 5 * n, 4 * n, 3 * n, 2 * n, n, 0);
+  const __mmask8 tail_mask =
+      static_cast<__mmask8>((1U << (batch_size % 8)) - 1);
+
+  for (size_t b = 0; b < batch_size; b += 8) {
+    __mmask8 mask = (b + 8 <= batch_size) ? 0xff : tail_mask;
+    const uint64_t* X_op = operand + b * N;
+    uint64_t* X_r = result + b * N;
+
+    // v[i] holds coefficient i of each polynomial
+    __m512i v[N];
+    for (size_t i = 0; i < N; ++i) {
+      v[i] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask,
+                                         v_index, X_op + i, 8);
+    }
+
+    size_t t = N >> 1;
+    for (size_t m = 1; m < N; m <<= 1, t >>= 1) {
+      for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 2 * i * t; j < (2 * i + 1) * t; ++j) {
+          FwdButterfly<BitShift, false>(&v[j], &v[j + t], v_W_op[m + i],
+                                        v_W_precon[m + i], v_neg_modulus,
+                                        v_twice_mod);
+        }
+      }
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+      if (reduce_output) {
+        v[i] = _mm512_hexl_small_mod_epu64<4>(v[i], v_modulus, &v_twice_mod);
+      }
+      _mm512_mask_i64scatter_epi64(X_r + i, mask, v_index, v[i], 8);
+    }
+  }
+}
+
+template <int BitShift>
+void ForwardTransformToBitReverseBatchAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(n >= 2 && n <= 16, "n " << n << " not in [2, 16]");
+  HEXL_CHECK(modulus < MaximumValue(BitShift) / 4,
+             "modulus " << modulus << " too large for BitShift " << BitShift
+                        << " => maximum value " << MaximumValue(BitShift) / 4);
+  HEXL_CHECK_BOUNDS(operand, n * batch_size, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  __m512i v_W_op[16];
+  __m512i v_W_precon[16];
+  for (size_t i = 1; i < n; ++i) {
+    v_W_op[i] =
+        _mm512_set1_epi64(static_cast<int64_t>(root_of_unity_powers[i]));
+    v_W_precon[i] =
+        _mm512_set1_epi64(static_cast<int64_t>(precon_root_of_unity_powers[i]));
+  }
+  bool reduce_output = (output_mod_factor == 1);
+
+  switch (n) {
+    case 2:
+      FwdBatchLanes<BitShift, 2>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    case 4:
+      FwdBatchLanes<BitShift, 4>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    case 8:
+      FwdBatchLanes<BitShift, 8>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    default:
+      FwdBatchLanes<BitShift, 16>(result, operand, batch_size, v_W_op,
+                                  v_W_precon, v_modulus, v_neg_modulus,
+                                  v_twice_mod, reduce_output);
   }
 }
 
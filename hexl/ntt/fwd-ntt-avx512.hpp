@@ -4,6 +4,7 @@
 #pragma once
 
 #include "hexl/ntt/ntt.hpp"
+#include "util/thread-pool.hpp"
 
 namespace intel {
 namespace hexl {
@@ -11,7 +12,9 @@ namespace hexl {
 #ifdef HEXL_HAS_AVX512DQ
 
 /// @brief AVX512 implementation of the forward NTT
-/// @param[in, out] operand Input data. Overwritten with NTT output
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
 /// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
 /// power of two.
 /// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
@@ -25,6 +28,8 @@ namespace hexl {
 /// output_mod_factor * modulus)
 /// @param[in] recursion_depth Depth of recursive call
 /// @param[in] recursion_half Helper for indexing roots of unity
+/// @param[in] base_ntt_size Transforms of at most this size are computed
+/// breadth-first. Power of two, at least 16.
 /// @details The implementation is recursive. The base case is a breadth-first
 /// NTT, where all the butterflies in a given stage are processed before any
 /// butteflies in the next stage. The base case is small enough to fit in the
@@ -34,11 +39,206 @@ namespace hexl {
 /// performance on larger transform sizes.
 template <int BitShift>
 void ForwardTransformToBitReverseAVX512(
-    uint64_t* operand, uint64_t n, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* root_of_unity_powers,
     const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth = 0,
-    uint64_t recursion_half = 0);
+    uint64_t recursion_half = 0,
+    uint64_t base_ntt_size = NTT::s_default_base_ntt_size);
+
+/// @brief AVX512 implementation of the forward NTT of NumRows rows at once,
+/// each with its own modulus, e.g. the rows of an RNS polynomial
+/// @param[out] result Stores the NTT output of row r in \p result[r]. May
+/// equal \p operand[r]; otherwise must not overlap it.
+/// @param[in] operand Input data of row r in \p operand[r], read by the first
+/// stage only
+/// @param[in] n Size of each transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] moduli Prime modulus of each row. Each must satisfy q == 1 mod
+/// 2n
+/// @param[in] root_of_unity_powers AVX512 root of unity powers of each row,
+/// see ForwardTransformToBitReverseAVX512
+/// @param[in] precon_root_of_unity_powers BitShift-bit pre-conditioned AVX512
+/// root of unity powers of each row
+/// @param[in] input_mod_factor Upper bound for inputs; row r must be in [0,
+/// input_mod_factor * moduli[r])
+/// @param[in] output_mod_factor Upper bound for result; row r must be in [0,
+/// output_mod_factor * moduli[r])
+/// @param[in] recursion_depth Depth of recursive call
+/// @param[in] recursion_half Helper for indexing roots of unity
+/// @param[in] base_ntt_size Transforms of at most this size are computed
+/// breadth-first. Power of two, at least 16.
+/// @details Same recursion as ForwardTransformToBitReverseAVX512, scheduled
+/// across the rows: each stage outside the registers computes one vector of
+/// butterflies on every row before moving to the next vector, and each
+/// subtransform is completed on every row before moving to the next
+/// subtransform. The result of row r matches
+/// ForwardTransformToBitReverseAVX512 with modulus \p moduli[r].
+template <int BitShift, size_t NumRows>
+void ForwardTransformToBitReverseAVX512Rows(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t n,
+    const uint64_t* moduli, const uint64_t* const* root_of_unity_powers,
+    const uint64_t* const* precon_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth = 0, uint64_t recursion_half = 0,
+    uint64_t base_ntt_size = NTT::s_default_base_ntt_size);
+
+/// @brief Computes the first log2(num_blocks) stages of
+/// ForwardTransformToBitReverseAVX512 on one column slice of \p operand
+/// @param[out] result Stores the intermediate result, in [0, 4 * modulus).
+/// May equal \p operand; otherwise must not overlap it.
+/// @param[in] operand Input data in [0, 4 * modulus)
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers Pre-conditioned Powers of 2n'th root
+/// of unity in F_q. In bit-reversed order.
+/// @param[in] num_blocks Power of two such that each block of n / num_blocks
+/// elements splits into num_blocks column slices of a multiple of 8 elements
+/// @param[in] slice Index of the column slice, in [0, num_blocks)
+/// @details These stages only combine elements whose indices agree modulo
+/// n / num_blocks, so the column slices are independent. Afterwards, calling
+/// ForwardTransformToBitReverseAVX512 in-place on each block b of \p result,
+/// with recursion_depth log2(num_blocks) and recursion_half b, completes the
+/// transform.
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512FirstStages(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t num_blocks,
+    uint64_t slice);
+
+/// @brief Multi-threaded AVX512 implementation of the forward NTT
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers Pre-conditioned Powers of 2n'th root
+/// of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @param[in] thread_pool Threads on which to run the transform. If nullptr,
+/// the transform runs on the calling thread.
+/// @param[in] base_ntt_size Transforms of at most this size are computed
+/// breadth-first. Power of two, at least 16.
+/// @details Let P be the largest power of two at most the number of threads,
+/// such that each of the P subtransforms is large enough to take the
+/// recursive path of ForwardTransformToBitReverseAVX512. The first log2(P)
+/// stages only combine elements whose indices agree modulo n / P, so they are
+/// split into P independent column slices. The remaining stages are P
+/// independent subtransforms of size n / P, see
+/// ForwardTransformToBitReverseAVX512FourStep. The result matches
+/// ForwardTransformToBitReverseAVX512.
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512Parallel(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size = NTT::s_default_base_ntt_size);
+
+/// @brief Four-step AVX512 implementation of the forward NTT, for transforms
+/// too large for the cache
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers Pre-conditioned Powers of 2n'th root
+/// of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @param[in] block_size Size of the row transforms. Power of two, at most \p
+/// n, such that block_size * block_size >= 8 * n.
+/// @param[in] thread_pool Threads on which to run the column and row
+/// transforms. If nullptr, the transform runs on the calling thread.
+/// @param[in] base_ntt_size Transforms of at most this size are computed
+/// breadth-first. Power of two, at least 16.
+/// @details Views \p operand as a row-major matrix of n / block_size rows of
+/// block_size elements. The first log2(n / block_size) stages are transforms
+/// of the columns, computed on column slices of block_size elements with
+/// ForwardTransformToBitReverseAVX512FirstStages. The remaining stages are
+/// transforms of the rows, computed with ForwardTransformToBitReverseAVX512.
+/// So with block_size sized to the L2 cache, the transform makes two passes
+/// over memory rather than one per stage. The result matches
+/// ForwardTransformToBitReverseAVX512.
+template <int BitShift>
+void ForwardTransformToBitReverseAVX512FourStep(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size = NTT::s_default_base_ntt_size);
+
+/// @brief AVX512 implementation of ForwardTransformToBitReverseStrided64
+/// @param[out] result Stores the NTT output in the same layout as \p operand.
+/// May equal \p operand; otherwise must not overlap it.
+/// @param[in] operand Input data, with coefficient i of polynomial j at index
+/// i * stride + j. Read by the first stage only.
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] batch_size Number of polynomials, at least 1
+/// @param[in] stride Distance between consecutive coefficients of a
+/// polynomial. Must be at least \p batch_size.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers BitShift-bit pre-conditioned powers
+/// of 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Each vector holds the same coefficient of 8 polynomials, so all
+/// its lanes use the same broadcast root of unity. The last vector of each row
+/// is loaded and stored with a mask if 8 does not divide \p batch_size.
+template <int BitShift>
+void ForwardTransformToBitReverseStridedAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+/// @brief AVX512 forward NTT of a batch of small polynomials stored
+/// contiguously, i.e. coefficient i of polynomial j at index j * n + i
+/// @param[out] result Stores the NTT outputs in the same layout. May equal \p
+/// operand; otherwise must not overlap it.
+/// @param[in] operand Input data
+/// @param[in] n Size of each transfrom, i.e. the polynomial degree. Must be 2,
+/// 4, 8 or 16.
+/// @param[in] batch_size Number of polynomials
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers BitShift-bit pre-conditioned powers
+/// of 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Transforms 8 polynomials at a time, with one polynomial per lane:
+/// coefficient i of the 8 polynomials is gathered into one vector, so all
+/// stages use broadcast roots of unity and no shuffles. The result matches
+/// ForwardTransformToBitReverse64 on each polynomial.
+template <int BitShift>
+void ForwardTransformToBitReverseBatchAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
 
 #endif  // HEXL_HAS_AVX512DQ
 
@@ -0,0 +1,172 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/goldilocks-ntt-avx512.hpp"
+
+#include <immintrin.h>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "ntt/goldilocks-ntt-internal.hpp"
+#include "ntt/ntt-avx512-util.hpp"
+#include "util/avx512-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+namespace {
+
+// Cooley-Tukey butterfly: X, Y -> X + W * Y, X - W * Y
+inline void GoldilocksFwdButterfly(__m512i* X, __m512i* Y, __m512i W) {
+  __m512i T = _mm512_hexl_goldilocks_mul_epu64(W, *Y);
+  *Y = _mm512_hexl_goldilocks_sub_epu64(*X, T);
+  *X = _mm512_hexl_goldilocks_add_epu64(*X, T);
+}
+
+// Gentleman-Sande butterfly: X, Y -> X + Y, W * (X - Y)
+inline void GoldilocksInvButterfly(__m512i* X, __m512i* Y, __m512i W) {
+  __m512i T = _mm512_hexl_goldilocks_sub_epu64(*X, *Y);
+  *X = _mm512_hexl_goldilocks_add_epu64(*X, *Y);
+  *Y = _mm512_hexl_goldilocks_mul_epu64(W, T);
+}
+
+// Stage with butterfly distance T on the 16 coefficients in v1, v2, using the
+// twiddle factors W of their groups
+template <int T, bool Inverse>
+inline void GoldilocksRegisterStage(__m512i* v1, __m512i* v2,
+                                    const uint64_t* W) {
+  __m512i X;
+  __m512i Y;
+  SplitButterflyOperands<T>(*v1, *v2, &X, &Y);
+  __m512i v_W = LoadButterflyTwiddles<T>(W);
+  if (Inverse) {
+    GoldilocksInvButterfly(&X, &Y, v_W);
+  } else {
+    GoldilocksFwdButterfly(&X, &Y, v_W);
+  }
+  MergeButterflyOperands<T>(X, Y, v1, v2);
+}
+
+}  // namespace
+
+void ForwardTransformToBitReverseGoldilocksAVX512(
+    uint64_t* operand, uint64_t n, const uint64_t* root_of_unity_powers) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (n < 16) {
+    ForwardTransformToBitReverseGoldilocks(operand, n, root_of_unity_powers);
+    return;
+  }
+
+  // Stages with butterfly distance t >= 8 broadcast the twiddle factor
+  size_t m = 1;
+  for (size_t t = (n >> 1); t >= 8; m <<= 1, t >>= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      __m512i v_W =
+          _mm512_set1_epi64(static_cast<int64_t>(root_of_unity_powers[m + i]));
+      __m512i* v_X_pt = reinterpret_cast<__m512i*>(operand + j1);
+      __m512i* v_Y_pt = reinterpret_cast<__m512i*>(operand + j1 + t);
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t j = t / 8; j > 0; --j) {
+        __m512i v_X = _mm512_loadu_si512(v_X_pt);
+        __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+        GoldilocksFwdButterfly(&v_X, &v_Y, v_W);
+        _mm512_storeu_si512(v_X_pt++, v_X);
+        _mm512_storeu_si512(v_Y_pt++, v_Y);
+      }
+    }
+  }
+
+  // The last three stages, with n / 8, n / 4 and n / 2 groups
+  const uint64_t* W4 = root_of_unity_powers + (n >> 3);
+  const uint64_t* W2 = root_of_unity_powers + (n >> 2);
+  const uint64_t* W1 = root_of_unity_powers + (n >> 1);
+  for (size_t j = 0; j < n; j += 16) {
+    __m512i v1 = _mm512_loadu_si512(operand + j);
+    __m512i v2 = _mm512_loadu_si512(operand + j + 8);
+    GoldilocksRegisterStage<4, false>(&v1, &v2, W4 + j / 8);
+    GoldilocksRegisterStage<2, false>(&v1, &v2, W2 + j / 4);
+    GoldilocksRegisterStage<1, false>(&v1, &v2, W1 + j / 2);
+    _mm512_storeu_si512(operand + j, v1);
+    _mm512_storeu_si512(operand + j + 8, v2);
+  }
+}
+
+void InverseTransformFromBitReverseGoldilocksAVX512(
+    uint64_t* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    uint64_t inv_n) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (n < 16) {
+    InverseTransformFromBitReverseGoldilocks(operand, n,
+                                             inv_root_of_unity_powers, inv_n);
+    return;
+  }
+
+  // The first three stages, with n / 2, n / 4 and n / 8 groups
+  const uint64_t* W1 = inv_root_of_unity_powers + (n >> 1);
+  const uint64_t* W2 = inv_root_of_unity_powers + (n >> 2);
+  const uint64_t* W4 = inv_root_of_unity_powers + (n >> 3);
+  for (size_t j = 0; j < n; j += 16) {
+    __m512i v1 = _mm512_loadu_si512(operand + j);
+    __m512i v2 = _mm512_loadu_si512(operand + j + 8);
+    GoldilocksRegisterStage<1, true>(&v1, &v2, W1 + j / 2);
+    GoldilocksRegisterStage<2, true>(&v1, &v2, W2 + j / 4);
+    GoldilocksRegisterStage<4, true>(&v1, &v2, W4 + j / 8);
+    _mm512_storeu_si512(operand + j, v1);
+    _mm512_storeu_si512(operand + j + 8, v2);
+  }
+
+  size_t t = 8;
+  for (size_t m = (n >> 4); m > 1; m >>= 1, t <<= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      __m512i v_W = _mm512_set1_epi64(
+          static_cast<int64_t>(inv_root_of_unity_powers[m + i]));
+      __m512i* v_X_pt = reinterpret_cast<__m512i*>(operand + j1);
+      __m512i* v_Y_pt = reinterpret_cast<__m512i*>(operand + j1 + t);
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t j = t / 8; j > 0; --j) {
+        __m512i v_X = _mm512_loadu_si512(v_X_pt);
+        __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+        GoldilocksInvButterfly(&v_X, &v_Y, v_W);
+        _mm512_storeu_si512(v_X_pt++, v_X);
+        _mm512_storeu_si512(v_Y_pt++, v_Y);
+      }
+    }
+  }
+
+  // Final stage, merging the multiplication by n^{-1}
+  __m512i v_inv_n = _mm512_set1_epi64(static_cast<int64_t>(inv_n));
+  __m512i v_W = _mm512_set1_epi64(static_cast<int64_t>(
+      MultiplyModGoldilocks(inv_root_of_unity_powers[1], inv_n)));
+  __m512i* v_X_pt = reinterpret_cast<__m512i*>(operand);
+  __m512i* v_Y_pt = reinterpret_cast<__m512i*>(operand + t);
+
+  HEXL_LOOP_UNROLL_4
+  for (size_t j = t / 8; j > 0; --j) {
+    __m512i v_X = _mm512_loadu_si512(v_X_pt);
+    __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+    GoldilocksInvButterfly(&v_X, &v_Y, v_W);
+    v_X = _mm512_hexl_goldilocks_mul_epu64(v_X, v_inv_n);
+    _mm512_storeu_si512(v_X_pt++, v_X);
+    _mm512_storeu_si512(v_Y_pt++, v_Y);
+  }
+}
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
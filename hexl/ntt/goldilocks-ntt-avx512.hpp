@@ -0,0 +1,30 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+/// @brief AVX512 implementation of the forward NTT over the Goldilocks field
+/// @details See ForwardTransformToBitReverseGoldilocks. Stages with butterfly
+/// distance 8 or more broadcast one twiddle factor per group. The last three
+/// stages run on pairs of registers, with two-source permutes separating the
+/// butterfly inputs. Falls back to the native transform for n < 16.
+void ForwardTransformToBitReverseGoldilocksAVX512(
+    uint64_t* operand, uint64_t n, const uint64_t* root_of_unity_powers);
+
+/// @brief AVX512 implementation of the inverse NTT over the Goldilocks field
+/// @details See InverseTransformFromBitReverseGoldilocks
+void InverseTransformFromBitReverseGoldilocksAVX512(
+    uint64_t* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    uint64_t inv_n);
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,34 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Radix-2 native forward NTT over the Goldilocks field
+/// @param[in, out] operand Input data, each less than kGoldilocksModulus.
+/// Overwritten with the bit-reversed NTT output
+/// @param[in] n Size of the transform, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] root_of_unity_powers Powers of the root of unity in bit-reversed
+/// order, as returned by GoldilocksNTT::GetRootOfUnityPowers
+void ForwardTransformToBitReverseGoldilocks(
+    uint64_t* operand, uint64_t n, const uint64_t* root_of_unity_powers);
+
+/// @brief Radix-2 native inverse NTT over the Goldilocks field
+/// @param[in, out] operand Input data in bit-reversed order, each less than
+/// kGoldilocksModulus. Overwritten with the inverse NTT output
+/// @param[in] n Size of the transform, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] inv_root_of_unity_powers Inverse powers of the root of unity, as
+/// returned by GoldilocksNTT::GetInvRootOfUnityPowers
+/// @param[in] inv_n n^{-1} mod kGoldilocksModulus. Merged into the last stage
+void InverseTransformFromBitReverseGoldilocks(
+    uint64_t* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    uint64_t inv_n);
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,205 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/ntt/goldilocks-ntt.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/compiler.hpp"
+#include "ntt/goldilocks-ntt-avx512.hpp"
+#include "ntt/goldilocks-ntt-internal.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+GoldilocksNTT::GoldilocksNTT(uint64_t degree, NTT::Mode mode,
+                             std::shared_ptr<AllocatorBase> alloc_ptr)
+    : m_degree(degree),
+      m_mode(mode),
+      m_alloc(alloc_ptr),
+      m_aligned_alloc(AlignedAllocator<uint64_t, 64>(m_alloc)),
+      m_root_of_unity_powers(degree, 0, m_aligned_alloc),
+      m_inv_root_of_unity_powers(degree, 0, m_aligned_alloc) {
+  HEXL_CHECK(IsPowerOfTwo(degree),
+             "degree " << degree << " is not a power of 2");
+  HEXL_CHECK(mode == NTT::Mode::kNegacyclic || mode == NTT::Mode::kCyclic,
+             "GoldilocksNTT supports only negacyclic and cyclic transforms");
+
+  const uint64_t p = kGoldilocksModulus;
+  bool negacyclic = (mode == NTT::Mode::kNegacyclic);
+  uint64_t order = negacyclic ? 2 * degree : degree;
+  HEXL_CHECK(order <= (1ULL << 32),
+             "degree " << degree << " too large; 2^32 is the largest power of "
+                       << "2 dividing p - 1");
+
+  m_root_of_unity = PowModGoldilocks(s_generator, (p - 1) / order);
+  m_inv_degree = PowModGoldilocks(degree, p - 2);
+
+  // The twiddle factor of group i in the stage with m groups is
+  // twist^(N / 2m) * psi^(ReverseBits(i, log2(N)) / 2), for psi a primitive
+  // N'th root of unity. The negacyclic transform has twist psi^(1/2), the root
+  // of unity itself; the cyclic transform has twist 1.
+  uint64_t psi = negacyclic ? MultiplyModGoldilocks(m_root_of_unity,
+                                                    m_root_of_unity)
+                            : m_root_of_unity;
+  uint64_t twist = negacyclic ? m_root_of_unity : 1;
+  uint64_t inv_twist = negacyclic ? PowModGoldilocks(twist, p - 2) : 1;
+
+  uint64_t half_degree = degree / 2;
+  std::vector<uint64_t> psi_powers(half_degree + 1, 1);
+  for (size_t j = 1; j < half_degree; ++j) {
+    psi_powers[j] = MultiplyModGoldilocks(psi_powers[j - 1], psi);
+  }
+
+  uint64_t log_degree = Log2(degree);
+  m_root_of_unity_powers[0] = 1;
+  m_inv_root_of_unity_powers[0] = 1;
+  for (size_t m = half_degree; m >= 1; m >>= 1) {
+    for (size_t i = 0; i < m; ++i) {
+      uint64_t j = ReverseBits(i, log_degree) / 2;
+      // psi^(-j) = -psi^(N/2 - j), since psi^(N/2) = -1
+      uint64_t inv_psi_power = (j == 0) ? 1 : p - psi_powers[half_degree - j];
+      m_root_of_unity_powers[m + i] =
+          MultiplyModGoldilocks(twist, psi_powers[j]);
+      m_inv_root_of_unity_powers[m + i] =
+          MultiplyModGoldilocks(inv_twist, inv_psi_power);
+    }
+    twist = MultiplyModGoldilocks(twist, twist);
+    inv_twist = MultiplyModGoldilocks(inv_twist, inv_twist);
+  }
+}
+
+void GoldilocksNTT::ComputeForward(uint64_t* result, const uint64_t* operand,
+                                   NTT::Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK_BOUNDS(operand, m_degree, kGoldilocksModulus,
+                    "value in operand exceeds bound " << kGoldilocksModulus);
+
+  if (result != operand) {
+    std::memcpy(result, operand, m_degree * sizeof(uint64_t));
+  }
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling Goldilocks AVX512 FwdNTT");
+    ForwardTransformToBitReverseGoldilocksAVX512(
+        result, m_degree, m_root_of_unity_powers.data());
+  } else {
+#endif
+    HEXL_VLOG(3, "Calling Goldilocks native FwdNTT");
+    ForwardTransformToBitReverseGoldilocks(result, m_degree,
+                                           m_root_of_unity_powers.data());
+#ifdef HEXL_HAS_AVX512DQ
+  }
+#endif
+
+  if (output_order == NTT::Ordering::kNatural) {
+    BitReversePermuteInPlace(result, m_degree);
+  }
+}
+
+void GoldilocksNTT::ComputeInverse(uint64_t* result, const uint64_t* operand,
+                                   NTT::Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK_BOUNDS(operand, m_degree, kGoldilocksModulus,
+                    "value in operand exceeds bound " << kGoldilocksModulus);
+
+  if (input_order == NTT::Ordering::kNatural) {
+    BitReversePermute(result, operand, m_degree);
+  } else if (result != operand) {
+    std::memcpy(result, operand, m_degree * sizeof(uint64_t));
+  }
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    HEXL_VLOG(3, "Calling Goldilocks AVX512 InvNTT");
+    InverseTransformFromBitReverseGoldilocksAVX512(
+        result, m_degree, m_inv_root_of_unity_powers.data(), m_inv_degree);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling Goldilocks native InvNTT");
+  InverseTransformFromBitReverseGoldilocks(
+      result, m_degree, m_inv_root_of_unity_powers.data(), m_inv_degree);
+}
+
+void ForwardTransformToBitReverseGoldilocks(
+    uint64_t* operand, uint64_t n, const uint64_t* root_of_unity_powers) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  size_t t = (n >> 1);
+  for (size_t m = 1; m < n; m <<= 1, t >>= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      const uint64_t W = root_of_unity_powers[m + i];
+      uint64_t* X = operand + j1;
+      uint64_t* Y = X + t;
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t j = 0; j < t; j++) {
+        uint64_t tx = X[j];
+        uint64_t ty = MultiplyModGoldilocks(W, Y[j]);
+        X[j] = AddModGoldilocks(tx, ty);
+        Y[j] = SubModGoldilocks(tx, ty);
+      }
+    }
+  }
+}
+
+void InverseTransformFromBitReverseGoldilocks(
+    uint64_t* operand, uint64_t n, const uint64_t* inv_root_of_unity_powers,
+    uint64_t inv_n) {
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(IsPowerOfTwo(n), "n " << n << " is not a power of 2");
+
+  if (n == 1) {
+    return;
+  }
+
+  size_t t = 1;
+  for (size_t m = (n >> 1); m > 1; m >>= 1, t <<= 1) {
+    size_t j1 = 0;
+    for (size_t i = 0; i < m; i++, j1 += (t << 1)) {
+      const uint64_t W = inv_root_of_unity_powers[m + i];
+      uint64_t* X = operand + j1;
+      uint64_t* Y = X + t;
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t j = 0; j < t; j++) {
+        uint64_t tx = X[j];
+        uint64_t ty = Y[j];
+        X[j] = AddModGoldilocks(tx, ty);
+        Y[j] = MultiplyModGoldilocks(W, SubModGoldilocks(tx, ty));
+      }
+    }
+  }
+
+  // Final stage, merging the multiplication by n^{-1}
+  const uint64_t W = MultiplyModGoldilocks(inv_root_of_unity_powers[1], inv_n);
+  uint64_t* X = operand;
+  uint64_t* Y = X + t;
+  HEXL_LOOP_UNROLL_4
+  for (size_t j = 0; j < t; j++) {
+    uint64_t tx = X[j];
+    uint64_t ty = Y[j];
+    X[j] = MultiplyModGoldilocks(AddModGoldilocks(tx, ty), inv_n);
+    Y[j] = MultiplyModGoldilocks(W, SubModGoldilocks(tx, ty));
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
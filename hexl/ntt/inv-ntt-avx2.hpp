@@ -0,0 +1,40 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+/// @brief AVX2 implementation of the inverse NTT
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two, at least 8.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] inv_root_of_unity_powers Powers of inverse 2n'th root of unity
+/// in F_q. In bit-reversed order.
+/// @param[in] precon_inv_root_of_unity_powers Pre-conditioned powers of
+/// inverse 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details See ForwardTransformToBitReverseAVX2 for the constraints on
+/// BitShift
+template <int BitShift>
+void InverseTransformFromBitReverseAVX2(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
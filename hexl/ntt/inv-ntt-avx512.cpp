@@ -20,27 +20,192 @@ namespace hexl {
 
 #ifdef HEXL_HAS_AVX512IFMA
 template void InverseTransformFromBitReverseAVX512<NTT::s_ifma_shift_bits>(
-    uint64_t* operand, uint64_t degree, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
-    uint64_t output_mod_factor, uint64_t recursion_depth = 0,
-    uint64_t recursion_half = 0);
+    uint64_t output_mod_factor, uint64_t recursion_depth,
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512Rows<NTT::s_ifma_shift_bits, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512Rows<NTT::s_ifma_shift_bits, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512Block<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t num_blocks, uint64_t block, uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512LastStages<NTT::s_ifma_shift_bits>(
+    uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t output_mod_factor,
+    uint64_t num_blocks, uint64_t slice);
+
+template void
+InverseTransformFromBitReverseAVX512Parallel<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512FourStep<NTT::s_ifma_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
 #endif
 
 #ifdef HEXL_HAS_AVX512DQ
 template void InverseTransformFromBitReverseAVX512<32>(
-    uint64_t* operand, uint64_t degree, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t recursion_depth,
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512Rows<32, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512Rows<32, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512Block<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t num_blocks, uint64_t block, uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512LastStages<32>(
+    uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t output_mod_factor,
+    uint64_t num_blocks, uint64_t slice);
+
+template void InverseTransformFromBitReverseAVX512Parallel<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseAVX512FourStep<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void InverseTransformFromBitReverseStridedAVX512<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t stride, uint64_t mod,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
-    uint64_t output_mod_factor, uint64_t recursion_depth = 0,
-    uint64_t recursion_half = 0);
+    uint64_t output_mod_factor);
+
+template void InverseTransformFromBitReverseBatchAVX512<32>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t mod, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
 
 template void InverseTransformFromBitReverseAVX512<NTT::s_default_shift_bits>(
-    uint64_t* operand, uint64_t degree, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
-    uint64_t output_mod_factor, uint64_t recursion_depth = 0,
-    uint64_t recursion_half = 0);
+    uint64_t output_mod_factor, uint64_t recursion_depth,
+    uint64_t recursion_half, uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512Rows<NTT::s_default_shift_bits, 2>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512Rows<NTT::s_default_shift_bits, 4>(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t degree,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512Block<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t num_blocks, uint64_t block, uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512LastStages<NTT::s_default_shift_bits>(
+    uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t output_mod_factor,
+    uint64_t num_blocks, uint64_t slice);
+
+template void
+InverseTransformFromBitReverseAVX512Parallel<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseAVX512FourStep<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size);
+
+template void
+InverseTransformFromBitReverseStridedAVX512<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t stride, uint64_t mod,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void
+InverseTransformFromBitReverseBatchAVX512<NTT::s_default_shift_bits>(
+    uint64_t* result, const uint64_t* operand, uint64_t degree,
+    uint64_t batch_size, uint64_t mod, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
 #endif
 
 #ifdef HEXL_HAS_AVX512DQ
@@ -87,125 +252,322 @@ inline void InvButterfly(__m512i* X, __m512i* Y, __m512i W_op, __m512i W_precon,
   }
 }
 
-template <int BitShift, bool InputLessThanMod>
-void InvT1(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t m, const uint64_t* W_op, const uint64_t* W_precon) {
-  const __m512i* v_W_op_pt = reinterpret_cast<const __m512i*>(W_op);
-  const __m512i* v_W_precon_pt = reinterpret_cast<const __m512i*>(W_precon);
+template <int BitShift>
+void InvT8(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
+           uint64_t t, uint64_t m, const uint64_t* W_op,
+           const uint64_t* W_precon) {
   size_t j1 = 0;
 
-  // 8 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_8
-  for (size_t i = m / 8; i > 0; --i) {
+  HEXL_LOOP_UNROLL_4
+  for (size_t i = 0; i < m; i++) {
     uint64_t* X = operand + j1;
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+    uint64_t* Y = X + t;
 
-    __m512i v_X;
-    __m512i v_Y;
-    LoadInvInterleavedT1(X, &v_X, &v_Y);
+    __m512i v_W_op = _mm512_set1_epi64(static_cast<int64_t>(*W_op++));
+    __m512i v_W_precon = _mm512_set1_epi64(static_cast<int64_t>(*W_precon++));
 
-    __m512i v_W_op = _mm512_loadu_si512(v_W_op_pt++);
-    __m512i v_W_precon = _mm512_loadu_si512(v_W_precon_pt++);
+    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+    __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y);
 
-    InvButterfly<BitShift, InputLessThanMod>(&v_X, &v_Y, v_W_op, v_W_precon,
-                                             v_neg_modulus, v_twice_mod);
+    // assume 8 | t
+    for (size_t j = t / 8; j > 0; --j) {
+      __m512i v_X = _mm512_loadu_si512(v_X_pt);
+      __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
 
-    _mm512_storeu_si512(v_X_pt++, v_X);
-    _mm512_storeu_si512(v_X_pt, v_Y);
+      InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                    v_neg_modulus, v_twice_mod);
 
-    j1 += 16;
+      _mm512_storeu_si512(v_X_pt++, v_X);
+      _mm512_storeu_si512(v_Y_pt++, v_Y);
+    }
+    j1 += (t << 1);
   }
 }
 
-template <int BitShift>
-void InvT2(uint64_t* X, __m512i v_neg_modulus, __m512i v_twice_mod, uint64_t m,
-           const uint64_t* W_op, const uint64_t* W_precon) {
-  // 4 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = m / 4; i > 0; --i) {
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
-
-    __m512i v_X;
-    __m512i v_Y;
-    LoadInvInterleavedT2(X, &v_X, &v_Y);
-
-    __m512i v_W_op = LoadWOpT2(static_cast<const void*>(W_op));
-    __m512i v_W_precon = LoadWOpT2(static_cast<const void*>(W_precon));
-
-    InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon, v_neg_modulus,
-                                  v_twice_mod);
+/// @brief Computes the inverse stage of m groups of butterflies on elements t
+/// apart on NumRows rows at once, in-place on \p operand[r] for row r
+/// @param[in] v_neg_modulus Negative modulus of each row
+/// @param[in] v_twice_mod Twice the modulus of each row
+/// @param[in] W_op Inverse roots of unity of each row for this stage
+/// @param[in] W_precon Pre-conditioned inverse roots of unity of each row for
+/// this stage
+/// @details Each inner iteration computes one vector of butterflies on every
+/// row, so the butterflies of different rows are independent and fill the
+/// multiplier latency of each other.
+template <int BitShift, size_t NumRows>
+void InvT8Rows(uint64_t* const* operand, const __m512i* v_neg_modulus,
+               const __m512i* v_twice_mod, uint64_t t, uint64_t m,
+               const uint64_t* const* W_op, const uint64_t* const* W_precon) {
+  // Local copies of the row pointers and moduli, which the stores can't
+  // alias, so they stay in registers
+  uint64_t* X[NumRows];
+  __m512i v_neg_mod[NumRows];
+  __m512i v_twice_q[NumRows];
+  for (size_t r = 0; r < NumRows; ++r) {
+    X[r] = operand[r];
+    v_neg_mod[r] = v_neg_modulus[r];
+    v_twice_q[r] = v_twice_mod[r];
+  }
 
-    _mm512_storeu_si512(v_X_pt++, v_X);
-    _mm512_storeu_si512(v_X_pt, v_Y);
-    X += 16;
+  size_t j1 = 0;
+  for (size_t i = 0; i < m; i++) {
+    __m512i v_W_op[NumRows];
+    __m512i v_W_precon[NumRows];
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRows; ++r) {
+      v_W_op[r] = _mm512_set1_epi64(static_cast<int64_t>(W_op[r][i]));
+      v_W_precon[r] = _mm512_set1_epi64(static_cast<int64_t>(W_precon[r][i]));
+    }
 
-    W_op += 4;
-    W_precon += 4;
+    // assume 8 | t
+    for (size_t j = j1; j < j1 + t; j += 8) {
+      // The rows are a multiple of 4KB apart, so all the loads are issued
+      // before any store, which would falsely alias the next row's loads
+      __m512i v_X[NumRows];
+      __m512i v_Y[NumRows];
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        v_X[r] = _mm512_loadu_si512(X[r] + j);
+        v_Y[r] = _mm512_loadu_si512(X[r] + j + t);
+      }
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        InvButterfly<BitShift, false>(&v_X[r], &v_Y[r], v_W_op[r],
+                                      v_W_precon[r], v_neg_mod[r],
+                                      v_twice_q[r]);
+      }
+      HEXL_LOOP_UNROLL_4
+      for (size_t r = 0; r < NumRows; ++r) {
+        _mm512_storeu_si512(X[r] + j, v_X[r]);
+        _mm512_storeu_si512(X[r] + j + t, v_Y[r]);
+      }
+    }
+    j1 += (t << 1);
   }
 }
 
-template <int BitShift>
-void InvT4(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t m, const uint64_t* W_op, const uint64_t* W_precon) {
-  uint64_t* X = operand;
+/// @brief Computes the first 3 + NumBcastStages stages of the inverse NTT,
+/// i.e. t = 1, 2, 4, ..., 4 * 2^NumBcastStages, on blocks of 8 * NumRegs
+/// coefficients. Each block is loaded into NumRegs registers once and
+/// shuffled in registers between the stages, rather than stored and re-loaded
+/// after every stage.
+/// @param[in] W_op Roots of unity for each stage. The stage t = 1 loads one
+/// vector of roots per 16 coefficients, the stages t = 2, 4 load 4 and 2
+/// roots per 16 coefficients, and the remaining stages broadcast one root per
+/// group.
+/// @param[in] W_precon Pre-conditioned roots of unity for each stage
+/// @param InputLessThanMod If true, assumes the input is in [0, q)
+/// @details Loads each block from \p operand and stores it to \p result,
+/// which may be equal.
+template <int BitShift, int NumRegs, int NumBcastStages, bool InputLessThanMod>
+void InvFirstStages(uint64_t* result, const uint64_t* operand, uint64_t n,
+                    __m512i v_neg_modulus, __m512i v_twice_mod,
+                    const uint64_t* const* W_op,
+                    const uint64_t* const* W_precon) {
+  static_assert(NumRegs == 2 || NumRegs == 4 || NumRegs == 8,
+                "NumRegs must be 2, 4, or 8");
+  static_assert((1 << NumBcastStages) <= NumRegs,
+                "Too many stages for NumRegs registers");
+  const size_t block_size = 8 * NumRegs;
+  const __m512i* v_W_op_T1 = reinterpret_cast<const __m512i*>(W_op[0]);
+  const __m512i* v_W_precon_T1 = reinterpret_cast<const __m512i*>(W_precon[0]);
+
+  for (size_t b = 0; b < n / block_size; ++b) {
+    const __m512i* v_X_op_pt =
+        reinterpret_cast<const __m512i*>(operand + b * block_size);
+    __m512i* v_X_pt = reinterpret_cast<__m512i*>(result + b * block_size);
+    __m512i v_X[NumRegs];
+    HEXL_LOOP_UNROLL_8
+    for (size_t r = 0; r < NumRegs; ++r) {
+      v_X[r] = _mm512_loadu_si512(v_X_op_pt + r);
+    }
 
-  // 2 | m guaranteed by n >= 16
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = m / 2; i > 0; --i) {
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+    // Stages t = 1, 2, 4 on each 16 coefficients. Each stage runs on all the
+    // registers before the next one, so independent butterflies are adjacent
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      InvInterleavedT1(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      InvButterfly<BitShift, InputLessThanMod>(
+          &v_X[r], &v_X[r + 1], _mm512_loadu_si512(v_W_op_T1 + W_idx),
+          _mm512_loadu_si512(v_W_precon_T1 + W_idx), v_neg_modulus,
+          v_twice_mod);
+    }
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      InvInterleavedT2(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      InvButterfly<BitShift, false>(
+          &v_X[r], &v_X[r + 1], LoadWOpT2(W_op[1] + 4 * W_idx),
+          LoadWOpT2(W_precon[1] + 4 * W_idx), v_neg_modulus, v_twice_mod);
+    }
+    HEXL_LOOP_UNROLL_4
+    for (size_t r = 0; r < NumRegs; r += 2) {
+      const size_t W_idx = (b * NumRegs + r) / 2;
+      InvInterleavedT4(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+      InvButterfly<BitShift, false>(
+          &v_X[r], &v_X[r + 1], LoadWOpT4(W_op[2] + 2 * W_idx),
+          LoadWOpT4(W_precon[2] + 2 * W_idx), v_neg_modulus, v_twice_mod);
+      InvDeinterleavedT4(v_X[r], v_X[r + 1], &v_X[r], &v_X[r + 1]);
+    }
 
-    __m512i v_X;
-    __m512i v_Y;
-    LoadInvInterleavedT4(X, &v_X, &v_Y);
+    // Stage s has NumRegs / 2^(s+1) groups of butterflies on registers 2^s
+    // apart
+    HEXL_LOOP_UNROLL_4
+    for (size_t s = 0; s < NumBcastStages; ++s) {
+      const size_t half = 1ULL << s;
+      const size_t num_groups = NumRegs >> (s + 1);
+      HEXL_LOOP_UNROLL_4
+      for (size_t g = 0; g < num_groups; ++g) {
+        const size_t W_idx = b * num_groups + g;
+        __m512i v_W_op =
+            _mm512_set1_epi64(static_cast<int64_t>(W_op[3 + s][W_idx]));
+        __m512i v_W_precon =
+            _mm512_set1_epi64(static_cast<int64_t>(W_precon[3 + s][W_idx]));
+        HEXL_LOOP_UNROLL_4
+        for (size_t r = 2 * half * g; r < 2 * half * g + half; ++r) {
+          InvButterfly<BitShift, false>(&v_X[r], &v_X[r + half], v_W_op,
+                                        v_W_precon, v_neg_modulus,
+                                        v_twice_mod);
+        }
+      }
+    }
 
-    __m512i v_W_op = LoadWOpT4(static_cast<const void*>(W_op));
-    __m512i v_W_precon = LoadWOpT4(static_cast<const void*>(W_precon));
+    HEXL_LOOP_UNROLL_8
+    for (size_t r = 0; r < NumRegs; ++r) {
+      _mm512_storeu_si512(v_X_pt + r, v_X[r]);
+    }
+  }
+}
 
-    InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon, v_neg_modulus,
-                                  v_twice_mod);
+/// @brief Dispatches InvFirstStages on the largest blocks with at most 64
+/// coefficients which leave the last stage of the transform out
+template <int BitShift, bool InputLessThanMod>
+void InvFirstStagesBlocked(uint64_t* result, const uint64_t* operand,
+                           uint64_t n, __m512i v_neg_modulus,
+                           __m512i v_twice_mod, const uint64_t* const* W_op,
+                           const uint64_t* const* W_precon) {
+  if (n == 16) {
+    InvFirstStages<BitShift, 2, 0, InputLessThanMod>(
+        result, operand, n, v_neg_modulus, v_twice_mod, W_op, W_precon);
+  } else if (n == 32) {
+    InvFirstStages<BitShift, 4, 1, InputLessThanMod>(
+        result, operand, n, v_neg_modulus, v_twice_mod, W_op, W_precon);
+  } else if (n == 64) {
+    InvFirstStages<BitShift, 8, 2, InputLessThanMod>(
+        result, operand, n, v_neg_modulus, v_twice_mod, W_op, W_precon);
+  } else {
+    InvFirstStages<BitShift, 8, 3, InputLessThanMod>(
+        result, operand, n, v_neg_modulus, v_twice_mod, W_op, W_precon);
+  }
+}
 
-    WriteInvInterleavedT4(v_X, v_Y, v_X_pt);
-    X += 16;
+/// @brief Butterfly of the final stage of the inverse NTT, which also
+/// multiplies by n^{-1}: assume \p X, \p Y in [0, 2q), and return X', Y' in
+/// [0, 2q) such that X', Y' = (X + Y) / n, W(X - Y) / n (mod q)
+/// @param[in] inv_n n^{-1} in each lane
+/// @param[in] inv_n_prime BitShift-bit Barrett factor of \p inv_n
+/// @param[in] inv_n_w n^{-1} * W in each lane, with W the root of unity for
+/// the final stage
+/// @param[in] inv_n_w_prime BitShift-bit Barrett factor of \p inv_n_w
+template <int BitShift>
+inline void InvFinalButterfly(__m512i* X, __m512i* Y, __m512i inv_n,
+                              __m512i inv_n_prime, __m512i inv_n_w,
+                              __m512i inv_n_w_prime, __m512i neg_modulus,
+                              __m512i twice_modulus) {
+  // Slightly different from regular InvButterfly because different W is
+  // used for X and Y
+  __m512i Y_minus_2q = _mm512_sub_epi64(*Y, twice_modulus);
+  __m512i X_plus_Y_mod2q =
+      _mm512_hexl_small_add_mod_epi64(*X, *Y, twice_modulus);
+  // T = *X + twice_mod - *Y
+  __m512i T = _mm512_sub_epi64(*X, Y_minus_2q);
 
-    W_op += 2;
-    W_precon += 2;
+  if (BitShift == 32) {
+    __m512i Q1 = _mm512_hexl_mullo_epi<64>(inv_n_prime, X_plus_Y_mod2q);
+    Q1 = _mm512_srli_epi64(Q1, 32);
+    // X = inv_N * X_plus_Y_mod2q - Q1 * modulus;
+    __m512i inv_N_tx = _mm512_hexl_mullo_epi<64>(inv_n, X_plus_Y_mod2q);
+    *X = _mm512_hexl_mullo_add_lo_epi<64>(inv_N_tx, Q1, neg_modulus);
+
+    __m512i Q2 = _mm512_hexl_mullo_epi<64>(inv_n_w_prime, T);
+    Q2 = _mm512_srli_epi64(Q2, 32);
+
+    // Y = inv_N_W * T - Q2 * modulus;
+    __m512i inv_N_W_T = _mm512_hexl_mullo_epi<64>(inv_n_w, T);
+    *Y = _mm512_hexl_mullo_add_lo_epi<64>(inv_N_W_T, Q2, neg_modulus);
+  } else {
+    __m512i Q1 = _mm512_hexl_mulhi_epi<BitShift>(inv_n_prime, X_plus_Y_mod2q);
+    // X = inv_N * X_plus_Y_mod2q - Q1 * modulus;
+    __m512i inv_N_tx = _mm512_hexl_mullo_epi<BitShift>(inv_n, X_plus_Y_mod2q);
+    *X = _mm512_hexl_mullo_add_lo_epi<BitShift>(inv_N_tx, Q1, neg_modulus);
+
+    __m512i Q2 = _mm512_hexl_mulhi_epi<BitShift>(inv_n_w_prime, T);
+    // Y = inv_N_W * T - Q2 * modulus;
+    __m512i inv_N_W_T = _mm512_hexl_mullo_epi<BitShift>(inv_n_w, T);
+    *Y = _mm512_hexl_mullo_add_lo_epi<BitShift>(inv_N_W_T, Q2, neg_modulus);
   }
 }
 
+/// @brief Final stage of the inverse NTT, which also multiplies by n^{-1}
+/// and reduces the output to [0, output_mod_factor * q)
+/// @param[in, out] X First half of the butterfly inputs
+/// @param[in, out] Y Second half of the butterfly inputs
+/// @param[in] num_elements Number of elements in each of \p X and \p Y. Must
+/// be a multiple of 8.
+/// @param[in] modulus Prime modulus q
+/// @param[in] mf_inv_n Factor for multiplication by n^{-1}
+/// @param[in] mf_inv_n_w Factor for multiplication by n^{-1} * W, with W the
+/// root of unity for the final stage
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
 template <int BitShift>
-void InvT8(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
-           uint64_t t, uint64_t m, const uint64_t* W_op,
-           const uint64_t* W_precon) {
-  size_t j1 = 0;
+void InvNTTFinalStage(uint64_t* X, uint64_t* Y, uint64_t num_elements,
+                      uint64_t modulus, const MultiplyFactor& mf_inv_n,
+                      const MultiplyFactor& mf_inv_n_w,
+                      uint64_t output_mod_factor) {
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(modulus << 1));
 
-  HEXL_LOOP_UNROLL_4
-  for (size_t i = 0; i < m; i++) {
-    uint64_t* X = operand + j1;
-    uint64_t* Y = X + t;
+  const uint64_t inv_n = mf_inv_n.Operand();
+  const uint64_t inv_n_prime = mf_inv_n.BarrettFactor();
+  const uint64_t inv_n_w = mf_inv_n_w.Operand();
+  const uint64_t inv_n_w_prime = mf_inv_n_w.BarrettFactor();
 
-    __m512i v_W_op = _mm512_set1_epi64(static_cast<int64_t>(*W_op++));
-    __m512i v_W_precon = _mm512_set1_epi64(static_cast<int64_t>(*W_precon++));
+  __m512i v_inv_n = _mm512_set1_epi64(static_cast<int64_t>(inv_n));
+  __m512i v_inv_n_prime = _mm512_set1_epi64(static_cast<int64_t>(inv_n_prime));
+  __m512i v_inv_n_w = _mm512_set1_epi64(static_cast<int64_t>(inv_n_w));
+  __m512i v_inv_n_w_prime =
+      _mm512_set1_epi64(static_cast<int64_t>(inv_n_w_prime));
 
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
-    __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y);
+  __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+  __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y);
 
-    // assume 8 | t
-    for (size_t j = t / 8; j > 0; --j) {
-      __m512i v_X = _mm512_loadu_si512(v_X_pt);
-      __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+  // Merge final InvNTT loop with modulus reduction baked-in
+  HEXL_LOOP_UNROLL_4
+  for (size_t j = num_elements / 8; j > 0; --j) {
+    __m512i v_X = _mm512_loadu_si512(v_X_pt);
+    __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
 
-      InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
-                                    v_neg_modulus, v_twice_mod);
+    InvFinalButterfly<BitShift>(&v_X, &v_Y, v_inv_n, v_inv_n_prime, v_inv_n_w,
+                                v_inv_n_w_prime, v_neg_modulus, v_twice_mod);
 
-      _mm512_storeu_si512(v_X_pt++, v_X);
-      _mm512_storeu_si512(v_Y_pt++, v_Y);
+    if (output_mod_factor == 1) {
+      // Modulus reduction from [0, 2q), to [0, q)
+      v_X = _mm512_hexl_small_mod_epu64(v_X, v_modulus);
+      v_Y = _mm512_hexl_small_mod_epu64(v_Y, v_modulus);
     }
-    j1 += (t << 1);
+
+    _mm512_storeu_si512(v_X_pt++, v_X);
+    _mm512_storeu_si512(v_Y_pt++, v_Y);
   }
 }
 
 /// @brief AVX512 implementation of the inverse NTT
-/// @param[in, out] operand Input data. Overwritten with NTT output
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
 /// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
 /// power of two.
 /// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
@@ -228,11 +590,11 @@ void InvT8(uint64_t* operand, __m512i v_neg_modulus, __m512i v_twice_mod,
 /// performance on larger transform sizes.
 template <int BitShift>
 void InverseTransformFromBitReverseAVX512(
-    uint64_t* operand, uint64_t n, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor, uint64_t recursion_depth,
-    uint64_t recursion_half) {
+    uint64_t recursion_half, uint64_t base_ntt_size) {
   HEXL_CHECK(CheckNTTArguments(n, modulus), "");
   HEXL_CHECK(n >= 16,
              "InverseTransformFromBitReverseAVX512 doesn't support small "
@@ -255,7 +617,6 @@ void InverseTransformFromBitReverseAVX512(
              "output_mod_factor must be 1 or 2; got " << output_mod_factor);
 
   uint64_t twice_mod = modulus << 1;
-  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
   __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
   __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(twice_mod));
 
@@ -263,68 +624,53 @@ void InverseTransformFromBitReverseAVX512(
   size_t m = (n >> 1);
   size_t W_idx = 1 + m * recursion_half;
 
-  static const size_t base_ntt_size = 1024;
-
   if (n <= base_ntt_size) {  // Perform breadth-first InvNTT
-    // Extract t=1, t=2, t=4 loops separately
-    {
-      // t = 1
-      const uint64_t* W_op = &inv_root_of_unity_powers[W_idx];
-      const uint64_t* W_precon = &precon_inv_root_of_unity_powers[W_idx];
-      if (input_mod_factor == 1) {
-        InvT1<BitShift, true>(operand, v_neg_modulus, v_twice_mod, m, W_op,
-                              W_precon);
-      } else {
-        InvT1<BitShift, false>(operand, v_neg_modulus, v_twice_mod, m, W_op,
-                               W_precon);
-      }
-
+    // Roots of unity for the stages computed in registers, i.e. all but the
+    // last stage, up to t = 32
+    const size_t num_reg_stages = (n >= 128) ? 6 : Log2(n) - 1;
+    const uint64_t* W_op[6];
+    const uint64_t* W_precon[6];
+    uint64_t W_idx_delta =
+        (m >> 1) * ((1ULL << (recursion_depth + 1)) - recursion_half);
+    for (size_t s = 0; s < num_reg_stages; ++s) {
+      W_op[s] = &inv_root_of_unity_powers[W_idx];
+      W_precon[s] = &precon_inv_root_of_unity_powers[W_idx];
       t <<= 1;
       m >>= 1;
-      uint64_t W_idx_delta =
-          m * ((1ULL << (recursion_depth + 1)) - recursion_half);
       W_idx += W_idx_delta;
+      W_idx_delta >>= 1;
+    }
 
-      // t = 2
-      W_op = &inv_root_of_unity_powers[W_idx];
-      W_precon = &precon_inv_root_of_unity_powers[W_idx];
-      InvT2<BitShift>(operand, v_neg_modulus, v_twice_mod, m, W_op, W_precon);
+    if (input_mod_factor == 1) {
+      InvFirstStagesBlocked<BitShift, true>(result, operand, n, v_neg_modulus,
+                                            v_twice_mod, W_op, W_precon);
+    } else {
+      InvFirstStagesBlocked<BitShift, false>(result, operand, n,
+                                             v_neg_modulus, v_twice_mod, W_op,
+                                             W_precon);
+    }
 
+    // t >= 64
+    for (; m > 1;) {
+      const uint64_t* W_op_t = &inv_root_of_unity_powers[W_idx];
+      const uint64_t* W_precon_t = &precon_inv_root_of_unity_powers[W_idx];
+      InvT8<BitShift>(result, v_neg_modulus, v_twice_mod, t, m, W_op_t,
+                      W_precon_t);
       t <<= 1;
       m >>= 1;
-      W_idx_delta >>= 1;
       W_idx += W_idx_delta;
-
-      // t = 4
-      W_op = &inv_root_of_unity_powers[W_idx];
-      W_precon = &precon_inv_root_of_unity_powers[W_idx];
-      InvT4<BitShift>(operand, v_neg_modulus, v_twice_mod, m, W_op, W_precon);
-      t <<= 1;
-      m >>= 1;
       W_idx_delta >>= 1;
-      W_idx += W_idx_delta;
-
-      // t >= 8
-      for (; m > 1;) {
-        W_op = &inv_root_of_unity_powers[W_idx];
-        W_precon = &precon_inv_root_of_unity_powers[W_idx];
-        InvT8<BitShift>(operand, v_neg_modulus, v_twice_mod, t, m, W_op,
-                        W_precon);
-        t <<= 1;
-        m >>= 1;
-        W_idx_delta >>= 1;
-        W_idx += W_idx_delta;
-      }
     }
   } else {
     InverseTransformFromBitReverseAVX512<BitShift>(
-        operand, n / 2, modulus, inv_root_of_unity_powers,
+        result, operand, n / 2, modulus, inv_root_of_unity_powers,
         precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
-        recursion_depth + 1, 2 * recursion_half);
+        recursion_depth + 1, 2 * recursion_half, base_ntt_size);
     InverseTransformFromBitReverseAVX512<BitShift>(
-        &operand[n / 2], n / 2, modulus, inv_root_of_unity_powers,
+        &result[n / 2], &operand[n / 2], n / 2, modulus,
+        inv_root_of_unity_powers,
         precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
-        recursion_depth + 1, 2 * recursion_half + 1);
+        recursion_depth + 1, 2 * recursion_half + 1, base_ntt_size);
 
     uint64_t W_idx_delta =
         m * ((1ULL << (recursion_depth + 1)) - recursion_half);
@@ -336,7 +682,7 @@ void InverseTransformFromBitReverseAVX512(
     if (m == 2) {
       const uint64_t* W_op = &inv_root_of_unity_powers[W_idx];
       const uint64_t* W_precon = &precon_inv_root_of_unity_powers[W_idx];
-      InvT8<BitShift>(operand, v_neg_modulus, v_twice_mod, t, m, W_op,
+      InvT8<BitShift>(result, v_neg_modulus, v_twice_mod, t, m, W_op,
                       W_precon);
       t <<= 1;
       m >>= 1;
@@ -347,89 +693,596 @@ void InverseTransformFromBitReverseAVX512(
 
   // Final loop through data
   if (recursion_depth == 0) {
-    HEXL_VLOG(4, "AVX512 intermediate operand "
-                     << std::vector<uint64_t>(operand, operand + n));
+    HEXL_VLOG(4, "AVX512 intermediate result "
+                     << std::vector<uint64_t>(result, result + n));
 
     const uint64_t W_op = inv_root_of_unity_powers[W_idx];
     MultiplyFactor mf_inv_n(InverseMod(n, modulus), BitShift, modulus);
-    const uint64_t inv_n = mf_inv_n.Operand();
-    const uint64_t inv_n_prime = mf_inv_n.BarrettFactor();
+    MultiplyFactor mf_inv_n_w(MultiplyMod(mf_inv_n.Operand(), W_op, modulus),
+                              BitShift, modulus);
+
+    HEXL_VLOG(4, "inv_n_w " << mf_inv_n_w.Operand());
 
-    MultiplyFactor mf_inv_n_w(MultiplyMod(inv_n, W_op, modulus), BitShift,
-                              modulus);
-    const uint64_t inv_n_w = mf_inv_n_w.Operand();
-    const uint64_t inv_n_w_prime = mf_inv_n_w.BarrettFactor();
+    InvNTTFinalStage<BitShift>(result, result + (n >> 1), n >> 1, modulus,
+                               mf_inv_n, mf_inv_n_w, output_mod_factor);
 
-    HEXL_VLOG(4, "inv_n_w " << inv_n_w);
+    HEXL_VLOG(5, "AVX512 returning result "
+                     << std::vector<uint64_t>(result, result + n));
+  }
+}
+
+template <int BitShift, size_t NumRows>
+void InverseTransformFromBitReverseAVX512Rows(
+    uint64_t* const* result, const uint64_t* const* operand, uint64_t n,
+    const uint64_t* moduli, const uint64_t* const* inv_root_of_unity_powers,
+    const uint64_t* const* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor, uint64_t output_mod_factor,
+    uint64_t recursion_depth, uint64_t recursion_half,
+    uint64_t base_ntt_size) {
+  HEXL_CHECK(n >= 16,
+             "InverseTransformFromBitReverseAVX512Rows doesn't support small "
+             "transforms. Need n >= 16, got n = "
+                 << n);
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
 
-    uint64_t* X = operand;
-    uint64_t* Y = X + (n >> 1);
+  __m512i v_neg_modulus[NumRows];
+  __m512i v_twice_mod[NumRows];
+  for (size_t r = 0; r < NumRows; ++r) {
+    HEXL_CHECK(CheckNTTArguments(n, moduli[r]), "");
+    HEXL_CHECK(moduli[r] < MaximumValue(BitShift) / 2,
+               "modulus " << moduli[r] << " too large for BitShift "
+                          << BitShift);
+    // Skip input bound checking for recursive steps
+    HEXL_CHECK_BOUNDS(operand[r], (recursion_depth == 0) ? n : 0,
+                      input_mod_factor * moduli[r],
+                      "operand larger than input_mod_factor * modulus ("
+                          << input_mod_factor << " * " << moduli[r] << ")");
+    v_neg_modulus[r] = _mm512_set1_epi64(-static_cast<int64_t>(moduli[r]));
+    v_twice_mod[r] = _mm512_set1_epi64(static_cast<int64_t>(moduli[r] << 1));
+  }
 
-    __m512i v_inv_n = _mm512_set1_epi64(static_cast<int64_t>(inv_n));
-    __m512i v_inv_n_prime =
-        _mm512_set1_epi64(static_cast<int64_t>(inv_n_prime));
-    __m512i v_inv_n_w = _mm512_set1_epi64(static_cast<int64_t>(inv_n_w));
-    __m512i v_inv_n_w_prime =
-        _mm512_set1_epi64(static_cast<int64_t>(inv_n_w_prime));
+  const uint64_t* W_op_rows[NumRows];
+  const uint64_t* W_precon_rows[NumRows];
+  // Offsets the inverse root of unity tables of each row by W_idx
+  auto set_roots = [&](size_t W_idx) {
+    for (size_t r = 0; r < NumRows; ++r) {
+      W_op_rows[r] = &inv_root_of_unity_powers[r][W_idx];
+      W_precon_rows[r] = &precon_inv_root_of_unity_powers[r][W_idx];
+    }
+  };
 
-    __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
-    __m512i* v_Y_pt = reinterpret_cast<__m512i*>(Y);
+  size_t t = 1;
+  size_t m = (n >> 1);
+  size_t W_idx = 1 + m * recursion_half;
 
-    // Merge final InvNTT loop with modulus reduction baked-in
-    HEXL_LOOP_UNROLL_4
-    for (size_t j = n / 16; j > 0; --j) {
-      __m512i v_X = _mm512_loadu_si512(v_X_pt);
-      __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+  if (n <= base_ntt_size) {  // Perform breadth-first InvNTT
+    // Indices of the roots of unity for the stages computed in registers,
+    // i.e. all but the last stage, up to t = 32
+    const size_t num_reg_stages = (n >= 128) ? 6 : Log2(n) - 1;
+    size_t reg_W_idx[6];
+    uint64_t W_idx_delta =
+        (m >> 1) * ((1ULL << (recursion_depth + 1)) - recursion_half);
+    for (size_t s = 0; s < num_reg_stages; ++s) {
+      reg_W_idx[s] = W_idx;
+      t <<= 1;
+      m >>= 1;
+      W_idx += W_idx_delta;
+      W_idx_delta >>= 1;
+    }
 
-      // Slightly different from regular InvButterfly because different W is
-      // used for X and Y
-      __m512i Y_minus_2q = _mm512_sub_epi64(v_Y, v_twice_mod);
-      __m512i X_plus_Y_mod2q =
-          _mm512_hexl_small_add_mod_epi64(v_X, v_Y, v_twice_mod);
-      // T = *X + twice_mod - *Y
-      __m512i T = _mm512_sub_epi64(v_X, Y_minus_2q);
-
-      if (BitShift == 32) {
-        __m512i Q1 = _mm512_hexl_mullo_epi<64>(v_inv_n_prime, X_plus_Y_mod2q);
-        Q1 = _mm512_srli_epi64(Q1, 32);
-        // X = inv_N * X_plus_Y_mod2q - Q1 * modulus;
-        __m512i inv_N_tx = _mm512_hexl_mullo_epi<64>(v_inv_n, X_plus_Y_mod2q);
-        v_X = _mm512_hexl_mullo_add_lo_epi<64>(inv_N_tx, Q1, v_neg_modulus);
-
-        __m512i Q2 = _mm512_hexl_mullo_epi<64>(v_inv_n_w_prime, T);
-        Q2 = _mm512_srli_epi64(Q2, 32);
-
-        // Y = inv_N_W * T - Q2 * modulus;
-        __m512i inv_N_W_T = _mm512_hexl_mullo_epi<64>(v_inv_n_w, T);
-        v_Y = _mm512_hexl_mullo_add_lo_epi<64>(inv_N_W_T, Q2, v_neg_modulus);
+    // Each row's block of the stages in registers already uses all the
+    // registers, so these run one row at a time
+    for (size_t r = 0; r < NumRows; ++r) {
+      const uint64_t* W_op[6];
+      const uint64_t* W_precon[6];
+      for (size_t s = 0; s < num_reg_stages; ++s) {
+        W_op[s] = &inv_root_of_unity_powers[r][reg_W_idx[s]];
+        W_precon[s] = &precon_inv_root_of_unity_powers[r][reg_W_idx[s]];
+      }
+      if (input_mod_factor == 1) {
+        InvFirstStagesBlocked<BitShift, true>(result[r], operand[r], n,
+                                              v_neg_modulus[r],
+                                              v_twice_mod[r], W_op, W_precon);
       } else {
-        __m512i Q1 =
-            _mm512_hexl_mulhi_epi<BitShift>(v_inv_n_prime, X_plus_Y_mod2q);
-        // X = inv_N * X_plus_Y_mod2q - Q1 * modulus;
-        __m512i inv_N_tx =
-            _mm512_hexl_mullo_epi<BitShift>(v_inv_n, X_plus_Y_mod2q);
-        v_X =
-            _mm512_hexl_mullo_add_lo_epi<BitShift>(inv_N_tx, Q1, v_neg_modulus);
-
-        __m512i Q2 = _mm512_hexl_mulhi_epi<BitShift>(v_inv_n_w_prime, T);
-        // Y = inv_N_W * T - Q2 * modulus;
-        __m512i inv_N_W_T = _mm512_hexl_mullo_epi<BitShift>(v_inv_n_w, T);
-        v_Y = _mm512_hexl_mullo_add_lo_epi<BitShift>(inv_N_W_T, Q2,
-                                                     v_neg_modulus);
+        InvFirstStagesBlocked<BitShift, false>(result[r], operand[r], n,
+                                               v_neg_modulus[r],
+                                               v_twice_mod[r], W_op, W_precon);
+      }
+    }
+
+    // t >= 64
+    for (; m > 1;) {
+      set_roots(W_idx);
+      InvT8Rows<BitShift, NumRows>(result, v_neg_modulus, v_twice_mod, t, m,
+                                   W_op_rows, W_precon_rows);
+      t <<= 1;
+      m >>= 1;
+      W_idx += W_idx_delta;
+      W_idx_delta >>= 1;
+    }
+  } else {
+    uint64_t* result_hi[NumRows];
+    const uint64_t* operand_hi[NumRows];
+    for (size_t r = 0; r < NumRows; ++r) {
+      result_hi[r] = result[r] + n / 2;
+      operand_hi[r] = operand[r] + n / 2;
+    }
+    InverseTransformFromBitReverseAVX512Rows<BitShift, NumRows>(
+        result, operand, n / 2, moduli, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, 2 * recursion_half, base_ntt_size);
+    InverseTransformFromBitReverseAVX512Rows<BitShift, NumRows>(
+        result_hi, operand_hi, n / 2, moduli, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        recursion_depth + 1, 2 * recursion_half + 1, base_ntt_size);
+
+    uint64_t W_idx_delta =
+        m * ((1ULL << (recursion_depth + 1)) - recursion_half);
+    for (; m > 2; m >>= 1) {
+      t <<= 1;
+      W_idx_delta >>= 1;
+      W_idx += W_idx_delta;
+    }
+    if (m == 2) {
+      set_roots(W_idx);
+      InvT8Rows<BitShift, NumRows>(result, v_neg_modulus, v_twice_mod, t, m,
+                                   W_op_rows, W_precon_rows);
+      t <<= 1;
+      m >>= 1;
+      W_idx_delta >>= 1;
+      W_idx += W_idx_delta;
+    }
+  }
+
+  // Final loop through data
+  if (recursion_depth == 0) {
+    for (size_t r = 0; r < NumRows; ++r) {
+      const uint64_t W_op = inv_root_of_unity_powers[r][W_idx];
+      MultiplyFactor mf_inv_n(InverseMod(n, moduli[r]), BitShift, moduli[r]);
+      MultiplyFactor mf_inv_n_w(
+          MultiplyMod(mf_inv_n.Operand(), W_op, moduli[r]), BitShift,
+          moduli[r]);
+      InvNTTFinalStage<BitShift>(result[r], result[r] + (n >> 1), n >> 1,
+                                 moduli[r], mf_inv_n, mf_inv_n_w,
+                                 output_mod_factor);
+    }
+  }
+}
+
+namespace {
+
+// The roots of unity are stored stage by stage, so the stage with butterfly
+// distance t of a transform of size n starts at index 1 + n - n / t
+inline size_t InvStageRootIndex(size_t n, size_t t) { return 1 + n - n / t; }
+
+}  // namespace
+
+template <int BitShift>
+void InverseTransformFromBitReverseAVX512Block(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t num_blocks, uint64_t block, uint64_t base_ntt_size) {
+  HEXL_CHECK(block < num_blocks,
+             "block " << block << " >= num_blocks " << num_blocks);
+
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(modulus << 1));
+
+  size_t block_size = n / num_blocks;
+  uint64_t* X = result + block * block_size;
+
+  // The last stage of each subtransform is computed by the caller in the
+  // recursive implementation
+  InverseTransformFromBitReverseAVX512<BitShift>(
+      X, operand + block * block_size, block_size, modulus,
+      inv_root_of_unity_powers, precon_inv_root_of_unity_powers,
+      input_mod_factor, 1, Log2(num_blocks), block, base_ntt_size);
+
+  size_t W_idx = InvStageRootIndex(n, block_size / 2) + block;
+  InvT8<BitShift>(X, v_neg_modulus, v_twice_mod, block_size / 2, 1,
+                  &inv_root_of_unity_powers[W_idx],
+                  &precon_inv_root_of_unity_powers[W_idx]);
+}
+
+template <int BitShift>
+void InverseTransformFromBitReverseAVX512LastStages(
+    uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t output_mod_factor,
+    uint64_t num_blocks, uint64_t slice) {
+  HEXL_CHECK(slice < num_blocks,
+             "slice " << slice << " >= num_blocks " << num_blocks);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(modulus << 1));
+
+  size_t block_size = n / num_blocks;
+  size_t slice_size = block_size / num_blocks;
+  HEXL_CHECK(slice_size % 8 == 0,
+             "slice_size " << slice_size << " not a multiple of 8");
+
+  size_t t = block_size;
+  for (; t < (n >> 1); t <<= 1) {
+    for (size_t i = 0; i < n / (2 * t); i++) {
+      size_t W_idx = InvStageRootIndex(n, t) + i;
+      __m512i v_W_op = _mm512_set1_epi64(
+          static_cast<int64_t>(inv_root_of_unity_powers[W_idx]));
+      __m512i v_W_precon = _mm512_set1_epi64(
+          static_cast<int64_t>(precon_inv_root_of_unity_powers[W_idx]));
+
+      for (size_t j1 = 0; j1 < t; j1 += block_size) {
+        uint64_t* X = operand + 2 * t * i + j1 + slice * slice_size;
+        __m512i* v_X_pt = reinterpret_cast<__m512i*>(X);
+        __m512i* v_Y_pt = reinterpret_cast<__m512i*>(X + t);
+
+        for (size_t j = slice_size / 8; j > 0; --j) {
+          __m512i v_X = _mm512_loadu_si512(v_X_pt);
+          __m512i v_Y = _mm512_loadu_si512(v_Y_pt);
+
+          InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                        v_neg_modulus, v_twice_mod);
+
+          _mm512_storeu_si512(v_X_pt++, v_X);
+          _mm512_storeu_si512(v_Y_pt++, v_Y);
+        }
+      }
+    }
+  }
+
+  const uint64_t W_op = inv_root_of_unity_powers[InvStageRootIndex(n, t)];
+  MultiplyFactor mf_inv_n(InverseMod(n, modulus), BitShift, modulus);
+  MultiplyFactor mf_inv_n_w(MultiplyMod(mf_inv_n.Operand(), W_op, modulus),
+                            BitShift, modulus);
+
+  for (size_t j1 = 0; j1 < t; j1 += block_size) {
+    uint64_t* X = operand + j1 + slice * slice_size;
+    InvNTTFinalStage<BitShift>(X, X + t, slice_size, modulus, mf_inv_n,
+                               mf_inv_n_w, output_mod_factor);
+  }
+}
+
+template <int BitShift>
+void InverseTransformFromBitReverseAVX512Parallel(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, ThreadPool* thread_pool,
+    uint64_t base_ntt_size) {
+  // Transforms too large for the cache use the four-step decomposition,
+  // whose row transforms and column slices fit in the L2 cache
+  if (n >= NTT::s_min_four_step_degree) {
+    HEXL_VLOG(4, "Calling four-step InvNTT");
+    InverseTransformFromBitReverseAVX512FourStep<BitShift>(
+        result, operand, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        FourStepBlockSize(n), thread_pool, base_ntt_size);
+    return;
+  }
+
+  // Each block must take the recursive path, and each column slice must hold
+  // a whole number of SIMD vectors
+  size_t num_blocks = 1;
+  while (thread_pool != nullptr &&
+         2 * num_blocks <= thread_pool->NumThreads()) {
+    size_t block_size = n / (2 * num_blocks);
+    if (block_size < base_ntt_size || block_size < 8 * (2 * num_blocks)) {
+      break;
+    }
+    num_blocks *= 2;
+  }
+  if (num_blocks == 1) {
+    InverseTransformFromBitReverseAVX512<BitShift>(
+        result, operand, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor, 0,
+        0, base_ntt_size);
+    return;
+  }
+
+  HEXL_VLOG(4, "Calling InvNTT on " << num_blocks << " threads");
+  InverseTransformFromBitReverseAVX512FourStep<BitShift>(
+      result, operand, n, modulus, inv_root_of_unity_powers,
+      precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+      n / num_blocks, thread_pool, base_ntt_size);
+}
+
+template <int BitShift>
+void InverseTransformFromBitReverseAVX512FourStep(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor, uint64_t block_size, ThreadPool* thread_pool,
+    uint64_t base_ntt_size) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(IsPowerOfTwo(block_size) && block_size <= n,
+             "block_size " << block_size << " not a power of two at most n");
+  HEXL_CHECK(block_size * block_size >= 8 * n,
+             "block_size " << block_size << " too small for n " << n);
+  HEXL_CHECK_BOUNDS(operand, n, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+
+  size_t num_blocks = n / block_size;
+  if (num_blocks == 1) {
+    InverseTransformFromBitReverseAVX512<BitShift>(
+        result, operand, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor, 0,
+        0, base_ntt_size);
+    return;
+  }
+
+  auto parallel_for = [thread_pool](size_t num_tasks,
+                                    const std::function<void(size_t)>& task) {
+    if (thread_pool == nullptr) {
+      for (size_t i = 0; i < num_tasks; ++i) {
+        task(i);
       }
+    } else {
+      thread_pool->ParallelFor(num_tasks, task);
+    }
+  };
+
+  // Row transforms: the first stages, as independent subtransforms
+  parallel_for(num_blocks, [&](size_t block) {
+    InverseTransformFromBitReverseAVX512Block<BitShift>(
+        result, operand, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, num_blocks, block,
+        base_ntt_size);
+  });
+
+  // Column transforms: the last log2(num_blocks) stages, split by column
+  // slice
+  parallel_for(num_blocks, [&](size_t slice) {
+    InverseTransformFromBitReverseAVX512LastStages<BitShift>(
+        result, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, output_mod_factor, num_blocks, slice);
+  });
+}
 
+template <int BitShift>
+void InverseTransformFromBitReverseStridedAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(modulus < MaximumValue(BitShift) / 2,
+             "modulus " << modulus << " too large for BitShift " << BitShift
+                        << " => maximum value " << MaximumValue(BitShift) / 2);
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  const __mmask8 tail_mask =
+      static_cast<__mmask8>((1U << (batch_size % 8)) - 1);
+
+  if (n == 1) {
+    for (size_t k = 0; k < batch_size; k += 8) {
+      __mmask8 mask = (k + 8 <= batch_size) ? 0xff : tail_mask;
+      __m512i v_X = _mm512_maskz_loadu_epi64(mask, operand + k);
+      if (output_mod_factor == 1) {
+        v_X = _mm512_hexl_small_mod_epu64(v_X, v_modulus);
+      }
+      _mm512_mask_storeu_epi64(result + k, mask, v_X);
+    }
+    return;
+  }
+
+  size_t t = 1;
+  size_t root_index = 1;
+
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
+  for (size_t m = (n >> 1); m > 1; m >>= 1) {
+    for (size_t i = 0; i < m; i++, root_index++) {
+      __m512i v_W_op = _mm512_set1_epi64(
+          static_cast<int64_t>(inv_root_of_unity_powers[root_index]));
+      __m512i v_W_precon = _mm512_set1_epi64(
+          static_cast<int64_t>(precon_inv_root_of_unity_powers[root_index]));
+
+      for (size_t j = 2 * i * t; j < (2 * i + 1) * t; j++) {
+        const uint64_t* X_op = input + j * stride;
+        const uint64_t* Y_op = X_op + t * stride;
+        uint64_t* X_r = result + j * stride;
+        uint64_t* Y_r = X_r + t * stride;
+
+        for (size_t k = 0; k < batch_size; k += 8) {
+          __mmask8 mask = (k + 8 <= batch_size) ? 0xff : tail_mask;
+          __m512i v_X = _mm512_maskz_loadu_epi64(mask, X_op + k);
+          __m512i v_Y = _mm512_maskz_loadu_epi64(mask, Y_op + k);
+
+          InvButterfly<BitShift, false>(&v_X, &v_Y, v_W_op, v_W_precon,
+                                        v_neg_modulus, v_twice_mod);
+
+          _mm512_mask_storeu_epi64(X_r + k, mask, v_X);
+          _mm512_mask_storeu_epi64(Y_r + k, mask, v_Y);
+        }
+      }
+    }
+    t <<= 1;
+    input = result;
+  }
+
+  // Final stage, merged with the multiplication by 1/n
+  const uint64_t W_op = inv_root_of_unity_powers[root_index];
+  MultiplyFactor mf_inv_n(InverseMod(n, modulus), BitShift, modulus);
+  MultiplyFactor mf_inv_n_w(MultiplyMod(mf_inv_n.Operand(), W_op, modulus),
+                            BitShift, modulus);
+  __m512i v_inv_n = _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n.Operand()));
+  __m512i v_inv_n_prime =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n.BarrettFactor()));
+  __m512i v_inv_n_w =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n_w.Operand()));
+  __m512i v_inv_n_w_prime =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n_w.BarrettFactor()));
+
+  for (size_t j = 0; j < (n >> 1); ++j) {
+    const uint64_t* X_op = input + j * stride;
+    const uint64_t* Y_op = X_op + (n >> 1) * stride;
+    uint64_t* X_r = result + j * stride;
+    uint64_t* Y_r = X_r + (n >> 1) * stride;
+
+    for (size_t k = 0; k < batch_size; k += 8) {
+      __mmask8 mask = (k + 8 <= batch_size) ? 0xff : tail_mask;
+      __m512i v_X = _mm512_maskz_loadu_epi64(mask, X_op + k);
+      __m512i v_Y = _mm512_maskz_loadu_epi64(mask, Y_op + k);
+
+      InvFinalButterfly<BitShift>(&v_X, &v_Y, v_inv_n, v_inv_n_prime,
+                                  v_inv_n_w, v_inv_n_w_prime, v_neg_modulus,
+                                  v_twice_mod);
       if (output_mod_factor == 1) {
-        // Modulus reduction from [0, 2q), to [0, q)
         v_X = _mm512_hexl_small_mod_epu64(v_X, v_modulus);
         v_Y = _mm512_hexl_small_mod_epu64(v_Y, v_modulus);
       }
 
-      _mm512_storeu_si512(v_X_pt++, v_X);
-      _mm512_storeu_si512(v_Y_pt++, v_Y);
+      _mm512_mask_storeu_epi64(X_r + k, mask, v_X);
+      _mm512_mask_storeu_epi64(Y_r + k, mask, v_Y);
     }
+  }
+}
+
+/// @brief Computes the inverse transforms of the polynomials of degree N
+/// stored contiguously in \p operand, 8 at a time with one polynomial per
+/// lane. Polynomials are gathered from \p operand and scattered to \p
+/// result, which may be equal.
+/// @param[in] v_W_op Broadcast inverse roots of unity in bit-reversed order
+/// @param[in] v_W_precon Broadcast pre-conditioned inverse roots of unity
+template <int BitShift, size_t N>
+void InvBatchLanes(uint64_t* result, const uint64_t* operand,
+                   uint64_t batch_size, const __m512i* v_W_op,
+                   const __m512i* v_W_precon, __m512i v_inv_n,
+                   __m512i v_inv_n_prime, __m512i v_inv_n_w,
+                   __m512i v_inv_n_w_prime, __m512i v_modulus,
+                   __m512i v_neg_modulus, __m512i v_twice_mod,
+                   bool reduce_output) {
+  const int64_t n = static_cast<int64_t>(N);
+  const __m512i v_index =
+      _mm512_set_epi64(7 * n, 6 * n, 5 * n, 4 * n, 3 * n, 2 * n, n, 0);
+  const __mmask8 tail_mask =
+      static_cast<__mmask8>((1U << (batch_size % 8)) - 1);
+
+  for (size_t b = 0; b < batch_size; b += 8) {
+    __mmask8 mask = (b + 8 <= batch_size) ? 0xff : tail_mask;
+    const uint64_t* X_op = operand + b * N;
+    uint64_t* X_r = result + b * N;
+
+    // v[i] holds evaluation i of each polynomial
+    __m512i v[N];
+    for (size_t i = 0; i < N; ++i) {
+      v[i] = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask,
+                                         v_index, X_op + i, 8);
+    }
+
+    size_t t = 1;
+    size_t root_index = 1;
+    for (size_t m = (N >> 1); m > 1; m >>= 1, t <<= 1) {
+      for (size_t i = 0; i < m; i++, root_index++) {
+        for (size_t j = 2 * i * t; j < (2 * i + 1) * t; j++) {
+          InvButterfly<BitShift, false>(&v[j], &v[j + t], v_W_op[root_index],
+                                        v_W_precon[root_index], v_neg_modulus,
+                                        v_twice_mod);
+        }
+      }
+    }
+
+    // Final stage, merged with the multiplication by 1/n
+    for (size_t j = 0; j < (N >> 1); ++j) {
+      InvFinalButterfly<BitShift>(&v[j], &v[j + (N >> 1)], v_inv_n,
+                                  v_inv_n_prime, v_inv_n_w, v_inv_n_w_prime,
+                                  v_neg_modulus, v_twice_mod);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+      if (reduce_output) {
+        v[i] = _mm512_hexl_small_mod_epu64(v[i], v_modulus);
+      }
+      _mm512_mask_i64scatter_epi64(X_r + i, mask, v_index, v[i], 8);
+    }
+  }
+}
+
+template <int BitShift>
+void InverseTransformFromBitReverseBatchAVX512(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t modulus, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(n >= 2 && n <= 16, "n " << n << " not in [2, 16]");
+  HEXL_CHECK(modulus < MaximumValue(BitShift) / 2,
+             "modulus " << modulus << " too large for BitShift " << BitShift
+                        << " => maximum value " << MaximumValue(BitShift) / 2);
+  HEXL_CHECK_BOUNDS(operand, n * batch_size, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi64(static_cast<int64_t>(modulus));
+  __m512i v_neg_modulus = _mm512_set1_epi64(-static_cast<int64_t>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi64(static_cast<int64_t>(2 * modulus));
+  __m512i v_W_op[16];
+  __m512i v_W_precon[16];
+  for (size_t i = 1; i < n - 1; ++i) {
+    v_W_op[i] =
+        _mm512_set1_epi64(static_cast<int64_t>(inv_root_of_unity_powers[i]));
+    v_W_precon[i] = _mm512_set1_epi64(
+        static_cast<int64_t>(precon_inv_root_of_unity_powers[i]));
+  }
 
-    HEXL_VLOG(5, "AVX512 returning operand "
-                     << std::vector<uint64_t>(operand, operand + n));
+  const uint64_t W_op = inv_root_of_unity_powers[n - 1];
+  MultiplyFactor mf_inv_n(InverseMod(n, modulus), BitShift, modulus);
+  MultiplyFactor mf_inv_n_w(MultiplyMod(mf_inv_n.Operand(), W_op, modulus),
+                            BitShift, modulus);
+  __m512i v_inv_n = _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n.Operand()));
+  __m512i v_inv_n_prime =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n.BarrettFactor()));
+  __m512i v_inv_n_w =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n_w.Operand()));
+  __m512i v_inv_n_w_prime =
+      _mm512_set1_epi64(static_cast<int64_t>(mf_inv_n_w.BarrettFactor()));
+  bool reduce_output = (output_mod_factor == 1);
+
+  switch (n) {
+    case 2:
+      InvBatchLanes<BitShift, 2>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_inv_n, v_inv_n_prime, v_inv_n_w,
+                                 v_inv_n_w_prime, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    case 4:
+      InvBatchLanes<BitShift, 4>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_inv_n, v_inv_n_prime, v_inv_n_w,
+                                 v_inv_n_w_prime, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    case 8:
+      InvBatchLanes<BitShift, 8>(result, operand, batch_size, v_W_op,
+                                 v_W_precon, v_inv_n, v_inv_n_prime, v_inv_n_w,
+                                 v_inv_n_w_prime, v_modulus, v_neg_modulus,
+                                 v_twice_mod, reduce_output);
+      break;
+    default:
+      InvBatchLanes<BitShift, 16>(result, operand, batch_size, v_W_op,
+                                  v_W_precon, v_inv_n, v_inv_n_prime,
+                                  v_inv_n_w, v_inv_n_w_prime, v_modulus,
+                                  v_neg_modulus, v_twice_mod, reduce_output);
   }
 }
 
@@ -17,6 +17,24 @@ namespace hexl {
 
 #ifdef HEXL_HAS_AVX512DQ
 
+// Given input: v1 = 0, 1, 2, 3, 4, 5, 6, 7
+//              v2 = 8, 9, 10, 11, 12, 13, 14, 15
+// Returns
+// *out1 =  _mm512_set_epi64(14, 6, 12, 4, 10, 2, 8, 0);
+// *out2 =  _mm512_set_epi64(15, 7, 13, 5, 11, 3, 9, 1);
+inline void FwdInterleavedT1(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i perm_idx = _mm512_set_epi64(6, 7, 4, 5, 2, 3, 0, 1);
+
+  // 1, 0, 3, 2, 5, 4, 7, 6
+  __m512i v1_perm = _mm512_permutexvar_epi64(perm_idx, v1);
+  // 9, 8, 11, 10, 13, 12, 15, 14
+  __m512i v2_perm = _mm512_permutexvar_epi64(perm_idx, v2);
+
+  *out1 = _mm512_mask_blend_epi64(0xaa, v1, v2_perm);
+  *out2 = _mm512_mask_blend_epi64(0xaa, v1_perm, v2);
+}
+
 // Given input: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
 // Returns
 // *out1 =  _mm512_set_epi64(14, 6, 12, 4, 10, 2, 8, 0);
@@ -30,15 +48,28 @@ inline void LoadFwdInterleavedT1(const uint64_t* arg, __m512i* out1,
   // 8, 9, 10, 11, 12, 13, 14, 15
   __m512i v2 = _mm512_loadu_si512(arg_512);
 
-  const __m512i perm_idx = _mm512_set_epi64(6, 7, 4, 5, 2, 3, 0, 1);
+  FwdInterleavedT1(v1, v2, out1, out2);
+}
 
-  // 1, 0, 3, 2, 5, 4, 7, 6
-  __m512i v1_perm = _mm512_permutexvar_epi64(perm_idx, v1);
-  // 9, 8, 11, 10, 13, 12, 15, 14
-  __m512i v2_perm = _mm512_permutexvar_epi64(perm_idx, v2);
+// Given input: v1 = 0, 1, 2, 3, 4, 5, 6, 7
+//              v2 = 8, 9, 10, 11, 12, 13, 14, 15
+// Returns
+// *out1 =  _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0);
+// *out2 =  _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
+inline void InvInterleavedT1(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i vperm_hi_idx = _mm512_set_epi64(6, 4, 2, 0, 7, 5, 3, 1);
+  const __m512i vperm_lo_idx = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
+  const __m512i vperm2_idx = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
 
-  *out1 = _mm512_mask_blend_epi64(0xaa, v1, v2_perm);
-  *out2 = _mm512_mask_blend_epi64(0xaa, v1_perm, v2);
+  // 7, 5, 3, 1, 6, 4, 2, 0
+  __m512i perm_lo = _mm512_permutexvar_epi64(vperm_lo_idx, v1);
+  // 14, 12, 10, 8, 15, 13, 11, 9
+  __m512i perm_hi = _mm512_permutexvar_epi64(vperm_hi_idx, v2);
+
+  *out1 = _mm512_mask_blend_epi64(0x0f, perm_hi, perm_lo);
+  *out2 = _mm512_mask_blend_epi64(0xf0, perm_hi, perm_lo);
+  *out2 = _mm512_permutexvar_epi64(vperm2_idx, *out2);
 }
 
 // Given input: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
@@ -47,24 +78,30 @@ inline void LoadFwdInterleavedT1(const uint64_t* arg, __m512i* out1,
 // *out2 =  _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1);
 inline void LoadInvInterleavedT1(const uint64_t* arg, __m512i* out1,
                                  __m512i* out2) {
-  const __m512i vperm_hi_idx = _mm512_set_epi64(6, 4, 2, 0, 7, 5, 3, 1);
-  const __m512i vperm_lo_idx = _mm512_set_epi64(7, 5, 3, 1, 6, 4, 2, 0);
-  const __m512i vperm2_idx = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
-
   const __m512i* arg_512 = reinterpret_cast<const __m512i*>(arg);
 
   // 7, 6, 5, 4, 3, 2, 1, 0
   __m512i v_7to0 = _mm512_loadu_si512(arg_512++);
   // 15, 14, 13, 12, 11, 10, 9, 8
   __m512i v_15to8 = _mm512_loadu_si512(arg_512);
-  // 7, 5, 3, 1, 6, 4, 2, 0
-  __m512i perm_lo = _mm512_permutexvar_epi64(vperm_lo_idx, v_7to0);
-  // 14, 12, 10, 8, 15, 13, 11, 9
-  __m512i perm_hi = _mm512_permutexvar_epi64(vperm_hi_idx, v_15to8);
 
-  *out1 = _mm512_mask_blend_epi64(0x0f, perm_hi, perm_lo);
-  *out2 = _mm512_mask_blend_epi64(0xf0, perm_hi, perm_lo);
-  *out2 = _mm512_permutexvar_epi64(vperm2_idx, *out2);
+  InvInterleavedT1(v_7to0, v_15to8, out1, out2);
+}
+
+// Given input: v1 = 0, 1, 2, 3, 4, 5, 6, 7
+//              v2 = 8, 9, 10, 11, 12, 13, 14, 15
+// Returns
+// *out1 =  _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+// *out2 =  _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+inline void FwdInterleavedT2(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i v1_perm_idx = _mm512_set_epi64(5, 4, 7, 6, 1, 0, 3, 2);
+
+  __m512i v1_perm = _mm512_permutexvar_epi64(v1_perm_idx, v1);
+  __m512i v2_perm = _mm512_permutexvar_epi64(v1_perm_idx, v2);
+
+  *out1 = _mm512_mask_blend_epi64(0xcc, v1, v2_perm);
+  *out2 = _mm512_mask_blend_epi64(0xcc, v1_perm, v2);
 }
 
 // Given input: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
@@ -80,13 +117,23 @@ inline void LoadFwdInterleavedT2(const uint64_t* arg, __m512i* out1,
   // 15, 14, 13, 12, 7, 6, 5, 4
   __m512i v2 = _mm512_loadu_si512(arg_512);
 
-  const __m512i v1_perm_idx = _mm512_set_epi64(5, 4, 7, 6, 1, 0, 3, 2);
+  FwdInterleavedT2(v1, v2, out1, out2);
+}
+
+// Given input: v1 = 0, 1, 2, 3, 4, 5, 6, 7
+//              v2 = 8, 9, 10, 11, 12, 13, 14, 15
+// Returns
+// *out1 =  _mm512_set_epi64(14, 6, 12, 4, 10, 2, 8, 0);
+// *out2 =  _mm512_set_epi64(15, 7, 13, 5, 11, 3, 9, 1);
+inline void InvInterleavedT2(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i v1_perm_idx = _mm512_set_epi64(6, 7, 4, 5, 2, 3, 0, 1);
 
   __m512i v1_perm = _mm512_permutexvar_epi64(v1_perm_idx, v1);
   __m512i v2_perm = _mm512_permutexvar_epi64(v1_perm_idx, v2);
 
-  *out1 = _mm512_mask_blend_epi64(0xcc, v1, v2_perm);
-  *out2 = _mm512_mask_blend_epi64(0xcc, v1_perm, v2);
+  *out1 = _mm512_mask_blend_epi64(0xaa, v1, v2_perm);
+  *out2 = _mm512_mask_blend_epi64(0xaa, v1_perm, v2);
 }
 
 // Given input: 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
@@ -100,13 +147,21 @@ inline void LoadInvInterleavedT2(const uint64_t* arg, __m512i* out1,
   __m512i v1 = _mm512_loadu_si512(arg_512++);
   __m512i v2 = _mm512_loadu_si512(arg_512);
 
-  const __m512i v1_perm_idx = _mm512_set_epi64(6, 7, 4, 5, 2, 3, 0, 1);
-
-  __m512i v1_perm = _mm512_permutexvar_epi64(v1_perm_idx, v1);
-  __m512i v2_perm = _mm512_permutexvar_epi64(v1_perm_idx, v2);
+  InvInterleavedT2(v1, v2, out1, out2);
+}
 
-  *out1 = _mm512_mask_blend_epi64(0xaa, v1, v2_perm);
-  *out2 = _mm512_mask_blend_epi64(0xaa, v1_perm, v2);
+// Returns
+// *out1 =  _mm512_set_epi64(v2[3], v2[2], v2[1], v2[0],
+//                           v1[3], v1[2], v1[1], v1[0]);
+// *out2 =  _mm512_set_epi64(v2[7], v2[6], v2[5], v2[4],
+//                           v1[7], v1[6], v1[5], v1[4]);
+inline void FwdInterleavedT4(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i vperm2_idx = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
+  __m512i perm_hi = _mm512_permutexvar_epi64(vperm2_idx, v2);
+  *out1 = _mm512_mask_blend_epi64(0x0f, perm_hi, v1);
+  *out2 = _mm512_mask_blend_epi64(0xf0, perm_hi, v1);
+  *out2 = _mm512_permutexvar_epi64(vperm2_idx, *out2);
 }
 
 // Returns
@@ -118,13 +173,25 @@ inline void LoadFwdInterleavedT4(const uint64_t* arg, __m512i* out1,
                                  __m512i* out2) {
   const __m512i* arg_512 = reinterpret_cast<const __m512i*>(arg);
 
-  const __m512i vperm2_idx = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
   __m512i v_7to0 = _mm512_loadu_si512(arg_512++);
   __m512i v_15to8 = _mm512_loadu_si512(arg_512);
-  __m512i perm_hi = _mm512_permutexvar_epi64(vperm2_idx, v_15to8);
-  *out1 = _mm512_mask_blend_epi64(0x0f, perm_hi, v_7to0);
-  *out2 = _mm512_mask_blend_epi64(0xf0, perm_hi, v_7to0);
-  *out2 = _mm512_permutexvar_epi64(vperm2_idx, *out2);
+  FwdInterleavedT4(v_7to0, v_15to8, out1, out2);
+}
+
+// Given input: v1 = 0, 1, 2, 3, 4, 5, 6, 7
+//              v2 = 8, 9, 10, 11, 12, 13, 14, 15
+// Returns
+// *out1 =  _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+// *out2 =  _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+inline void InvInterleavedT4(__m512i v1, __m512i v2, __m512i* out1,
+                             __m512i* out2) {
+  const __m512i perm_idx = _mm512_set_epi64(5, 4, 7, 6, 1, 0, 3, 2);
+
+  __m512i v1_perm = _mm512_permutexvar_epi64(perm_idx, v1);
+  __m512i v2_perm = _mm512_permutexvar_epi64(perm_idx, v2);
+
+  *out1 = _mm512_mask_blend_epi64(0xcc, v1, v2_perm);
+  *out2 = _mm512_mask_blend_epi64(0xcc, v1_perm, v2);
 }
 
 inline void LoadInvInterleavedT4(const uint64_t* arg, __m512i* out1,
@@ -135,23 +202,17 @@ inline void LoadInvInterleavedT4(const uint64_t* arg, __m512i* out1,
   __m512i v1 = _mm512_loadu_si512(arg_512++);
   // 8, 9, 10, 11, 12, 13, 14, 15
   __m512i v2 = _mm512_loadu_si512(arg_512);
-  const __m512i perm_idx = _mm512_set_epi64(5, 4, 7, 6, 1, 0, 3, 2);
-
-  // 1, 0, 3, 2, 5, 4, 7, 6
-  __m512i v1_perm = _mm512_permutexvar_epi64(perm_idx, v1);
-  // 9, 8, 11, 10, 13, 12, 15, 14
-  __m512i v2_perm = _mm512_permutexvar_epi64(perm_idx, v2);
 
-  *out1 = _mm512_mask_blend_epi64(0xcc, v1, v2_perm);
-  *out2 = _mm512_mask_blend_epi64(0xcc, v1_perm, v2);
+  InvInterleavedT4(v1, v2, out1, out2);
 }
 
 // Given inputs
 // @param arg1 = _mm512_set_epi64(15, 14, 13, 12, 11, 10, 9, 8);
 // @param arg2 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
-// Writes out = {8,  0, 9,  1, 10, 2, 11, 3,
-//               12, 4, 13, 5, 14, 6, 15, 7}
-inline void WriteFwdInterleavedT1(__m512i arg1, __m512i arg2, __m512i* out) {
+// Returns *out1 = {8,  0, 9,  1, 10, 2, 11, 3} and
+// *out2 = {12, 4, 13, 5, 14, 6, 15, 7}
+inline void FwdDeinterleavedT1(__m512i arg1, __m512i arg2, __m512i* out1,
+                               __m512i* out2) {
   const __m512i vperm2_idx = _mm512_set_epi64(3, 2, 1, 0, 7, 6, 5, 4);
   const __m512i v_X_out_idx = _mm512_set_epi64(7, 3, 6, 2, 5, 1, 4, 0);
   const __m512i v_Y_out_idx = _mm512_set_epi64(3, 7, 2, 6, 1, 5, 0, 4);
@@ -164,8 +225,17 @@ inline void WriteFwdInterleavedT1(__m512i arg1, __m512i arg2, __m512i* out) {
   // 8, 9, 10, 11, 0, 1, 2, 3
   __m512i perm_hi = _mm512_mask_blend_epi64(0xf0, arg1, arg2);
 
-  arg1 = _mm512_permutexvar_epi64(v_X_out_idx, perm_hi);
-  arg2 = _mm512_permutexvar_epi64(v_Y_out_idx, perm_lo);
+  *out1 = _mm512_permutexvar_epi64(v_X_out_idx, perm_hi);
+  *out2 = _mm512_permutexvar_epi64(v_Y_out_idx, perm_lo);
+}
+
+// Given inputs
+// @param arg1 = _mm512_set_epi64(15, 14, 13, 12, 11, 10, 9, 8);
+// @param arg2 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+// Writes out = {8,  0, 9,  1, 10, 2, 11, 3,
+//               12, 4, 13, 5, 14, 6, 15, 7}
+inline void WriteFwdInterleavedT1(__m512i arg1, __m512i arg2, __m512i* out) {
+  FwdDeinterleavedT1(arg1, arg2, &arg1, &arg2);
 
   _mm512_storeu_si512(out++, arg1);
   _mm512_storeu_si512(out, arg2);
@@ -188,6 +258,18 @@ inline void WriteInvInterleavedT4(__m512i arg1, __m512i arg2, __m512i* out) {
   _mm256_storeu_si256(out_256++, y1);
 }
 
+// Given inputs
+// @param arg1 = _mm512_set_epi64(15, 14, 13, 12, 11, 10, 9, 8);
+// @param arg2 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+// Returns *out1 = {8,  9,  10, 11, 0, 1, 2, 3} and
+// *out2 = {12, 13, 14, 15, 4, 5, 6, 7}, i.e. the layout written by
+// WriteInvInterleavedT4
+inline void InvDeinterleavedT4(__m512i arg1, __m512i arg2, __m512i* out1,
+                               __m512i* out2) {
+  *out1 = _mm512_shuffle_i64x2(arg1, arg2, 0x44);
+  *out2 = _mm512_shuffle_i64x2(arg1, arg2, 0xee);
+}
+
 // Returns _mm512_set_epi64(arg[3], arg[3], arg[2], arg[2],
 //                          arg[1], arg[1], arg[0], arg[0]);
 inline __m512i LoadWOpT2(const void* arg) {
@@ -213,6 +295,91 @@ inline __m512i LoadWOpT4(const void* arg) {
   return v_W_op;
 }
 
+// Permutes the 16 coefficients in v1, v2 such that the butterflies with
+// distance T pair lane k of *X with lane k of *Y, for T = 1, 2 or 4
+template <int T>
+inline void SplitButterflyOperands(__m512i v1, __m512i v2, __m512i* X,
+                                   __m512i* Y);
+
+// Inverse of SplitButterflyOperands<T>
+template <int T>
+inline void MergeButterflyOperands(__m512i X, __m512i Y, __m512i* v1,
+                                   __m512i* v2);
+
+template <>
+inline void SplitButterflyOperands<4>(__m512i v1, __m512i v2, __m512i* X,
+                                      __m512i* Y) {
+  *X = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0), v2);
+  *Y = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4), v2);
+}
+
+template <>
+inline void MergeButterflyOperands<4>(__m512i X, __m512i Y, __m512i* v1,
+                                      __m512i* v2) {
+  SplitButterflyOperands<4>(X, Y, v1, v2);
+}
+
+template <>
+inline void SplitButterflyOperands<2>(__m512i v1, __m512i v2, __m512i* X,
+                                      __m512i* Y) {
+  *X = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(13, 12, 9, 8, 5, 4, 1, 0), v2);
+  *Y = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(15, 14, 11, 10, 7, 6, 3, 2), v2);
+}
+
+template <>
+inline void MergeButterflyOperands<2>(__m512i X, __m512i Y, __m512i* v1,
+                                      __m512i* v2) {
+  *v1 = _mm512_permutex2var_epi64(
+      X, _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0), Y);
+  *v2 = _mm512_permutex2var_epi64(
+      X, _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4), Y);
+}
+
+template <>
+inline void SplitButterflyOperands<1>(__m512i v1, __m512i v2, __m512i* X,
+                                      __m512i* Y) {
+  *X = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), v2);
+  *Y = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), v2);
+}
+
+template <>
+inline void MergeButterflyOperands<1>(__m512i X, __m512i Y, __m512i* v1,
+                                      __m512i* v2) {
+  *v1 = _mm512_permutex2var_epi64(
+      X, _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0), Y);
+  *v2 = _mm512_permutex2var_epi64(
+      X, _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4), Y);
+}
+
+// Returns the twiddle factors of the butterflies split by
+// SplitButterflyOperands<T>, given the 8 / (2 * T) twiddle factors of
+// consecutive groups in W
+template <int T>
+inline __m512i LoadButterflyTwiddles(const uint64_t* W);
+
+template <>
+inline __m512i LoadButterflyTwiddles<4>(const uint64_t* W) {
+  return _mm512_permutexvar_epi64(_mm512_set_epi64(1, 1, 1, 1, 0, 0, 0, 0),
+                                  _mm512_maskz_loadu_epi64(0x03, W));
+}
+
+template <>
+inline __m512i LoadButterflyTwiddles<2>(const uint64_t* W) {
+  return _mm512_permutexvar_epi64(_mm512_set_epi64(3, 3, 2, 2, 1, 1, 0, 0),
+                                  _mm512_maskz_loadu_epi64(0x0F, W));
+}
+
+template <>
+inline __m512i LoadButterflyTwiddles<1>(const uint64_t* W) {
+  return _mm512_loadu_si512(W);
+}
+
 #endif  // HEXL_HAS_AVX512DQ
 
 }  // namespace hexl
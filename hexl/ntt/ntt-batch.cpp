@@ -0,0 +1,139 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx512.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Largest degree transformed with one polynomial per AVX512 lane. Larger
+// transforms vectorize within each polynomial instead.
+const uint64_t s_max_batch_lanes_degree = 16;
+
+}  // namespace
+
+void NTT::ComputeForwardBatch(uint64_t* result, const uint64_t* operand,
+                              uint64_t batch_size, uint64_t input_mod_factor,
+                              uint64_t output_mod_factor,
+                              Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2 or 4; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+  HEXL_CHECK_BOUNDS(
+      operand, m_degree * batch_size, m_q * input_mod_factor,
+      "value in operand exceeds bound " << m_q * input_mod_factor);
+
+  ForwardToBitReverseBatch(result, operand, batch_size, input_mod_factor,
+                           output_mod_factor);
+  if (output_order == Ordering::kNatural) {
+    for (size_t b = 0; b < batch_size; ++b) {
+      BitReversePermuteInPlace(result + b * m_degree, m_degree);
+    }
+  }
+}
+
+void NTT::ForwardToBitReverseBatch(uint64_t* result, const uint64_t* operand,
+                                   uint64_t batch_size,
+                                   uint64_t input_mod_factor,
+                                   uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && m_degree >= 2 && m_degree <= s_max_batch_lanes_degree) {
+    const uint64_t* root_of_unity_powers =
+        m_tables->Data(NTTTables::kRootOfUnityPowers);
+    if (m_q < s_max_fwd_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX512-DQ batched FwdNTT");
+      ForwardTransformToBitReverseBatchAVX512<32>(
+          result, operand, m_degree, batch_size, m_q, root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX512-DQ batched FwdNTT");
+      ForwardTransformToBitReverseBatchAVX512<s_default_shift_bits>(
+          result, operand, m_degree, batch_size, m_q, root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  for (size_t b = 0; b < batch_size; ++b) {
+    ForwardToBitReverse(result + b * m_degree, operand + b * m_degree,
+                        input_mod_factor, output_mod_factor);
+  }
+}
+
+void NTT::ComputeInverseBatch(uint64_t* result, const uint64_t* operand,
+                              uint64_t batch_size, uint64_t input_mod_factor,
+                              uint64_t output_mod_factor,
+                              Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+  HEXL_CHECK_BOUNDS(operand, m_degree * batch_size, m_q * input_mod_factor,
+                    "operand exceeds bound " << m_q * input_mod_factor);
+
+  // Natural-order inputs are permuted into result, and transformed in-place
+  if (input_order == Ordering::kNatural) {
+    for (size_t b = 0; b < batch_size; ++b) {
+      BitReversePermute(result + b * m_degree, operand + b * m_degree,
+                        m_degree);
+    }
+    operand = result;
+  }
+
+  InverseFromBitReverseBatch(result, operand, batch_size, input_mod_factor,
+                             output_mod_factor);
+}
+
+void NTT::InverseFromBitReverseBatch(uint64_t* result, const uint64_t* operand,
+                                     uint64_t batch_size,
+                                     uint64_t input_mod_factor,
+                                     uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && m_degree >= 2 && m_degree <= s_max_batch_lanes_degree) {
+    const uint64_t* inv_root_of_unity_powers =
+        m_tables->Data(NTTTables::kInvRootOfUnityPowers);
+    if (m_q < s_max_inv_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX512-DQ batched InvNTT");
+      InverseTransformFromBitReverseBatchAVX512<32>(
+          result, operand, m_degree, batch_size, m_q, inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX512-DQ batched InvNTT");
+      InverseTransformFromBitReverseBatchAVX512<s_default_shift_bits>(
+          result, operand, m_degree, batch_size, m_q, inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  for (size_t b = 0; b < batch_size; ++b) {
+    InverseFromBitReverse(result + b * m_degree, operand + b * m_degree,
+                          input_mod_factor, output_mod_factor);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,135 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/ntt-cache.hpp"
+
+#include <algorithm>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+
+namespace intel {
+namespace hexl {
+
+constexpr size_t NTTTableCache::s_min_prune_size;
+
+NTTTableCache& NTTTableCache::GetInstance() {
+  // Intentionally leaked, so NTT objects with static storage duration may
+  // safely release their tables during program exit
+  static NTTTableCache* instance = new NTTTableCache;
+  return *instance;
+}
+
+std::shared_ptr<const NTTTables> NTTTableCache::GetOrCreate(
+    uint64_t degree, uint64_t q, uint64_t root_of_unity, uint64_t twist,
+    const std::function<std::shared_ptr<const NTTTables>()>& create) {
+  Key key{degree, q, root_of_unity, twist};
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_tables.find(key);
+    if (it != m_tables.end()) {
+      std::shared_ptr<const NTTTables> tables = it->second.lock();
+      if (tables) {
+        ++m_hits;
+        return tables;
+      }
+    }
+    ++m_misses;
+  }
+
+  // Build the tables without holding the lock, so misses on different keys
+  // don't serialize
+  HEXL_VLOG(3, "Computing NTT tables for degree " << degree << ", modulus "
+                                                  << q);
+  std::shared_ptr<const NTTTables> tables = create();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::weak_ptr<const NTTTables>& entry = m_tables[key];
+  // Another thread may have inserted the same tables in the meantime
+  std::shared_ptr<const NTTTables> resident = entry.lock();
+  if (resident) {
+    return resident;
+  }
+  entry = tables;
+  MaybePruneLocked();
+  return tables;
+}
+
+uint64_t NTTTableCache::MinimalPrimitiveRoot(uint64_t degree, uint64_t q) {
+  RootKey key{degree, q};
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_roots.find(key);
+    if (it != m_roots.end()) {
+      return it->second;
+    }
+  }
+
+  // Search for the root without holding the lock
+  uint64_t root = intel::hexl::MinimalPrimitiveRoot(degree, q);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_roots.emplace(key, root);
+  MaybePruneLocked();
+  return root;
+}
+
+bool NTTTableCache::HasTablesLocked(uint64_t degree, uint64_t q) const {
+  auto it = m_tables.lower_bound(Key{degree, q, 0, 0});
+  return it != m_tables.end() && std::get<0>(it->first) == degree &&
+         std::get<1>(it->first) == q;
+}
+
+void NTTTableCache::PruneLocked() {
+  for (auto it = m_tables.begin(); it != m_tables.end();) {
+    if (it->second.expired()) {
+      it = m_tables.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // Roots of order 2N are used by negacyclic NTTs of degree N, roots of order
+  // N by cyclic and twisted NTTs of degree N
+  for (auto it = m_roots.begin(); it != m_roots.end();) {
+    uint64_t degree = it->first.first;
+    uint64_t q = it->first.second;
+    if (HasTablesLocked(degree, q) || HasTablesLocked(degree / 2, q)) {
+      ++it;
+    } else {
+      it = m_roots.erase(it);
+    }
+  }
+  m_prune_size =
+      std::max(s_min_prune_size, 2 * (m_tables.size() + m_roots.size()));
+}
+
+void NTTTableCache::MaybePruneLocked() {
+  if (m_tables.size() + m_roots.size() >= m_prune_size) {
+    PruneLocked();
+  }
+}
+
+NTT::CacheStats NTTTableCache::GetStats() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  PruneLocked();
+  NTT::CacheStats stats;
+  stats.hits = m_hits;
+  stats.misses = m_misses;
+  for (const auto& entry : m_tables) {
+    std::shared_ptr<const NTTTables> tables = entry.second.lock();
+    if (tables) {
+      ++stats.num_entries;
+      stats.resident_bytes += tables->MemoryBytes();
+    }
+  }
+  return stats;
+}
+
+void NTTTableCache::ResetStats() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_hits = 0;
+  m_misses = 0;
+}
+
+}  // namespace hexl
+}  // namespace intel
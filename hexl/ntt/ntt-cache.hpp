@@ -0,0 +1,80 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include "hexl/ntt/ntt.hpp"
+#include "ntt/ntt-tables.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Thread-safe process-wide registry of NTTTables, keyed by (degree,
+/// modulus, root of unity, twist)
+/// @details The registry holds weak references, so tables are freed once the
+/// last NTT object using them is destroyed. Expired entries are pruned
+/// whenever the registry has doubled in size since the last pruning. The
+/// registry also memoizes the minimal primitive roots of unity of resident
+/// (degree, modulus) pairs, so constructing an NTT without an explicit root
+/// of unity doesn't repeat the root search on a hit.
+class NTTTableCache {
+ public:
+  /// @brief Returns the process-wide registry
+  static NTTTableCache& GetInstance();
+
+  /// @brief Returns the tables for (degree, q, root_of_unity, twist), calling
+  /// \p create to build them if they are not resident
+  std::shared_ptr<const NTTTables> GetOrCreate(
+      uint64_t degree, uint64_t q, uint64_t root_of_unity, uint64_t twist,
+      const std::function<std::shared_ptr<const NTTTables>()>& create);
+
+  /// @brief Returns MinimalPrimitiveRoot(degree, q), computing it only if it
+  /// is not resident
+  uint64_t MinimalPrimitiveRoot(uint64_t degree, uint64_t q);
+
+  /// @brief Returns the cache statistics
+  NTT::CacheStats GetStats();
+
+  /// @brief Resets the hit and miss counters to zero
+  void ResetStats();
+
+ private:
+  NTTTableCache() = default;
+
+  using Key = std::tuple<uint64_t, uint64_t, uint64_t, uint64_t>;
+  using RootKey = std::pair<uint64_t, uint64_t>;
+
+  // Minimum number of entries before expired entries are pruned
+  static constexpr size_t s_min_prune_size = 64;
+
+  // Erases expired tables, and the roots of (degree, modulus) pairs without
+  // resident tables. Requires m_mutex to be held.
+  void PruneLocked();
+
+  // Prunes if the registry has doubled in size since the last pruning.
+  // Requires m_mutex to be held.
+  void MaybePruneLocked();
+
+  // Returns true if any resident tables have the given degree and modulus.
+  // Requires m_mutex to be held.
+  bool HasTablesLocked(uint64_t degree, uint64_t q) const;
+
+  std::mutex m_mutex;  // Guards the state below
+  std::map<Key, std::weak_ptr<const NTTTables>> m_tables;
+  std::map<RootKey, uint64_t> m_roots;  // (degree, q) -> minimal root
+  size_t m_prune_size{s_min_prune_size};
+  uint64_t m_hits{0};
+  uint64_t m_misses{0};
+};
+
+}  // namespace hexl
+}  // namespace intel
@@ -3,177 +3,202 @@
 
 #include "ntt/ntt-internal.hpp"
 
-#include <cstring>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <utility>
 
 #include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
 #include "hexl/ntt/ntt.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "hexl/util/aligned-allocator.hpp"
 #include "hexl/util/check.hpp"
+#include "ntt/fwd-ntt-avx2.hpp"
 #include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx2.hpp"
 #include "ntt/inv-ntt-avx512.hpp"
+#include "ntt/ntt-cache.hpp"
+#include "ntt/ntt-radix.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "ntt/ntt32-avx512.hpp"
 #include "util/cpu-features.hpp"
+#include "util/thread-pool.hpp"
 
 namespace intel {
 namespace hexl {
 
 AllocatorStrategyPtr mallocStrategy = AllocatorStrategyPtr(new MallocStrategy);
 
+NTT::NTT() = default;
+
 NTT::NTT(uint64_t degree, uint64_t q, uint64_t root_of_unity,
          std::shared_ptr<AllocatorBase> alloc_ptr)
-    : m_degree(degree),
+    : NTT(Mode::kNegacyclic, degree, q, root_of_unity, root_of_unity,
+          alloc_ptr) {}
+
+NTT::NTT(uint64_t degree, uint64_t q, std::shared_ptr<AllocatorBase> alloc_ptr)
+    : NTT(degree, q,
+          NTTTableCache::GetInstance().MinimalPrimitiveRoot(2 * degree, q),
+          alloc_ptr) {}
+
+NTT::NTT(Mode mode, uint64_t degree, uint64_t q, uint64_t root_of_unity,
+         uint64_t twist, std::shared_ptr<AllocatorBase> alloc_ptr)
+    : m_mode(mode),
+      m_degree(degree),
       m_q(q),
       m_w(root_of_unity),
+      m_twist(twist),
       m_alloc(alloc_ptr),
-      m_aligned_alloc(AlignedAllocator<uint64_t, 64>(m_alloc)),
-      m_root_of_unity_powers(m_aligned_alloc),
-      m_precon32_root_of_unity_powers(m_aligned_alloc),
-      m_precon64_root_of_unity_powers(m_aligned_alloc),
-      m_avx512_root_of_unity_powers(m_aligned_alloc),
-      m_avx512_precon32_root_of_unity_powers(m_aligned_alloc),
-      m_avx512_precon52_root_of_unity_powers(m_aligned_alloc),
-      m_avx512_precon64_root_of_unity_powers(m_aligned_alloc),
-      m_precon32_inv_root_of_unity_powers(m_aligned_alloc),
-      m_precon52_inv_root_of_unity_powers(m_aligned_alloc),
-      m_precon64_inv_root_of_unity_powers(m_aligned_alloc),
-      m_inv_root_of_unity_powers(m_aligned_alloc) {
+      m_aligned_alloc(AlignedAllocator<uint64_t, 64>(m_alloc)) {
   HEXL_CHECK(CheckNTTArguments(degree, q), "");
-  HEXL_CHECK(IsPrimitiveRoot(m_w, 2 * degree, q),
-             m_w << " is not a primitive 2*" << degree << "'th root of unity");
+  if (m_mode == Mode::kNegacyclic) {
+    HEXL_CHECK(IsPrimitiveRoot(m_w, 2 * degree, q),
+               m_w << " is not a primitive 2*" << degree
+                   << "'th root of unity");
+  } else {
+    HEXL_CHECK(degree == 1 || IsPrimitiveRoot(m_w, degree, q),
+               m_w << " is not a primitive " << degree << "'th root of unity");
+  }
+  HEXL_CHECK(m_twist % q != 0, "twist " << m_twist << " is 0 mod " << q);
 
   m_degree_bits = Log2(m_degree);
   m_winv = InverseMod(m_w, m_q);
-  ComputeRootOfUnityPowers();
+
+  uint64_t table_root = TablesRootOfUnity(m_mode, m_w, m_q);
+
+  // Tables allocated with a custom allocator are not shared
+  auto create_tables = [this, table_root] {
+    return std::make_shared<const NTTTables>(m_degree, m_q, table_root,
+                                             m_twist, m_aligned_alloc);
+  };
+  if (m_alloc) {
+    m_tables = create_tables();
+  } else {
+    m_tables = NTTTableCache::GetInstance().GetOrCreate(
+        m_degree, m_q, table_root, m_twist, create_tables);
+  }
 }
 
-NTT::NTT(uint64_t degree, uint64_t q, std::shared_ptr<AllocatorBase> alloc_ptr)
-    : NTT(degree, q, MinimalPrimitiveRoot(2 * degree, q), alloc_ptr) {}
+NTT NTT::CreateCyclic(uint64_t degree, uint64_t q,
+                      std::shared_ptr<AllocatorBase> alloc_ptr) {
+  return CreateTwisted(degree, q, 1, alloc_ptr);
+}
 
-NTT::~NTT() = default;
+NTT NTT::CreateCyclic(uint64_t degree, uint64_t q, uint64_t root_of_unity,
+                      std::shared_ptr<AllocatorBase> alloc_ptr) {
+  return NTT(Mode::kCyclic, degree, q, root_of_unity, 1, alloc_ptr);
+}
 
-void NTT::ComputeRootOfUnityPowers() {
-  AlignedVector64<uint64_t> root_of_unity_powers(m_degree, 0, m_aligned_alloc);
-  AlignedVector64<uint64_t> inv_root_of_unity_powers(m_degree, 0,
-                                                     m_aligned_alloc);
-
-  // 64-bit preconditioned inverse and root of unity powers
-  root_of_unity_powers[0] = 1;
-  inv_root_of_unity_powers[0] = InverseMod(1, m_q);
-  uint64_t idx = 0;
-  uint64_t prev_idx = idx;
-
-  for (size_t i = 1; i < m_degree; i++) {
-    idx = ReverseBits(i, m_degree_bits);
-    root_of_unity_powers[idx] =
-        MultiplyMod(root_of_unity_powers[prev_idx], m_w, m_q);
-    inv_root_of_unity_powers[idx] = InverseMod(root_of_unity_powers[idx], m_q);
-
-    prev_idx = idx;
-  }
-
-  m_root_of_unity_powers = root_of_unity_powers;
-  m_avx512_root_of_unity_powers = m_root_of_unity_powers;
-
-  // Duplicate each root of unity at indices [N/4, N/2].
-  // These are the roots of unity used in the FwdNTT FwdT2 function
-  // By creating these duplicates, we avoid extra permutations while loading the
-  // roots of unity
-  AlignedVector64<uint64_t> W2_roots;
-  W2_roots.reserve(m_degree / 2);
-  for (size_t i = m_degree / 4; i < m_degree / 2; ++i) {
-    W2_roots.push_back(m_root_of_unity_powers[i]);
-    W2_roots.push_back(m_root_of_unity_powers[i]);
-  }
-  m_avx512_root_of_unity_powers.erase(
-      m_avx512_root_of_unity_powers.begin() + m_degree / 4,
-      m_avx512_root_of_unity_powers.begin() + m_degree / 2);
-  m_avx512_root_of_unity_powers.insert(
-      m_avx512_root_of_unity_powers.begin() + m_degree / 4, W2_roots.begin(),
-      W2_roots.end());
-
-  // Duplicate each root of unity at indices [N/8, N/4].
-  // These are the roots of unity used in the FwdNTT FwdT4 function
-  // By creating these duplicates, we avoid extra permutations while loading the
-  // roots of unity
-  AlignedVector64<uint64_t> W4_roots;
-  W4_roots.reserve(m_degree / 2);
-  for (size_t i = m_degree / 8; i < m_degree / 4; ++i) {
-    W4_roots.push_back(m_root_of_unity_powers[i]);
-    W4_roots.push_back(m_root_of_unity_powers[i]);
-    W4_roots.push_back(m_root_of_unity_powers[i]);
-    W4_roots.push_back(m_root_of_unity_powers[i]);
-  }
-  m_avx512_root_of_unity_powers.erase(
-      m_avx512_root_of_unity_powers.begin() + m_degree / 8,
-      m_avx512_root_of_unity_powers.begin() + m_degree / 4);
-  m_avx512_root_of_unity_powers.insert(
-      m_avx512_root_of_unity_powers.begin() + m_degree / 8, W4_roots.begin(),
-      W4_roots.end());
-
-  auto compute_barrett_vector = [&](const AlignedVector64<uint64_t>& values,
-                                    uint64_t bit_shift) {
-    AlignedVector64<uint64_t> barrett_vector(m_aligned_alloc);
-    for (uint64_t value : values) {
-      MultiplyFactor mf(value, bit_shift, m_q);
-      barrett_vector.push_back(mf.BarrettFactor());
-    }
-    return barrett_vector;
-  };
+NTT NTT::CreateTwisted(uint64_t degree, uint64_t q, uint64_t twist,
+                       std::shared_ptr<AllocatorBase> alloc_ptr) {
+  uint64_t root_of_unity =
+      (degree == 1)
+          ? 1
+          : NTTTableCache::GetInstance().MinimalPrimitiveRoot(degree, q);
+  return CreateTwisted(degree, q, twist, root_of_unity, alloc_ptr);
+}
 
-  m_precon32_root_of_unity_powers =
-      compute_barrett_vector(root_of_unity_powers, 32);
-  m_precon64_root_of_unity_powers =
-      compute_barrett_vector(root_of_unity_powers, 64);
+NTT NTT::CreateTwisted(uint64_t degree, uint64_t q, uint64_t twist,
+                       uint64_t root_of_unity,
+                       std::shared_ptr<AllocatorBase> alloc_ptr) {
+  Mode mode = (twist == 1) ? Mode::kCyclic : Mode::kTwisted;
+  return NTT(mode, degree, q, root_of_unity, twist, alloc_ptr);
+}
 
-  // 52-bit preconditioned root of unity powers
-  if (has_avx512ifma) {
-    m_avx512_precon52_root_of_unity_powers =
-        compute_barrett_vector(m_avx512_root_of_unity_powers, 52);
-  }
+NTT::~NTT() = default;
 
-  if (has_avx512dq) {
-    m_avx512_precon32_root_of_unity_powers =
-        compute_barrett_vector(m_avx512_root_of_unity_powers, 32);
-    m_avx512_precon64_root_of_unity_powers =
-        compute_barrett_vector(m_avx512_root_of_unity_powers, 64);
+void NTT::SetNumThreads(size_t num_threads) {
+  HEXL_CHECK(num_threads > 0, "num_threads == 0");
+  if (num_threads == 1) {
+    m_thread_pool.reset();
+  } else if (num_threads != GetNumThreads()) {
+    m_thread_pool = std::make_shared<ThreadPool>(num_threads);
   }
+}
 
-  // Inverse root of unity powers
+void NTT::SetNativeRadix(size_t radix) {
+  HEXL_CHECK(radix == 2 || radix == 4 || radix == 8,
+             "radix must be 2, 4 or 8; got " << radix);
+  m_native_radix = radix;
+}
 
-  // Reordering inv_root_of_powers
-  AlignedVector64<uint64_t> temp(m_degree, 0, m_aligned_alloc);
-  temp[0] = inv_root_of_unity_powers[0];
-  idx = 1;
+void NTT::SetBaseNTTSize(size_t base_ntt_size) {
+  HEXL_CHECK(IsPowerOfTwo(base_ntt_size) && base_ntt_size >= 16,
+             "base_ntt_size must be a power of two at least 16; got "
+                 << base_ntt_size);
+  m_base_ntt_size = base_ntt_size;
+}
 
-  for (size_t m = (m_degree >> 1); m > 0; m >>= 1) {
-    for (size_t i = 0; i < m; i++) {
-      temp[idx] = inv_root_of_unity_powers[m + i];
-      idx++;
-    }
-  }
-  m_inv_root_of_unity_powers = std::move(temp);
+size_t NTT::GetNumThreads() const {
+  return m_thread_pool ? m_thread_pool->NumThreads() : 1;
+}
 
-  // 32-bit preconditioned inverse root of unity powers
-  m_precon32_inv_root_of_unity_powers =
-      compute_barrett_vector(m_inv_root_of_unity_powers, 32);
+NTT::CacheStats NTT::GetCacheStats() {
+  return NTTTableCache::GetInstance().GetStats();
+}
 
-  // 52-bit preconditioned inverse root of unity powers
-  if (has_avx512ifma) {
-    m_precon52_inv_root_of_unity_powers =
-        compute_barrett_vector(m_inv_root_of_unity_powers, 52);
+void NTT::ResetCacheStats() { NTTTableCache::GetInstance().ResetStats(); }
+
+std::map<std::string, size_t> NTT::GetMemoryFootprint() const {
+  std::map<std::string, size_t> footprint;
+  for (size_t i = 0; i < NTTTables::kNumTables; ++i) {
+    NTTTables::Table table = static_cast<NTTTables::Table>(i);
+    footprint[NTTTables::Name(table)] = m_tables->MemoryBytes(table);
   }
+  return footprint;
+}
+
+const AlignedVector64<uint64_t>& NTT::GetRootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kRootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetPrecon32RootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kPrecon32RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetPrecon64RootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kPrecon64RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetAVX512RootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kAVX512RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetAVX512Precon32RootOfUnityPowers()
+    const {
+  return m_tables->Get(NTTTables::kAVX512Precon32RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetAVX512Precon52RootOfUnityPowers()
+    const {
+  return m_tables->Get(NTTTables::kAVX512Precon52RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetAVX512Precon64RootOfUnityPowers()
+    const {
+  return m_tables->Get(NTTTables::kAVX512Precon64RootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetInvRootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kInvRootOfUnityPowers);
+}
 
-  // 64-bit preconditioned inverse root of unity powers
-  m_precon64_inv_root_of_unity_powers =
-      compute_barrett_vector(m_inv_root_of_unity_powers, 64);
+const AlignedVector64<uint64_t>& NTT::GetPrecon32InvRootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kPrecon32InvRootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetPrecon52InvRootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kPrecon52InvRootOfUnityPowers);
+}
+
+const AlignedVector64<uint64_t>& NTT::GetPrecon64InvRootOfUnityPowers() const {
+  return m_tables->Get(NTTTables::kPrecon64InvRootOfUnityPowers);
 }
 
 void NTT::ComputeForward(uint64_t* result, const uint64_t* operand,
-                         uint64_t input_mod_factor,
-                         uint64_t output_mod_factor) {
+                         uint64_t input_mod_factor, uint64_t output_mod_factor,
+                         Ordering output_order) {
   HEXL_CHECK(result != nullptr, "result == nullptr");
   HEXL_CHECK(operand != nullptr, "operand == nullptr");
   HEXL_CHECK(
@@ -185,20 +210,32 @@ void NTT::ComputeForward(uint64_t* result, const uint64_t* operand,
       operand, m_degree, m_q * input_mod_factor,
       "value in operand exceeds bound " << m_q * input_mod_factor);
 
-  if (result != operand) {
-    std::memcpy(result, operand, m_degree * sizeof(uint64_t));
+  ForwardToBitReverse(result, operand, input_mod_factor, output_mod_factor);
+  if (output_order == Ordering::kNatural) {
+    BitReversePermuteInPlace(result, m_degree);
   }
+}
+
+void NTT::ForwardToBitReverse(uint64_t* result, const uint64_t* operand,
+                              uint64_t input_mod_factor,
+                              uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  ThreadPool* thread_pool =
+      (m_degree >= s_min_parallel_degree) ? m_thread_pool.get() : nullptr;
+#endif
 
 #ifdef HEXL_HAS_AVX512IFMA
   if (has_avx512ifma && (m_q < s_max_fwd_ifma_modulus && (m_degree >= 16))) {
-    const uint64_t* root_of_unity_powers = GetAVX512RootOfUnityPowers().data();
+    const uint64_t* root_of_unity_powers =
+        m_tables->Data(NTTTables::kAVX512RootOfUnityPowers);
     const uint64_t* precon_root_of_unity_powers =
-        GetAVX512Precon52RootOfUnityPowers().data();
+        m_tables->Data(NTTTables::kAVX512Precon52RootOfUnityPowers);
 
     HEXL_VLOG(3, "Calling 52-bit AVX512-IFMA FwdNTT");
-    ForwardTransformToBitReverseAVX512<s_ifma_shift_bits>(
-        result, m_degree, m_q, root_of_unity_powers,
-        precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+    ForwardTransformToBitReverseAVX512Parallel<s_ifma_shift_bits>(
+        result, operand, m_degree, m_q, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        thread_pool, m_base_ntt_size);
     return;
   }
 #endif
@@ -208,40 +245,82 @@ void NTT::ComputeForward(uint64_t* result, const uint64_t* operand,
     if (m_q < s_max_fwd_32_modulus) {
       HEXL_VLOG(3, "Calling 32-bit AVX512-DQ FwdNTT");
       const uint64_t* root_of_unity_powers =
-          GetAVX512RootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kAVX512RootOfUnityPowers);
       const uint64_t* precon_root_of_unity_powers =
-          GetAVX512Precon32RootOfUnityPowers().data();
-      ForwardTransformToBitReverseAVX512<32>(
-          result, m_degree, m_q, root_of_unity_powers,
-          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+          m_tables->Data(NTTTables::kAVX512Precon32RootOfUnityPowers);
+      ForwardTransformToBitReverseAVX512Parallel<32>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+          thread_pool, m_base_ntt_size);
     } else {
       HEXL_VLOG(3, "Calling 64-bit AVX512-DQ FwdNTT");
       const uint64_t* root_of_unity_powers =
-          GetAVX512RootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kAVX512RootOfUnityPowers);
       const uint64_t* precon_root_of_unity_powers =
-          GetAVX512Precon64RootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kAVX512Precon64RootOfUnityPowers);
 
-      ForwardTransformToBitReverseAVX512<s_default_shift_bits>(
-          result, m_degree, m_q, root_of_unity_powers,
-          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      ForwardTransformToBitReverseAVX512Parallel<s_default_shift_bits>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor,
+          thread_pool, m_base_ntt_size);
     }
     return;
   }
 #endif
 
-  HEXL_VLOG(3, "Calling 64-bit default FwdNTT");
-  const uint64_t* root_of_unity_powers = GetRootOfUnityPowers().data();
+#ifdef HEXL_HAS_AVX256
+  // AVX2 lacks 64-bit multiplies, but even the emulated 64-bit kernel runs
+  // about twice as fast as the native radix-4 transform, so it takes
+  // precedence over the native transforms below
+  if (has_avx2 && m_degree >= 16) {
+    const uint64_t* root_of_unity_powers =
+        m_tables->Data(NTTTables::kRootOfUnityPowers);
+    if (m_q < s_max_fwd_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX2 FwdNTT");
+      ForwardTransformToBitReverseAVX2<32>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX2 FwdNTT");
+      ForwardTransformToBitReverseAVX2<s_default_shift_bits>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  const uint64_t* root_of_unity_powers =
+      m_tables->Data(NTTTables::kRootOfUnityPowers);
   const uint64_t* precon_root_of_unity_powers =
-      GetPrecon64RootOfUnityPowers().data();
+      m_tables->Data(NTTTables::kPrecon64RootOfUnityPowers);
 
-  ForwardTransformToBitReverse64(result, m_degree, m_q, root_of_unity_powers,
-                                 precon_root_of_unity_powers, input_mod_factor,
-                                 output_mod_factor);
+  switch (m_native_radix) {
+    case 4:
+      HEXL_VLOG(3, "Calling 64-bit radix-4 default FwdNTT");
+      ForwardTransformToBitReverseRadix<2>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      break;
+    case 8:
+      HEXL_VLOG(3, "Calling 64-bit radix-8 default FwdNTT");
+      ForwardTransformToBitReverseRadix<3>(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      break;
+    default:
+      HEXL_VLOG(3, "Calling 64-bit default FwdNTT");
+      ForwardTransformToBitReverse64(
+          result, operand, m_degree, m_q, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+  }
 }
 
 void NTT::ComputeInverse(uint64_t* result, const uint64_t* operand,
-                         uint64_t input_mod_factor,
-                         uint64_t output_mod_factor) {
+                         uint64_t input_mod_factor, uint64_t output_mod_factor,
+                         Ordering input_order) {
   HEXL_CHECK(result != nullptr, "result == nullptr");
   HEXL_CHECK(operand != nullptr, "operand == nullptr");
   HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
@@ -251,19 +330,33 @@ void NTT::ComputeInverse(uint64_t* result, const uint64_t* operand,
   HEXL_CHECK_BOUNDS(operand, m_degree, m_q * input_mod_factor,
                     "operand exceeds bound " << m_q * input_mod_factor);
 
-  if (operand != result) {
-    std::memcpy(result, operand, m_degree * sizeof(uint64_t));
+  // Natural-order inputs are permuted into result, and transformed in-place
+  if (input_order == Ordering::kNatural) {
+    BitReversePermute(result, operand, m_degree);
+    operand = result;
   }
+  InverseFromBitReverse(result, operand, input_mod_factor, output_mod_factor);
+}
+
+void NTT::InverseFromBitReverse(uint64_t* result, const uint64_t* operand,
+                                uint64_t input_mod_factor,
+                                uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  ThreadPool* thread_pool =
+      (m_degree >= s_min_parallel_degree) ? m_thread_pool.get() : nullptr;
+#endif
 
 #ifdef HEXL_HAS_AVX512IFMA
   if (has_avx512ifma && (m_q < s_max_inv_ifma_modulus) && (m_degree >= 16)) {
     HEXL_VLOG(3, "Calling 52-bit AVX512-IFMA InvNTT");
-    const uint64_t* inv_root_of_unity_powers = GetInvRootOfUnityPowers().data();
+    const uint64_t* inv_root_of_unity_powers =
+        m_tables->Data(NTTTables::kInvRootOfUnityPowers);
     const uint64_t* precon_inv_root_of_unity_powers =
-        GetPrecon52InvRootOfUnityPowers().data();
-    InverseTransformFromBitReverseAVX512<s_ifma_shift_bits>(
-        result, m_degree, m_q, inv_root_of_unity_powers,
-        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+        m_tables->Data(NTTTables::kPrecon52InvRootOfUnityPowers);
+    InverseTransformFromBitReverseAVX512Parallel<s_ifma_shift_bits>(
+        result, operand, m_degree, m_q, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+        thread_pool, m_base_ntt_size);
     return;
   }
 #endif
@@ -273,39 +366,174 @@ void NTT::ComputeInverse(uint64_t* result, const uint64_t* operand,
     if (m_q < s_max_inv_32_modulus) {
       HEXL_VLOG(3, "Calling 32-bit AVX512-DQ InvNTT");
       const uint64_t* inv_root_of_unity_powers =
-          GetInvRootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kInvRootOfUnityPowers);
       const uint64_t* precon_inv_root_of_unity_powers =
-          GetPrecon32InvRootOfUnityPowers().data();
-      InverseTransformFromBitReverseAVX512<32>(
-          result, m_degree, m_q, inv_root_of_unity_powers,
-          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+          m_tables->Data(NTTTables::kPrecon32InvRootOfUnityPowers);
+      InverseTransformFromBitReverseAVX512Parallel<32>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+          thread_pool, m_base_ntt_size);
     } else {
       HEXL_VLOG(3, "Calling 64-bit AVX512 InvNTT");
       const uint64_t* inv_root_of_unity_powers =
-          GetInvRootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kInvRootOfUnityPowers);
       const uint64_t* precon_inv_root_of_unity_powers =
-          GetPrecon64InvRootOfUnityPowers().data();
+          m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers);
 
-      InverseTransformFromBitReverseAVX512<s_default_shift_bits>(
-          result, m_degree, m_q, inv_root_of_unity_powers,
-          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      InverseTransformFromBitReverseAVX512Parallel<s_default_shift_bits>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+          thread_pool, m_base_ntt_size);
     }
     return;
   }
 #endif
 
-  HEXL_VLOG(3, "Calling 64-bit default InvNTT");
-  const uint64_t* inv_root_of_unity_powers = GetInvRootOfUnityPowers().data();
+#ifdef HEXL_HAS_AVX256
+  // Takes precedence over the native transforms, see ForwardToBitReverse
+  if (has_avx2 && m_degree >= 16) {
+    // The 32-bit kernel multiplies differences in [0, 4q), so it needs the
+    // tighter forward bound on the modulus
+    const uint64_t* inv_root_of_unity_powers =
+        m_tables->Data(NTTTables::kInvRootOfUnityPowers);
+    if (m_q < s_max_fwd_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX2 InvNTT");
+      InverseTransformFromBitReverseAVX2<32>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX2 InvNTT");
+      InverseTransformFromBitReverseAVX2<s_default_shift_bits>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  const uint64_t* inv_root_of_unity_powers =
+      m_tables->Data(NTTTables::kInvRootOfUnityPowers);
   const uint64_t* precon_inv_root_of_unity_powers =
-      GetPrecon64InvRootOfUnityPowers().data();
-  InverseTransformFromBitReverse64(
-      result, m_degree, m_q, inv_root_of_unity_powers,
+      m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers);
+
+  switch (m_native_radix) {
+    case 4:
+      HEXL_VLOG(3, "Calling 64-bit radix-4 default InvNTT");
+      InverseTransformFromBitReverseRadix<2>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      break;
+    case 8:
+      HEXL_VLOG(3, "Calling 64-bit radix-8 default InvNTT");
+      InverseTransformFromBitReverseRadix<3>(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      break;
+    default:
+      HEXL_VLOG(3, "Calling 64-bit default InvNTT");
+      InverseTransformFromBitReverse64(
+          result, operand, m_degree, m_q, inv_root_of_unity_powers,
+          precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+  }
+}
+
+void NTT::ComputeForward(uint32_t* result, const uint32_t* operand,
+                         uint64_t input_mod_factor, uint64_t output_mod_factor,
+                         Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(m_q < s_max_fwd_32_modulus,
+             "modulus " << m_q << " too large for 32-bit NTT");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2 or 4; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+  HEXL_CHECK_BOUNDS(
+      operand, m_degree, m_q * input_mod_factor,
+      "value in operand exceeds bound " << m_q * input_mod_factor);
+
+  ForwardToBitReverse(result, operand, input_mod_factor, output_mod_factor);
+  if (output_order == Ordering::kNatural) {
+    BitReversePermuteInPlace(result, m_degree);
+  }
+}
+
+void NTT::ForwardToBitReverse(uint32_t* result, const uint32_t* operand,
+                              uint64_t input_mod_factor,
+                              uint64_t output_mod_factor) {
+  const uint32_t* root_of_unity_powers =
+      m_tables->Data32(NTTTables::kRootOfUnityPowersU32);
+  const uint32_t* precon_root_of_unity_powers =
+      m_tables->Data32(NTTTables::kPrecon32RootOfUnityPowersU32);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && m_degree >= 32) {
+    HEXL_VLOG(3, "Calling 32-bit AVX512 FwdNTT on 32-bit coefficients");
+    ForwardTransformToBitReverse32AVX512(
+        result, operand, m_degree, m_q, root_of_unity_powers,
+        precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling 32-bit default FwdNTT on 32-bit coefficients");
+  ForwardTransformToBitReverse32(result, operand, m_degree, m_q,
+                                 root_of_unity_powers,
+                                 precon_root_of_unity_powers,
+                                 input_mod_factor, output_mod_factor);
+}
+
+void NTT::ComputeInverse(uint32_t* result, const uint32_t* operand,
+                         uint64_t input_mod_factor, uint64_t output_mod_factor,
+                         Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(m_q < s_max_fwd_32_modulus,
+             "modulus " << m_q << " too large for 32-bit NTT");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+  HEXL_CHECK_BOUNDS(operand, m_degree, m_q * input_mod_factor,
+                    "operand exceeds bound " << m_q * input_mod_factor);
+
+  if (input_order == Ordering::kNatural) {
+    BitReversePermute(result, operand, m_degree);
+    operand = result;
+  }
+  InverseFromBitReverse(result, operand, input_mod_factor, output_mod_factor);
+}
+
+void NTT::InverseFromBitReverse(uint32_t* result, const uint32_t* operand,
+                                uint64_t input_mod_factor,
+                                uint64_t output_mod_factor) {
+  const uint32_t* inv_root_of_unity_powers =
+      m_tables->Data32(NTTTables::kInvRootOfUnityPowersU32);
+  const uint32_t* precon_inv_root_of_unity_powers =
+      m_tables->Data32(NTTTables::kPrecon32InvRootOfUnityPowersU32);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq && m_degree >= 32) {
+    HEXL_VLOG(3, "Calling 32-bit AVX512 InvNTT on 32-bit coefficients");
+    InverseTransformFromBitReverse32AVX512(
+        result, operand, m_degree, m_q, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling 32-bit default InvNTT on 32-bit coefficients");
+  InverseTransformFromBitReverse32(
+      result, operand, m_degree, m_q, inv_root_of_unity_powers,
       precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor);
 }
 
 // Free functions
-void ForwardTransformToBitReverse64(uint64_t* operand, uint64_t n,
-                                    uint64_t modulus,
+void ForwardTransformToBitReverse64(uint64_t* result, const uint64_t* operand,
+                                    uint64_t n, uint64_t modulus,
                                     const uint64_t* root_of_unity_powers,
                                     const uint64_t* precon_root_of_unity_powers,
                                     uint64_t input_mod_factor,
@@ -327,32 +555,35 @@ void ForwardTransformToBitReverse64(uint64_t* operand, uint64_t n,
   uint64_t twice_mod = modulus << 1;
   size_t t = (n >> 1);
 
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
   for (size_t m = 1; m < n; m <<= 1) {
-    size_t j1 = 0;
     for (size_t i = 0; i < m; i++) {
-      if (i != 0) j1 += (t << 1);
-      size_t j2 = j1 + t;
       const uint64_t W_op = root_of_unity_powers[m + i];
       const uint64_t W_precon = precon_root_of_unity_powers[m + i];
 
-      uint64_t* X = operand;
-      uint64_t* Y = X + t;
+      const uint64_t* X_op = input + 2 * i * t;
+      const uint64_t* Y_op = X_op + t;
+      uint64_t* X_r = result + 2 * i * t;
+      uint64_t* Y_r = X_r + t;
 
       uint64_t tx;
       uint64_t T;
       HEXL_LOOP_UNROLL_8
-      for (size_t j = j1; j < j2; j++) {
+      for (size_t j = 0; j < t; j++) {
         // The Harvey butterfly: assume X, Y in [0, 4q), and return X', Y'
         // in [0, 4q). Such that X', Y' = X + WY, X - WY (mod q).
         // See Algorithm 4 of https://arxiv.org/pdf/1205.2926.pdf
-        HEXL_CHECK(X[j] < modulus * 4, "input X " << X[j] << " too large");
-        HEXL_CHECK(Y[j] < modulus * 4, "input Y " << Y[j] << " too large");
+        HEXL_CHECK(X_op[j] < modulus * 4,
+                   "input X " << X_op[j] << " too large");
+        HEXL_CHECK(Y_op[j] < modulus * 4,
+                   "input Y " << Y_op[j] << " too large");
 
-        tx = (X[j] >= twice_mod) ? (X[j] - twice_mod) : X[j];
-        T = MultiplyModLazy<64>(Y[j], W_op, W_precon, modulus);
+        tx = (X_op[j] >= twice_mod) ? (X_op[j] - twice_mod) : X_op[j];
+        T = MultiplyModLazy<64>(Y_op[j], W_op, W_precon, modulus);
 
-        X[j] = tx + T;
-        Y[j] = tx + twice_mod - T;
+        X_r[j] = tx + T;
+        Y_r[j] = tx + twice_mod - T;
 
         HEXL_CHECK(tx + T < modulus * 4,
                    "ouput X " << (tx + T) << " too large");
@@ -361,18 +592,17 @@ void ForwardTransformToBitReverse64(uint64_t* operand, uint64_t n,
       }
     }
     t >>= 1;
+    input = result;
   }
   if (output_mod_factor == 1) {
     for (size_t i = 0; i < n; ++i) {
-      if (operand[i] >= twice_mod) {
-        operand[i] -= twice_mod;
-      }
-      if (operand[i] >= modulus) {
-        operand[i] -= modulus;
-      }
-      HEXL_CHECK(operand[i] < modulus, "Incorrect modulus reduction in NTT "
-                                           << operand[i] << " >= " << modulus);
+      result[i] = ReduceMod<4>(input[i], modulus, &twice_mod);
+      HEXL_CHECK(result[i] < modulus, "Incorrect modulus reduction in NTT "
+                                          << result[i] << " >= " << modulus);
     }
+  } else if (input != result) {
+    // No stage ran, i.e. n == 1
+    result[0] = input[0];
   }
 }
 
@@ -407,7 +637,7 @@ void ReferenceForwardTransformToBitReverse(
 }
 
 void InverseTransformFromBitReverse64(
-    uint64_t* operand, uint64_t n, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
     uint64_t output_mod_factor) {
@@ -423,66 +653,254 @@ void InverseTransformFromBitReverse64(
   HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
              "output_mod_factor must be 1 or 2; got " << output_mod_factor);
 
+  if (n == 1) {
+    result[0] = (output_mod_factor == 1) ? ReduceMod<2>(operand[0], modulus)
+                                         : operand[0];
+    return;
+  }
+
   uint64_t twice_mod = modulus << 1;
   size_t t = 1;
   size_t root_index = 1;
 
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
   for (size_t m = (n >> 1); m > 1; m >>= 1) {
-    size_t j1 = 0;
     for (size_t i = 0; i < m; i++, root_index++) {
-      if (i != 0) j1 += (t << 1);
-      size_t j2 = j1 + t;
       const uint64_t W_op = inv_root_of_unity_powers[root_index];
       const uint64_t W_op_precon = precon_inv_root_of_unity_powers[root_index];
 
-      uint64_t* X = operand;
-      uint64_t* Y = X + t;
+      const uint64_t* X_op = input + 2 * i * t;
+      const uint64_t* Y_op = X_op + t;
+      uint64_t* X_r = result + 2 * i * t;
+      uint64_t* Y_r = X_r + t;
 
       HEXL_LOOP_UNROLL_8
-      for (size_t j = j1; j < j2; j++) {
-        HEXL_VLOG(4, "Loaded X " << X[j]);
-        HEXL_VLOG(4, "Loaded Y " << Y[j]);
+      for (size_t j = 0; j < t; j++) {
+        HEXL_VLOG(4, "Loaded X " << X_op[j]);
+        HEXL_VLOG(4, "Loaded Y " << Y_op[j]);
         // The Harvey butterfly: assume X, Y in [0, 2q), and return X', Y'
         // in [0, 2q). X', Y' = X + Y (mod q), W(X - Y) (mod q).
-        uint64_t tx = X[j] + Y[j];
-        uint64_t ty = X[j] + twice_mod - Y[j];
+        uint64_t tx = X_op[j] + Y_op[j];
+        uint64_t ty = X_op[j] + twice_mod - Y_op[j];
 
-        X[j] = (tx >= twice_mod) ? (tx - twice_mod) : tx;
-        Y[j] = MultiplyModLazy<64>(ty, W_op, W_op_precon, modulus);
+        X_r[j] = (tx >= twice_mod) ? (tx - twice_mod) : tx;
+        Y_r[j] = MultiplyModLazy<64>(ty, W_op, W_op_precon, modulus);
       }
     }
     t <<= 1;
+    input = result;
   }
 
   const uint64_t W_op = inv_root_of_unity_powers[root_index];
   const uint64_t inv_n = InverseMod(n, modulus);
   const uint64_t inv_n_w = MultiplyMod(inv_n, W_op, modulus);
 
-  uint64_t* X = operand;
-  uint64_t* Y = X + (n >> 1);
+  const uint64_t* X_op = input;
+  const uint64_t* Y_op = X_op + (n >> 1);
+  uint64_t* X_r = result;
+  uint64_t* Y_r = X_r + (n >> 1);
   uint64_t tx;
   uint64_t ty;
 
   for (size_t j = 0; j < (n >> 1); ++j) {
-    tx = X[j] + Y[j];
+    tx = X_op[j] + Y_op[j];
     if (tx >= twice_mod) {
       tx -= twice_mod;
     }
-    ty = X[j] + twice_mod - Y[j];
-    X[j] = MultiplyModLazy<64>(tx, inv_n, modulus);
-    Y[j] = MultiplyModLazy<64>(ty, inv_n_w, modulus);
+    ty = X_op[j] + twice_mod - Y_op[j];
+    X_r[j] = MultiplyModLazy<64>(tx, inv_n, modulus);
+    Y_r[j] = MultiplyModLazy<64>(ty, inv_n_w, modulus);
   }
 
   if (output_mod_factor == 1) {
     // Reduce from [0, 2q) to [0,q)
     for (size_t i = 0; i < n; ++i) {
-      if (operand[i] >= modulus) {
-        operand[i] -= modulus;
+      if (result[i] >= modulus) {
+        result[i] -= modulus;
+      }
+      HEXL_CHECK(result[i] < modulus, "Incorrect modulus reduction in InvNTT"
+                                          << result[i] << " >= " << modulus);
+    }
+  }
+}
+
+void ForwardTransformToBitReverse32(uint32_t* result, const uint32_t* operand,
+                                    uint64_t n, uint64_t modulus,
+                                    const uint32_t* root_of_unity_powers,
+                                    const uint32_t* precon_root_of_unity_powers,
+                                    uint64_t input_mod_factor,
+                                    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(modulus < NTT::s_max_fwd_32_modulus,
+             "modulus " << modulus << " too large for 32-bit NTT");
+  HEXL_CHECK_BOUNDS(operand, n, modulus * input_mod_factor,
+                    "operand exceeds bound " << modulus * input_mod_factor);
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_root_of_unity_powers != nullptr,
+             "precon_root_of_unity_powers == nullptr");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  // 4q < 2^32, so the lazy butterflies never overflow
+  uint32_t mod = static_cast<uint32_t>(modulus);
+  uint32_t twice_mod = mod << 1;
+  size_t t = (n >> 1);
+
+  // The first stage reads from operand, the others from result
+  const uint32_t* input = operand;
+  for (size_t m = 1; m < n; m <<= 1) {
+    for (size_t i = 0; i < m; i++) {
+      const uint32_t W_op = root_of_unity_powers[m + i];
+      const uint32_t W_precon = precon_root_of_unity_powers[m + i];
+
+      const uint32_t* X_op = input + 2 * i * t;
+      const uint32_t* Y_op = X_op + t;
+      uint32_t* X_r = result + 2 * i * t;
+      uint32_t* Y_r = X_r + t;
+
+      HEXL_LOOP_UNROLL_8
+      for (size_t j = 0; j < t; j++) {
+        // Harvey butterfly as in ForwardTransformToBitReverse64, with X, Y
+        // in [0, 4q)
+        uint32_t tx = (X_op[j] >= twice_mod) ? (X_op[j] - twice_mod) : X_op[j];
+        uint32_t T = static_cast<uint32_t>(
+            MultiplyModLazy<32>(Y_op[j], W_op, W_precon, mod));
+        X_r[j] = tx + T;
+        Y_r[j] = tx + twice_mod - T;
       }
-      HEXL_CHECK(operand[i] < modulus, "Incorrect modulus reduction in InvNTT"
-                                           << operand[i] << " >= " << modulus);
     }
+    t >>= 1;
+    input = result;
+  }
+  if (output_mod_factor == 1) {
+    for (size_t i = 0; i < n; ++i) {
+      uint32_t x = input[i];
+      if (x >= twice_mod) {
+        x -= twice_mod;
+      }
+      if (x >= mod) {
+        x -= mod;
+      }
+      result[i] = x;
+    }
+  } else if (input != result) {
+    // No stage ran, i.e. n == 1
+    result[0] = input[0];
+  }
+}
+
+void InverseTransformFromBitReverse32(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* inv_root_of_unity_powers,
+    const uint32_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(modulus < NTT::s_max_fwd_32_modulus,
+             "modulus " << modulus << " too large for 32-bit NTT");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_inv_root_of_unity_powers != nullptr,
+             "precon_inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  uint32_t mod = static_cast<uint32_t>(modulus);
+  if (n == 1) {
+    result[0] = (output_mod_factor == 1 && operand[0] >= mod)
+                    ? operand[0] - mod
+                    : operand[0];
+    return;
+  }
+
+  uint32_t twice_mod = mod << 1;
+  size_t t = 1;
+  size_t root_index = 1;
+
+  // The first stage reads from operand, the others from result
+  const uint32_t* input = operand;
+  for (size_t m = (n >> 1); m > 1; m >>= 1) {
+    for (size_t i = 0; i < m; i++, root_index++) {
+      const uint32_t W_op = inv_root_of_unity_powers[root_index];
+      const uint32_t W_op_precon = precon_inv_root_of_unity_powers[root_index];
+
+      const uint32_t* X_op = input + 2 * i * t;
+      const uint32_t* Y_op = X_op + t;
+      uint32_t* X_r = result + 2 * i * t;
+      uint32_t* Y_r = X_r + t;
+
+      HEXL_LOOP_UNROLL_8
+      for (size_t j = 0; j < t; j++) {
+        // Harvey butterfly as in InverseTransformFromBitReverse64, with X, Y
+        // in [0, 2q)
+        uint32_t tx = X_op[j] + Y_op[j];
+        uint32_t ty = X_op[j] + twice_mod - Y_op[j];
+        X_r[j] = (tx >= twice_mod) ? (tx - twice_mod) : tx;
+        Y_r[j] = static_cast<uint32_t>(
+            MultiplyModLazy<32>(ty, W_op, W_op_precon, mod));
+      }
+    }
+    t <<= 1;
+    input = result;
+  }
+
+  // The last stage also multiplies by 1/n
+  const uint64_t W_op = inv_root_of_unity_powers[root_index];
+  const uint64_t inv_n = InverseMod(n, modulus);
+  const uint64_t inv_n_precon =
+      MultiplyFactor(inv_n, 32, modulus).BarrettFactor();
+  const uint64_t inv_n_w = MultiplyMod(inv_n, W_op, modulus);
+  const uint64_t inv_n_w_precon =
+      MultiplyFactor(inv_n_w, 32, modulus).BarrettFactor();
+
+  const uint32_t* X_op = input;
+  const uint32_t* Y_op = X_op + (n >> 1);
+  uint32_t* X_r = result;
+  uint32_t* Y_r = X_r + (n >> 1);
+  for (size_t j = 0; j < (n >> 1); ++j) {
+    uint32_t tx = X_op[j] + Y_op[j];
+    if (tx >= twice_mod) {
+      tx -= twice_mod;
+    }
+    uint32_t ty = X_op[j] + twice_mod - Y_op[j];
+    X_r[j] = static_cast<uint32_t>(
+        MultiplyModLazy<32>(tx, inv_n, inv_n_precon, modulus));
+    Y_r[j] = static_cast<uint32_t>(
+        MultiplyModLazy<32>(ty, inv_n_w, inv_n_w_precon, modulus));
+  }
+
+  if (output_mod_factor == 1) {
+    for (size_t i = 0; i < n; ++i) {
+      if (result[i] >= mod) {
+        result[i] -= mod;
+      }
+    }
+  }
+}
+
+uint64_t TablesRootOfUnity(NTT::Mode mode, uint64_t root_of_unity,
+                           uint64_t modulus) {
+  if (mode == NTT::Mode::kNegacyclic) {
+    return MultiplyMod(root_of_unity, root_of_unity, modulus);
+  }
+  return root_of_unity;
+}
+
+uint64_t FourStepBlockSize(uint64_t degree) {
+  uint64_t block_size = std::min(degree, NTT::s_four_step_block_size);
+  while (block_size * block_size < 8 * degree) {
+    block_size *= 2;
   }
+  return block_size;
 }
 
 bool CheckNTTArguments(uint64_t degree, uint64_t modulus) {
@@ -495,7 +913,9 @@ bool CheckNTTArguments(uint64_t degree, uint64_t modulus) {
              "degree should be less than 2^" << NTT::s_max_degree_bits
                                              << " got " << degree);
 
-  HEXL_CHECK(modulus % (2 * degree) == 1, "modulus mod 2n != 1");
+  // Negacyclic transforms further require modulus == 1 mod 2n, which is
+  // checked on construction
+  HEXL_CHECK((modulus - 1) % degree == 0, "modulus mod n != 1");
   return true;
 }
 
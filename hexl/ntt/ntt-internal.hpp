@@ -17,8 +17,10 @@
 namespace intel {
 namespace hexl {
 
-void ForwardTransformToBitReverse64(uint64_t* operand, uint64_t n,
-                                    uint64_t modulus,
+/// @brief Native radix-2 forward NTT of \p operand into \p result. \p result
+/// may equal \p operand; otherwise it must not overlap it.
+void ForwardTransformToBitReverse64(uint64_t* result, const uint64_t* operand,
+                                    uint64_t n, uint64_t modulus,
                                     const uint64_t* root_of_unity_powers,
                                     const uint64_t* precon_root_of_unity_powers,
                                     uint64_t input_mod_factor = 1,
@@ -35,13 +37,71 @@ void ReferenceForwardTransformToBitReverse(
     uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* root_of_unity_powers);
 
+/// @brief Native radix-2 inverse NTT of \p operand into \p result. \p result
+/// may equal \p operand; otherwise it must not overlap it.
 void InverseTransformFromBitReverse64(
-    uint64_t* operand, uint64_t n, uint64_t modulus,
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
     const uint64_t* inv_root_of_unity_powers,
     const uint64_t* precon_inv_root_of_unity_powers,
     uint64_t input_mod_factor = 1, uint64_t output_mod_factor = 1);
 
-// Returns true if arguments satisfy constraints for negacyclic NTT
+/// @brief Native forward NTT on 32-bit coefficients
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data. Read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n and q <
+/// NTT::s_max_fwd_32_modulus, so values in [0, 4q) fit in 32 bits
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers 32-bit pre-conditioned powers of
+/// 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+void ForwardTransformToBitReverse32(uint32_t* result, const uint32_t* operand,
+                                    uint64_t n, uint64_t modulus,
+                                    const uint32_t* root_of_unity_powers,
+                                    const uint32_t* precon_root_of_unity_powers,
+                                    uint64_t input_mod_factor = 1,
+                                    uint64_t output_mod_factor = 1);
+
+/// @brief Native inverse NTT on 32-bit coefficients
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data. Read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n and q <
+/// NTT::s_max_fwd_32_modulus
+/// @param[in] inv_root_of_unity_powers Powers of inverse 2n'th root of unity
+/// in F_q. In bit-reversed order.
+/// @param[in] precon_inv_root_of_unity_powers 32-bit pre-conditioned powers
+/// of inverse 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+void InverseTransformFromBitReverse32(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* inv_root_of_unity_powers,
+    const uint32_t* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor = 1, uint64_t output_mod_factor = 1);
+
+// Returns the N'th root of unity which, with the twist, determines the
+// pre-computed tables of a transform with mode mode and root of unity
+// root_of_unity. Negacyclic transforms use the square of their 2N'th root.
+uint64_t TablesRootOfUnity(NTT::Mode mode, uint64_t root_of_unity,
+                           uint64_t modulus);
+
+// Returns the size of the row transforms of the four-step decomposition of a
+// transform of size degree: NTT::s_four_step_block_size, or the smallest
+// size leaving column slices of at least 8 elements
+uint64_t FourStepBlockSize(uint64_t degree);
+
+// Returns true if arguments satisfy constraints for an NTT of size degree
 bool CheckNTTArguments(uint64_t degree, uint64_t modulus);
 
 }  // namespace hexl
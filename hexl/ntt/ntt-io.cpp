@@ -0,0 +1,209 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-cache.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "util/mapped-file.hpp"
+
+namespace intel {
+namespace hexl {
+
+// File layout, with all fields stored as uint64_t in native byte order:
+//   Header: magic, byte order mark, version, number of NTTs, number of tables
+//   Per NTT: degree, modulus, mode, root of unity, twist, then (offset, size)
+//   per table
+//   Table data, each table starting at a 64-byte aligned offset
+// A table with size 0 is not stored, and is computed on first use instead.
+// SaveTables stores the tables read by the transforms dispatched on the
+// saving CPU, plus any other table already built, such as the tables of the
+// 32-bit coefficient transforms.
+
+namespace {
+
+const char s_magic[8] = {'H', 'E', 'X', 'L', 'N', 'T', 'T', '\0'};
+const uint64_t s_byte_order_mark = 0x0102030405060708ULL;
+const uint64_t s_table_alignment = 64;
+
+const size_t s_header_words = 5;
+const size_t s_record_params = 5;
+
+uint64_t AlignUp(uint64_t offset) {
+  return (offset + s_table_alignment - 1) & ~(s_table_alignment - 1);
+}
+
+void WriteWords(std::ofstream* file, const uint64_t* words, size_t size) {
+  file->write(reinterpret_cast<const char*>(words),
+              static_cast<std::streamsize>(size * sizeof(uint64_t)));
+}
+
+}  // namespace
+
+void NTT::SaveTables(const std::string& filename,
+                     const std::vector<NTT>& ntts) {
+  const size_t num_tables = NTTTables::kNumTables;
+  const size_t record_words = s_record_params + 2 * num_tables;
+
+  std::vector<uint64_t> header(s_header_words);
+  std::memcpy(&header[0], s_magic, sizeof(s_magic));
+  header[1] = s_byte_order_mark;
+  header[2] = s_tables_file_version;
+  header[3] = ntts.size();
+  header[4] = num_tables;
+
+  std::vector<uint64_t> records;
+  records.reserve(ntts.size() * record_words);
+  uint64_t offset =
+      (s_header_words + ntts.size() * record_words) * sizeof(uint64_t);
+  for (const auto& ntt : ntts) {
+    if (!ntt.m_tables) {
+      throw std::invalid_argument("Cannot save tables of an empty NTT");
+    }
+    // Builds the tables read by the dispatched transforms. The copy shares
+    // the tables of ntt.
+    NTT dispatched(ntt);
+    AlignedVector64<uint64_t> zeros(ntt.m_degree, 0);
+    dispatched.ForwardToBitReverse(zeros.data(), zeros.data(), 1, 1);
+    dispatched.InverseFromBitReverse(zeros.data(), zeros.data(), 1, 1);
+
+    records.push_back(ntt.m_degree);
+    records.push_back(ntt.m_q);
+    records.push_back(static_cast<uint64_t>(ntt.m_mode));
+    records.push_back(ntt.m_w);
+    records.push_back(ntt.m_twist);
+    for (size_t table = 0; table < num_tables; ++table) {
+      offset = AlignUp(offset);
+      auto id = static_cast<NTTTables::Table>(table);
+      size_t size = ntt.m_tables->IsBuilt(id) ? ntt.m_tables->Size(id) : 0;
+      records.push_back(offset);
+      records.push_back(size);
+      offset += size * sizeof(uint64_t);
+    }
+  }
+
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw std::runtime_error("Unable to open " + filename + " for writing");
+  }
+  WriteWords(&file, header.data(), header.size());
+  WriteWords(&file, records.data(), records.size());
+
+  const char padding[s_table_alignment] = {};
+  for (size_t i = 0; i < ntts.size(); ++i) {
+    const uint64_t* record = &records[i * record_words + s_record_params];
+    for (size_t table = 0; table < num_tables; ++table) {
+      uint64_t table_offset = record[2 * table];
+      uint64_t position = static_cast<uint64_t>(file.tellp());
+      file.write(padding,
+                 static_cast<std::streamsize>(table_offset - position));
+      uint64_t size = record[2 * table + 1];
+      if (size > 0) {
+        auto id = static_cast<NTTTables::Table>(table);
+        WriteWords(&file, ntts[i].m_tables->Data(id), size);
+      }
+    }
+  }
+
+  file.close();
+  if (!file) {
+    throw std::runtime_error("Unable to write " + filename);
+  }
+  HEXL_VLOG(3, "Saved tables of " << ntts.size() << " NTTs to " << filename);
+}
+
+std::vector<NTT> NTT::LoadTables(const std::string& filename) {
+  auto mapping = std::make_shared<MappedFile>(filename);
+  const uint8_t* data = mapping->Data();
+  const uint64_t file_size = mapping->Size();
+  auto words = reinterpret_cast<const uint64_t*>(data);
+
+  auto invalid = [&](const std::string& reason) {
+    return std::runtime_error("Invalid NTT tables file " + filename + ": " +
+                              reason);
+  };
+
+  if (file_size < s_header_words * sizeof(uint64_t) ||
+      std::memcmp(data, s_magic, sizeof(s_magic)) != 0) {
+    throw invalid("bad magic");
+  }
+  if (words[1] != s_byte_order_mark) {
+    throw invalid("byte order mismatch");
+  }
+  if (words[2] != s_tables_file_version) {
+    throw invalid("unsupported version " + std::to_string(words[2]));
+  }
+  const uint64_t num_ntts = words[3];
+  const uint64_t num_tables = words[4];
+  const uint64_t record_words = s_record_params + 2 * num_tables;
+  const uint64_t max_records = file_size / sizeof(uint64_t) - s_header_words;
+  if (num_tables > max_records ||
+      (record_words > 0 && num_ntts > max_records / record_words)) {
+    throw invalid("truncated header");
+  }
+
+  std::vector<NTT> ntts;
+  ntts.reserve(num_ntts);
+  for (uint64_t i = 0; i < num_ntts; ++i) {
+    const uint64_t* record = words + s_header_words + i * record_words;
+    uint64_t degree = record[0];
+    uint64_t q = record[1];
+    auto mode = static_cast<Mode>(record[2]);
+    uint64_t root_of_unity = record[3];
+    uint64_t twist = record[4];
+    bool negacyclic = (mode == Mode::kNegacyclic);
+    uint64_t root_order = negacyclic ? 2 * degree : degree;
+    if (record[2] > static_cast<uint64_t>(Mode::kTwisted) ||
+        !IsPowerOfTwo(degree) || degree < 2 ||
+        degree > (1ULL << s_max_degree_bits) || q % root_order != 1 ||
+        !IsPrimitiveRoot(root_of_unity, root_order, q) || twist % q == 0 ||
+        (negacyclic && twist != root_of_unity)) {
+      throw invalid("bad parameters for NTT " + std::to_string(i));
+    }
+
+    uint64_t tables_root = TablesRootOfUnity(mode, root_of_unity, q);
+    auto tables = std::make_shared<NTTTables>(
+        degree, q, tables_root, twist, AlignedAllocator<uint64_t, 64>());
+    // Tables appended by later versions are ignored
+    for (uint64_t table = 0; table < num_tables; ++table) {
+      uint64_t offset = record[s_record_params + 2 * table];
+      uint64_t size = record[s_record_params + 2 * table + 1];
+      if (table >= NTTTables::kNumTables || size == 0) {
+        continue;
+      }
+      auto id = static_cast<NTTTables::Table>(table);
+      if (size != NTTTables::TableSize(id, degree) ||
+          offset % s_table_alignment != 0 || offset > file_size ||
+          size > (file_size - offset) / sizeof(uint64_t)) {
+        throw invalid(std::string("bad table ") + NTTTables::Name(id) +
+                      " for NTT " + std::to_string(i));
+      }
+      tables->SetExternal(id, reinterpret_cast<const uint64_t*>(data + offset),
+                          size, mapping);
+    }
+
+    // Registers the tables, so the NTT below and any NTT object constructed
+    // later with the same parameters share them
+    std::shared_ptr<const NTTTables> shared =
+        NTTTableCache::GetInstance().GetOrCreate(
+            degree, q, tables_root, twist,
+            [&]() -> std::shared_ptr<const NTTTables> { return tables; });
+    ntts.push_back(NTT(mode, degree, q, root_of_unity, twist, {}));
+    ntts.back().m_tables = std::move(shared);
+  }
+  HEXL_VLOG(3, "Loaded tables of " << num_ntts << " NTTs from " << filename);
+  return ntts;
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,218 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <utility>
+
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx512.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Size of the blocks of the fused transform. Both operands of a block stay in
+// the L2 cache, and the blocks are few enough that the column slices, which
+// touch one row per block, don't thrash the L1 cache.
+const size_t s_poly_mul_block_size = 4096;
+
+#ifdef HEXL_HAS_AVX512DQ
+
+// Stores in result the product of operand1 with a second polynomial, given
+// either by its coefficients operand2 or by its forward transform
+// operand2_ntt. The forward transform of operand1 goes to X, and that of
+// operand2 to Y. Fuses the forward transforms, the dyadic product and the
+// inverse transform block by block, so each block is loaded from memory once
+// for the middle stages.
+template <int BitShift>
+void PolyMulModAVX512(uint64_t* result, const uint64_t* operand1, uint64_t* X,
+                      const uint64_t* operand2, uint64_t* Y,
+                      const uint64_t* operand2_ntt, uint64_t n,
+                      uint64_t modulus, uint64_t mod_factor,
+                      const uint64_t* root_of_unity_powers,
+                      const uint64_t* precon_root_of_unity_powers,
+                      const uint64_t* inv_root_of_unity_powers,
+                      const uint64_t* precon_inv_root_of_unity_powers,
+                      uint64_t base_ntt_size) {
+  // Each column slice must hold a whole number of SIMD vectors, i.e.
+  // block_size / num_blocks >= 8
+  size_t block_size = s_poly_mul_block_size;
+  while (block_size * block_size < 8 * n) {
+    block_size *= 2;
+  }
+  size_t num_blocks = n / block_size;
+  uint64_t recursion_depth = Log2(num_blocks);
+
+  HEXL_VLOG(4, "Calling fused AVX512 PolyMulMod on " << num_blocks
+                                                     << " blocks");
+
+  // First forward stages, split by column slice. They read the operands, so
+  // operand2 is read before X overwrites it if the two alias.
+  for (size_t slice = 0; slice < num_blocks; ++slice) {
+    if (operand2 != nullptr) {
+      ForwardTransformToBitReverseAVX512FirstStages<BitShift>(
+          Y, operand2, n, modulus, root_of_unity_powers,
+          precon_root_of_unity_powers, num_blocks, slice);
+    }
+    ForwardTransformToBitReverseAVX512FirstStages<BitShift>(
+        X, operand1, n, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, num_blocks, slice);
+  }
+
+  // Last forward stages, dyadic product and first inverse stages, block by
+  // block. The first stages leave values in [0, 4q), so the subtransforms
+  // reduce their inputs.
+  for (size_t block = 0; block < num_blocks; ++block) {
+    size_t offset = block * block_size;
+    ForwardTransformToBitReverseAVX512<BitShift>(
+        X + offset, X + offset, block_size, modulus, root_of_unity_powers,
+        precon_root_of_unity_powers, 4, mod_factor, recursion_depth, block,
+        base_ntt_size);
+
+    const uint64_t* Y_ntt = operand2_ntt;
+    if (operand2 != nullptr) {
+      ForwardTransformToBitReverseAVX512<BitShift>(
+          Y + offset, Y + offset, block_size, modulus, root_of_unity_powers,
+          precon_root_of_unity_powers, 4, mod_factor, recursion_depth, block,
+          base_ntt_size);
+      Y_ntt = Y;
+    }
+    EltwiseMultMod(result + offset, X + offset, Y_ntt + offset, block_size,
+                   modulus, mod_factor);
+
+    InverseTransformFromBitReverseAVX512Block<BitShift>(
+        result, result, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, 1, num_blocks, block, base_ntt_size);
+  }
+
+  // Last inverse stages, split by column slice
+  for (size_t slice = 0; slice < num_blocks; ++slice) {
+    InverseTransformFromBitReverseAVX512LastStages<BitShift>(
+        result, n, modulus, inv_root_of_unity_powers,
+        precon_inv_root_of_unity_powers, 1, num_blocks, slice);
+  }
+}
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace
+
+void NTT::PolyMulMod(uint64_t* result, const uint64_t* operand1,
+                     const uint64_t* operand2) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand1 != nullptr, "operand1 == nullptr");
+  HEXL_CHECK(operand2 != nullptr, "operand2 == nullptr");
+  HEXL_CHECK_BOUNDS(operand1, m_degree, m_q,
+                    "value in operand1 exceeds bound " << m_q);
+  HEXL_CHECK_BOUNDS(operand2, m_degree, m_q,
+                    "value in operand2 exceeds bound " << m_q);
+
+  // The product is symmetric, so let result alias operand1 rather than
+  // operand2
+  if (result == operand2) {
+    std::swap(operand1, operand2);
+  }
+  // Holds the forward transform of operand2
+  AlignedVector64<uint64_t> scratch(m_degree, 0, m_aligned_alloc);
+  PolyMulModImpl(result, operand1, result, operand2, scratch.data(), nullptr);
+}
+
+void NTT::PolyMulModNTT(uint64_t* result, const uint64_t* operand1,
+                        const uint64_t* operand2_ntt) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand1 != nullptr, "operand1 == nullptr");
+  HEXL_CHECK(operand2_ntt != nullptr, "operand2_ntt == nullptr");
+  HEXL_CHECK_BOUNDS(operand1, m_degree, m_q,
+                    "value in operand1 exceeds bound " << m_q);
+  HEXL_CHECK_BOUNDS(operand2_ntt, m_degree, m_q,
+                    "value in operand2_ntt exceeds bound " << m_q);
+
+  if (result == operand2_ntt) {
+    // Holds the forward transform of operand1, as operand2_ntt is read
+    // after the transform is complete
+    AlignedVector64<uint64_t> scratch(m_degree, 0, m_aligned_alloc);
+    PolyMulModImpl(result, operand1, scratch.data(), nullptr, nullptr,
+                   operand2_ntt);
+    return;
+  }
+  PolyMulModImpl(result, operand1, result, nullptr, nullptr, operand2_ntt);
+}
+
+void NTT::PolyMulModImpl(uint64_t* result, const uint64_t* operand1,
+                         uint64_t* X, const uint64_t* operand2, uint64_t* Y,
+                         const uint64_t* operand2_ntt) {
+  // Keep the forward outputs in [0, 4q) if EltwiseMultMod supports it
+  uint64_t mod_factor = (m_q < (1ULL << 61)) ? 4 : 1;
+
+#ifdef HEXL_HAS_AVX512DQ
+  // Multi-threaded transforms split the work across threads instead, and
+  // smaller transforms fit in the cache anyway
+  bool fused = has_avx512dq && m_degree > s_poly_mul_block_size &&
+               (m_thread_pool == nullptr || m_degree < s_min_parallel_degree);
+  if (fused) {
+    // The fused kernel uses one Barrett factor precision for both transforms,
+    // so the tighter forward bounds on the modulus apply
+    const uint64_t* root_of_unity_powers =
+        m_tables->Data(NTTTables::kAVX512RootOfUnityPowers);
+    const uint64_t* inv_root_of_unity_powers =
+        m_tables->Data(NTTTables::kInvRootOfUnityPowers);
+#ifdef HEXL_HAS_AVX512IFMA
+    if (has_avx512ifma && m_q < s_max_fwd_ifma_modulus) {
+      HEXL_VLOG(3, "Calling 52-bit AVX512-IFMA PolyMulMod");
+      PolyMulModAVX512<s_ifma_shift_bits>(
+          result, operand1, X, operand2, Y, operand2_ntt, m_degree, m_q,
+          mod_factor,
+          root_of_unity_powers,
+          m_tables->Data(NTTTables::kAVX512Precon52RootOfUnityPowers),
+          inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon52InvRootOfUnityPowers),
+          m_base_ntt_size);
+      return;
+    }
+#endif
+    if (m_q < s_max_fwd_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX512-DQ PolyMulMod");
+      PolyMulModAVX512<32>(
+          result, operand1, X, operand2, Y, operand2_ntt, m_degree, m_q,
+          mod_factor,
+          root_of_unity_powers,
+          m_tables->Data(NTTTables::kAVX512Precon32RootOfUnityPowers),
+          inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32InvRootOfUnityPowers),
+          m_base_ntt_size);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX512-DQ PolyMulMod");
+      PolyMulModAVX512<s_default_shift_bits>(
+          result, operand1, X, operand2, Y, operand2_ntt, m_degree, m_q,
+          mod_factor,
+          root_of_unity_powers,
+          m_tables->Data(NTTTables::kAVX512Precon64RootOfUnityPowers),
+          inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers),
+          m_base_ntt_size);
+    }
+    return;
+  }
+#endif
+
+  const uint64_t* Y_ntt = operand2_ntt;
+  if (operand2 != nullptr) {
+    ForwardToBitReverse(Y, operand2, 1, mod_factor);
+    Y_ntt = Y;
+  }
+  ForwardToBitReverse(X, operand1, 1, mod_factor);
+  EltwiseMultMod(result, X, Y_ntt, m_degree, m_q, mod_factor);
+  InverseFromBitReverse(result, result, 1, 1);
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,369 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/ntt-radix.hpp"
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/ntt-internal.hpp"
+
+namespace intel {
+namespace hexl {
+
+template void ForwardTransformToBitReverseRadix<2>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void ForwardTransformToBitReverseRadix<3>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void InverseTransformFromBitReverseRadix<2>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+template void InverseTransformFromBitReverseRadix<3>(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor);
+
+namespace {
+
+// The Harvey butterfly: assume X, Y in [0, 4q), and return X', Y' in [0, 4q)
+// such that X', Y' = X + WY, X - WY (mod q).
+// See Algorithm 4 of https://arxiv.org/pdf/1205.2926.pdf
+inline void FwdButterflyRadix2(uint64_t* X, uint64_t* Y, uint64_t W_op,
+                               uint64_t W_precon, uint64_t modulus,
+                               uint64_t twice_mod) {
+  uint64_t tx = (*X >= twice_mod) ? (*X - twice_mod) : *X;
+  uint64_t T = MultiplyModLazy<64>(*Y, W_op, W_precon, modulus);
+  *X = tx + T;
+  *Y = tx + twice_mod - T;
+}
+
+// The Harvey butterfly: assume X, Y in [0, 2q), and return X', Y' in [0, 2q)
+// such that X', Y' = X + Y (mod q), W(X - Y) (mod q).
+inline void InvButterflyRadix2(uint64_t* X, uint64_t* Y, uint64_t W_op,
+                               uint64_t W_precon, uint64_t modulus,
+                               uint64_t twice_mod) {
+  uint64_t tx = *X + *Y;
+  uint64_t ty = *X + twice_mod - *Y;
+  *X = (tx >= twice_mod) ? (tx - twice_mod) : tx;
+  *Y = MultiplyModLazy<64>(ty, W_op, W_precon, modulus);
+}
+
+// Computes LogRadix forward stages in one pass, starting with the stage of m
+// groups of butterflies on elements t apart. Each group of the first stage is
+// split into 2^LogRadix-point transforms on elements t / 2^(LogRadix - 1)
+// apart, which are loaded from operand, kept in registers across the stages
+// and stored to result.
+template <int LogRadix>
+void FwdRadixPass(uint64_t* result, const uint64_t* operand, size_t m,
+                  size_t t, uint64_t modulus,
+                  const uint64_t* root_of_unity_powers,
+                  const uint64_t* precon_root_of_unity_powers,
+                  bool reduce_output) {
+  const size_t radix = 1 << LogRadix;
+  const size_t stride = t >> (LogRadix - 1);
+  const uint64_t twice_mod = modulus << 1;
+
+  for (size_t i = 0; i < m; ++i) {
+    // Group g of stage s uses root (m + i) * 2^s + g, stored at 2^s - 1 + g
+    uint64_t W_op[radix - 1];
+    uint64_t W_precon[radix - 1];
+    for (size_t s = 0; s < LogRadix; ++s) {
+      for (size_t g = 0; g < (1ULL << s); ++g) {
+        size_t root_index = ((m + i) << s) + g;
+        size_t w = (1ULL << s) - 1 + g;
+        W_op[w] = root_of_unity_powers[root_index];
+        W_precon[w] = precon_root_of_unity_powers[root_index];
+      }
+    }
+
+    const uint64_t* X_op = operand + 2 * t * i;
+    uint64_t* X_r = result + 2 * t * i;
+    for (size_t j = 0; j < stride; ++j) {
+      uint64_t x[radix];
+      HEXL_LOOP_UNROLL_8
+      for (size_t k = 0; k < radix; ++k) {
+        x[k] = X_op[j + k * stride];
+      }
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t s = 0; s < LogRadix; ++s) {
+        const size_t half = radix >> (s + 1);
+        HEXL_LOOP_UNROLL_4
+        for (size_t g = 0; g < (1ULL << s); ++g) {
+          const size_t w = (1ULL << s) - 1 + g;
+          HEXL_LOOP_UNROLL_4
+          for (size_t k = 2 * half * g; k < 2 * half * g + half; ++k) {
+            FwdButterflyRadix2(&x[k], &x[k + half], W_op[w], W_precon[w],
+                               modulus, twice_mod);
+          }
+        }
+      }
+
+      if (reduce_output) {
+        HEXL_LOOP_UNROLL_8
+        for (size_t k = 0; k < radix; ++k) {
+          x[k] = (x[k] >= twice_mod) ? (x[k] - twice_mod) : x[k];
+          x[k] = (x[k] >= modulus) ? (x[k] - modulus) : x[k];
+        }
+      }
+
+      HEXL_LOOP_UNROLL_8
+      for (size_t k = 0; k < radix; ++k) {
+        X_r[j + k * stride] = x[k];
+      }
+    }
+  }
+}
+
+// Computes LogRadix inverse stages in one pass from operand to result,
+// starting with the stage of m groups of butterflies on elements t apart. If
+// the pass ends with the last stage, it also multiplies by 1/n and, if
+// reduce_output is set, reduces the result to [0, q).
+template <int LogRadix>
+void InvRadixPass(uint64_t* result, const uint64_t* operand, uint64_t n,
+                  size_t m, size_t t, uint64_t modulus,
+                  const uint64_t* inv_root_of_unity_powers,
+                  const uint64_t* precon_inv_root_of_unity_powers,
+                  bool reduce_output) {
+  const size_t radix = 1 << LogRadix;
+  const uint64_t twice_mod = modulus << 1;
+  const size_t num_groups = m >> (LogRadix - 1);
+  const bool last_pass = (num_groups == 1);
+
+  uint64_t inv_n = 0;
+  uint64_t inv_n_precon = 0;
+  uint64_t inv_n_w = 0;
+  uint64_t inv_n_w_precon = 0;
+  if (last_pass) {
+    inv_n = InverseMod(n, modulus);
+    inv_n_precon = MultiplyFactor(inv_n, 64, modulus).BarrettFactor();
+    inv_n_w = MultiplyMod(inv_n, inv_root_of_unity_powers[n - 1], modulus);
+    inv_n_w_precon = MultiplyFactor(inv_n_w, 64, modulus).BarrettFactor();
+  }
+
+  for (size_t i = 0; i < num_groups; ++i) {
+    // Stage s has m / 2^s groups, whose roots start at n - 2m / 2^s + 1.
+    // Group g of stage s uses root i * 2^(LogRadix - 1 - s) + g of the stage,
+    // stored at radix - radix / 2^s + g.
+    uint64_t W_op[radix - 1];
+    uint64_t W_precon[radix - 1];
+    for (size_t s = 0; s < LogRadix; ++s) {
+      size_t stage_groups = radix >> (s + 1);
+      size_t root_index = n - 2 * (m >> s) + 1 + i * stage_groups;
+      for (size_t g = 0; g < stage_groups; ++g, ++root_index) {
+        size_t w = radix - (radix >> s) + g;
+        W_op[w] = inv_root_of_unity_powers[root_index];
+        W_precon[w] = precon_inv_root_of_unity_powers[root_index];
+      }
+    }
+
+    const uint64_t* X_op = operand + radix * t * i;
+    uint64_t* X_r = result + radix * t * i;
+    for (size_t j = 0; j < t; ++j) {
+      uint64_t x[radix];
+      HEXL_LOOP_UNROLL_8
+      for (size_t k = 0; k < radix; ++k) {
+        x[k] = X_op[j + k * t];
+      }
+
+      HEXL_LOOP_UNROLL_4
+      for (size_t s = 0; s < LogRadix - 1; ++s) {
+        const size_t half = 1ULL << s;
+        HEXL_LOOP_UNROLL_4
+        for (size_t g = 0; g < (radix >> (s + 1)); ++g) {
+          const size_t w = radix - (radix >> s) + g;
+          HEXL_LOOP_UNROLL_4
+          for (size_t k = 2 * half * g; k < 2 * half * g + half; ++k) {
+            InvButterflyRadix2(&x[k], &x[k + half], W_op[w], W_precon[w],
+                               modulus, twice_mod);
+          }
+        }
+      }
+
+      const size_t half = radix >> 1;
+      if (last_pass) {
+        HEXL_LOOP_UNROLL_4
+        for (size_t k = 0; k < half; ++k) {
+          uint64_t tx = x[k] + x[k + half];
+          tx = (tx >= twice_mod) ? (tx - twice_mod) : tx;
+          uint64_t ty = x[k] + twice_mod - x[k + half];
+          x[k] = MultiplyModLazy<64>(tx, inv_n, inv_n_precon, modulus);
+          x[k + half] =
+              MultiplyModLazy<64>(ty, inv_n_w, inv_n_w_precon, modulus);
+        }
+        if (reduce_output) {
+          HEXL_LOOP_UNROLL_8
+          for (size_t k = 0; k < radix; ++k) {
+            x[k] = (x[k] >= modulus) ? (x[k] - modulus) : x[k];
+          }
+        }
+      } else {
+        HEXL_LOOP_UNROLL_4
+        for (size_t k = 0; k < half; ++k) {
+          InvButterflyRadix2(&x[k], &x[k + half], W_op[radix - 2],
+                             W_precon[radix - 2], modulus, twice_mod);
+        }
+      }
+
+      HEXL_LOOP_UNROLL_8
+      for (size_t k = 0; k < radix; ++k) {
+        X_r[j + k * t] = x[k];
+      }
+    }
+  }
+}
+
+}  // namespace
+
+template <int LogRadix>
+void ForwardTransformToBitReverseRadix(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK_BOUNDS(operand, n, modulus * input_mod_factor,
+                    "operand exceeds bound " << modulus * input_mod_factor);
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_root_of_unity_powers != nullptr,
+             "precon_root_of_unity_powers == nullptr");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+  static_assert(LogRadix == 2 || LogRadix == 3, "LogRadix must be 2 or 3");
+
+  const bool reduce_output = (output_mod_factor == 1);
+  if (n == 1) {
+    uint64_t twice_mod = modulus << 1;
+    result[0] = reduce_output ? ReduceMod<4>(operand[0], modulus, &twice_mod)
+                              : operand[0];
+    return;
+  }
+
+  const size_t num_stages = Log2(n);
+  size_t num_passes = num_stages / LogRadix;
+  size_t m = 1;
+  size_t t = n >> 1;
+
+  // The first pass reads from operand, the others from result
+  const uint64_t* input = operand;
+
+  // Stages left over by the full-radix passes run first, in a smaller pass
+  switch (num_stages % LogRadix) {
+    case 1:
+      FwdRadixPass<1>(result, input, m, t, modulus, root_of_unity_powers,
+                      precon_root_of_unity_powers,
+                      reduce_output && num_passes == 0);
+      m <<= 1;
+      t >>= 1;
+      input = result;
+      break;
+    case 2:
+      FwdRadixPass<2>(result, input, m, t, modulus, root_of_unity_powers,
+                      precon_root_of_unity_powers,
+                      reduce_output && num_passes == 0);
+      m <<= 2;
+      t >>= 2;
+      input = result;
+      break;
+  }
+
+  for (; num_passes > 0; --num_passes) {
+    FwdRadixPass<LogRadix>(result, input, m, t, modulus, root_of_unity_powers,
+                           precon_root_of_unity_powers,
+                           reduce_output && num_passes == 1);
+    m <<= LogRadix;
+    t >>= LogRadix;
+    input = result;
+  }
+
+  if (reduce_output) {
+    HEXL_CHECK_BOUNDS(result, n, modulus,
+                      "Incorrect modulus reduction in NTT");
+  }
+}
+
+template <int LogRadix>
+void InverseTransformFromBitReverseRadix(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_inv_root_of_unity_powers != nullptr,
+             "precon_inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+  static_assert(LogRadix == 2 || LogRadix == 3, "LogRadix must be 2 or 3");
+
+  const bool reduce_output = (output_mod_factor == 1);
+  if (n == 1) {
+    result[0] = reduce_output ? ReduceMod<2>(operand[0], modulus) : operand[0];
+    return;
+  }
+
+  const size_t num_stages = Log2(n);
+  size_t m = n >> 1;
+  size_t t = 1;
+
+  // The first pass reads from operand, the others from result
+  const uint64_t* input = operand;
+
+  // Stages left over by the full-radix passes run first, in a smaller pass.
+  // The last pass always ends with the final stage, which scales by 1/n.
+  switch (num_stages % LogRadix) {
+    case 1:
+      InvRadixPass<1>(result, input, n, m, t, modulus,
+                      inv_root_of_unity_powers,
+                      precon_inv_root_of_unity_powers, reduce_output);
+      m >>= 1;
+      t <<= 1;
+      input = result;
+      break;
+    case 2:
+      InvRadixPass<2>(result, input, n, m, t, modulus,
+                      inv_root_of_unity_powers,
+                      precon_inv_root_of_unity_powers, reduce_output);
+      m >>= 2;
+      t <<= 2;
+      input = result;
+      break;
+  }
+
+  for (; m > 0; m >>= LogRadix, t <<= LogRadix) {
+    InvRadixPass<LogRadix>(result, input, n, m, t, modulus,
+                           inv_root_of_unity_powers,
+                           precon_inv_root_of_unity_powers, reduce_output);
+    input = result;
+  }
+
+  if (reduce_output) {
+    HEXL_CHECK_BOUNDS(result, n, modulus,
+                      "Incorrect modulus reduction in InvNTT");
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,66 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Native forward NTT computing several radix-2 stages per pass over
+/// the data
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first pass only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers 64-bit pre-conditioned powers of
+/// 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Each pass loads 2^LogRadix elements into registers, applies
+/// LogRadix stages of Harvey butterflies to them and stores them back, so the
+/// transform makes ceil(log2(n) / LogRadix) passes over the data instead of
+/// log2(n). The final reduction to [0, q) is merged into the last pass.
+/// LogRadix must be 2 (radix-4) or 3 (radix-8).
+template <int LogRadix>
+void ForwardTransformToBitReverseRadix(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor = 1,
+    uint64_t output_mod_factor = 1);
+
+/// @brief Native inverse NTT computing several radix-2 stages per pass over
+/// the data
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first pass only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] inv_root_of_unity_powers Powers of inverse 2n'th root of unity
+/// in F_q. In bit-reversed order.
+/// @param[in] precon_inv_root_of_unity_powers 64-bit pre-conditioned powers of
+/// inverse 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Mirrors ForwardTransformToBitReverseRadix. The last pass also
+/// multiplies by 1/n and reduces the result. LogRadix must be 2 (radix-4) or
+/// 3 (radix-8).
+template <int LogRadix>
+void InverseTransformFromBitReverseRadix(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t modulus,
+    const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor = 1, uint64_t output_mod_factor = 1);
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,326 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/ntt-strided.hpp"
+
+#include <algorithm>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx512.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Permutes the rows of a column-wise batch into bit-reversed order. Rows are
+// copied from operand to result, which may be equal.
+void BitReversePermuteRows(uint64_t* result, const uint64_t* operand,
+                           uint64_t n, uint64_t batch_size, uint64_t stride) {
+  uint64_t log_n = Log2(n);
+  for (size_t i = 0; i < n; ++i) {
+    size_t rev_i = ReverseBits(i, log_n);
+    if (result == operand) {
+      if (i < rev_i) {
+        std::swap_ranges(result + i * stride, result + i * stride + batch_size,
+                         result + rev_i * stride);
+      }
+    } else {
+      std::copy(operand + rev_i * stride, operand + rev_i * stride + batch_size,
+                result + i * stride);
+    }
+  }
+}
+
+}  // namespace
+
+void NTT::ComputeForwardStrided(uint64_t* result, const uint64_t* operand,
+                                uint64_t batch_size, uint64_t stride,
+                                uint64_t input_mod_factor,
+                                uint64_t output_mod_factor,
+                                Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2 or 4; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+  for (size_t i = 0; i < m_degree; ++i) {
+    HEXL_CHECK_BOUNDS(
+        operand + i * stride, batch_size, m_q * input_mod_factor,
+        "value in operand exceeds bound " << m_q * input_mod_factor);
+  }
+
+  ForwardToBitReverseStrided(result, operand, batch_size, stride,
+                             input_mod_factor, output_mod_factor);
+  if (output_order == Ordering::kNatural) {
+    BitReversePermuteRows(result, result, m_degree, batch_size, stride);
+  }
+}
+
+void NTT::ForwardToBitReverseStrided(uint64_t* result, const uint64_t* operand,
+                                     uint64_t batch_size, uint64_t stride,
+                                     uint64_t input_mod_factor,
+                                     uint64_t output_mod_factor) {
+  const uint64_t* root_of_unity_powers =
+      m_tables->Data(NTTTables::kRootOfUnityPowers);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    if (m_q < s_max_fwd_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX512-DQ strided FwdNTT");
+      ForwardTransformToBitReverseStridedAVX512<32>(
+          result, operand, m_degree, batch_size, stride, m_q,
+          root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX512-DQ strided FwdNTT");
+      ForwardTransformToBitReverseStridedAVX512<s_default_shift_bits>(
+          result, operand, m_degree, batch_size, stride, m_q,
+          root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64RootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling 64-bit default strided FwdNTT");
+  ForwardTransformToBitReverseStrided64(
+      result, operand, m_degree, batch_size, stride, m_q, root_of_unity_powers,
+      m_tables->Data(NTTTables::kPrecon64RootOfUnityPowers), input_mod_factor,
+      output_mod_factor);
+}
+
+void NTT::ComputeInverseStrided(uint64_t* result, const uint64_t* operand,
+                                uint64_t batch_size, uint64_t stride,
+                                uint64_t input_mod_factor,
+                                uint64_t output_mod_factor,
+                                Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+  HEXL_CHECK(batch_size > 0, "batch_size == 0");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+  for (size_t i = 0; i < m_degree; ++i) {
+    HEXL_CHECK_BOUNDS(operand + i * stride, batch_size,
+                      m_q * input_mod_factor,
+                      "operand exceeds bound " << m_q * input_mod_factor);
+  }
+
+  // Natural-order inputs are permuted into result, and transformed in-place
+  if (input_order == Ordering::kNatural) {
+    BitReversePermuteRows(result, operand, m_degree, batch_size, stride);
+    operand = result;
+  }
+
+  InverseFromBitReverseStrided(result, operand, batch_size, stride,
+                               input_mod_factor, output_mod_factor);
+}
+
+void NTT::InverseFromBitReverseStrided(uint64_t* result,
+                                       const uint64_t* operand,
+                                       uint64_t batch_size, uint64_t stride,
+                                       uint64_t input_mod_factor,
+                                       uint64_t output_mod_factor) {
+  const uint64_t* inv_root_of_unity_powers =
+      m_tables->Data(NTTTables::kInvRootOfUnityPowers);
+
+#ifdef HEXL_HAS_AVX512DQ
+  if (has_avx512dq) {
+    if (m_q < s_max_inv_32_modulus) {
+      HEXL_VLOG(3, "Calling 32-bit AVX512-DQ strided InvNTT");
+      InverseTransformFromBitReverseStridedAVX512<32>(
+          result, operand, m_degree, batch_size, stride, m_q,
+          inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon32InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    } else {
+      HEXL_VLOG(3, "Calling 64-bit AVX512-DQ strided InvNTT");
+      InverseTransformFromBitReverseStridedAVX512<s_default_shift_bits>(
+          result, operand, m_degree, batch_size, stride, m_q,
+          inv_root_of_unity_powers,
+          m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers),
+          input_mod_factor, output_mod_factor);
+    }
+    return;
+  }
+#endif
+
+  HEXL_VLOG(3, "Calling 64-bit default strided InvNTT");
+  InverseTransformFromBitReverseStrided64(
+      result, operand, m_degree, batch_size, stride, m_q,
+      inv_root_of_unity_powers,
+      m_tables->Data(NTTTables::kPrecon64InvRootOfUnityPowers),
+      input_mod_factor, output_mod_factor);
+}
+
+void ForwardTransformToBitReverseStrided64(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(root_of_unity_powers != nullptr,
+             "root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_root_of_unity_powers != nullptr,
+             "precon_root_of_unity_powers == nullptr");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  uint64_t twice_mod = modulus << 1;
+  size_t t = (n >> 1);
+
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
+  for (size_t m = 1; m < n; m <<= 1) {
+    for (size_t i = 0; i < m; i++) {
+      const uint64_t W_op = root_of_unity_powers[m + i];
+      const uint64_t W_precon = precon_root_of_unity_powers[m + i];
+
+      for (size_t j = 2 * i * t; j < (2 * i + 1) * t; j++) {
+        const uint64_t* X_op = input + j * stride;
+        const uint64_t* Y_op = X_op + t * stride;
+        uint64_t* X_r = result + j * stride;
+        uint64_t* Y_r = X_r + t * stride;
+
+        HEXL_LOOP_UNROLL_8
+        for (size_t k = 0; k < batch_size; k++) {
+          // Harvey butterfly as in ForwardTransformToBitReverse64
+          uint64_t tx =
+              (X_op[k] >= twice_mod) ? (X_op[k] - twice_mod) : X_op[k];
+          uint64_t T = MultiplyModLazy<64>(Y_op[k], W_op, W_precon, modulus);
+          X_r[k] = tx + T;
+          Y_r[k] = tx + twice_mod - T;
+        }
+      }
+    }
+    t >>= 1;
+    input = result;
+  }
+
+  if (output_mod_factor == 1 || input != result) {
+    for (size_t i = 0; i < n; ++i) {
+      const uint64_t* X_op = input + i * stride;
+      uint64_t* X_r = result + i * stride;
+      for (size_t k = 0; k < batch_size; ++k) {
+        X_r[k] = (output_mod_factor == 1)
+                     ? ReduceMod<4>(X_op[k], modulus, &twice_mod)
+                     : X_op[k];
+      }
+    }
+  }
+}
+
+void InverseTransformFromBitReverseStrided64(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(stride >= batch_size,
+             "stride " << stride << " less than batch_size " << batch_size);
+  HEXL_CHECK(inv_root_of_unity_powers != nullptr,
+             "inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(precon_inv_root_of_unity_powers != nullptr,
+             "precon_inv_root_of_unity_powers == nullptr");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  if (n == 1) {
+    for (size_t k = 0; k < batch_size; ++k) {
+      result[k] = (output_mod_factor == 1) ? ReduceMod<2>(operand[k], modulus)
+                                           : operand[k];
+    }
+    return;
+  }
+
+  uint64_t twice_mod = modulus << 1;
+  size_t t = 1;
+  size_t root_index = 1;
+
+  // The first stage reads from operand, the others from result
+  const uint64_t* input = operand;
+  for (size_t m = (n >> 1); m > 1; m >>= 1) {
+    for (size_t i = 0; i < m; i++, root_index++) {
+      const uint64_t W_op = inv_root_of_unity_powers[root_index];
+      const uint64_t W_precon = precon_inv_root_of_unity_powers[root_index];
+
+      for (size_t j = 2 * i * t; j < (2 * i + 1) * t; j++) {
+        const uint64_t* X_op = input + j * stride;
+        const uint64_t* Y_op = X_op + t * stride;
+        uint64_t* X_r = result + j * stride;
+        uint64_t* Y_r = X_r + t * stride;
+
+        HEXL_LOOP_UNROLL_8
+        for (size_t k = 0; k < batch_size; k++) {
+          // Harvey butterfly as in InverseTransformFromBitReverse64
+          uint64_t tx = X_op[k] + Y_op[k];
+          uint64_t ty = X_op[k] + twice_mod - Y_op[k];
+          X_r[k] = (tx >= twice_mod) ? (tx - twice_mod) : tx;
+          Y_r[k] = MultiplyModLazy<64>(ty, W_op, W_precon, modulus);
+        }
+      }
+    }
+    t <<= 1;
+    input = result;
+  }
+
+  // The final stage also multiplies by 1/n
+  const uint64_t W_op = inv_root_of_unity_powers[root_index];
+  MultiplyFactor mf_inv_n(InverseMod(n, modulus), 64, modulus);
+  MultiplyFactor mf_inv_n_w(MultiplyMod(mf_inv_n.Operand(), W_op, modulus), 64,
+                            modulus);
+
+  for (size_t j = 0; j < (n >> 1); ++j) {
+    const uint64_t* X_op = input + j * stride;
+    const uint64_t* Y_op = X_op + (n >> 1) * stride;
+    uint64_t* X_r = result + j * stride;
+    uint64_t* Y_r = X_r + (n >> 1) * stride;
+
+    for (size_t k = 0; k < batch_size; ++k) {
+      uint64_t tx = X_op[k] + Y_op[k];
+      if (tx >= twice_mod) {
+        tx -= twice_mod;
+      }
+      uint64_t ty = X_op[k] + twice_mod - Y_op[k];
+      X_r[k] = MultiplyModLazy<64>(tx, mf_inv_n.Operand(),
+                                   mf_inv_n.BarrettFactor(), modulus);
+      Y_r[k] = MultiplyModLazy<64>(ty, mf_inv_n_w.Operand(),
+                                   mf_inv_n_w.BarrettFactor(), modulus);
+      if (output_mod_factor == 1) {
+        // Reduce from [0, 2q) to [0,q)
+        X_r[k] = (X_r[k] >= modulus) ? X_r[k] - modulus : X_r[k];
+        Y_r[k] = (Y_r[k] >= modulus) ? Y_r[k] - modulus : Y_r[k];
+      }
+    }
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,67 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Native forward NTT of a batch of polynomials stored column-wise,
+/// i.e. coefficient i of polynomial j at index i * stride + j
+/// @param[out] result Stores the NTT output in the same layout. May equal \p
+/// operand; otherwise must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] batch_size Number of polynomials, at least 1
+/// @param[in] stride Distance between consecutive coefficients of a
+/// polynomial. Must be at least \p batch_size.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers 64-bit pre-conditioned powers of
+/// 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Each butterfly combines two rows of \p batch_size coefficients
+/// with the same root of unity, so the innermost loop runs over contiguous
+/// memory. The evaluations of each polynomial are in bit-reversed order along
+/// the rows.
+void ForwardTransformToBitReverseStrided64(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* root_of_unity_powers,
+    const uint64_t* precon_root_of_unity_powers, uint64_t input_mod_factor = 1,
+    uint64_t output_mod_factor = 1);
+
+/// @brief Native inverse NTT of a batch of polynomials stored column-wise,
+/// i.e. coefficient i of polynomial j at index i * stride + j
+/// @param[out] result Stores the NTT output in the same layout. May equal \p
+/// operand; otherwise must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two.
+/// @param[in] batch_size Number of polynomials, at least 1
+/// @param[in] stride Distance between consecutive coefficients of a
+/// polynomial. Must be at least \p batch_size.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n
+/// @param[in] inv_root_of_unity_powers Powers of inverse 2n'th root of unity
+/// in F_q. In bit-reversed order.
+/// @param[in] precon_inv_root_of_unity_powers 64-bit pre-conditioned powers of
+/// inverse 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Mirrors ForwardTransformToBitReverseStrided64
+void InverseTransformFromBitReverseStrided64(
+    uint64_t* result, const uint64_t* operand, uint64_t n, uint64_t batch_size,
+    uint64_t stride, uint64_t modulus, const uint64_t* inv_root_of_unity_powers,
+    const uint64_t* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor = 1, uint64_t output_mod_factor = 1);
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,338 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/ntt-tables.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Stores base^ReverseBits(i, log2(n)) mod modulus in result[i], for i in
+// [0, n), where base is a primitive 2n'th root of unity.
+void ComputeBitReversedPowers(uint64_t base, uint64_t n, uint64_t modulus,
+                              uint64_t* result) {
+  // Writing i = m + j with m a power of two and j < m gives
+  // result[m + j] = result[m] * result[j], where result[m] = base^(n / 2m).
+  // So each block [m, 2m) is the previous blocks scaled by a single factor,
+  // which avoids a serial chain of multiplications and scattered stores.
+  result[0] = 1;
+  uint64_t power = base;
+  for (size_t m = n >> 1; m > 0; m >>= 1) {
+    result[m] = power;
+    power = MultiplyMod(power, power, modulus);
+  }
+  for (size_t m = 2; m < n; m <<= 1) {
+    uint64_t factor = result[m];
+    uint64_t factor_precon =
+        MultiplyFactor(factor, 64, modulus).BarrettFactor();
+    for (size_t j = 1; j < m; ++j) {
+      result[m + j] = MultiplyMod(result[j], factor, factor_precon, modulus);
+    }
+  }
+}
+
+// Stores twist^(n / 2m) * root^ReverseBits(i, log2(n / 2)) mod modulus in
+// result[m + i], for each power of two m < n and i in [0, m), and 1 in
+// result[0]. These are the twiddle factors of a Cooley-Tukey transform
+// evaluating at twist * root^j, with the twist merged into the butterflies.
+void ComputeTwistedBitReversedPowers(uint64_t root, uint64_t twist, uint64_t n,
+                                     uint64_t modulus, uint64_t* result) {
+  if (MultiplyMod(twist, twist, modulus) == root) {
+    // twist^(n / 2m) * twist^(2 * ReverseBits(i, log2(n / 2))) is
+    // twist^ReverseBits(m + i, log2(n)), e.g. for negacyclic transforms
+    ComputeBitReversedPowers(twist, n, modulus, result);
+    return;
+  }
+  result[0] = 1;
+  if (n == 1) {
+    return;
+  }
+
+  // The last block holds root^ReverseBits(i, log2(n / 2)). Each other block
+  // [m, 2m) is a prefix of it, scaled by twist^(n / 2m).
+  uint64_t* last_block = result + n / 2;
+  ComputeBitReversedPowers(root, n / 2, modulus, last_block);
+  std::vector<uint64_t> factors;  // twist^(n / 2m), for m = n / 2, ..., 1
+  uint64_t factor = twist;
+  for (size_t m = n >> 1; m > 0; m >>= 1) {
+    factors.push_back(factor);
+    factor = MultiplyMod(factor, factor, modulus);
+  }
+  // Scale the last block in-place after the other blocks have read it
+  for (size_t m = 1, k = factors.size(); m < n; m <<= 1) {
+    uint64_t block_factor = factors[--k];
+    uint64_t block_factor_precon =
+        MultiplyFactor(block_factor, 64, modulus).BarrettFactor();
+    for (size_t i = 0; i < m; ++i) {
+      result[m + i] = MultiplyMod(last_block[i], block_factor,
+                                  block_factor_precon, modulus);
+    }
+  }
+}
+
+// Stores floor(operands[i] * 2^bit_shift / modulus) in result[i], for i in
+// [0, n). Avoids a 128-bit division per element by multiplying with a
+// pre-computed 128-bit reciprocal of the modulus, then correcting the
+// quotient, which is off by at most one.
+void ComputeBarrettFactors(const uint64_t* operands, uint64_t n,
+                           uint64_t bit_shift, uint64_t modulus,
+                           uint64_t* result) {
+  HEXL_CHECK(bit_shift == 32 || bit_shift == 52 || bit_shift == 64,
+             "Unsupported BitShift " << bit_shift);
+  HEXL_CHECK(modulus < (1ULL << 63), "modulus " << modulus << " too large");
+
+  // recip_hi * 2^64 + recip_lo == floor(2^128 / modulus)
+  uint64_t recip_hi = DivideUInt128UInt64Lo(1, 0, modulus);
+  uint64_t recip_rem = 0 - recip_hi * modulus;
+  uint64_t recip_lo = DivideUInt128UInt64Lo(recip_rem, 0, modulus);
+
+  for (size_t i = 0; i < n; ++i) {
+    uint64_t x = operands[i];
+    HEXL_CHECK(x < modulus, "operand " << x << " >= modulus " << modulus);
+    uint64_t quotient = x * recip_hi + MultiplyUInt64Hi<64>(x, recip_lo);
+    // The remainder x * 2^64 - quotient * modulus is in [0, 2 * modulus)
+    uint64_t remainder = 0 - quotient * modulus;
+    if (remainder >= modulus) {
+      ++quotient;
+    }
+    result[i] = quotient >> (64 - bit_shift);
+  }
+}
+
+// Returns true if table holds 32-bit values
+bool IsU32Table(NTTTables::Table table) {
+  return table >= NTTTables::kRootOfUnityPowersU32 &&
+         table <= NTTTables::kPrecon32InvRootOfUnityPowersU32;
+}
+
+}  // namespace
+
+NTTTables::NTTTables(uint64_t degree, uint64_t q, uint64_t root_of_unity,
+                     uint64_t twist,
+                     const AlignedAllocator<uint64_t, 64>& alloc)
+    : m_degree(degree), m_q(q), m_root(root_of_unity), m_twist(twist) {
+  for (auto& table : m_tables) {
+    table.reset(new LazyTable(alloc));
+  }
+}
+
+void NTTTables::SetExternal(Table table, const uint64_t* data, size_t size,
+                            const std::shared_ptr<const void>& owner) {
+  HEXL_CHECK(table < kNumTables, "Invalid table " << table);
+  HEXL_CHECK(m_external_owner == nullptr || m_external_owner == owner,
+             "External tables must share the same owner");
+  m_external_owner = owner;
+  LazyTable& lazy = *m_tables[table];
+  // Marks the table as built, so it is never computed
+  std::call_once(lazy.once, [] {});
+  lazy.data = data;
+  lazy.size = size;
+  lazy.external = true;
+  lazy.built.store(true, std::memory_order_release);
+}
+
+const NTTTables::LazyTable& NTTTables::Built(Table table) const {
+  HEXL_CHECK(table < kNumTables, "Invalid table " << table);
+  LazyTable& lazy = *m_tables[table];
+  std::call_once(lazy.once, [&] {
+    HEXL_VLOG(3, "Building NTT table " << Name(table));
+    Build(table, &lazy.values);
+    lazy.data = lazy.values.data();
+    lazy.size = lazy.values.size();
+    lazy.built.store(true, std::memory_order_release);
+  });
+  return lazy;
+}
+
+const uint64_t* NTTTables::Data(Table table) const {
+  return Built(table).data;
+}
+
+const uint32_t* NTTTables::Data32(Table table) const {
+  HEXL_CHECK(IsU32Table(table), "Table " << Name(table) << " is not 32-bit");
+  return reinterpret_cast<const uint32_t*>(Built(table).data);
+}
+
+size_t NTTTables::Size(Table table) const { return Built(table).size; }
+
+const AlignedVector64<uint64_t>& NTTTables::Get(Table table) const {
+  LazyTable& lazy = *m_tables[table];
+  Built(table);
+  if (lazy.external) {
+    std::call_once(lazy.copy_once, [&] {
+      lazy.values.assign(lazy.data, lazy.data + lazy.size);
+    });
+  }
+  return lazy.values;
+}
+
+bool NTTTables::IsBuilt(Table table) const {
+  HEXL_CHECK(table < kNumTables, "Invalid table " << table);
+  return m_tables[table]->built.load(std::memory_order_acquire);
+}
+
+size_t NTTTables::MemoryBytes(Table table) const {
+  if (!IsBuilt(table)) {
+    return 0;
+  }
+  return m_tables[table]->size * sizeof(uint64_t);
+}
+
+size_t NTTTables::MemoryBytes() const {
+  size_t bytes = 0;
+  for (size_t table = 0; table < kNumTables; ++table) {
+    bytes += MemoryBytes(static_cast<Table>(table));
+  }
+  return bytes;
+}
+
+const char* NTTTables::Name(Table table) {
+  static const char* names[kNumTables] = {
+      "RootOfUnityPowers",
+      "Precon32RootOfUnityPowers",
+      "Precon64RootOfUnityPowers",
+      "AVX512RootOfUnityPowers",
+      "AVX512Precon32RootOfUnityPowers",
+      "AVX512Precon52RootOfUnityPowers",
+      "AVX512Precon64RootOfUnityPowers",
+      "InvRootOfUnityPowers",
+      "Precon32InvRootOfUnityPowers",
+      "Precon52InvRootOfUnityPowers",
+      "Precon64InvRootOfUnityPowers",
+      "RootOfUnityPowersU32",
+      "Precon32RootOfUnityPowersU32",
+      "InvRootOfUnityPowersU32",
+      "Precon32InvRootOfUnityPowersU32"};
+  HEXL_CHECK(table < kNumTables, "Invalid table " << table);
+  return names[table];
+}
+
+size_t NTTTables::TableSize(Table table, uint64_t degree) {
+  HEXL_CHECK(table < kNumTables, "Invalid table " << table);
+  if (table >= kAVX512RootOfUnityPowers &&
+      table <= kAVX512Precon64RootOfUnityPowers) {
+    // Roots at indices [N/8, N/4) appear four times; roots at indices
+    // [N/4, N/2) appear twice
+    return degree / 8 + 4 * (degree / 4 - degree / 8) +
+           2 * (degree / 2 - degree / 4) + (degree - degree / 2);
+  }
+  if (IsU32Table(table)) {
+    return (degree + 1) / 2;
+  }
+  return degree;
+}
+
+void NTTTables::Build(Table table, AlignedVector64<uint64_t>* values) const {
+  auto compute_barrett_vector = [&](Table source, uint64_t bit_shift) {
+    values->resize(Size(source));
+    ComputeBarrettFactors(Data(source), Size(source), bit_shift, m_q,
+                          values->data());
+  };
+  // Moduli of 32-bit transforms are below 2^30, so narrowing is exact;
+  // other moduli never read the U32 tables
+  auto narrow_vector = [&](Table source) {
+    const uint64_t* wide = Data(source);
+    std::vector<uint32_t> narrow(m_degree);
+    for (size_t i = 0; i < m_degree; ++i) {
+      narrow[i] = static_cast<uint32_t>(wide[i]);
+    }
+    values->resize(TableSize(table, m_degree), 0);
+    std::memcpy(values->data(), narrow.data(), m_degree * sizeof(uint32_t));
+  };
+
+  switch (table) {
+    case kRootOfUnityPowers: {
+      values->resize(m_degree);
+      ComputeTwistedBitReversedPowers(m_root, m_twist, m_degree, m_q,
+                                      values->data());
+      break;
+    }
+    case kAVX512RootOfUnityPowers: {
+      // Duplicate each root of unity at indices [N/8, N/4) four times, and
+      // each root of unity at indices [N/4, N/2) twice.
+      // These are the roots of unity used in the FwdNTT FwdT4 and FwdT2
+      // functions. By creating these duplicates, we avoid extra permutations
+      // while loading the roots of unity
+      const uint64_t* roots = Data(kRootOfUnityPowers);
+      values->reserve(TableSize(kAVX512RootOfUnityPowers, m_degree));
+      for (size_t i = 0; i < m_degree / 8; ++i) {
+        values->push_back(roots[i]);
+      }
+      for (size_t i = m_degree / 8; i < m_degree / 4; ++i) {
+        values->insert(values->end(), 4, roots[i]);
+      }
+      for (size_t i = m_degree / 4; i < m_degree / 2; ++i) {
+        values->insert(values->end(), 2, roots[i]);
+      }
+      for (size_t i = m_degree / 2; i < m_degree; ++i) {
+        values->push_back(roots[i]);
+      }
+      break;
+    }
+    case kInvRootOfUnityPowers: {
+      // Inverses of the root of unity powers, reordered to match the order
+      // of access in the inverse transform. The inverse of w^k is (w^-1)^k,
+      // so only the root and twist need a modular inverse.
+      std::vector<uint64_t> inv_roots(m_degree);
+      ComputeTwistedBitReversedPowers(InverseMod(m_root, m_q),
+                                      InverseMod(m_twist, m_q), m_degree, m_q,
+                                      inv_roots.data());
+      values->reserve(m_degree);
+      values->push_back(inv_roots[0]);
+      for (size_t m = (m_degree >> 1); m > 0; m >>= 1) {
+        values->insert(values->end(), inv_roots.begin() + m,
+                       inv_roots.begin() + 2 * m);
+      }
+      break;
+    }
+    case kPrecon32RootOfUnityPowers:
+      compute_barrett_vector(kRootOfUnityPowers, 32);
+      break;
+    case kPrecon64RootOfUnityPowers:
+      compute_barrett_vector(kRootOfUnityPowers, 64);
+      break;
+    case kAVX512Precon32RootOfUnityPowers:
+      compute_barrett_vector(kAVX512RootOfUnityPowers, 32);
+      break;
+    case kAVX512Precon52RootOfUnityPowers:
+      compute_barrett_vector(kAVX512RootOfUnityPowers, 52);
+      break;
+    case kAVX512Precon64RootOfUnityPowers:
+      compute_barrett_vector(kAVX512RootOfUnityPowers, 64);
+      break;
+    case kPrecon32InvRootOfUnityPowers:
+      compute_barrett_vector(kInvRootOfUnityPowers, 32);
+      break;
+    case kPrecon52InvRootOfUnityPowers:
+      compute_barrett_vector(kInvRootOfUnityPowers, 52);
+      break;
+    case kPrecon64InvRootOfUnityPowers:
+      compute_barrett_vector(kInvRootOfUnityPowers, 64);
+      break;
+    case kRootOfUnityPowersU32:
+      narrow_vector(kRootOfUnityPowers);
+      break;
+    case kPrecon32RootOfUnityPowersU32:
+      narrow_vector(kPrecon32RootOfUnityPowers);
+      break;
+    case kInvRootOfUnityPowersU32:
+      narrow_vector(kInvRootOfUnityPowers);
+      break;
+    case kPrecon32InvRootOfUnityPowersU32:
+      narrow_vector(kPrecon32InvRootOfUnityPowers);
+      break;
+    default:
+      HEXL_CHECK(false, "Invalid table " << table);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,137 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "hexl/util/aligned-allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Pre-computed root of unity tables of an NTT object
+/// @details Each table is built on first use, so only the tables read by the
+/// selected forward and inverse implementations take up memory. Once built, a
+/// table is never modified, so a single NTTTables object can be shared by
+/// every NTT object with the same degree, modulus and root of unity.
+class NTTTables {
+ public:
+  /// @brief Identifies one of the pre-computed tables. See the corresponding
+  /// NTT getters for a description of each table.
+  enum Table : size_t {
+    kRootOfUnityPowers,
+    kPrecon32RootOfUnityPowers,
+    kPrecon64RootOfUnityPowers,
+    kAVX512RootOfUnityPowers,
+    kAVX512Precon32RootOfUnityPowers,
+    kAVX512Precon52RootOfUnityPowers,
+    kAVX512Precon64RootOfUnityPowers,
+    kInvRootOfUnityPowers,
+    kPrecon32InvRootOfUnityPowers,
+    kPrecon52InvRootOfUnityPowers,
+    kPrecon64InvRootOfUnityPowers,
+    // 32-bit copies of the tables above for moduli below 2^30, packed two
+    // values per 64-bit word
+    kRootOfUnityPowersU32,
+    kPrecon32RootOfUnityPowersU32,
+    kInvRootOfUnityPowersU32,
+    kPrecon32InvRootOfUnityPowersU32,
+    kNumTables
+  };
+
+  /// @brief Initializes the tables of a transform evaluating at \p twist
+  /// times the powers of \p root_of_unity. Doesn't compute any table.
+  /// @param[in] degree Size N of the transform
+  /// @param[in] q Prime modulus
+  /// @param[in] root_of_unity Primitive N'th root of unity
+  /// @param[in] twist Non-zero twist. Negacyclic transforms use a 2N'th root
+  /// of unity whose square is \p root_of_unity; cyclic transforms use 1.
+  /// @param[in] alloc Allocator for the computed tables
+  NTTTables(uint64_t degree, uint64_t q, uint64_t root_of_unity,
+            uint64_t twist, const AlignedAllocator<uint64_t, 64>& alloc);
+
+  NTTTables(const NTTTables&) = delete;
+  NTTTables& operator=(const NTTTables&) = delete;
+
+  /// @brief Sets \p table to the \p size values at \p data, which must stay
+  /// valid while \p owner is alive. Must be called before the tables are
+  /// shared with other threads.
+  void SetExternal(Table table, const uint64_t* data, size_t size,
+                   const std::shared_ptr<const void>& owner);
+
+  /// @brief Returns a pointer to the values of \p table, building it first if
+  /// needed. Thread-safe.
+  const uint64_t* Data(Table table) const;
+
+  /// @brief Returns a pointer to the 32-bit values of \p table, which must be
+  /// one of the U32 tables, building it first if needed. Thread-safe.
+  const uint32_t* Data32(Table table) const;
+
+  /// @brief Returns the number of values in \p table, building it first if
+  /// needed. Thread-safe.
+  size_t Size(Table table) const;
+
+  /// @brief Returns \p table, building it first if needed. Thread-safe.
+  /// @details External tables are copied on first call
+  const AlignedVector64<uint64_t>& Get(Table table) const;
+
+  /// @brief Returns true if \p table has been built or set externally.
+  /// Doesn't build the table. Thread-safe.
+  bool IsBuilt(Table table) const;
+
+  /// @brief Returns the number of bytes used by \p table, or 0 if the table
+  /// has not been built
+  size_t MemoryBytes(Table table) const;
+
+  /// @brief Returns the number of bytes used by all built tables
+  size_t MemoryBytes() const;
+
+  /// @brief Returns a human-readable name of \p table
+  static const char* Name(Table table);
+
+  /// @brief Returns the number of values in \p table for an NTT of degree \p
+  /// degree
+  static size_t TableSize(Table table, uint64_t degree);
+
+ private:
+  struct LazyTable {
+    explicit LazyTable(const AlignedAllocator<uint64_t, 64>& alloc)
+        : values(alloc) {}
+
+    std::once_flag once;
+    std::atomic<bool> built{false};
+    AlignedVector64<uint64_t> values;
+
+    // Points to values, or to external memory such as a memory-mapped file
+    const uint64_t* data{nullptr};
+    size_t size{0};
+
+    bool external{false};
+    std::once_flag copy_once;  // Copies external memory into values
+  };
+
+  // Builds \p table if needed and returns it
+  const LazyTable& Built(Table table) const;
+
+  // Computes the values of \p table into \p values
+  void Build(Table table, AlignedVector64<uint64_t>* values) const;
+
+  uint64_t m_degree;  // N: size of NTT transform, should be power of 2
+  uint64_t m_q;       // prime modulus. Must satisfy q == 1 mod 2n
+  uint64_t m_root;    // A primitive N'th root of unity
+  uint64_t m_twist;   // Twist applied to the inputs of the forward transform
+
+  std::array<std::unique_ptr<LazyTable>, kNumTables> m_tables;
+
+  // Keeps the memory of external tables alive
+  std::shared_ptr<const void> m_external_owner;
+};
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,112 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/aligned-allocator.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Smallest and largest candidate breadth-first sizes. Below the smallest, the
+// recursion overhead dominates; above the largest, the breadth-first stages
+// no longer fit in the L2 cache on any supported processor.
+const size_t s_min_tuned_base_ntt_size = 64;
+const size_t s_max_tuned_base_ntt_size = 1ULL << 16;
+
+// Number of coefficients transformed per candidate, to keep the measurements
+// of small transforms above the timer resolution
+const size_t s_tune_num_coeffs = 1ULL << 20;
+
+// Degree, modulus bit width and number of threads
+using TuneKey = std::tuple<uint64_t, uint64_t, uint64_t>;
+
+std::mutex& TuneCacheMutex() {
+  static std::mutex* mutex = new std::mutex;
+  return *mutex;
+}
+
+// Intentionally leaked, like the table cache
+std::map<TuneKey, size_t>& TuneCache() {
+  static std::map<TuneKey, size_t>* cache = new std::map<TuneKey, size_t>;
+  return *cache;
+}
+
+}  // namespace
+
+size_t NTT::TuneBaseNTTSize() {
+#ifdef HEXL_HAS_AVX512DQ
+  if (!has_avx512dq || m_degree <= s_min_tuned_base_ntt_size) {
+    return m_base_ntt_size;
+  }
+
+  TuneKey key{m_degree, MSB(m_q) + 1, GetNumThreads()};
+  {
+    std::lock_guard<std::mutex> lock(TuneCacheMutex());
+    auto it = TuneCache().find(key);
+    if (it != TuneCache().end()) {
+      m_base_ntt_size = it->second;
+      return m_base_ntt_size;
+    }
+  }
+
+  // Measure without holding the lock; concurrent tuners of the same key
+  // may both measure, and the last one wins
+  AlignedVector64<uint64_t> operand(m_degree, 0, m_aligned_alloc);
+  for (size_t i = 0; i < m_degree; ++i) {
+    operand[i] = i % m_q;
+  }
+  size_t reps = std::max(size_t(3), s_tune_num_coeffs / m_degree);
+
+  size_t max_base_ntt_size =
+      std::min(static_cast<size_t>(m_degree), s_max_tuned_base_ntt_size);
+  size_t best_base_ntt_size = m_base_ntt_size;
+  auto best_time = std::chrono::steady_clock::duration::max();
+  for (size_t base_ntt_size = s_min_tuned_base_ntt_size;
+       base_ntt_size <= max_base_ntt_size; base_ntt_size *= 2) {
+    m_base_ntt_size = base_ntt_size;
+    // Warm up the caches with one untimed round trip
+    ForwardToBitReverse(operand.data(), operand.data(), 1, 1);
+    InverseFromBitReverse(operand.data(), operand.data(), 1, 1);
+
+    auto min_time = std::chrono::steady_clock::duration::max();
+    for (size_t rep = 0; rep < reps; ++rep) {
+      auto start = std::chrono::steady_clock::now();
+      ForwardToBitReverse(operand.data(), operand.data(), 1, 1);
+      InverseFromBitReverse(operand.data(), operand.data(), 1, 1);
+      min_time = std::min(min_time, std::chrono::steady_clock::now() - start);
+    }
+    HEXL_VLOG(3, "Base NTT size " << base_ntt_size << " took "
+                                  << std::chrono::duration_cast<
+                                         std::chrono::nanoseconds>(min_time)
+                                         .count()
+                                  << " ns");
+    if (min_time < best_time) {
+      best_time = min_time;
+      best_base_ntt_size = base_ntt_size;
+    }
+  }
+
+  HEXL_VLOG(3, "Tuned base NTT size for degree "
+                   << m_degree << ", modulus " << m_q << ": "
+                   << best_base_ntt_size);
+  m_base_ntt_size = best_base_ntt_size;
+  std::lock_guard<std::mutex> lock(TuneCacheMutex());
+  TuneCache()[key] = m_base_ntt_size;
+#endif
+  return m_base_ntt_size;
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,295 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "ntt/ntt32-avx512.hpp"
+
+#include <immintrin.h>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "util/avx512-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+namespace {
+
+// Harvey butterfly of ForwardTransformToBitReverse32: X, Y in [0, 4q) to
+// X', Y' in [0, 4q)
+inline void FwdButterfly32(__m512i* X, __m512i* Y, __m512i W, __m512i W_precon,
+                           __m512i v_modulus, __m512i v_twice_mod) {
+  __m512i tx = _mm512_hexl_small_mod_epu32(*X, v_twice_mod);
+  __m512i T = _mm512_hexl_mulmod_lazy_epu32(*Y, W, W_precon, v_modulus);
+  *X = _mm512_add_epi32(tx, T);
+  *Y = _mm512_sub_epi32(_mm512_add_epi32(tx, v_twice_mod), T);
+}
+
+// Harvey butterfly of InverseTransformFromBitReverse32: X, Y in [0, 2q) to
+// X', Y' in [0, 2q)
+inline void InvButterfly32(__m512i* X, __m512i* Y, __m512i W, __m512i W_precon,
+                           __m512i v_modulus, __m512i v_twice_mod) {
+  __m512i tx = _mm512_add_epi32(*X, *Y);
+  __m512i ty = _mm512_sub_epi32(_mm512_add_epi32(*X, v_twice_mod), *Y);
+  *X = _mm512_hexl_small_mod_epu32(tx, v_twice_mod);
+  *Y = _mm512_hexl_mulmod_lazy_epu32(ty, W, W_precon, v_modulus);
+}
+
+// Permutations for a stage with butterfly distance t < 16, which pairs
+// elements within blocks of 32 elements, i.e. two vectors v0, v1. Indices
+// below 16 select lanes of the first permute source, others of the second.
+struct SmallStagePermutes {
+  explicit SmallStagePermutes(size_t t) {
+    alignas(64) uint32_t x[16];
+    alignas(64) uint32_t y[16];
+    alignas(64) uint32_t v0[16];
+    alignas(64) uint32_t v1[16];
+    alignas(64) uint32_t w[16];
+    for (uint32_t k = 0; k < 16; ++k) {
+      // Lane k holds the k'th butterfly of the block
+      x[k] = static_cast<uint32_t>((k / t) * 2 * t + k % t);
+      y[k] = static_cast<uint32_t>(x[k] + t);
+      w[k] = static_cast<uint32_t>(k / t);
+    }
+    for (uint32_t p = 0; p < 32; ++p) {
+      // Element p of the block is an X operand iff (p & t) == 0
+      uint32_t k = static_cast<uint32_t>((p / (2 * t)) * t + p % t);
+      uint32_t idx = (p & t) ? (16 + k) : k;
+      if (p < 16) {
+        v0[p] = idx;
+      } else {
+        v1[p - 16] = idx;
+      }
+    }
+    x_idx = _mm512_load_si512(x);
+    y_idx = _mm512_load_si512(y);
+    v0_idx = _mm512_load_si512(v0);
+    v1_idx = _mm512_load_si512(v1);
+    w_idx = _mm512_load_si512(w);
+    w_mask = static_cast<__mmask16>((1U << (16 / t)) - 1);
+  }
+
+  __m512i x_idx;   // X operands from (v0, v1)
+  __m512i y_idx;   // Y operands from (v0, v1)
+  __m512i v0_idx;  // v0 from (X, Y)
+  __m512i v1_idx;  // v1 from (X, Y)
+  __m512i w_idx;   // Twiddle factor of each butterfly
+  __mmask16 w_mask;  // The 16 / t twiddle factors of a block
+};
+
+// Computes the forward stage with butterfly distance t < 16, whose twiddle
+// factors start at W and W_precon. Reduces the output to [0, q) if
+// reduce_output.
+void FwdSmallStage32(uint32_t* operand, uint64_t n, size_t t,
+                     const uint32_t* W, const uint32_t* W_precon,
+                     __m512i v_modulus, __m512i v_twice_mod,
+                     bool reduce_output) {
+  SmallStagePermutes perm(t);
+  const size_t groups = 16 / t;
+  for (size_t block = 0; block < n / 32; ++block) {
+    __m512i* v_ptr = reinterpret_cast<__m512i*>(operand + 32 * block);
+    __m512i v0 = _mm512_loadu_si512(v_ptr);
+    __m512i v1 = _mm512_loadu_si512(v_ptr + 1);
+    __m512i X = _mm512_permutex2var_epi32(v0, perm.x_idx, v1);
+    __m512i Y = _mm512_permutex2var_epi32(v0, perm.y_idx, v1);
+    __m512i v_W = _mm512_permutexvar_epi32(
+        perm.w_idx,
+        _mm512_maskz_loadu_epi32(perm.w_mask, W + block * groups));
+    __m512i v_W_precon = _mm512_permutexvar_epi32(
+        perm.w_idx,
+        _mm512_maskz_loadu_epi32(perm.w_mask, W_precon + block * groups));
+
+    FwdButterfly32(&X, &Y, v_W, v_W_precon, v_modulus, v_twice_mod);
+
+    v0 = _mm512_permutex2var_epi32(X, perm.v0_idx, Y);
+    v1 = _mm512_permutex2var_epi32(X, perm.v1_idx, Y);
+    if (reduce_output) {
+      v0 = _mm512_hexl_small_mod_epu32<4>(v0, v_modulus, &v_twice_mod);
+      v1 = _mm512_hexl_small_mod_epu32<4>(v1, v_modulus, &v_twice_mod);
+    }
+    _mm512_storeu_si512(v_ptr, v0);
+    _mm512_storeu_si512(v_ptr + 1, v1);
+  }
+}
+
+// Computes the inverse stage with butterfly distance t < 16 from operand to
+// result, which may be equal, with twiddle factors starting at W and W_precon
+void InvSmallStage32(uint32_t* result, const uint32_t* operand, uint64_t n,
+                     size_t t, const uint32_t* W, const uint32_t* W_precon,
+                     __m512i v_modulus, __m512i v_twice_mod) {
+  SmallStagePermutes perm(t);
+  const size_t groups = 16 / t;
+  for (size_t block = 0; block < n / 32; ++block) {
+    const __m512i* v_op_ptr =
+        reinterpret_cast<const __m512i*>(operand + 32 * block);
+    __m512i* v_ptr = reinterpret_cast<__m512i*>(result + 32 * block);
+    __m512i v0 = _mm512_loadu_si512(v_op_ptr);
+    __m512i v1 = _mm512_loadu_si512(v_op_ptr + 1);
+    __m512i X = _mm512_permutex2var_epi32(v0, perm.x_idx, v1);
+    __m512i Y = _mm512_permutex2var_epi32(v0, perm.y_idx, v1);
+    __m512i v_W = _mm512_permutexvar_epi32(
+        perm.w_idx,
+        _mm512_maskz_loadu_epi32(perm.w_mask, W + block * groups));
+    __m512i v_W_precon = _mm512_permutexvar_epi32(
+        perm.w_idx,
+        _mm512_maskz_loadu_epi32(perm.w_mask, W_precon + block * groups));
+
+    InvButterfly32(&X, &Y, v_W, v_W_precon, v_modulus, v_twice_mod);
+
+    _mm512_storeu_si512(v_ptr, _mm512_permutex2var_epi32(X, perm.v0_idx, Y));
+    _mm512_storeu_si512(v_ptr + 1,
+                        _mm512_permutex2var_epi32(X, perm.v1_idx, Y));
+  }
+}
+
+}  // namespace
+
+void ForwardTransformToBitReverse32AVX512(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* root_of_unity_powers,
+    const uint32_t* precon_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(n >= 32, "Need n >= 32, got n = " << n);
+  HEXL_CHECK(modulus < NTT::s_max_fwd_32_modulus,
+             "modulus " << modulus << " too large for 32-bit NTT");
+  HEXL_CHECK_BOUNDS(operand, n, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+  HEXL_CHECK(
+      input_mod_factor == 1 || input_mod_factor == 2 || input_mod_factor == 4,
+      "input_mod_factor must be 1, 2, or 4; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 4,
+             "output_mod_factor must be 1 or 4; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi32(static_cast<int>(2 * modulus));
+
+  // n >= 32, so the first stage is one of the t >= 16 stages, which reads
+  // from operand; the others read from result
+  const uint32_t* input = operand;
+  size_t t = (n >> 1);
+  size_t m = 1;
+  for (; t >= 16; t >>= 1, m <<= 1, input = result) {
+    for (size_t i = 0; i < m; ++i) {
+      __m512i v_W = _mm512_set1_epi32(
+          static_cast<int>(root_of_unity_powers[m + i]));
+      __m512i v_W_precon = _mm512_set1_epi32(
+          static_cast<int>(precon_root_of_unity_powers[m + i]));
+      const __m512i* v_X_op =
+          reinterpret_cast<const __m512i*>(input + 2 * i * t);
+      const __m512i* v_Y_op =
+          reinterpret_cast<const __m512i*>(input + 2 * i * t + t);
+      __m512i* v_X = reinterpret_cast<__m512i*>(result + 2 * i * t);
+      __m512i* v_Y = reinterpret_cast<__m512i*>(result + 2 * i * t + t);
+      for (size_t j = 0; j < t / 16; ++j, ++v_X, ++v_Y) {
+        __m512i X = _mm512_loadu_si512(v_X_op++);
+        __m512i Y = _mm512_loadu_si512(v_Y_op++);
+        FwdButterfly32(&X, &Y, v_W, v_W_precon, v_modulus, v_twice_mod);
+        _mm512_storeu_si512(v_X, X);
+        _mm512_storeu_si512(v_Y, Y);
+      }
+    }
+  }
+  for (; t > 0; t >>= 1, m <<= 1) {
+    FwdSmallStage32(result, n, t, root_of_unity_powers + m,
+                    precon_root_of_unity_powers + m, v_modulus, v_twice_mod,
+                    (t == 1) && (output_mod_factor == 1));
+  }
+
+  if (output_mod_factor == 1) {
+    HEXL_CHECK_BOUNDS(result, n, modulus, "result exceeds bound " << modulus);
+  }
+}
+
+void InverseTransformFromBitReverse32AVX512(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* inv_root_of_unity_powers,
+    const uint32_t* precon_inv_root_of_unity_powers, uint64_t input_mod_factor,
+    uint64_t output_mod_factor) {
+  HEXL_CHECK(CheckNTTArguments(n, modulus), "");
+  HEXL_CHECK(n >= 32, "Need n >= 32, got n = " << n);
+  HEXL_CHECK(modulus < NTT::s_max_fwd_32_modulus,
+             "modulus " << modulus << " too large for 32-bit NTT");
+  HEXL_CHECK_BOUNDS(operand, n, input_mod_factor * modulus,
+                    "operand larger than input_mod_factor * modulus ("
+                        << input_mod_factor << " * " << modulus << ")");
+  HEXL_CHECK(input_mod_factor == 1 || input_mod_factor == 2,
+             "input_mod_factor must be 1 or 2; got " << input_mod_factor);
+  (void)(input_mod_factor);  // Avoid unused parameter warning
+  HEXL_CHECK(output_mod_factor == 1 || output_mod_factor == 2,
+             "output_mod_factor must be 1 or 2; got " << output_mod_factor);
+
+  __m512i v_modulus = _mm512_set1_epi32(static_cast<int>(modulus));
+  __m512i v_twice_mod = _mm512_set1_epi32(static_cast<int>(2 * modulus));
+
+  // The first stage reads from operand, the others from result
+  const uint32_t* input = operand;
+  size_t t = 1;
+  size_t m = (n >> 1);
+  size_t root_index = 1;
+  for (; t < 16; t <<= 1, root_index += m, m >>= 1, input = result) {
+    InvSmallStage32(result, input, n, t, inv_root_of_unity_powers + root_index,
+                    precon_inv_root_of_unity_powers + root_index, v_modulus,
+                    v_twice_mod);
+  }
+  for (; m > 1; t <<= 1, m >>= 1) {
+    for (size_t i = 0; i < m; ++i, ++root_index) {
+      __m512i v_W = _mm512_set1_epi32(
+          static_cast<int>(inv_root_of_unity_powers[root_index]));
+      __m512i v_W_precon = _mm512_set1_epi32(
+          static_cast<int>(precon_inv_root_of_unity_powers[root_index]));
+      __m512i* v_X = reinterpret_cast<__m512i*>(result + 2 * i * t);
+      __m512i* v_Y = reinterpret_cast<__m512i*>(result + 2 * i * t + t);
+      for (size_t j = 0; j < t / 16; ++j, ++v_X, ++v_Y) {
+        __m512i X = _mm512_loadu_si512(v_X);
+        __m512i Y = _mm512_loadu_si512(v_Y);
+        InvButterfly32(&X, &Y, v_W, v_W_precon, v_modulus, v_twice_mod);
+        _mm512_storeu_si512(v_X, X);
+        _mm512_storeu_si512(v_Y, Y);
+      }
+    }
+  }
+
+  // The last stage also multiplies by 1/n
+  uint64_t inv_n = InverseMod(n, modulus);
+  uint64_t inv_n_w =
+      MultiplyMod(inv_n, inv_root_of_unity_powers[root_index], modulus);
+  __m512i v_inv_n = _mm512_set1_epi32(static_cast<int>(inv_n));
+  __m512i v_inv_n_precon = _mm512_set1_epi32(
+      static_cast<int>(MultiplyFactor(inv_n, 32, modulus).BarrettFactor()));
+  __m512i v_inv_n_w = _mm512_set1_epi32(static_cast<int>(inv_n_w));
+  __m512i v_inv_n_w_precon = _mm512_set1_epi32(
+      static_cast<int>(MultiplyFactor(inv_n_w, 32, modulus).BarrettFactor()));
+
+  __m512i* v_X = reinterpret_cast<__m512i*>(result);
+  __m512i* v_Y = reinterpret_cast<__m512i*>(result + n / 2);
+  for (size_t j = 0; j < n / 32; ++j, ++v_X, ++v_Y) {
+    __m512i X = _mm512_loadu_si512(v_X);
+    __m512i Y = _mm512_loadu_si512(v_Y);
+    __m512i tx =
+        _mm512_hexl_small_mod_epu32(_mm512_add_epi32(X, Y), v_twice_mod);
+    __m512i ty = _mm512_sub_epi32(_mm512_add_epi32(X, v_twice_mod), Y);
+    X = _mm512_hexl_mulmod_lazy_epu32(tx, v_inv_n, v_inv_n_precon, v_modulus);
+    Y = _mm512_hexl_mulmod_lazy_epu32(ty, v_inv_n_w, v_inv_n_w_precon,
+                                      v_modulus);
+    if (output_mod_factor == 1) {
+      X = _mm512_hexl_small_mod_epu32(X, v_modulus);
+      Y = _mm512_hexl_small_mod_epu32(Y, v_modulus);
+    }
+    _mm512_storeu_si512(v_X, X);
+    _mm512_storeu_si512(v_Y, Y);
+  }
+
+  HEXL_CHECK_BOUNDS(result, n, output_mod_factor * modulus,
+                    "result exceeds bound " << output_mod_factor * modulus);
+}
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
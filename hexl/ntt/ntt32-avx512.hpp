@@ -0,0 +1,66 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+
+/// @brief AVX512 implementation of the forward NTT on 32-bit coefficients
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two, at least 32.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n and q <
+/// NTT::s_max_fwd_32_modulus
+/// @param[in] root_of_unity_powers Powers of 2n'th root of unity in F_q. In
+/// bit-reversed order.
+/// @param[in] precon_root_of_unity_powers 32-bit pre-conditioned powers of
+/// 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Computes the stages breadth-first on sixteen 32-bit lanes. The
+/// stages with butterfly distance less than 16 gather their operands from
+/// pairs of vectors with two-source permutes. The result matches
+/// ForwardTransformToBitReverse32.
+void ForwardTransformToBitReverse32AVX512(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* root_of_unity_powers,
+    const uint32_t* precon_root_of_unity_powers, uint64_t input_mod_factor = 1,
+    uint64_t output_mod_factor = 1);
+
+/// @brief AVX512 implementation of the inverse NTT on 32-bit coefficients
+/// @param[out] result Stores the NTT output. May equal \p operand; otherwise
+/// must not overlap it.
+/// @param[in] operand Input data, read by the first stage only
+/// @param[in] n Size of the transfrom, i.e. the polynomial degree. Must be a
+/// power of two, at least 32.
+/// @param[in] modulus Prime modulus. Must satisfy q == 1 mod 2n and q <
+/// NTT::s_max_fwd_32_modulus
+/// @param[in] inv_root_of_unity_powers Powers of inverse 2n'th root of unity
+/// in F_q. In bit-reversed order.
+/// @param[in] precon_inv_root_of_unity_powers 32-bit pre-conditioned powers
+/// of inverse 2n'th root of unity in F_q. In bit-reversed order.
+/// @param[in] input_mod_factor Upper bound for inputs; inputs must be in [0,
+/// input_mod_factor * modulus)
+/// @param[in] output_mod_factor Upper bound for result; result must be in [0,
+/// output_mod_factor * modulus)
+/// @details Mirrors ForwardTransformToBitReverse32AVX512. The result matches
+/// InverseTransformFromBitReverse32.
+void InverseTransformFromBitReverse32AVX512(
+    uint32_t* result, const uint32_t* operand, uint64_t n, uint64_t modulus,
+    const uint32_t* inv_root_of_unity_powers,
+    const uint32_t* precon_inv_root_of_unity_powers,
+    uint64_t input_mod_factor = 1, uint64_t output_mod_factor = 1);
+
+#endif  // HEXL_HAS_AVX512DQ
+
+}  // namespace hexl
+}  // namespace intel
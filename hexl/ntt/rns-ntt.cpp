@@ -0,0 +1,283 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/ntt/rns-ntt.hpp"
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
+#include "hexl/util/check.hpp"
+#include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/inv-ntt-avx512.hpp"
+#include "ntt/ntt-tables.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+namespace {
+
+// Maximum number of rows transformed together
+const size_t kMaxRowsAVX512 = 4;
+
+// Bit shift of the AVX512 kernel NTT::ComputeForward calls for modulus q
+size_t FwdBitShiftAVX512(uint64_t q) {
+#ifdef HEXL_HAS_AVX512IFMA
+  if (has_avx512ifma && q < NTT::s_max_fwd_ifma_modulus) {
+    return NTT::s_ifma_shift_bits;
+  }
+#endif
+  return (q < NTT::s_max_fwd_32_modulus) ? 32 : NTT::s_default_shift_bits;
+}
+
+// Bit shift of the AVX512 kernel NTT::ComputeInverse calls for modulus q
+size_t InvBitShiftAVX512(uint64_t q) {
+#ifdef HEXL_HAS_AVX512IFMA
+  if (has_avx512ifma && q < NTT::s_max_inv_ifma_modulus) {
+    return NTT::s_ifma_shift_bits;
+  }
+#endif
+  return (q < NTT::s_max_inv_32_modulus) ? 32 : NTT::s_default_shift_bits;
+}
+
+// Returns the number of rows, at most max_rows, starting at row first which
+// take the same recursive single-threaded AVX512 kernel as row first. Returns
+// 4, 2 or 0, where 0 means row first is transformed on its own.
+size_t NumRowsAVX512(const std::vector<NTT>& ntts, size_t first,
+                     size_t max_rows, size_t (*bit_shift)(uint64_t)) {
+  uint64_t degree = ntts[first].GetDegree();
+  if (!has_avx512dq || max_rows == 1 || degree < 16 ||
+      degree >= NTT::s_min_four_step_degree) {
+    return 0;
+  }
+  auto single_threaded = [&](const NTT& ntt) {
+    return degree < NTT::s_min_parallel_degree || ntt.GetNumThreads() == 1;
+  };
+
+  size_t num_rows = 0;
+  for (size_t i = first;
+       i < ntts.size() && num_rows < max_rows && single_threaded(ntts[i]) &&
+       bit_shift(ntts[i].GetModulus()) ==
+           bit_shift(ntts[first].GetModulus()) &&
+       ntts[i].GetBaseNTTSize() == ntts[first].GetBaseNTTSize();
+       ++i) {
+    ++num_rows;
+  }
+  if (num_rows == 4) {
+    return num_rows;
+  }
+  return (num_rows >= 2) ? 2 : 0;
+}
+
+// Signature of the multi-row forward and inverse AVX512 kernels
+using RowsKernel = void (*)(uint64_t* const*, const uint64_t* const*, uint64_t,
+                            const uint64_t*, const uint64_t* const*,
+                            const uint64_t* const*, uint64_t, uint64_t,
+                            uint64_t, uint64_t, uint64_t);
+
+template <int BitShift>
+RowsKernel FwdRowsKernel(size_t num_rows) {
+  if (num_rows == 4) {
+    return ForwardTransformToBitReverseAVX512Rows<BitShift, 4>;
+  }
+  return ForwardTransformToBitReverseAVX512Rows<BitShift, 2>;
+}
+
+template <int BitShift>
+RowsKernel InvRowsKernel(size_t num_rows) {
+  if (num_rows == 4) {
+    return InverseTransformFromBitReverseAVX512Rows<BitShift, 4>;
+  }
+  return InverseTransformFromBitReverseAVX512Rows<BitShift, 2>;
+}
+
+}  // namespace
+#endif
+
+RNSNTT::RNSNTT(uint64_t degree, const std::vector<uint64_t>& moduli,
+               std::shared_ptr<AllocatorBase> alloc_ptr)
+    : m_degree(degree), m_moduli(moduli) {
+  HEXL_CHECK(!moduli.empty(), "moduli is empty");
+  // Reserve up front, since NTT objects are expensive to copy
+  m_ntts.reserve(moduli.size());
+  for (uint64_t modulus : moduli) {
+    m_ntts.emplace_back(degree, modulus, alloc_ptr);
+  }
+}
+
+void RNSNTT::SetNumInterleavedRows(size_t num_rows) {
+  HEXL_CHECK(num_rows == 1 || num_rows == 2 || num_rows == 4,
+             "num_rows must be 1, 2 or 4; got " << num_rows);
+  m_num_interleaved_rows = num_rows;
+}
+
+void RNSNTT::ComputeForward(uint64_t* result, const uint64_t* operand,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor,
+                            NTT::Ordering output_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+
+  HEXL_VLOG(3, "Calling RNS FwdNTT with " << m_ntts.size() << " moduli");
+  for (size_t i = 0; i < m_ntts.size();) {
+    size_t num_rows = ForwardRowsAVX512(result, operand, i, input_mod_factor,
+                                        output_mod_factor);
+    if (num_rows == 0) {
+      m_ntts[i].ComputeForward(result + i * m_degree, operand + i * m_degree,
+                               input_mod_factor, output_mod_factor,
+                               output_order);
+      num_rows = 1;
+    } else if (output_order == NTT::Ordering::kNatural) {
+      for (size_t r = i; r < i + num_rows; ++r) {
+        BitReversePermuteInPlace(result + r * m_degree, m_degree);
+      }
+    }
+    i += num_rows;
+  }
+}
+
+void RNSNTT::ComputeInverse(uint64_t* result, const uint64_t* operand,
+                            uint64_t input_mod_factor,
+                            uint64_t output_mod_factor,
+                            NTT::Ordering input_order) {
+  HEXL_CHECK(result != nullptr, "result == nullptr");
+  HEXL_CHECK(operand != nullptr, "operand == nullptr");
+
+  HEXL_VLOG(3, "Calling RNS InvNTT with " << m_ntts.size() << " moduli");
+  // Natural-order inputs are permuted into result, and transformed in-place
+  if (input_order == NTT::Ordering::kNatural) {
+    for (size_t i = 0; i < m_ntts.size(); ++i) {
+      BitReversePermute(result + i * m_degree, operand + i * m_degree,
+                        m_degree);
+    }
+    operand = result;
+  }
+  for (size_t i = 0; i < m_ntts.size();) {
+    size_t num_rows = InverseRowsAVX512(result, operand, i, input_mod_factor,
+                                        output_mod_factor);
+    if (num_rows == 0) {
+      m_ntts[i].ComputeInverse(result + i * m_degree, operand + i * m_degree,
+                               input_mod_factor, output_mod_factor,
+                               NTT::Ordering::kBitReversed);
+      num_rows = 1;
+    }
+    i += num_rows;
+  }
+}
+
+size_t RNSNTT::ForwardRowsAVX512(uint64_t* result, const uint64_t* operand,
+                                 size_t first, uint64_t input_mod_factor,
+                                 uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  size_t num_rows = NumRowsAVX512(m_ntts, first, m_num_interleaved_rows,
+                                  FwdBitShiftAVX512);
+  if (num_rows == 0) {
+    return 0;
+  }
+  size_t bit_shift = FwdBitShiftAVX512(m_moduli[first]);
+  NTTTables::Table precon_table =
+      (bit_shift == 32) ? NTTTables::kAVX512Precon32RootOfUnityPowers
+      : (bit_shift == NTT::s_ifma_shift_bits)
+          ? NTTTables::kAVX512Precon52RootOfUnityPowers
+          : NTTTables::kAVX512Precon64RootOfUnityPowers;
+
+  uint64_t* row_result[kMaxRowsAVX512];
+  const uint64_t* row_operand[kMaxRowsAVX512];
+  const uint64_t* root_of_unity_powers[kMaxRowsAVX512];
+  const uint64_t* precon_root_of_unity_powers[kMaxRowsAVX512];
+  for (size_t r = 0; r < num_rows; ++r) {
+    const NTT& ntt = m_ntts[first + r];
+    row_result[r] = result + (first + r) * m_degree;
+    row_operand[r] = operand + (first + r) * m_degree;
+    root_of_unity_powers[r] =
+        ntt.m_tables->Data(NTTTables::kAVX512RootOfUnityPowers);
+    precon_root_of_unity_powers[r] = ntt.m_tables->Data(precon_table);
+  }
+  const uint64_t* moduli = &m_moduli[first];
+  uint64_t base_ntt_size = m_ntts[first].GetBaseNTTSize();
+
+  HEXL_VLOG(3, "Calling " << bit_shift << "-bit AVX512 FwdNTT on "
+                          << num_rows << " rows");
+  RowsKernel kernel = FwdRowsKernel<32>(num_rows);
+  if (bit_shift == NTT::s_default_shift_bits) {
+    kernel = FwdRowsKernel<NTT::s_default_shift_bits>(num_rows);
+  }
+#ifdef HEXL_HAS_AVX512IFMA
+  if (bit_shift == NTT::s_ifma_shift_bits) {
+    kernel = FwdRowsKernel<NTT::s_ifma_shift_bits>(num_rows);
+  }
+#endif
+  kernel(row_result, row_operand, m_degree, moduli, root_of_unity_powers,
+       precon_root_of_unity_powers, input_mod_factor, output_mod_factor, 0, 0,
+       base_ntt_size);
+  return num_rows;
+#else
+  // Avoid unused parameter warnings
+  (void)result;
+  (void)operand;
+  (void)first;
+  (void)input_mod_factor;
+  (void)output_mod_factor;
+  return 0;
+#endif
+}
+
+size_t RNSNTT::InverseRowsAVX512(uint64_t* result, const uint64_t* operand,
+                                 size_t first, uint64_t input_mod_factor,
+                                 uint64_t output_mod_factor) {
+#ifdef HEXL_HAS_AVX512DQ
+  size_t num_rows = NumRowsAVX512(m_ntts, first, m_num_interleaved_rows,
+                                  InvBitShiftAVX512);
+  if (num_rows == 0) {
+    return 0;
+  }
+  size_t bit_shift = InvBitShiftAVX512(m_moduli[first]);
+  NTTTables::Table precon_table =
+      (bit_shift == 32) ? NTTTables::kPrecon32InvRootOfUnityPowers
+      : (bit_shift == NTT::s_ifma_shift_bits)
+          ? NTTTables::kPrecon52InvRootOfUnityPowers
+          : NTTTables::kPrecon64InvRootOfUnityPowers;
+
+  uint64_t* row_result[kMaxRowsAVX512];
+  const uint64_t* row_operand[kMaxRowsAVX512];
+  const uint64_t* inv_root_of_unity_powers[kMaxRowsAVX512];
+  const uint64_t* precon_inv_root_of_unity_powers[kMaxRowsAVX512];
+  for (size_t r = 0; r < num_rows; ++r) {
+    const NTT& ntt = m_ntts[first + r];
+    row_result[r] = result + (first + r) * m_degree;
+    row_operand[r] = operand + (first + r) * m_degree;
+    inv_root_of_unity_powers[r] =
+        ntt.m_tables->Data(NTTTables::kInvRootOfUnityPowers);
+    precon_inv_root_of_unity_powers[r] = ntt.m_tables->Data(precon_table);
+  }
+  const uint64_t* moduli = &m_moduli[first];
+  uint64_t base_ntt_size = m_ntts[first].GetBaseNTTSize();
+
+  HEXL_VLOG(3, "Calling " << bit_shift << "-bit AVX512 InvNTT on "
+                          << num_rows << " rows");
+  RowsKernel kernel = InvRowsKernel<32>(num_rows);
+  if (bit_shift == NTT::s_default_shift_bits) {
+    kernel = InvRowsKernel<NTT::s_default_shift_bits>(num_rows);
+  }
+#ifdef HEXL_HAS_AVX512IFMA
+  if (bit_shift == NTT::s_ifma_shift_bits) {
+    kernel = InvRowsKernel<NTT::s_ifma_shift_bits>(num_rows);
+  }
+#endif
+  kernel(row_result, row_operand, m_degree, moduli, inv_root_of_unity_powers,
+       precon_inv_root_of_unity_powers, input_mod_factor, output_mod_factor,
+       0, 0, base_ntt_size);
+  return num_rows;
+#else
+  // Avoid unused parameter warnings
+  (void)result;
+  (void)operand;
+  (void)first;
+  (void)input_mod_factor;
+  (void)output_mod_factor;
+  return 0;
+#endif
+}
+
+}  // namespace hexl
+}  // namespace intel
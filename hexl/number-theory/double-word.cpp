@@ -0,0 +1,175 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hexl/number-theory/double-word.hpp"
+
+#include <vector>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+
+namespace intel {
+namespace hexl {
+
+DoubleWordModulus::DoubleWordModulus(DoubleWord modulus) : m_modulus(modulus) {
+  HEXL_CHECK(modulus.lo % 2 == 1, "modulus " << modulus << " must be odd");
+  HEXL_CHECK((modulus.hi >> 62) == 0,
+             "modulus " << modulus << " must be less than 2^126");
+  HEXL_CHECK(modulus.hi != 0 || modulus.lo >= 3,
+             "modulus " << modulus << " must be at least 3");
+
+  // MSB rounds up for some values just below a power of two
+  uint64_t word = (modulus.hi != 0) ? modulus.hi : modulus.lo;
+  uint64_t msb = MSB(word);
+  if (msb > 63 || (word >> msb) == 0) {
+    --msb;
+  }
+  m_bit_length = msb + 1 + ((modulus.hi != 0) ? 64 : 0);
+
+  // floor(2^(2k) / q) by long division; the quotient is less than 2^(k + 1)
+  DoubleWord remainder{0, 0};
+  DoubleWord quotient{0, 0};
+  for (uint64_t i = 2 * m_bit_length + 1; i-- > 0;) {
+    remainder = ShiftLeftDoubleWord(remainder, 1);
+    remainder.lo |= (i == 2 * m_bit_length) ? 1 : 0;
+    quotient = ShiftLeftDoubleWord(quotient, 1);
+    if (remainder >= modulus) {
+      remainder = SubDoubleWord(remainder, modulus);
+      quotient.lo |= 1;
+    }
+  }
+  m_barrett_factor = quotient;
+
+  // Newton iteration; each step doubles the number of correct low bits
+  DoubleWord inv = modulus;
+  for (size_t i = 0; i < 7; ++i) {
+    DoubleWord error = MultiplyDoubleWordLo(modulus, inv);
+    inv = MultiplyDoubleWordLo(inv, SubDoubleWord(DoubleWord{2, 0}, error));
+  }
+  m_neg_inverse = SubDoubleWord(DoubleWord{0, 0}, inv);
+}
+
+DoubleWord PowModDoubleWord(DoubleWord base, DoubleWord exp,
+                            const DoubleWordModulus& modulus) {
+  DoubleWord result{1, 0};
+  while (exp.lo != 0 || exp.hi != 0) {
+    if (exp.lo & 1) {
+      result = MultiplyModDoubleWord(result, base, modulus);
+    }
+    base = MultiplyModDoubleWord(base, base, modulus);
+    exp = ShiftRightDoubleWord(exp, 1);
+  }
+  return result;
+}
+
+DoubleWord InverseModDoubleWord(DoubleWord x,
+                                const DoubleWordModulus& modulus) {
+  HEXL_CHECK(x.lo != 0 || x.hi != 0, x << " does not have an inverse");
+  return PowModDoubleWord(x, SubDoubleWord(modulus.Modulus(), DoubleWord{2, 0}),
+                          modulus);
+}
+
+bool IsPrimeDoubleWord(DoubleWord n) {
+  HEXL_CHECK((n.hi >> 62) == 0, "n " << n << " must be less than 2^126");
+  if (n.hi == 0) {
+    return IsPrime(n.lo);
+  }
+  static const uint64_t bases[] = {2,  3,  5,  7,  11, 13, 17, 19, 23, 29,
+                                   31, 37, 41, 43, 47, 53, 59, 61, 67, 71};
+  for (uint64_t p : bases) {
+    // n mod p, for n = hi * 2^64 + lo and 2^64 mod p = (2^64 - p) mod p
+    uint64_t r = MultiplyMod(n.hi % p, (uint64_t(0) - p) % p, p);
+    r = (r + n.lo % p) % p;
+    if (r == 0) {
+      return false;
+    }
+  }
+
+  // n - 1 = d * 2^r, with d odd
+  DoubleWordModulus modulus(n);
+  DoubleWord n_minus_1 = SubDoubleWord(n, DoubleWord{1, 0});
+  DoubleWord d = n_minus_1;
+  size_t r = 0;
+  while ((d.lo & 1) == 0) {
+    d = ShiftRightDoubleWord(d, 1);
+    ++r;
+  }
+
+  for (uint64_t base : bases) {
+    DoubleWord x = PowModDoubleWord(DoubleWord{base, 0}, d, modulus);
+    if (x == DoubleWord{1, 0} || x == n_minus_1) {
+      continue;
+    }
+    bool composite = true;
+    for (size_t i = 1; i < r; ++i) {
+      x = MultiplyModDoubleWord(x, x, modulus);
+      if (x == n_minus_1) {
+        composite = false;
+        break;
+      }
+    }
+    if (composite) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<DoubleWord> GeneratePrimesDoubleWord(size_t num_primes,
+                                                 size_t bit_size,
+                                                 size_t ntt_size) {
+  HEXL_CHECK(num_primes > 0, "num_primes == 0");
+  HEXL_CHECK(IsPowerOfTwo(ntt_size),
+             "ntt_size " << ntt_size << " is not a power of two");
+  HEXL_CHECK(Log2(ntt_size) < bit_size,
+             "log2(ntt_size) " << Log2(ntt_size)
+                               << " should be less than bit_size " << bit_size);
+  HEXL_CHECK(bit_size < 126, "bit_size " << bit_size << " too large");
+
+  DoubleWord value =
+      AddDoubleWord(ShiftLeftDoubleWord(DoubleWord{1, 0}, bit_size),
+                    DoubleWord{1, 0});
+  DoubleWord bound = ShiftLeftDoubleWord(DoubleWord{1, 0}, bit_size + 1);
+  DoubleWord step{2 * ntt_size, 0};
+
+  std::vector<DoubleWord> ret;
+  while (value < bound) {
+    if (IsPrimeDoubleWord(value)) {
+      ret.emplace_back(value);
+      if (ret.size() == num_primes) {
+        return ret;
+      }
+    }
+    value = AddDoubleWord(value, step);
+  }
+
+  HEXL_CHECK(false, "Failed to find enough primes");
+  return ret;
+}
+
+DoubleWord GeneratePrimitiveRootDoubleWord(uint64_t degree,
+                                           const DoubleWordModulus& modulus) {
+  HEXL_CHECK(IsPowerOfTwo(degree), degree << " not a power of 2");
+  const DoubleWord q = modulus.Modulus();
+  const DoubleWord q_minus_1 = SubDoubleWord(q, DoubleWord{1, 0});
+  HEXL_CHECK((q_minus_1.lo & (degree - 1)) == 0,
+             "degree " << degree << " does not divide q - 1");
+  if (degree == 1) {
+    return DoubleWord{1, 0};
+  }
+
+  DoubleWord exp = ShiftRightDoubleWord(q_minus_1, Log2(degree));
+  DoubleWord half_degree{degree / 2, 0};
+  for (uint64_t g = 2; g < (1ULL << 20); ++g) {
+    DoubleWord root = PowModDoubleWord(DoubleWord{g, 0}, exp, modulus);
+    // root is primitive iff root^(degree / 2) = -1
+    if (PowModDoubleWord(root, half_degree, modulus) == q_minus_1) {
+      return root;
+    }
+  }
+  HEXL_CHECK(false, "Failed to find a primitive " << degree << "'th root");
+  return DoubleWord{0, 0};
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -66,6 +66,46 @@ uint64_t MultiplyMod(uint64_t x, uint64_t y, uint64_t y_precon,
   return q >= modulus ? q - modulus : q;
 }
 
+uint64_t MontgomeryNegInverse(uint64_t modulus) {
+  HEXL_CHECK(modulus % 2 == 1, "modulus " << modulus << " must be odd");
+  // Newton iteration; modulus * modulus = 1 mod 8, and each step doubles the
+  // number of correct low bits
+  uint64_t inv = modulus;
+  for (size_t i = 0; i < 5; ++i) {
+    inv *= 2 - modulus * inv;
+  }
+  return 0 - inv;
+}
+
+SpecialFormModulus::SpecialFormModulus(uint64_t modulus)
+    : m_modulus(modulus) {
+  if (modulus % 2 == 0 || modulus < 3 || modulus >= (1ULL << 62)) {
+    return;
+  }
+  uint64_t k = MSB(modulus) + 1;
+  uint64_t d = (1ULL << k) - modulus;
+  // Folding twice reaches [0, 2q) only if d^2 < 2^(k - 2)
+  if (2 * (MSB(d) + 1) + 2 > k) {
+    return;
+  }
+
+  // d is odd, so d + 1 = c * 2^m with m >= 1
+  uint64_t c = d + 1;
+  uint64_t m = 0;
+  while (c % 2 == 0) {
+    c >>= 1;
+    ++m;
+  }
+  if (MSB(c) + 1 + k > 64) {
+    return;
+  }
+
+  m_k = k;
+  m_c = c;
+  m_m = m;
+  m_special_form = true;
+}
+
 uint64_t AddUIntMod(uint64_t x, uint64_t y, uint64_t modulus) {
   HEXL_CHECK(x < modulus, "x " << x << " >= modulus " << modulus);
   HEXL_CHECK(y < modulus, "y " << y << " >= modulus " << modulus);
@@ -94,6 +134,18 @@ uint64_t PowMod(uint64_t base, uint64_t exp, uint64_t modulus) {
   return result;
 }
 
+uint64_t PowModGoldilocks(uint64_t base, uint64_t exp) {
+  uint64_t result = 1;
+  while (exp > 0) {
+    if (exp & 1) {
+      result = MultiplyModGoldilocks(result, base);
+    }
+    base = MultiplyModGoldilocks(base, base);
+    exp >>= 1;
+  }
+  return result;
+}
+
 // Returns true whether root is a degree-th root of unity
 // degree must be a power of two.
 bool IsPrimitiveRoot(uint64_t root, uint64_t degree, uint64_t modulus) {
@@ -143,16 +195,21 @@ uint64_t MinimalPrimitiveRoot(uint64_t degree, uint64_t modulus) {
   uint64_t root = GeneratePrimitiveRoot(degree, modulus);
 
   uint64_t generator_sq = MultiplyMod(root, root, modulus);
+  // Pre-compute the Barrett factor of generator_sq, avoiding a 128-bit
+  // division in each multiplication below
+  uint64_t generator_sq_precon =
+      MultiplyFactor(generator_sq, 64, modulus).BarrettFactor();
   uint64_t current_generator = root;
 
   uint64_t min_root = root;
 
-  // Check if root^(degree/2) == -1 mod modulus
-  for (size_t i = 0; i < degree; ++i) {
+  // The primitive roots are the odd powers of root
+  for (size_t i = 0; i < degree / 2; ++i) {
     if (current_generator < min_root) {
       min_root = current_generator;
     }
-    current_generator = MultiplyMod(current_generator, generator_sq, modulus);
+    current_generator = MultiplyMod(current_generator, generator_sq,
+                                    generator_sq_precon, modulus);
   }
 
   return min_root;
@@ -223,7 +280,7 @@ bool IsPrime(uint64_t n) {
 }
 
 std::vector<uint64_t> GeneratePrimes(size_t num_primes, size_t bit_size,
-                                     size_t ntt_size) {
+                                     size_t ntt_size, bool special_form) {
   HEXL_CHECK(num_primes > 0, "num_primes == 0");
   HEXL_CHECK(IsPowerOfTwo(ntt_size),
              "ntt_size " << ntt_size << " is not a power of two");
@@ -231,10 +288,30 @@ std::vector<uint64_t> GeneratePrimes(size_t num_primes, size_t bit_size,
              "log2(ntt_size) " << Log2(ntt_size)
                                << " should be less than bit_size " << bit_size);
 
-  uint64_t value = (1ULL << bit_size) + 1;
-
   std::vector<uint64_t> ret;
 
+  if (special_form) {
+    HEXL_CHECK(bit_size < 62, "bit_size " << bit_size
+                                          << " too large for special form");
+    // Search downwards from 2^(bit_size + 1), so d = 2^(bit_size + 1) - q
+    // grows from 2N - 1 until it exceeds the special-form bound
+    uint64_t top = 1ULL << (bit_size + 1);
+    for (uint64_t d = 2 * ntt_size - 1; 2 * (MSB(d) + 1) + 2 <= bit_size + 1;
+         d += 2 * ntt_size) {
+      uint64_t value = top - d;
+      if (IsPrime(value) && SpecialFormModulus(value).IsSpecialForm()) {
+        ret.emplace_back(value);
+        if (ret.size() == num_primes) {
+          return ret;
+        }
+      }
+    }
+    HEXL_CHECK(false, "Failed to find enough primes");
+    return ret;
+  }
+
+  uint64_t value = (1ULL << bit_size) + 1;
+
   while (value < (1ULL << (bit_size + 1))) {
     if (IsPrime(value)) {
       ret.emplace_back(value);
@@ -0,0 +1,203 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <immintrin.h>
+
+#include <vector>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "hexl/util/check.hpp"
+#include "hexl/util/util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// AVX2 has no 64-bit multiplication nor unsigned 64-bit comparison, so the
+// helpers below emulate them with 32x32-bit multiplications and signed
+// comparisons.
+
+/// @brief Returns the unsigned 64-bit integer values in x as a vector
+inline std::vector<uint64_t> ExtractValues(__m256i x) {
+  return std::vector<uint64_t>{
+      static_cast<uint64_t>(_mm256_extract_epi64(x, 0)),
+      static_cast<uint64_t>(_mm256_extract_epi64(x, 1)),
+      static_cast<uint64_t>(_mm256_extract_epi64(x, 2)),
+      static_cast<uint64_t>(_mm256_extract_epi64(x, 3))};
+}
+
+// Returns the low 64 bits of the product of the unsigned 64-bit integers in
+// each lane of x and y
+inline __m256i _mm256_hexl_mullo_epi64(__m256i x, __m256i y) {
+  __m256i x_hi = _mm256_srli_epi64(x, 32);
+  __m256i y_hi = _mm256_srli_epi64(y, 32);
+  __m256i lo = _mm256_mul_epu32(x, y);
+  __m256i cross =
+      _mm256_add_epi64(_mm256_mul_epu32(x_hi, y), _mm256_mul_epu32(x, y_hi));
+  return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+// Computes the 128-bit product of the unsigned 64-bit integers in each lane of
+// x and y, storing the high 64 bits in prod_hi and the low 64 bits in prod_lo
+inline void _mm256_hexl_mul_epu64(__m256i x, __m256i y, __m256i* prod_hi,
+                                  __m256i* prod_lo) {
+  const __m256i lo_mask = _mm256_set1_epi64x(0x00000000ffffffff);
+  __m256i x_hi = _mm256_srli_epi64(x, 32);
+  __m256i y_hi = _mm256_srli_epi64(y, 32);
+  __m256i w0 = _mm256_mul_epu32(x, y);
+  __m256i w1 = _mm256_mul_epu32(x, y_hi);
+  __m256i w2 = _mm256_mul_epu32(x_hi, y);
+  __m256i w3 = _mm256_mul_epu32(x_hi, y_hi);
+  __m256i s1 = _mm256_add_epi64(w1, _mm256_srli_epi64(w0, 32));
+  __m256i s2 = _mm256_add_epi64(w2, _mm256_and_si256(s1, lo_mask));
+  __m256i hi = _mm256_add_epi64(w3, _mm256_srli_epi64(s1, 32));
+  *prod_hi = _mm256_add_epi64(hi, _mm256_srli_epi64(s2, 32));
+  *prod_lo = _mm256_or_si256(_mm256_slli_epi64(s2, 32),
+                             _mm256_and_si256(w0, lo_mask));
+}
+
+// Returns the high 64 bits of the 128-bit product of the unsigned 64-bit
+// integers in each lane of x and y
+inline __m256i _mm256_hexl_mulhi_epi64(__m256i x, __m256i y) {
+  __m256i prod_hi;
+  __m256i prod_lo;
+  _mm256_hexl_mul_epu64(x, y, &prod_hi, &prod_lo);
+  return prod_hi;
+}
+
+// Returns the high 64 bits of the 128-bit product of the unsigned 64-bit
+// integers in each lane of x and y, minus 0, 1 or 2. Dropping the carries
+// into the high bits saves a multiplication over _mm256_hexl_mulhi_epi64.
+inline __m256i _mm256_hexl_mulhi_approx_epi64(__m256i x, __m256i y) {
+  __m256i x_hi = _mm256_srli_epi64(x, 32);
+  __m256i y_hi = _mm256_srli_epi64(y, 32);
+  __m256i hi = _mm256_mul_epu32(x_hi, y_hi);
+  __m256i cross_hi =
+      _mm256_add_epi64(_mm256_srli_epi64(_mm256_mul_epu32(x, y_hi), 32),
+                       _mm256_srli_epi64(_mm256_mul_epu32(x_hi, y), 32));
+  return _mm256_add_epi64(hi, cross_hi);
+}
+
+// Returns a mask with all bits set in the lanes where the unsigned 64-bit
+// integer in a is less than the one in b
+inline __m256i _mm256_hexl_cmplt_epu64(__m256i a, __m256i b) {
+  const __m256i sign_bit =
+      _mm256_set1_epi64x(static_cast<int64_t>(1ULL << 63));
+  return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign_bit),
+                            _mm256_xor_si256(a, sign_bit));
+}
+
+// Returns a mask with all bits set in the lanes where the unsigned 64-bit
+// integers in a and b satisfy a CMP b
+inline __m256i _mm256_hexl_cmp_epu64(__m256i a, __m256i b, CMPINT cmp) {
+  const __m256i all_ones = _mm256_set1_epi64x(-1);
+  switch (cmp) {
+    case CMPINT::EQ:
+      return _mm256_cmpeq_epi64(a, b);
+    case CMPINT::LT:
+      return _mm256_hexl_cmplt_epu64(a, b);
+    case CMPINT::LE:
+      return _mm256_xor_si256(_mm256_hexl_cmplt_epu64(b, a), all_ones);
+    case CMPINT::FALSE:
+      return _mm256_setzero_si256();
+    case CMPINT::NE:
+      return _mm256_xor_si256(_mm256_cmpeq_epi64(a, b), all_ones);
+    case CMPINT::NLT:
+      return _mm256_xor_si256(_mm256_hexl_cmplt_epu64(a, b), all_ones);
+    case CMPINT::NLE:
+      return _mm256_hexl_cmplt_epu64(b, a);
+    case CMPINT::TRUE:
+      return all_ones;
+  }
+  return _mm256_setzero_si256();  // Avoid end of non-void function warning
+}
+
+// Returns c[i] = a[i] CMP b[i] ? match_value : 0
+inline __m256i _mm256_hexl_cmp_epi64(__m256i a, __m256i b, CMPINT cmp,
+                                     uint64_t match_value) {
+  return _mm256_and_si256(
+      _mm256_hexl_cmp_epu64(a, b, cmp),
+      _mm256_set1_epi64x(static_cast<int64_t>(match_value)));
+}
+
+// Returns x mod q in each 64-bit lane
+// Assumes x < InputModFactor * q in all lanes
+template <int InputModFactor = 2>
+inline __m256i _mm256_hexl_small_mod_epu64(__m256i x, __m256i q,
+                                           __m256i* q_times_2 = nullptr,
+                                           __m256i* q_times_4 = nullptr) {
+  HEXL_CHECK(InputModFactor == 1 || InputModFactor == 2 ||
+                 InputModFactor == 4 || InputModFactor == 8,
+             "InputModFactor must be 1, 2, 4, or 8");
+  if (InputModFactor == 1) {
+    return x;
+  }
+  if (InputModFactor == 8) {
+    HEXL_CHECK(q_times_4 != nullptr, "q_times_4 must not be nullptr");
+    x = _mm256_hexl_small_mod_epu64(x, *q_times_4);
+  }
+  if (InputModFactor >= 4) {
+    HEXL_CHECK(q_times_2 != nullptr, "q_times_2 must not be nullptr");
+    x = _mm256_hexl_small_mod_epu64(x, *q_times_2);
+  }
+  __m256i x_lt_q = _mm256_hexl_cmplt_epu64(x, q);
+  return _mm256_sub_epi64(x, _mm256_andnot_si256(x_lt_q, q));
+}
+
+// Returns (x + y) mod q; assumes 0 <= x, y < q
+inline __m256i _mm256_hexl_small_add_mod_epi64(__m256i x, __m256i y,
+                                               __m256i q) {
+  return _mm256_hexl_small_mod_epu64(_mm256_add_epi64(x, y), q);
+}
+
+// Returns (x - y) mod q; assumes 0 <= x, y < q
+inline __m256i _mm256_hexl_small_sub_mod_epi64(__m256i x, __m256i y,
+                                               __m256i q) {
+  __m256i x_lt_y = _mm256_hexl_cmplt_epu64(x, y);
+  return _mm256_add_epi64(_mm256_sub_epi64(x, y), _mm256_and_si256(x_lt_y, q));
+}
+
+// Returns x mod q, computed via Barrett reduction
+// @param q_barr floor(2^64 / q)
+inline __m256i _mm256_hexl_barrett_reduce64(__m256i x, __m256i q,
+                                            __m256i q_barr) {
+  __m256i Q = _mm256_hexl_mulhi_epi64(x, q_barr);
+  x = _mm256_sub_epi64(x, _mm256_hexl_mullo_epi64(Q, q));
+  return _mm256_hexl_small_mod_epu64(x, q);
+}
+
+// Returns x * y mod q in [0, 2q) in each 64-bit lane, given y_precon =
+// floor(y * 2^BitShift / q). BitShift 32 requires x, y, q < 2^32; BitShift 64
+// requires q < 2^62.
+template <int BitShift>
+inline __m256i _mm256_hexl_mulmod_lazy_epi64(__m256i x, __m256i y,
+                                             __m256i y_precon, __m256i q,
+                                             __m256i twice_q);
+
+template <>
+inline __m256i _mm256_hexl_mulmod_lazy_epi64<32>(__m256i x, __m256i y,
+                                                 __m256i y_precon, __m256i q,
+                                                 __m256i twice_q) {
+  (void)twice_q;  // Avoid unused parameter warning
+  __m256i Q = _mm256_srli_epi64(_mm256_mul_epu32(y_precon, x), 32);
+  return _mm256_sub_epi64(_mm256_mul_epu32(y, x), _mm256_mul_epu32(Q, q));
+}
+
+template <>
+inline __m256i _mm256_hexl_mulmod_lazy_epi64<64>(__m256i x, __m256i y,
+                                                 __m256i y_precon, __m256i q,
+                                                 __m256i twice_q) {
+  // The approximate quotient leaves the result in [0, 4q)
+  __m256i Q = _mm256_hexl_mulhi_approx_epi64(y_precon, x);
+  __m256i result = _mm256_sub_epi64(_mm256_hexl_mullo_epi64(y, x),
+                                    _mm256_hexl_mullo_epi64(Q, q));
+  return _mm256_hexl_small_mod_epu64(result, twice_q);
+}
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
@@ -322,6 +322,280 @@ inline __m512i _mm512_hexl_shrdi_epi64(__m512i x, __m512i y) {
   return _mm512_hexl_shrdi_epi64(x, y, BitShift);
 }
 
+// Returns the Montgomery product x * y * 2^{-64} mod q in [0, 2q) in each
+// 64-bit lane, given neg_inv_q = -q^{-1} mod 2^64. Requires x, y < q < 2^63.
+inline __m512i _mm512_hexl_montgomery_mul_lazy_epu64(__m512i x, __m512i y,
+                                                     __m512i q,
+                                                     __m512i neg_inv_q) {
+  __m512i prod_hi = _mm512_hexl_mulhi_epi<64>(x, y);
+  __m512i prod_lo = _mm512_hexl_mullo_epi<64>(x, y);
+  __m512i m = _mm512_hexl_mullo_epi<64>(prod_lo, neg_inv_q);
+  __m512i result = _mm512_add_epi64(prod_hi, _mm512_hexl_mulhi_epi<64>(m, q));
+  // prod + m * q = 0 mod 2^64, so its low word carries iff prod_lo != 0
+  __mmask8 carry = _mm512_test_epi64_mask(prod_lo, prod_lo);
+  return _mm512_mask_add_epi64(result, carry, result, _mm512_set1_epi64(1));
+}
+
+// Multiplies the unsigned 64-bit integers in each 64-bit lane of x and y,
+// returning the high and low 64 bits of the 128-bit products in *prod_hi and
+// *prod_lo
+inline void _mm512_hexl_mul_wide_epu64(__m512i x, __m512i y, __m512i* prod_hi,
+                                       __m512i* prod_lo) {
+  __m512i lomask = _mm512_set1_epi64(0x00000000ffffffff);
+  __m512i xh = _mm512_shuffle_epi32(x, (_MM_PERM_ENUM)0xB1);
+  __m512i yh = _mm512_shuffle_epi32(y, (_MM_PERM_ENUM)0xB1);
+  __m512i w0 = _mm512_mul_epu32(x, y);
+  __m512i w1 = _mm512_mul_epu32(x, yh);
+  __m512i w2 = _mm512_mul_epu32(xh, y);
+  __m512i w3 = _mm512_mul_epu32(xh, yh);
+  __m512i s1 = _mm512_add_epi64(w1, _mm512_srli_epi64(w0, 32));
+  __m512i s2 = _mm512_add_epi64(w2, _mm512_and_si512(s1, lomask));
+  *prod_hi = _mm512_add_epi64(
+      _mm512_add_epi64(w3, _mm512_srli_epi64(s1, 32)),
+      _mm512_srli_epi64(s2, 32));
+  *prod_lo = _mm512_or_si512(_mm512_slli_epi64(s2, 32),
+                             _mm512_and_si512(w0, lomask));
+}
+
+// Returns (x_hi * 2^64 + x_lo) mod p in each 64-bit lane, for the Goldilocks
+// prime p = 2^64 - 2^32 + 1. See ReduceGoldilocks.
+inline __m512i _mm512_hexl_goldilocks_reduce_epu64(__m512i x_hi, __m512i x_lo) {
+  __m512i epsilon = _mm512_set1_epi64(0xFFFFFFFF);
+  __m512i p = _mm512_set1_epi64(static_cast<int64_t>(kGoldilocksModulus));
+  __m512i x_hi_hi = _mm512_srli_epi64(x_hi, 32);
+  __m512i x_hi_lo = _mm512_and_si512(x_hi, epsilon);
+
+  __m512i t0 = _mm512_sub_epi64(x_lo, x_hi_hi);
+  __mmask8 borrow = _mm512_cmplt_epu64_mask(x_lo, x_hi_hi);
+  t0 = _mm512_mask_sub_epi64(t0, borrow, t0, epsilon);
+  __m512i t1 = _mm512_sub_epi64(_mm512_slli_epi64(x_hi_lo, 32), x_hi_lo);
+  __m512i t2 = _mm512_add_epi64(t0, t1);
+  __mmask8 carry = _mm512_cmplt_epu64_mask(t2, t1);
+  t2 = _mm512_mask_add_epi64(t2, carry, t2, epsilon);
+  // p > 2^63, so t2 - p wraps to a larger value iff t2 < p
+  return _mm512_min_epu64(t2, _mm512_sub_epi64(t2, p));
+}
+
+// Returns (x * y) mod p in each 64-bit lane, for the Goldilocks prime p
+inline __m512i _mm512_hexl_goldilocks_mul_epu64(__m512i x, __m512i y) {
+  __m512i prod_hi;
+  __m512i prod_lo;
+  _mm512_hexl_mul_wide_epu64(x, y, &prod_hi, &prod_lo);
+  return _mm512_hexl_goldilocks_reduce_epu64(prod_hi, prod_lo);
+}
+
+// Returns (x + y) mod p in each 64-bit lane, for the Goldilocks prime p.
+// Assumes x, y < p
+inline __m512i _mm512_hexl_goldilocks_add_epu64(__m512i x, __m512i y) {
+  __m512i epsilon = _mm512_set1_epi64(0xFFFFFFFF);
+  __m512i p = _mm512_set1_epi64(static_cast<int64_t>(kGoldilocksModulus));
+  __m512i sum = _mm512_add_epi64(x, y);
+  __mmask8 carry = _mm512_cmplt_epu64_mask(sum, x);
+  sum = _mm512_mask_add_epi64(sum, carry, sum, epsilon);
+  return _mm512_min_epu64(sum, _mm512_sub_epi64(sum, p));
+}
+
+// Returns (x - y) mod p in each 64-bit lane, for the Goldilocks prime p.
+// Assumes x, y < p
+inline __m512i _mm512_hexl_goldilocks_sub_epu64(__m512i x, __m512i y) {
+  __m512i epsilon = _mm512_set1_epi64(0xFFFFFFFF);
+  __m512i diff = _mm512_sub_epi64(x, y);
+  __mmask8 borrow = _mm512_cmplt_epu64_mask(x, y);
+  return _mm512_mask_sub_epi64(diff, borrow, diff, epsilon);
+}
+
+#ifdef HEXL_HAS_AVX512IFMA
+// The double-word functions below hold a value x < 2^156 in each 64-bit lane
+// of three vectors of 52-bit limbs, x = x[0] + x[1] * 2^52 + x[2] * 2^104
+
+// Splits the 128-bit values hi * 2^64 + lo in each 64-bit lane into limbs x
+inline void _mm512_hexl_dw_split_epu64(__m512i lo, __m512i hi, __m512i* x) {
+  const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+  x[0] = _mm512_and_epi64(lo, mask52);
+  x[1] = _mm512_and_epi64(
+      _mm512_or_epi64(_mm512_srli_epi64(lo, 52), _mm512_slli_epi64(hi, 12)),
+      mask52);
+  x[2] = _mm512_srli_epi64(hi, 40);
+}
+
+// Inverse of _mm512_hexl_dw_split_epu64. Requires x < 2^128.
+inline void _mm512_hexl_dw_merge_epu64(const __m512i* x, __m512i* lo,
+                                       __m512i* hi) {
+  *lo = _mm512_or_epi64(x[0], _mm512_slli_epi64(x[1], 52));
+  *hi =
+      _mm512_or_epi64(_mm512_srli_epi64(x[1], 12), _mm512_slli_epi64(x[2], 40));
+}
+
+// Loads the 8 128-bit values stored as (low word, high word) pairs at p into
+// limbs x
+inline void _mm512_hexl_dw_loadu_epu64(const uint64_t* p, __m512i* x) {
+  __m512i v1 = _mm512_loadu_si512(p);
+  __m512i v2 = _mm512_loadu_si512(p + 8);
+  __m512i lo = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), v2);
+  __m512i hi = _mm512_permutex2var_epi64(
+      v1, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), v2);
+  _mm512_hexl_dw_split_epu64(lo, hi, x);
+}
+
+// Inverse of _mm512_hexl_dw_loadu_epu64. Requires x < 2^128.
+inline void _mm512_hexl_dw_storeu_epu64(uint64_t* p, const __m512i* x) {
+  __m512i lo;
+  __m512i hi;
+  _mm512_hexl_dw_merge_epu64(x, &lo, &hi);
+  __m512i v1 = _mm512_permutex2var_epi64(
+      lo, _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0), hi);
+  __m512i v2 = _mm512_permutex2var_epi64(
+      lo, _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4), hi);
+  _mm512_storeu_si512(p, v1);
+  _mm512_storeu_si512(p + 8, v2);
+}
+
+// Returns x mod q, given x < 2q with x[0], x[1] < 2^52
+inline void _mm512_hexl_dw_reduce_once_epu52(__m512i* x, const __m512i* q) {
+  const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+  // Arithmetic shifts propagate the borrows
+  __m512i d0 = _mm512_sub_epi64(x[0], q[0]);
+  __m512i d1 = _mm512_add_epi64(_mm512_sub_epi64(x[1], q[1]),
+                                _mm512_srai_epi64(d0, 52));
+  __m512i d2 = _mm512_add_epi64(_mm512_sub_epi64(x[2], q[2]),
+                                _mm512_srai_epi64(d1, 52));
+  __mmask8 ge = _mm512_cmpge_epi64_mask(d2, _mm512_setzero_si512());
+  x[0] = _mm512_mask_and_epi64(x[0], ge, d0, mask52);
+  x[1] = _mm512_mask_and_epi64(x[1], ge, d1, mask52);
+  x[2] = _mm512_mask_mov_epi64(x[2], ge, d2);
+}
+
+// Returns (x + y) mod q. Assumes x, y < q < 2^155.
+inline void _mm512_hexl_dw_add_mod_epu52(__m512i* z, const __m512i* x,
+                                         const __m512i* y, const __m512i* q) {
+  const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+  __m512i s0 = _mm512_add_epi64(x[0], y[0]);
+  __m512i s1 = _mm512_add_epi64(_mm512_add_epi64(x[1], y[1]),
+                                _mm512_srli_epi64(s0, 52));
+  z[2] = _mm512_add_epi64(_mm512_add_epi64(x[2], y[2]),
+                          _mm512_srli_epi64(s1, 52));
+  z[0] = _mm512_and_epi64(s0, mask52);
+  z[1] = _mm512_and_epi64(s1, mask52);
+  _mm512_hexl_dw_reduce_once_epu52(z, q);
+}
+
+// Returns (x - y) mod q. Assumes x, y < q.
+inline void _mm512_hexl_dw_sub_mod_epu52(__m512i* z, const __m512i* x,
+                                         const __m512i* y, const __m512i* q) {
+  const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+  __m512i d0 = _mm512_sub_epi64(x[0], y[0]);
+  __m512i d1 = _mm512_add_epi64(_mm512_sub_epi64(x[1], y[1]),
+                                _mm512_srai_epi64(d0, 52));
+  __m512i d2 = _mm512_add_epi64(_mm512_sub_epi64(x[2], y[2]),
+                                _mm512_srai_epi64(d1, 52));
+  __mmask8 borrow = _mm512_cmplt_epi64_mask(d2, _mm512_setzero_si512());
+  // x - y + q in the lanes with x < y
+  __m512i a0 = _mm512_add_epi64(_mm512_and_epi64(d0, mask52), q[0]);
+  __m512i a1 = _mm512_add_epi64(
+      _mm512_add_epi64(_mm512_and_epi64(d1, mask52), q[1]),
+      _mm512_srli_epi64(a0, 52));
+  __m512i a2 = _mm512_add_epi64(_mm512_add_epi64(d2, q[2]),
+                                _mm512_srli_epi64(a1, 52));
+  z[0] = _mm512_and_epi64(_mm512_mask_mov_epi64(d0, borrow, a0), mask52);
+  z[1] = _mm512_and_epi64(_mm512_mask_mov_epi64(d1, borrow, a1), mask52);
+  z[2] = _mm512_mask_mov_epi64(d2, borrow, a2);
+}
+
+// Returns the Montgomery product x * y * 2^{-156} mod q, given q_inv = -q^{-1}
+// mod 2^52. Assumes x, y < q < 2^155 with all limbs less than 2^52.
+inline void _mm512_hexl_dw_montmul_epu52(__m512i* z, const __m512i* x,
+                                         const __m512i* y, const __m512i* q,
+                                         __m512i q_inv) {
+  const __m512i zero = _mm512_setzero_si512();
+  // The limbs t[j] accumulate unreduced sums below 2^57
+  __m512i t0 = zero;
+  __m512i t1 = zero;
+  __m512i t2 = zero;
+  __m512i t3 = zero;
+  for (size_t i = 0; i < 3; ++i) {
+    // t += x[i] * y
+    t0 = _mm512_madd52lo_epu64(t0, x[i], y[0]);
+    t1 = _mm512_madd52hi_epu64(t1, x[i], y[0]);
+    t1 = _mm512_madd52lo_epu64(t1, x[i], y[1]);
+    t2 = _mm512_madd52hi_epu64(t2, x[i], y[1]);
+    t2 = _mm512_madd52lo_epu64(t2, x[i], y[2]);
+    t3 = _mm512_madd52hi_epu64(t3, x[i], y[2]);
+
+    // t += m * q, for m such that t = 0 mod 2^52
+    __m512i m = _mm512_madd52lo_epu64(zero, t0, q_inv);
+    t0 = _mm512_madd52lo_epu64(t0, m, q[0]);
+    t1 = _mm512_madd52hi_epu64(t1, m, q[0]);
+    t1 = _mm512_madd52lo_epu64(t1, m, q[1]);
+    t2 = _mm512_madd52hi_epu64(t2, m, q[1]);
+    t2 = _mm512_madd52lo_epu64(t2, m, q[2]);
+    t3 = _mm512_madd52hi_epu64(t3, m, q[2]);
+
+    // t /= 2^52
+    t0 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52));
+    t1 = t2;
+    t2 = t3;
+    t3 = zero;
+  }
+
+  // Normalize t < 2q to 52-bit limbs, then subtract q
+  const __m512i mask52 = _mm512_set1_epi64((1ULL << 52) - 1);
+  t1 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52));
+  z[2] = _mm512_add_epi64(t2, _mm512_srli_epi64(t1, 52));
+  z[0] = _mm512_and_epi64(t0, mask52);
+  z[1] = _mm512_and_epi64(t1, mask52);
+  _mm512_hexl_dw_reduce_once_epu52(z, q);
+}
+#endif
+
+// Returns the high 32 bits of the 64-bit products of the unsigned 32-bit
+// integers in each 32-bit lane of x and y
+inline __m512i _mm512_hexl_mulhi_epu32(__m512i x, __m512i y) {
+  __m512i prod_even = _mm512_mul_epu32(x, y);
+  __m512i prod_odd =
+      _mm512_mul_epu32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32));
+  return _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(prod_even, 32),
+                                 prod_odd);
+}
+
+// Returns x * y mod q in [0, 2q) in each 32-bit lane, given y_precon =
+// floor(y * 2^32 / q). Requires y < q < 2^31.
+inline __m512i _mm512_hexl_mulmod_lazy_epu32(__m512i x, __m512i y,
+                                             __m512i y_precon, __m512i q) {
+  __m512i Q = _mm512_hexl_mulhi_epu32(x, y_precon);
+  return _mm512_sub_epi32(_mm512_mullo_epi32(x, y), _mm512_mullo_epi32(Q, q));
+}
+
+// Returns x mod q across each 32-bit integer SIMD lane
+// Assumes x < InputModFactor * q in all lanes, and InputModFactor * q / 2 <
+// 2^32
+template <int InputModFactor = 2>
+inline __m512i _mm512_hexl_small_mod_epu32(__m512i x, __m512i q,
+                                           __m512i* q_times_2 = nullptr,
+                                           __m512i* q_times_4 = nullptr) {
+  HEXL_CHECK(InputModFactor == 1 || InputModFactor == 2 ||
+                 InputModFactor == 4 || InputModFactor == 8,
+             "InputModFactor must be 1, 2, 4, or 8");
+  if (InputModFactor == 1) {
+    return x;
+  }
+  if (InputModFactor == 2) {
+    return _mm512_min_epu32(x, _mm512_sub_epi32(x, q));
+  }
+  if (InputModFactor == 4) {
+    HEXL_CHECK(q_times_2 != nullptr, "q_times_2 must not be nullptr");
+    x = _mm512_min_epu32(x, _mm512_sub_epi32(x, *q_times_2));
+    return _mm512_min_epu32(x, _mm512_sub_epi32(x, q));
+  }
+  if (InputModFactor == 8) {
+    HEXL_CHECK(q_times_2 != nullptr, "q_times_2 must not be nullptr");
+    HEXL_CHECK(q_times_4 != nullptr, "q_times_4 must not be nullptr");
+    x = _mm512_min_epu32(x, _mm512_sub_epi32(x, *q_times_4));
+    x = _mm512_min_epu32(x, _mm512_sub_epi32(x, *q_times_2));
+    return _mm512_min_epu32(x, _mm512_sub_epi32(x, q));
+  }
+}
+
 #endif  // HEXL_HAS_AVX512DQ
 
 }  // namespace hexl
@@ -12,7 +12,8 @@
 namespace intel {
 namespace hexl {
 
-// Use to disable avx512 dispatching at runtime
+// Use to disable avx2 and avx512 dispatching at runtime
+static const bool disable_avx2 = (std::getenv("HEXL_DISABLE_AVX2") != nullptr);
 static const bool disable_avx512dq =
     (std::getenv("HEXL_DISABLE_AVX512DQ") != nullptr);
 static const bool disable_avx512ifma =
@@ -23,6 +24,8 @@ static const bool disable_avx512vbmi2 =
 static const cpu_features::X86Features features =
     cpu_features::GetX86Info().features;
 
+static const bool has_avx2 = features.avx2 && !disable_avx2;
+
 static const bool has_avx512dq = features.avx512f && features.avx512dq &&
                                  features.avx512vl && !disable_avx512dq;
 
@@ -0,0 +1,73 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util/mapped-file.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace intel {
+namespace hexl {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename) {
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
+  if (!file) {
+    throw std::runtime_error("Unable to open " + filename);
+  }
+  m_size = static_cast<size_t>(file.tellg());
+  m_buffer.resize(m_size);
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char*>(m_buffer.data()),
+                 static_cast<std::streamsize>(m_size))) {
+    throw std::runtime_error("Unable to read " + filename);
+  }
+  m_data = m_buffer.data();
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+MappedFile::MappedFile(const std::string& filename) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open " + filename);
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    throw std::runtime_error("Unable to stat " + filename);
+  }
+  m_size = static_cast<size_t>(file_stat.st_size);
+  if (m_size > 0) {
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("Unable to mmap " + filename);
+    }
+    m_data = static_cast<const uint8_t*>(data);
+  }
+  // The mapping remains valid after closing the file
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (m_size > 0) {
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+  }
+}
+
+#endif
+
+}  // namespace hexl
+}  // namespace intel
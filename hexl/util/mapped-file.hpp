@@ -0,0 +1,45 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+
+#include "hexl/util/aligned-allocator.hpp"
+
+namespace intel {
+namespace hexl {
+
+/// @brief Read-only view of a file's contents
+/// @details On POSIX systems, the file is memory-mapped, so processes mapping
+/// the same file share its physical pages through the page cache. Elsewhere,
+/// the file is read into 64-byte aligned memory.
+class MappedFile {
+ public:
+  /// @brief Maps \p filename. Throws std::runtime_error on failure.
+  explicit MappedFile(const std::string& filename);
+
+  /// @brief Unmaps the file
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// @brief Returns the start of the file contents, aligned to at least 64
+  /// bytes
+  const uint8_t* Data() const { return m_data; }
+
+  /// @brief Returns the size of the file in bytes
+  size_t Size() const { return m_size; }
+
+ private:
+  const uint8_t* m_data{nullptr};
+  size_t m_size{0};
+
+  AlignedVector64<uint8_t> m_buffer;  // File contents if not memory-mapped
+};
+
+}  // namespace hexl
+}  // namespace intel
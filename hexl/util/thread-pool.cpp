@@ -0,0 +1,86 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util/thread-pool.hpp"
+
+#include "hexl/util/check.hpp"
+
+namespace intel {
+namespace hexl {
+
+ThreadPool::ThreadPool(size_t num_threads) {
+  HEXL_CHECK(num_threads > 0, "num_threads == 0");
+  m_workers.reserve(num_threads - 1);
+  for (size_t i = 1; i < num_threads; ++i) {
+    m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_start_cv.notify_all();
+  for (auto& worker : m_workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(size_t num_tasks,
+                             const std::function<void(size_t)>& task) {
+  if (m_workers.empty() || num_tasks <= 1) {
+    for (size_t i = 0; i < num_tasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(m_run_mutex);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = &task;
+    m_num_tasks = num_tasks;
+    m_next_task = 0;
+    m_num_busy_workers = m_workers.size();
+    ++m_generation;
+  }
+  m_start_cv.notify_all();
+
+  RunTasks();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_cv.wait(lock, [this] { return m_num_busy_workers == 0; });
+  m_task = nullptr;
+}
+
+void ThreadPool::WorkerLoop() {
+  uint64_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_start_cv.wait(lock,
+                      [&] { return m_stop || m_generation != generation; });
+      if (m_stop) {
+        return;
+      }
+      generation = m_generation;
+    }
+
+    RunTasks();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (--m_num_busy_workers == 0) {
+      m_done_cv.notify_one();
+    }
+  }
+}
+
+void ThreadPool::RunTasks() {
+  for (size_t i = m_next_task++; i < m_num_tasks; i = m_next_task++) {
+    (*m_task)(i);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,62 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace intel {
+namespace hexl {
+
+/// @brief Fixed-size pool of worker threads used to run multi-threaded
+/// kernels
+/// @details The worker threads are created once and sleep between calls, so
+/// the cost of a parallel call is a wake-up rather than a thread creation.
+/// Concurrent calls to ParallelFor on the same pool are serialized.
+class ThreadPool {
+ public:
+  /// @brief Creates a pool running tasks on \p num_threads threads, including
+  /// the calling thread. Spawns num_threads - 1 worker threads.
+  explicit ThreadPool(size_t num_threads);
+
+  /// @brief Stops and joins the worker threads
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// @brief Returns the number of threads, including the calling thread
+  size_t NumThreads() const { return m_workers.size() + 1; }
+
+  /// @brief Runs task(i) for each i in [0, num_tasks), and returns once all
+  /// tasks are complete. The calling thread also runs tasks.
+  void ParallelFor(size_t num_tasks, const std::function<void(size_t)>& task);
+
+ private:
+  void WorkerLoop();
+  void RunTasks();
+
+  std::vector<std::thread> m_workers;
+
+  std::mutex m_run_mutex;  // Serializes calls to ParallelFor
+  std::mutex m_mutex;      // Guards the state below
+  std::condition_variable m_start_cv;
+  std::condition_variable m_done_cv;
+
+  const std::function<void(size_t)>* m_task{nullptr};
+  size_t m_num_tasks{0};
+  std::atomic<size_t> m_next_task{0};
+  size_t m_num_busy_workers{0};
+  uint64_t m_generation{0};
+  bool m_stop{false};
+};
+
+}  // namespace hexl
+}  // namespace intel
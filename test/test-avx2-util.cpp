@@ -0,0 +1,137 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <immintrin.h>
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/avx2-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+TEST(AVX2, ExtractValues) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  __m256i x = _mm256_set_epi64x(1, 2, 3, 4);
+
+  AssertEqual(ExtractValues(x), std::vector<uint64_t>{4, 3, 2, 1});
+}
+
+TEST(AVX2, _mm256_hexl_mullo_epi64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  __m256i x = _mm256_set_epi64x(-1, 1ULL << 40, 123456789012345, 3);
+  __m256i y = _mm256_set_epi64x(-1, 1ULL << 30, 987654321, 5);
+  __m256i z = _mm256_hexl_mullo_epi64(x, y);
+
+  std::vector<uint64_t> exp{15, 123456789012345ULL * 987654321ULL,
+                            (1ULL << 40) * (1ULL << 30), 1};
+  AssertEqual(ExtractValues(z), exp);
+}
+
+TEST(AVX2, _mm256_hexl_mulhi_epi64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  for (size_t trial = 0; trial < 1000; ++trial) {
+    std::vector<uint64_t> x(4);
+    std::vector<uint64_t> y(4);
+    std::vector<uint64_t> exp(4);
+    for (size_t i = 0; i < 4; ++i) {
+      x[i] = distrib(gen);
+      y[i] = distrib(gen);
+      uint64_t lo;
+      uint64_t hi;
+      MultiplyUInt64(x[i], y[i], &hi, &lo);
+      exp[i] = hi;
+    }
+    __m256i v_x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x[0]));
+    __m256i v_y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y[0]));
+
+    AssertEqual(ExtractValues(_mm256_hexl_mulhi_epi64(v_x, v_y)), exp);
+
+    std::vector<uint64_t> approx =
+        ExtractValues(_mm256_hexl_mulhi_approx_epi64(v_x, v_y));
+    for (size_t i = 0; i < 4; ++i) {
+      ASSERT_LE(approx[i], exp[i]);
+      ASSERT_LE(exp[i] - approx[i], 2);
+    }
+  }
+}
+
+TEST(AVX2, _mm256_hexl_small_mod_epu64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  // Modulus with the high bit set checks the unsigned comparison
+  uint64_t q = (1ULL << 63) + 5;
+  __m256i v_q = _mm256_set1_epi64x(static_cast<int64_t>(q));
+  __m256i x = _mm256_set_epi64x(static_cast<int64_t>(q + 7),
+                                static_cast<int64_t>(q),
+                                static_cast<int64_t>(q - 1), 1);
+
+  std::vector<uint64_t> exp{1, q - 1, 0, 7};
+  AssertEqual(ExtractValues(_mm256_hexl_small_mod_epu64(x, v_q)), exp);
+}
+
+TEST(AVX2, _mm256_hexl_mulmod_lazy_epi64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t bits : {27, 29, 50, 61}) {
+    uint64_t q = GeneratePrimes(1, bits, 1024)[0];
+    std::uniform_int_distribution<uint64_t> distrib(0, 4 * q - 1);
+    std::uniform_int_distribution<uint64_t> distrib_y(0, q - 1);
+    __m256i v_q = _mm256_set1_epi64x(static_cast<int64_t>(q));
+    __m256i v_twice_q = _mm256_set1_epi64x(static_cast<int64_t>(2 * q));
+
+    for (size_t trial = 0; trial < 100; ++trial) {
+      std::vector<uint64_t> x(4);
+      for (auto& elem : x) {
+        elem = distrib(gen);
+      }
+      uint64_t y = distrib_y(gen);
+      __m256i v_x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x[0]));
+      __m256i v_y = _mm256_set1_epi64x(static_cast<int64_t>(y));
+
+      std::vector<uint64_t> result;
+      if (bits < 30) {
+        __m256i v_y_precon = _mm256_set1_epi64x(
+            static_cast<int64_t>(MultiplyFactor(y, 32, q).BarrettFactor()));
+        result = ExtractValues(_mm256_hexl_mulmod_lazy_epi64<32>(
+            v_x, v_y, v_y_precon, v_q, v_twice_q));
+      } else {
+        __m256i v_y_precon = _mm256_set1_epi64x(
+            static_cast<int64_t>(MultiplyFactor(y, 64, q).BarrettFactor()));
+        result = ExtractValues(_mm256_hexl_mulmod_lazy_epi64<64>(
+            v_x, v_y, v_y_precon, v_q, v_twice_q));
+      }
+      for (size_t i = 0; i < 4; ++i) {
+        ASSERT_LT(result[i], 2 * q);
+        ASSERT_EQ(result[i] % q, MultiplyMod(x[i] % q, y, q));
+      }
+    }
+  }
+}
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
@@ -301,6 +301,114 @@ TEST(AVX512, _mm512_hexl_barrett_reduce64) {
     }
   }
 }
+
+TEST(AVX512, _mm512_hexl_goldilocks_mul_epu64) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  const uint64_t p = kGoldilocksModulus;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+  std::uniform_int_distribution<uint64_t> distrib_mod(0, p - 1);
+
+  for (size_t trial = 0; trial < 200; ++trial) {
+    std::vector<uint64_t> x(8);
+    std::vector<uint64_t> y(8);
+    std::vector<uint64_t> x_mod(8);
+    std::vector<uint64_t> y_mod(8);
+    for (size_t i = 0; i < 8; ++i) {
+      x[i] = distrib(gen);
+      y[i] = distrib(gen);
+      x_mod[i] = distrib_mod(gen);
+      y_mod[i] = distrib_mod(gen);
+    }
+    // Edge cases
+    x[0] = 0xFFFFFFFFFFFFFFFFULL;
+    y[0] = 0xFFFFFFFFFFFFFFFFULL;
+    x_mod[1] = p - 1;
+    y_mod[1] = p - 1;
+
+    __m512i v_x = _mm512_loadu_si512(x.data());
+    __m512i v_y = _mm512_loadu_si512(y.data());
+    __m512i v_x_mod = _mm512_loadu_si512(x_mod.data());
+    __m512i v_y_mod = _mm512_loadu_si512(y_mod.data());
+
+    __m512i v_prod_hi;
+    __m512i v_prod_lo;
+    _mm512_hexl_mul_wide_epu64(v_x, v_y, &v_prod_hi, &v_prod_lo);
+    std::vector<uint64_t> prod_hi = ExtractValues(v_prod_hi);
+    std::vector<uint64_t> prod_lo = ExtractValues(v_prod_lo);
+    std::vector<uint64_t> reduced =
+        ExtractValues(_mm512_hexl_goldilocks_reduce_epu64(v_x, v_y));
+    std::vector<uint64_t> prod =
+        ExtractValues(_mm512_hexl_goldilocks_mul_epu64(v_x, v_y));
+    std::vector<uint64_t> sum =
+        ExtractValues(_mm512_hexl_goldilocks_add_epu64(v_x_mod, v_y_mod));
+    std::vector<uint64_t> diff =
+        ExtractValues(_mm512_hexl_goldilocks_sub_epu64(v_x_mod, v_y_mod));
+
+    for (size_t i = 0; i < 8; ++i) {
+      uint64_t exp_hi;
+      uint64_t exp_lo;
+      MultiplyUInt64(x[i], y[i], &exp_hi, &exp_lo);
+      ASSERT_EQ(prod_hi[i], exp_hi);
+      ASSERT_EQ(prod_lo[i], exp_lo);
+      ASSERT_EQ(reduced[i], ReduceGoldilocks(x[i], y[i]));
+      ASSERT_EQ(prod[i], MultiplyModGoldilocks(x[i], y[i]));
+      ASSERT_EQ(sum[i], AddModGoldilocks(x_mod[i], y_mod[i]));
+      ASSERT_EQ(diff[i], SubModGoldilocks(x_mod[i], y_mod[i]));
+    }
+  }
+}
+
+TEST(AVX512, _mm512_hexl_mulhi_epu32) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint32_t> distrib;
+
+  alignas(64) uint32_t x[16];
+  alignas(64) uint32_t y[16];
+  alignas(64) uint32_t z[16];
+  for (size_t i = 0; i < 16; ++i) {
+    x[i] = distrib(gen);
+    y[i] = distrib(gen);
+  }
+  _mm512_store_si512(z, _mm512_hexl_mulhi_epu32(_mm512_load_si512(x),
+                                                _mm512_load_si512(y)));
+  for (size_t i = 0; i < 16; ++i) {
+    ASSERT_EQ(z[i], (uint64_t(x[i]) * y[i]) >> 32);
+  }
+}
+
+TEST(AVX512, _mm512_hexl_small_mod_epu32) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  __m512i a = _mm512_set_epi32(0, 2, 4, 6, 8, 10, 11, 12, 0, 2, 4, 6, 8, 10,
+                               11, 12);
+  __m512i moduli =
+      _mm512_set_epi32(1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8);
+  __m512i expected_out =
+      _mm512_set_epi32(0, 0, 1, 2, 3, 4, 4, 4, 0, 0, 1, 2, 3, 4, 4, 4);
+  CheckEqual(_mm512_hexl_small_mod_epu32(a, moduli), expected_out);
+
+  // Inputs in [0, 4q) for q near 2^31
+  uint32_t q = (1U << 31) - 1;
+  __m512i v_q = _mm512_set1_epi32(static_cast<int>(q));
+  __m512i v_twice_q = _mm512_set1_epi32(static_cast<int>(2 * q));
+  __m512i b = _mm512_set_epi32(0, 1, q - 1, q, q + 1, 2 * q - 1, 2 * q,
+                               2 * q + 1, 0xFFFFFFFF, 5, 6, 7, 8, 9, 10, 11);
+  __m512i expected_b = _mm512_set_epi32(0, 1, q - 1, 0, 1, q - 1, 0, 1, 1, 5,
+                                        6, 7, 8, 9, 10, 11);
+  CheckEqual(_mm512_hexl_small_mod_epu32<4>(b, v_q, &v_twice_q), expected_b);
+}
 #endif
 
 }  // namespace hexl
@@ -0,0 +1,50 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/bit-reverse-avx512.hpp"
+#include "ntt/bit-reverse-internal.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+// Checks AVX512 and native implementations match
+#ifdef HEXL_HAS_AVX512DQ
+TEST(BitReversePermute, AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  for (uint64_t log_n = 6; log_n <= 16; ++log_n) {
+    uint64_t n = 1ULL << log_n;
+    std::vector<uint64_t> input(n);
+    for (auto& value : input) {
+      value = distrib(gen);
+    }
+
+    std::vector<uint64_t> expected(n);
+    BitReversePermuteNative(expected.data(), input.data(), n);
+
+    std::vector<uint64_t> result(n);
+    BitReversePermuteAVX512(result.data(), input.data(), n);
+    AssertEqual(result, expected);
+
+    BitReversePermuteInPlaceAVX512(input.data(), n);
+    AssertEqual(input, expected);
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
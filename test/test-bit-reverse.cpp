@@ -0,0 +1,86 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+#include "hexl/ntt/bit-reverse.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/bit-reverse-internal.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+std::vector<uint64_t> ReferenceBitReverse(const std::vector<uint64_t>& input) {
+  uint64_t log_n = Log2(input.size());
+  std::vector<uint64_t> output(input.size());
+  for (size_t i = 0; i < input.size(); ++i) {
+    output[ReverseBits(i, log_n)] = input[i];
+  }
+  return output;
+}
+
+}  // namespace
+
+TEST(BitReversePermute, Native) {
+  for (uint64_t log_n = 0; log_n <= 14; ++log_n) {
+    uint64_t n = 1ULL << log_n;
+    std::vector<uint64_t> input(n);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<uint64_t> expected = ReferenceBitReverse(input);
+
+    std::vector<uint64_t> result(n);
+    BitReversePermuteNative(result.data(), input.data(), n);
+    AssertEqual(result, expected);
+
+    BitReversePermuteInPlaceNative(input.data(), n);
+    AssertEqual(input, expected);
+  }
+}
+
+TEST(BitReversePermute, PublicAPI) {
+  for (uint64_t log_n = 0; log_n <= 14; ++log_n) {
+    uint64_t n = 1ULL << log_n;
+    std::vector<uint64_t> input(n);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<uint64_t> expected = ReferenceBitReverse(input);
+
+    std::vector<uint64_t> result(n);
+    BitReversePermute(result.data(), input.data(), n);
+    AssertEqual(result, expected);
+
+    // The permutation is an involution
+    BitReversePermute(result.data(), result.data(), n);
+    AssertEqual(result, input);
+
+    BitReversePermuteInPlace(input.data(), n);
+    AssertEqual(input, expected);
+  }
+}
+
+TEST(BitReversePermute, U32) {
+  for (uint64_t log_n = 0; log_n <= 14; ++log_n) {
+    uint64_t n = 1ULL << log_n;
+    std::vector<uint32_t> input(n);
+    std::iota(input.begin(), input.end(), 0);
+    std::vector<uint32_t> expected(n);
+    for (size_t i = 0; i < n; ++i) {
+      expected[ReverseBits(i, log_n)] = input[i];
+    }
+
+    std::vector<uint32_t> result(n);
+    BitReversePermute(result.data(), input.data(), n);
+    AssertEqual(result, expected);
+
+    BitReversePermuteInPlace(input.data(), n);
+    AssertEqual(input, expected);
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,159 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/ntt/double-word-ntt.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "ntt/double-word-ntt-internal.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+std::vector<DoubleWord> RandomDoubleWordVector(uint64_t n,
+                                               const DoubleWordModulus& q) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  std::vector<DoubleWord> values(n);
+  for (auto& value : values) {
+    value = ShiftRightDoubleWord(DoubleWord{distrib(gen), distrib(gen)},
+                                 128 - q.BitLength());
+    if (value >= q.Modulus()) {
+      value = SubDoubleWord(value, q.Modulus());
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
+class DoubleWordNTTTest
+    : public ::testing::TestWithParam<std::tuple<uint64_t, uint64_t>> {};
+
+// Compares against a direct evaluation at the odd powers of the root of unity
+TEST_P(DoubleWordNTTTest, Naive) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t bit_size = std::get<1>(GetParam());
+  DoubleWord q = GeneratePrimesDoubleWord(1, bit_size - 1, N)[0];
+  DoubleWordModulus modulus(q);
+  DoubleWordNTT ntt(N, q);
+
+  std::vector<DoubleWord> input = RandomDoubleWordVector(N, modulus);
+  input[0] = SubDoubleWord(q, DoubleWord{1, 0});
+  std::vector<DoubleWord> result(N);
+  ntt.ComputeForward(result.data(), input.data(), NTT::Ordering::kNatural);
+
+  DoubleWord root = ntt.GetMinimalRootOfUnity();
+  for (size_t i = 0; i < N; ++i) {
+    DoubleWord point =
+        PowModDoubleWord(root, DoubleWord{2 * i + 1, 0}, modulus);
+    DoubleWord expected{0, 0};
+    DoubleWord point_power{1, 0};
+    for (size_t j = 0; j < N; ++j) {
+      expected = AddModDoubleWord(
+          expected, MultiplyModDoubleWord(input[j], point_power, modulus),
+          modulus);
+      point_power = MultiplyModDoubleWord(point_power, point, modulus);
+    }
+    ASSERT_EQ(expected, result[i]) << "i " << i;
+  }
+
+  std::vector<DoubleWord> inverse(N);
+  ntt.ComputeInverse(inverse.data(), result.data(), NTT::Ordering::kNatural);
+  AssertEqual(input, inverse);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    DoubleWordNTT, DoubleWordNTTTest,
+    ::testing::Combine(::testing::Values(1, 2, 4, 8, 16, 32, 128),
+                       ::testing::Values(64, 100, 125)));
+
+TEST(DoubleWordNTT, RoundTrip) {
+  for (uint64_t N = 1; N <= (1 << 12); N <<= 1) {
+    for (uint64_t bit_size : {80, 125}) {
+      DoubleWord q = GeneratePrimesDoubleWord(1, bit_size - 1, N)[0];
+      DoubleWordModulus modulus(q);
+      DoubleWordNTT ntt(N, q);
+      std::vector<DoubleWord> input = RandomDoubleWordVector(N, modulus);
+      input[0] = SubDoubleWord(q, DoubleWord{1, 0});
+
+      std::vector<DoubleWord> data = input;
+      ntt.ComputeForward(data.data(), data.data());
+      ntt.ComputeInverse(data.data(), data.data());
+      AssertEqual(input, data);
+    }
+  }
+}
+
+TEST(DoubleWordNTT, PolyMulNegacyclic) {
+  uint64_t N = 64;
+  DoubleWord q = GeneratePrimesDoubleWord(1, 120, N)[0];
+  DoubleWordModulus modulus(q);
+  DoubleWordNTT ntt(N, q);
+
+  std::vector<DoubleWord> a = RandomDoubleWordVector(N, modulus);
+  std::vector<DoubleWord> b = RandomDoubleWordVector(N, modulus);
+
+  // Schoolbook multiplication modulo X^N + 1
+  std::vector<DoubleWord> expected(N, DoubleWord{0, 0});
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = 0; j < N; ++j) {
+      DoubleWord prod = MultiplyModDoubleWord(a[i], b[j], modulus);
+      size_t k = (i + j) % N;
+      expected[k] = (i + j < N)
+                        ? AddModDoubleWord(expected[k], prod, modulus)
+                        : SubModDoubleWord(expected[k], prod, modulus);
+    }
+  }
+
+  std::vector<DoubleWord> a_ntt(N);
+  std::vector<DoubleWord> b_ntt(N);
+  ntt.ComputeForward(a_ntt.data(), a.data());
+  ntt.ComputeForward(b_ntt.data(), b.data());
+  std::vector<DoubleWord> prod(N);
+  for (size_t i = 0; i < N; ++i) {
+    prod[i] = MultiplyModDoubleWord(a_ntt[i], b_ntt[i], modulus);
+  }
+  ntt.ComputeInverse(prod.data(), prod.data());
+  AssertEqual(expected, prod);
+}
+
+// Checks the native transforms against ComputeForward and ComputeInverse,
+// which dispatch to AVX512-IFMA when available
+TEST(DoubleWordNTT, Native) {
+  uint64_t N = 1024;
+  DoubleWord q = GeneratePrimesDoubleWord(1, 124, N)[0];
+  DoubleWordModulus modulus(q);
+  DoubleWordNTT ntt(N, q);
+
+  std::vector<DoubleWord> input = RandomDoubleWordVector(N, modulus);
+  std::vector<DoubleWord> expected(N);
+  ntt.ComputeForward(expected.data(), input.data());
+
+  std::vector<DoubleWord> native = input;
+  ForwardTransformToBitReverseDoubleWord(
+      native.data(), N, ntt.GetRootOfUnityPowers().data(), modulus);
+  AssertEqual(expected, native);
+
+  ntt.ComputeInverse(expected.data(), input.data());
+  DoubleWord inv_n = MultiplyModDoubleWord(
+      InverseModDoubleWord(DoubleWord{N, 0}, modulus),
+      PowModDoubleWord(DoubleWord{2, 0}, DoubleWord{128, 0}, modulus),
+      modulus);
+  native = input;
+  InverseTransformFromBitReverseDoubleWord(
+      native.data(), N, ntt.GetInvRootOfUnityPowers().data(), modulus, inv_n);
+  AssertEqual(expected, native);
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -171,6 +171,44 @@ TEST(EltwiseAddMod, vector_scalar_avx512_native_match) {
     }
   }
 }
+
+// Checks AVX512 and native eltwise add implementations on 32-bit elements
+// match
+TEST(EltwiseAddMod, u32_avx512_native_match) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 1; bits <= 30; ++bits) {
+    for (uint64_t modulus : {1ULL << bits, (1ULL << (bits + 1)) - 1}) {
+      std::uniform_int_distribution<uint32_t> distrib(
+          0, static_cast<uint32_t>(modulus - 1));
+      std::vector<uint32_t> op1(length, 0);
+      std::vector<uint32_t> op2(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+      }
+      uint32_t scalar = distrib(gen);
+
+      std::vector<uint32_t> native(length, 0);
+      std::vector<uint32_t> avx512(length, 0);
+      EltwiseAddModNative(native.data(), op1.data(), op2.data(), length,
+                          modulus);
+      EltwiseAddModAVX512(avx512.data(), op1.data(), op2.data(), length,
+                          modulus);
+      ASSERT_EQ(native, avx512);
+
+      EltwiseAddModNative(native.data(), op1.data(), scalar, length, modulus);
+      EltwiseAddModAVX512(avx512.data(), op1.data(), scalar, length, modulus);
+      ASSERT_EQ(native, avx512);
+    }
+  }
+}
 #endif
 
 }  // namespace hexl
@@ -0,0 +1,56 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-cmp-add-avx2.hpp"
+#include "eltwise/eltwise-cmp-add-internal.hpp"
+#include "hexl/eltwise/eltwise-cmp-add.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Checks AVX2 and native implementations match
+TEST(EltwiseCmpAdd, AVX2) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+
+  uint64_t length = 173;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  // Values with the high bit set check the unsigned comparisons
+  std::uniform_int_distribution<uint64_t> distrib(0, (1ULL << 63) + 100);
+
+  for (size_t cmp = 0; cmp < 8; ++cmp) {
+    for (size_t trial = 0; trial < 200; ++trial) {
+      std::vector<uint64_t> op1(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+      }
+      uint64_t bound = op1[trial % length];
+      uint64_t diff = distrib(gen) + 1;
+
+      std::vector<uint64_t> out_native(length, 0);
+      std::vector<uint64_t> out_avx2(length, 0);
+      EltwiseCmpAddNative(out_native.data(), op1.data(), length,
+                          static_cast<CMPINT>(cmp), bound, diff);
+      EltwiseCmpAddAVX2(out_avx2.data(), op1.data(), length,
+                        static_cast<CMPINT>(cmp), bound, diff);
+
+      ASSERT_EQ(out_native, out_avx2);
+    }
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
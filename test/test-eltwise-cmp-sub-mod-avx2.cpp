@@ -0,0 +1,60 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-cmp-sub-mod-avx2.hpp"
+#include "eltwise/eltwise-cmp-sub-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-cmp-sub-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Checks AVX2 and native implementations match
+TEST(EltwiseCmpSubMod, AVX2) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+
+  uint64_t length = 173;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (size_t cmp = 0; cmp < 8; ++cmp) {
+    for (size_t bits : {20, 40, 50, 60}) {
+      uint64_t modulus = GeneratePrimes(1, bits, 1024)[0];
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::uniform_int_distribution<uint64_t> distrib_op;
+
+      for (size_t trial = 0; trial < 50; ++trial) {
+        std::vector<uint64_t> op1(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          op1[i] = (i % 2 == 0) ? distrib(gen) : distrib_op(gen);
+        }
+        uint64_t bound = distrib(gen);
+        uint64_t diff = distrib(gen) % (modulus - 1) + 1;
+
+        std::vector<uint64_t> out_native(length, 0);
+        std::vector<uint64_t> out_avx2(length, 0);
+        EltwiseCmpSubModNative(out_native.data(), op1.data(), length, modulus,
+                               static_cast<CMPINT>(cmp), bound, diff);
+        EltwiseCmpSubModAVX2(out_avx2.data(), op1.data(), length, modulus,
+                             static_cast<CMPINT>(cmp), bound, diff);
+
+        ASSERT_EQ(out_native, out_avx2);
+      }
+    }
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,69 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-double-word-avx512.hpp"
+#include "eltwise/eltwise-double-word-internal.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512IFMA
+TEST(EltwiseDoubleWord, AVX512) {
+  if (!has_avx512ifma) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  std::vector<DoubleWord> moduli{
+      // 2^107 - 1 and 2^61 - 1
+      DoubleWord{0xFFFFFFFFFFFFFFFFULL, (1ULL << 43) - 1},
+      DoubleWord{(1ULL << 61) - 1, 0}, DoubleWord{3, 0},
+      GeneratePrimesDoubleWord(1, 124, 4096)[0],
+      GeneratePrimesDoubleWord(1, 103, 4096)[0]};
+
+  for (const auto& q : moduli) {
+    DoubleWordModulus modulus(q);
+    for (size_t n : {1, 7, 8, 9, 64, 1021, 1024}) {
+      std::vector<DoubleWord> op1(n);
+      std::vector<DoubleWord> op2(n);
+      for (size_t i = 0; i < n; ++i) {
+        op1[i] = ShiftRightDoubleWord(DoubleWord{distrib(gen), distrib(gen)},
+                                      128 - modulus.BitLength());
+        op2[i] = ShiftRightDoubleWord(DoubleWord{distrib(gen), distrib(gen)},
+                                      128 - modulus.BitLength());
+        if (op1[i] >= q) {
+          op1[i] = SubDoubleWord(op1[i], q);
+        }
+        if (op2[i] >= q) {
+          op2[i] = SubDoubleWord(op2[i], q);
+        }
+      }
+      // Edge cases
+      op1[n - 1] = SubDoubleWord(q, DoubleWord{1, 0});
+      op2[n - 1] = SubDoubleWord(q, DoubleWord{1, 0});
+
+      std::vector<DoubleWord> result_native(n);
+      std::vector<DoubleWord> result_avx512(n);
+      EltwiseMultModDoubleWordNative(result_native.data(), op1.data(),
+                                     op2.data(), n, modulus);
+      EltwiseMultModDoubleWordAVX512(result_avx512.data(), op1.data(),
+                                     op2.data(), n, modulus);
+      AssertEqual(result_native, result_avx512);
+    }
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
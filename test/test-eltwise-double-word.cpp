@@ -0,0 +1,98 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "hexl/eltwise/eltwise-double-word.hpp"
+#include "hexl/number-theory/double-word.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Returns n random values in [0, q)
+std::vector<DoubleWord> RandomDoubleWordVector(uint64_t n,
+                                               const DoubleWordModulus& q) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  std::vector<DoubleWord> values(n);
+  for (auto& value : values) {
+    value = ShiftRightDoubleWord(DoubleWord{distrib(gen), distrib(gen)},
+                                 128 - q.BitLength());
+    if (value >= q.Modulus()) {
+      value = SubDoubleWord(value, q.Modulus());
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(EltwiseDoubleWord, small) {
+  // 2^107 - 1
+  const DoubleWord q{0xFFFFFFFFFFFFFFFFULL, (1ULL << 43) - 1};
+  DoubleWordModulus modulus(q);
+  const DoubleWord q_minus_1 = SubDoubleWord(q, DoubleWord{1, 0});
+  const DoubleWord two_64{0, 1};
+
+  std::vector<DoubleWord> op1{DoubleWord{0, 0}, DoubleWord{1, 0}, q_minus_1,
+                              q_minus_1, two_64, DoubleWord{5, 0}};
+  std::vector<DoubleWord> op2{DoubleWord{0, 0}, q_minus_1, q_minus_1,
+                              DoubleWord{1, 0}, two_64, DoubleWord{7, 0}};
+  std::vector<DoubleWord> result(op1.size());
+
+  EltwiseAddModDoubleWord(result.data(), op1.data(), op2.data(), op1.size(),
+                          modulus);
+  AssertEqual(result, std::vector<DoubleWord>{
+                          DoubleWord{0, 0}, DoubleWord{0, 0},
+                          SubDoubleWord(q, DoubleWord{2, 0}), DoubleWord{0, 0},
+                          DoubleWord{0, 2}, DoubleWord{12, 0}});
+
+  EltwiseSubModDoubleWord(result.data(), op1.data(), op2.data(), op1.size(),
+                          modulus);
+  AssertEqual(result, std::vector<DoubleWord>{
+                          DoubleWord{0, 0}, DoubleWord{2, 0}, DoubleWord{0, 0},
+                          SubDoubleWord(q, DoubleWord{2, 0}), DoubleWord{0, 0},
+                          SubDoubleWord(q, DoubleWord{2, 0})});
+
+  // 2^64 * 2^64 = 2^128 = 2^21 mod 2^107 - 1
+  EltwiseMultModDoubleWord(result.data(), op1.data(), op2.data(), op1.size(),
+                           modulus);
+  AssertEqual(result, std::vector<DoubleWord>{
+                          DoubleWord{0, 0}, q_minus_1, DoubleWord{1, 0},
+                          q_minus_1, DoubleWord{1ULL << 21, 0},
+                          DoubleWord{35, 0}});
+}
+
+TEST(EltwiseDoubleWord, random) {
+  for (size_t bit_size : {64, 100, 125}) {
+    DoubleWordModulus modulus(GeneratePrimesDoubleWord(1, bit_size - 1)[0]);
+    for (size_t n : {1, 7, 8, 9, 64, 1021}) {
+      std::vector<DoubleWord> op1 = RandomDoubleWordVector(n, modulus);
+      std::vector<DoubleWord> op2 = RandomDoubleWordVector(n, modulus);
+      std::vector<DoubleWord> sum(n);
+      std::vector<DoubleWord> diff(n);
+      std::vector<DoubleWord> prod(n);
+      EltwiseAddModDoubleWord(sum.data(), op1.data(), op2.data(), n, modulus);
+      EltwiseSubModDoubleWord(diff.data(), op1.data(), op2.data(), n, modulus);
+      EltwiseMultModDoubleWord(prod.data(), op1.data(), op2.data(), n,
+                               modulus);
+
+      for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(op1[i], SubModDoubleWord(sum[i], op2[i], modulus));
+        ASSERT_EQ(op1[i], AddModDoubleWord(diff[i], op2[i], modulus));
+        ASSERT_EQ(MultiplyModDoubleWord(op1[i], op2[i], modulus), prod[i]);
+      }
+    }
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,76 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-fma-mod-avx2.hpp"
+#include "eltwise/eltwise-fma-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-fma-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+namespace {
+
+// Checks the AVX2 implementation matches the native one, with and without
+// the addend
+template <int InputModFactor>
+void CheckEltwiseFMAModAVX2(uint64_t modulus_bits) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  uint64_t length = 173;
+  uint64_t modulus = GeneratePrimes(1, modulus_bits, 1024)[0];
+  std::uniform_int_distribution<uint64_t> distrib(
+      0, InputModFactor * modulus - 1);
+
+  for (size_t trial = 0; trial < 50; ++trial) {
+    std::vector<uint64_t> arg1(length, 0);
+    std::vector<uint64_t> arg3(length, 0);
+    for (size_t i = 0; i < length; ++i) {
+      arg1[i] = distrib(gen);
+      arg3[i] = distrib(gen);
+    }
+    uint64_t arg2 = distrib(gen);
+
+    std::vector<uint64_t> out_native(length, 0);
+    std::vector<uint64_t> out_avx2(length, 0);
+    EltwiseFMAModNative<InputModFactor>(out_native.data(), arg1.data(), arg2,
+                                        arg3.data(), length, modulus);
+    EltwiseFMAModAVX2<InputModFactor>(out_avx2.data(), arg1.data(), arg2,
+                                      arg3.data(), length, modulus);
+    ASSERT_EQ(out_native, out_avx2);
+
+    EltwiseFMAModNative<InputModFactor>(out_native.data(), arg1.data(), arg2,
+                                        nullptr, length, modulus);
+    EltwiseFMAModAVX2<InputModFactor>(out_avx2.data(), arg1.data(), arg2,
+                                      nullptr, length, modulus);
+    ASSERT_EQ(out_native, out_avx2);
+  }
+}
+
+}  // namespace
+
+TEST(EltwiseFMAMod, AVX2) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  for (uint64_t bits : {20, 25, 31}) {
+    CheckEltwiseFMAModAVX2<1>(bits);
+    CheckEltwiseFMAModAVX2<2>(bits);
+    CheckEltwiseFMAModAVX2<4>(bits);
+    CheckEltwiseFMAModAVX2<8>(bits);
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -262,6 +262,70 @@ TEST(EltwiseFMAMod, AVX512) {
     }
   }
 }
+
+// Checks AVX512 and native eltwise FMA implementations on 32-bit elements
+// match
+TEST(EltwiseFMAMod, U32AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 1; bits <= 30; ++bits) {
+    for (uint64_t modulus : {1ULL << bits, (1ULL << (bits + 1)) - 1}) {
+      for (uint64_t input_mod_factor : {1, 2, 4, 8}) {
+        if (input_mod_factor * modulus > (1ULL << 32)) {
+          continue;
+        }
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint32_t> arg1(length, 0);
+        std::vector<uint32_t> arg3(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          arg1[i] = static_cast<uint32_t>(distrib(gen));
+          arg3[i] = static_cast<uint32_t>(distrib(gen));
+        }
+        uint32_t arg2 = static_cast<uint32_t>(distrib(gen));
+
+        std::vector<const uint32_t*> adds{arg3.data(), nullptr};
+        for (const uint32_t* add : adds) {
+          std::vector<uint32_t> native(length, 0);
+          std::vector<uint32_t> avx512(length, 0);
+          switch (input_mod_factor) {
+            case 1:
+              EltwiseFMAModNative<1>(native.data(), arg1.data(), arg2, add,
+                                     length, modulus);
+              EltwiseFMAModAVX512U32<1>(avx512.data(), arg1.data(), arg2, add,
+                                        length, modulus);
+              break;
+            case 2:
+              EltwiseFMAModNative<2>(native.data(), arg1.data(), arg2, add,
+                                     length, modulus);
+              EltwiseFMAModAVX512U32<2>(avx512.data(), arg1.data(), arg2, add,
+                                        length, modulus);
+              break;
+            case 4:
+              EltwiseFMAModNative<4>(native.data(), arg1.data(), arg2, add,
+                                     length, modulus);
+              EltwiseFMAModAVX512U32<4>(avx512.data(), arg1.data(), arg2, add,
+                                        length, modulus);
+              break;
+            case 8:
+              EltwiseFMAModNative<8>(native.data(), arg1.data(), arg2, add,
+                                     length, modulus);
+              EltwiseFMAModAVX512U32<8>(avx512.data(), arg1.data(), arg2, add,
+                                        length, modulus);
+              break;
+          }
+          ASSERT_EQ(native, avx512);
+        }
+      }
+    }
+  }
+}
 #endif
 
 }  // namespace hexl
@@ -9,6 +9,7 @@
 
 #include "eltwise/eltwise-fma-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-fma-mod.hpp"
+#include "hexl/eltwise/eltwise-reduce-mod.hpp"
 #include "hexl/logging/logging.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "test-util.hpp"
@@ -96,5 +97,74 @@ TEST(EltwiseFMAMod, mult_input_mod_factor) {
   }
 }
 
+TEST(EltwiseFMAMod, u32) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus : {uint64_t(101), GeneratePrimes(1, 28, 1024)[0],
+                           GeneratePrimes(1, 30, 1024)[0]}) {
+    for (uint64_t input_mod_factor : {1, 2, 4, 8}) {
+      if (input_mod_factor * modulus > (1ULL << 32)) {
+        continue;
+      }
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      size_t length = 173;
+      std::vector<uint32_t> arg1(length);
+      std::vector<uint32_t> arg3(length);
+      uint32_t arg2 = static_cast<uint32_t>(distrib(gen));
+      std::vector<uint32_t> exp_out(length);
+      std::vector<uint32_t> exp_out_null(length);
+      for (size_t i = 0; i < length; ++i) {
+        arg1[i] = static_cast<uint32_t>(distrib(gen));
+        arg3[i] = static_cast<uint32_t>(distrib(gen));
+        uint64_t prod = (uint64_t(arg1[i]) % modulus) * (arg2 % modulus);
+        exp_out_null[i] = static_cast<uint32_t>(prod % modulus);
+        exp_out[i] = static_cast<uint32_t>((prod + arg3[i]) % modulus);
+      }
+
+      std::vector<uint32_t> result(length);
+      EltwiseFMAMod(result.data(), arg1.data(), arg2, arg3.data(), length,
+                    modulus, input_mod_factor);
+      ASSERT_EQ(result, exp_out);
+
+      EltwiseFMAMod(result.data(), arg1.data(), arg2, nullptr, length, modulus,
+                    input_mod_factor);
+      ASSERT_EQ(result, exp_out_null);
+    }
+  }
+}
+
+TEST(EltwiseFMAMod, Montgomery) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus :
+       {uint64_t(769), GeneratePrimes(1, 50, 1024)[0]}) {
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+    size_t length = 173;
+    uint64_t arg2 = distrib(gen);
+    std::vector<uint64_t> arg1(length);
+    std::vector<uint64_t> arg3(length);
+    std::vector<uint64_t> exp_out(length);
+    for (size_t i = 0; i < length; ++i) {
+      arg1[i] = distrib(gen);
+      arg3[i] = distrib(gen);
+      exp_out[i] = AddUIntMod(MultiplyMod(arg1[i], arg2, modulus), arg3[i],
+                              modulus);
+    }
+
+    uint64_t arg2_mont = ToMontgomery(arg2, modulus);
+    EltwiseToMontgomery(arg1.data(), arg1.data(), length, modulus);
+    EltwiseToMontgomery(arg3.data(), arg3.data(), length, modulus);
+
+    std::vector<uint64_t> result(length);
+    EltwiseFMAModMontgomery(result.data(), arg1.data(), arg2_mont, arg3.data(),
+                            length, modulus);
+    EltwiseFromMontgomery(result.data(), result.data(), length, modulus);
+    ASSERT_EQ(result, exp_out);
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
@@ -0,0 +1,85 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-goldilocks-avx512.hpp"
+#include "eltwise/eltwise-goldilocks-internal.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX512DQ
+TEST(EltwiseGoldilocks, AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  const uint64_t p = kGoldilocksModulus;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+  std::uniform_int_distribution<uint64_t> distrib_mod(0, p - 1);
+
+  for (size_t n : {1, 7, 8, 9, 64, 1021, 1024}) {
+    std::vector<uint64_t> op1(n);
+    std::vector<uint64_t> op2(n);
+    std::vector<uint64_t> any1(n);
+    std::vector<uint64_t> any2(n);
+    for (size_t i = 0; i < n; ++i) {
+      op1[i] = distrib_mod(gen);
+      op2[i] = distrib_mod(gen);
+      any1[i] = distrib(gen);
+      any2[i] = distrib(gen);
+    }
+    // Edge cases
+    op1[0] = p - 1;
+    op2[0] = p - 1;
+    any1[n - 1] = 0xFFFFFFFFFFFFFFFFULL;
+    any2[n - 1] = 0xFFFFFFFFFFFFFFFFULL;
+    uint64_t scalar = distrib(gen);
+
+    std::vector<uint64_t> result_native(n);
+    std::vector<uint64_t> result_avx512(n);
+
+    EltwiseAddModGoldilocksNative(result_native.data(), op1.data(), op2.data(),
+                                  n);
+    EltwiseAddModGoldilocksAVX512(result_avx512.data(), op1.data(), op2.data(),
+                                  n);
+    AssertEqual(result_native, result_avx512);
+
+    EltwiseSubModGoldilocksNative(result_native.data(), op1.data(), op2.data(),
+                                  n);
+    EltwiseSubModGoldilocksAVX512(result_avx512.data(), op1.data(), op2.data(),
+                                  n);
+    AssertEqual(result_native, result_avx512);
+
+    EltwiseMultModGoldilocksNative(result_native.data(), any1.data(),
+                                   any2.data(), n);
+    EltwiseMultModGoldilocksAVX512(result_avx512.data(), any1.data(),
+                                   any2.data(), n);
+    AssertEqual(result_native, result_avx512);
+
+    EltwiseFMAModGoldilocksNative(result_native.data(), any1.data(), scalar,
+                                  any2.data(), n);
+    EltwiseFMAModGoldilocksAVX512(result_avx512.data(), any1.data(), scalar,
+                                  any2.data(), n);
+    AssertEqual(result_native, result_avx512);
+
+    EltwiseFMAModGoldilocksNative(result_native.data(), any1.data(), scalar,
+                                  nullptr, n);
+    EltwiseFMAModGoldilocksAVX512(result_avx512.data(), any1.data(), scalar,
+                                  nullptr, n);
+    AssertEqual(result_native, result_avx512);
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,89 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "hexl/eltwise/eltwise-goldilocks.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+TEST(EltwiseGoldilocks, small) {
+  const uint64_t p = kGoldilocksModulus;
+  std::vector<uint64_t> op1{0, 1, 2, p - 1, p - 1, 1ULL << 32, 1ULL << 63, 5};
+  std::vector<uint64_t> op2{0, p - 1, p - 1, p - 1, 1, 1ULL << 32, 2, 7};
+  std::vector<uint64_t> result(op1.size());
+
+  EltwiseAddModGoldilocks(result.data(), op1.data(), op2.data(), op1.size());
+  CheckEqual(result, std::vector<uint64_t>{0, 0, 1, p - 2, 0, 1ULL << 33,
+                                           (1ULL << 63) + 2, 12});
+
+  EltwiseSubModGoldilocks(result.data(), op1.data(), op2.data(), op1.size());
+  CheckEqual(result, std::vector<uint64_t>{0, 2, 3, 0, p - 2, 0,
+                                           (1ULL << 63) - 2, p - 2});
+
+  // 2^32 * 2^32 = 2^64 = 2^32 - 1 mod p; 2^63 * 2 = 2^32 - 1 mod p
+  EltwiseMultModGoldilocks(result.data(), op1.data(), op2.data(), op1.size());
+  CheckEqual(result, std::vector<uint64_t>{0, p - 1, p - 2, 1, p - 1,
+                                           0xFFFFFFFFULL, 0xFFFFFFFFULL, 35});
+
+  EltwiseFMAModGoldilocks(result.data(), op1.data(), 2, op2.data(),
+                          op1.size());
+  CheckEqual(result, std::vector<uint64_t>{0, 1, 3, p - 3, p - 1,
+                                           3ULL << 32, 0xFFFFFFFFULL + 2, 17});
+
+  EltwiseFMAModGoldilocks(result.data(), op1.data(), 2, nullptr, op1.size());
+  CheckEqual(result, std::vector<uint64_t>{0, 2, 4, p - 2, p - 2, 1ULL << 33,
+                                           0xFFFFFFFFULL, 10});
+}
+
+TEST(EltwiseGoldilocks, random) {
+  const uint64_t p = kGoldilocksModulus;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+  std::uniform_int_distribution<uint64_t> distrib_mod(0, p - 1);
+
+  for (size_t n = 1; n < 40; ++n) {
+    std::vector<uint64_t> op1(n);
+    std::vector<uint64_t> op2(n);
+    std::vector<uint64_t> any1(n);
+    std::vector<uint64_t> any2(n);
+    for (size_t i = 0; i < n; ++i) {
+      op1[i] = distrib_mod(gen);
+      op2[i] = distrib_mod(gen);
+      any1[i] = distrib(gen);
+      any2[i] = distrib(gen);
+    }
+    uint64_t scalar = distrib(gen);
+
+    std::vector<uint64_t> result(n);
+    EltwiseAddModGoldilocks(result.data(), op1.data(), op2.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(result[i], AddModGoldilocks(op1[i], op2[i]));
+    }
+    EltwiseSubModGoldilocks(result.data(), op1.data(), op2.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(result[i], SubModGoldilocks(op1[i], op2[i]));
+    }
+    EltwiseMultModGoldilocks(result.data(), any1.data(), any2.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(result[i], MultiplyModGoldilocks(any1[i], any2[i]));
+    }
+    EltwiseFMAModGoldilocks(result.data(), any1.data(), scalar, any2.data(),
+                            n);
+    for (size_t i = 0; i < n; ++i) {
+      uint64_t exp = AddModGoldilocks(MultiplyModGoldilocks(any1[i], scalar),
+                                      ReduceGoldilocks(0, any2[i]));
+      ASSERT_EQ(result[i], exp);
+    }
+  }
+}
+
+}  // namespace hexl
+}  // namespace intel
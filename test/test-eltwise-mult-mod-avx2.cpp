@@ -0,0 +1,73 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-mult-mod-avx2.hpp"
+#include "eltwise/eltwise-mult-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+namespace {
+
+// Checks the AVX2 implementation matches the native one for moduli of each
+// bit width in [min_bits, max_bits]
+template <int InputModFactor>
+void CheckEltwiseMultModAVX2(
+    size_t min_bits, size_t max_bits,
+    void (*avx2_impl)(uint64_t*, const uint64_t*, const uint64_t*, uint64_t,
+                      uint64_t)) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  uint64_t length = 173;
+  for (size_t bits = min_bits; bits <= max_bits; ++bits) {
+    uint64_t modulus = (1ULL << bits) + 1;
+    std::uniform_int_distribution<uint64_t> distrib(
+        0, InputModFactor * modulus - 1);
+
+    for (size_t trial = 0; trial < 20; ++trial) {
+      std::vector<uint64_t> op1(length, 0);
+      std::vector<uint64_t> op2(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+      }
+      op1[length - 1] = InputModFactor * modulus - 1;
+      op2[length - 1] = InputModFactor * modulus - 1;
+
+      std::vector<uint64_t> out_native(length, 0);
+      std::vector<uint64_t> out_avx2(length, 0);
+      EltwiseMultModNative<InputModFactor>(out_native.data(), op1.data(),
+                                           op2.data(), length, modulus);
+      avx2_impl(out_avx2.data(), op1.data(), op2.data(), length, modulus);
+
+      ASSERT_EQ(out_native, out_avx2);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(EltwiseMultMod, AVX2Int32) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  CheckEltwiseMultModAVX2<1>(1, 29, EltwiseMultModAVX2Int32<1>);
+  CheckEltwiseMultModAVX2<2>(1, 29, EltwiseMultModAVX2Int32<2>);
+  CheckEltwiseMultModAVX2<4>(1, 29, EltwiseMultModAVX2Int32<4>);
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
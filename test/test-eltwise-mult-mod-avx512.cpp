@@ -207,6 +207,212 @@ TEST(EltwiseMultMod, AVX512Big) {
     }
   }
 }
+
+// Checks AVX512 and native eltwise mult implementations on 32-bit elements
+// match
+TEST(EltwiseMultMod, U32AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 1; bits <= 30; ++bits) {
+    for (uint64_t modulus : {1ULL << bits, (1ULL << (bits + 1)) - 1}) {
+      for (uint64_t input_mod_factor : {1, 2, 4}) {
+        if (input_mod_factor * modulus > (1ULL << 32)) {
+          continue;
+        }
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint32_t> op1(length, 0);
+        std::vector<uint32_t> op2(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          op1[i] = static_cast<uint32_t>(distrib(gen));
+          op2[i] = static_cast<uint32_t>(distrib(gen));
+        }
+
+        std::vector<uint32_t> native(length, 0);
+        std::vector<uint32_t> avx512(length, 0);
+        switch (input_mod_factor) {
+          case 1:
+            EltwiseMultModNative<1>(native.data(), op1.data(), op2.data(),
+                                    length, modulus);
+            EltwiseMultModAVX512U32<1>(avx512.data(), op1.data(), op2.data(),
+                                       length, modulus);
+            break;
+          case 2:
+            EltwiseMultModNative<2>(native.data(), op1.data(), op2.data(),
+                                    length, modulus);
+            EltwiseMultModAVX512U32<2>(avx512.data(), op1.data(), op2.data(),
+                                       length, modulus);
+            break;
+          case 4:
+            EltwiseMultModNative<4>(native.data(), op1.data(), op2.data(),
+                                    length, modulus);
+            EltwiseMultModAVX512U32<4>(avx512.data(), op1.data(), op2.data(),
+                                       length, modulus);
+            break;
+        }
+        ASSERT_EQ(native, avx512);
+        for (size_t i = 0; i < length; ++i) {
+          ASSERT_EQ(native[i], (uint64_t(op1[i]) * op2[i]) % modulus);
+        }
+      }
+    }
+  }
+}
+// Checks AVX512 and native Montgomery eltwise mult implementations match
+TEST(EltwiseMultMod, MontgomeryAVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 2; bits <= 62; ++bits) {
+    for (uint64_t modulus : {(1ULL << (bits - 1)) + 1, (1ULL << bits) - 1}) {
+      uint64_t neg_inv_modulus = MontgomeryNegInverse(modulus);
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> op1(length, 0);
+      std::vector<uint64_t> op2(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+      }
+      op1[0] = modulus - 1;
+      op2[0] = modulus - 1;
+
+      std::vector<uint64_t> native(length, 0);
+      std::vector<uint64_t> avx512(length, 0);
+      EltwiseMultModMontgomeryNative(native.data(), op1.data(), op2.data(),
+                                     length, modulus, neg_inv_modulus);
+      EltwiseMultModMontgomeryAVX512(avx512.data(), op1.data(), op2.data(),
+                                     length, modulus, neg_inv_modulus);
+      ASSERT_EQ(native, avx512);
+    }
+  }
+}
+
+// Checks AVX512 and native special-form eltwise mult implementations match
+TEST(EltwiseMultMod, SpecialAVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 30; bits <= 61; ++bits) {
+    uint64_t modulus = GeneratePrimes(1, bits - 1, 1, true)[0];
+    SpecialFormModulus special_modulus(modulus);
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      if (input_mod_factor * modulus >= (1ULL << 63)) {
+        continue;
+      }
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      std::vector<uint64_t> op1(length, 0);
+      std::vector<uint64_t> op2(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+      }
+      op1[0] = input_mod_factor * modulus - 1;
+      op2[0] = input_mod_factor * modulus - 1;
+
+      std::vector<uint64_t> native(length, 0);
+      std::vector<uint64_t> avx512(length, 0);
+      switch (input_mod_factor) {
+        case 1:
+          EltwiseMultModSpecialNative<1>(native.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          EltwiseMultModAVX512Special<1>(avx512.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+        case 2:
+          EltwiseMultModSpecialNative<2>(native.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          EltwiseMultModAVX512Special<2>(avx512.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+        case 4:
+          EltwiseMultModSpecialNative<4>(native.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          EltwiseMultModAVX512Special<4>(avx512.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+      }
+      ASSERT_EQ(native, avx512);
+    }
+  }
+}
+#endif
+
+#ifdef HEXL_HAS_AVX512IFMA
+// Checks AVX512-IFMA eltwise mult against scalar MultiplyMod
+TEST(EltwiseMultMod, IFMAAVX512) {
+  if (!has_avx512ifma) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (size_t bits = 2; bits <= 51; ++bits) {
+    // Powers of two round the Barrett factor down
+    std::vector<uint64_t> moduli{1ULL << (bits - 1), (1ULL << bits) - 1};
+    if (bits >= 3) {
+      moduli.push_back(GeneratePrimes(1, bits - 1, 1)[0]);
+    }
+    for (uint64_t modulus : moduli) {
+      // The n % 8 leading elements go to EltwiseMultModNative, whose Barrett
+      // factor overflows for powers of two
+      size_t length = IsPowerOfTwo(modulus) ? 176 : 173;
+      for (uint64_t input_mod_factor : {1, 2, 4}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> op1(length, 0);
+        std::vector<uint64_t> op2(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          op1[i] = distrib(gen);
+          op2[i] = distrib(gen);
+        }
+        op1[0] = input_mod_factor * modulus - 1;
+        op2[0] = input_mod_factor * modulus - 1;
+        op1[length - 1] = modulus - 1;
+        op2[length - 1] = modulus - 1;
+
+        std::vector<uint64_t> expected(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          expected[i] =
+              MultiplyMod(op1[i] % modulus, op2[i] % modulus, modulus);
+        }
+        std::vector<uint64_t> avx512(length, 0);
+        switch (input_mod_factor) {
+          case 1:
+            EltwiseMultModAVX512IFMA<1>(avx512.data(), op1.data(), op2.data(),
+                                        length, modulus);
+            break;
+          case 2:
+            EltwiseMultModAVX512IFMA<2>(avx512.data(), op1.data(), op2.data(),
+                                        length, modulus);
+            break;
+          case 4:
+            EltwiseMultModAVX512IFMA<4>(avx512.data(), op1.data(), op2.data(),
+                                        length, modulus);
+            break;
+        }
+        ASSERT_EQ(expected, avx512);
+      }
+    }
+  }
+}
 #endif
 }  // namespace hexl
 }  // namespace intel
@@ -9,6 +9,7 @@
 
 #include "eltwise/eltwise-mult-mod-internal.hpp"
 #include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/eltwise/eltwise-reduce-mod.hpp"
 #include "hexl/logging/logging.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "test-util.hpp"
@@ -210,5 +211,120 @@ TEST(EltwiseMultMod, 9) {
   CheckEqual(result, exp_out);
 }
 
+TEST(EltwiseMultMod, u32) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus :
+       {uint64_t(769), uint64_t(1ULL << 30), GeneratePrimes(1, 30, 1024)[0]}) {
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      if (input_mod_factor * modulus > (1ULL << 32)) {
+        continue;
+      }
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      size_t length = 173;
+      std::vector<uint32_t> op1(length);
+      std::vector<uint32_t> op2(length);
+      std::vector<uint32_t> exp_out(length);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = static_cast<uint32_t>(distrib(gen));
+        op2[i] = static_cast<uint32_t>(distrib(gen));
+        exp_out[i] = static_cast<uint32_t>(
+            (uint64_t(op1[i]) % modulus) * (op2[i] % modulus) % modulus);
+      }
+      op1[0] = static_cast<uint32_t>(modulus - 1);
+      op2[0] = static_cast<uint32_t>(modulus - 1);
+      exp_out[0] = 1;
+
+      std::vector<uint32_t> result(length);
+      EltwiseMultMod(result.data(), op1.data(), op2.data(), length, modulus,
+                     input_mod_factor);
+      ASSERT_EQ(result, exp_out);
+    }
+  }
+}
+
+TEST(EltwiseMultMod, Montgomery) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus : {uint64_t(769), GeneratePrimes(1, 45, 1024)[0],
+                           GeneratePrimes(1, 61, 1024)[0]}) {
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+    size_t length = 173;
+    std::vector<uint64_t> op1(length);
+    std::vector<uint64_t> op2(length);
+    std::vector<uint64_t> exp_out(length);
+    for (size_t i = 0; i < length; ++i) {
+      op1[i] = distrib(gen);
+      op2[i] = distrib(gen);
+      exp_out[i] = MultiplyMod(op1[i], op2[i], modulus);
+    }
+
+    std::vector<uint64_t> op1_mont(length);
+    std::vector<uint64_t> op2_mont(length);
+    EltwiseToMontgomery(op1_mont.data(), op1.data(), length, modulus);
+    EltwiseToMontgomery(op2_mont.data(), op2.data(), length, modulus);
+
+    std::vector<uint64_t> result(length);
+    EltwiseMultModMontgomery(result.data(), op1_mont.data(), op2_mont.data(),
+                             length, modulus);
+    EltwiseFromMontgomery(result.data(), result.data(), length, modulus);
+    ASSERT_EQ(result, exp_out);
+  }
+}
+
+TEST(EltwiseMultMod, SpecialForm) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus :
+       {GeneratePrimes(1, 50, 1024, true)[0],
+        GeneratePrimes(1, 55, 1024, true)[0],
+        GeneratePrimes(1, 60, 1024, true)[0], uint64_t((1ULL << 61) - 1)}) {
+    SpecialFormModulus special_modulus(modulus);
+    ASSERT_TRUE(special_modulus.IsSpecialForm());
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      if (input_mod_factor * modulus >= (1ULL << 63)) {
+        continue;
+      }
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      size_t length = 173;
+      std::vector<uint64_t> op1(length);
+      std::vector<uint64_t> op2(length);
+      std::vector<uint64_t> exp_out(length);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+        exp_out[i] =
+            MultiplyMod(op1[i] % modulus, op2[i] % modulus, modulus);
+      }
+
+      std::vector<uint64_t> result(length);
+      EltwiseMultMod(result.data(), op1.data(), op2.data(), length, modulus,
+                     input_mod_factor);
+      ASSERT_EQ(result, exp_out);
+
+      switch (input_mod_factor) {
+        case 1:
+          EltwiseMultModSpecialNative<1>(result.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+        case 2:
+          EltwiseMultModSpecialNative<2>(result.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+        case 4:
+          EltwiseMultModSpecialNative<4>(result.data(), op1.data(),
+                                         op2.data(), length, special_modulus);
+          break;
+      }
+      ASSERT_EQ(result, exp_out);
+    }
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
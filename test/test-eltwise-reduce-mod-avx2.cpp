@@ -0,0 +1,66 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "eltwise/eltwise-reduce-mod-avx2.hpp"
+#include "eltwise/eltwise-reduce-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-reduce-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Checks AVX2 and native implementations match
+TEST(EltwiseReduceMod, AVX2) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+
+  uint64_t length = 173;
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  std::vector<std::pair<uint64_t, uint64_t>> mod_factors{
+      {0, 1}, {2, 1}, {4, 1}, {4, 2}};
+  for (const auto& mod_factor : mod_factors) {
+    uint64_t input_mod_factor = mod_factor.first;
+    uint64_t output_mod_factor = mod_factor.second;
+    for (size_t bits : {20, 35, 50, 60}) {
+      uint64_t modulus = GeneratePrimes(1, bits, 1024)[0];
+      uint64_t bound = (input_mod_factor == 0)
+                           ? std::numeric_limits<uint64_t>::max()
+                           : input_mod_factor * modulus - 1;
+      std::uniform_int_distribution<uint64_t> distrib(0, bound);
+
+      for (size_t trial = 0; trial < 50; ++trial) {
+        std::vector<uint64_t> op(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          op[i] = distrib(gen);
+        }
+
+        std::vector<uint64_t> out_native(length, 0);
+        std::vector<uint64_t> out_avx2(length, 0);
+        EltwiseReduceModNative(out_native.data(), op.data(), length, modulus,
+                               input_mod_factor, output_mod_factor);
+        EltwiseReduceModAVX2(out_avx2.data(), op.data(), length, modulus,
+                             input_mod_factor, output_mod_factor);
+
+        ASSERT_EQ(out_native, out_avx2);
+      }
+    }
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
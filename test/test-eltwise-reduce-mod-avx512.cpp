@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "eltwise/eltwise-reduce-mod-avx512.hpp"
@@ -244,6 +245,48 @@ TEST(EltwiseReduceMod, AVX512Big_2_1) {
     }
   }
 }
+
+// Checks AVX512 and native eltwise reduce implementations on 32-bit elements
+// match
+TEST(EltwiseReduceMod, U32AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::vector<std::pair<uint64_t, uint64_t>> mod_factors{
+      {0, 1}, {2, 1}, {4, 1}, {4, 2}};
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+  for (size_t bits = 1; bits <= 30; ++bits) {
+    for (uint64_t modulus : {1ULL << bits, (1ULL << (bits + 1)) - 1}) {
+      for (const auto& mod_factor : mod_factors) {
+        uint64_t input_mod_factor = mod_factor.first;
+        uint64_t output_mod_factor = mod_factor.second;
+        // input_mod_factor == 0 allows any 32-bit input
+        uint64_t bound = (input_mod_factor == 0) ? (1ULL << 32)
+                                                 : input_mod_factor * modulus;
+        if (bound > (1ULL << 32)) {
+          continue;
+        }
+        std::uniform_int_distribution<uint64_t> distrib(0, bound - 1);
+        std::vector<uint32_t> op(length, 0);
+        for (size_t i = 0; i < length; ++i) {
+          op[i] = static_cast<uint32_t>(distrib(gen));
+        }
+
+        std::vector<uint32_t> native(length, 0);
+        std::vector<uint32_t> avx512(length, 0);
+        EltwiseReduceModNative(native.data(), op.data(), length, modulus,
+                               input_mod_factor, output_mod_factor);
+        EltwiseReduceModAVX512(avx512.data(), op.data(), length, modulus,
+                               input_mod_factor, output_mod_factor);
+        ASSERT_EQ(native, avx512);
+      }
+    }
+  }
+}
 #endif
 
 }  // namespace hexl
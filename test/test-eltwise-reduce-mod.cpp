@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "eltwise/eltwise-reduce-mod-internal.hpp"
@@ -81,5 +82,40 @@ TEST(EltwiseReduceMod, 4_2) {
   CheckEqual(result, exp_out);
 }
 
+TEST(EltwiseReduceMod, u32) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  std::vector<std::pair<uint64_t, uint64_t>> mod_factors{
+      {0, 1}, {2, 1}, {4, 1}, {4, 2}};
+  for (uint64_t modulus : {uint64_t(750), GeneratePrimes(1, 29, 1024)[0],
+                           GeneratePrimes(1, 30, 1024)[0]}) {
+    for (const auto& mod_factor : mod_factors) {
+      uint64_t input_mod_factor = mod_factor.first;
+      uint64_t output_mod_factor = mod_factor.second;
+      // input_mod_factor == 0 allows any 32-bit input
+      uint64_t bound =
+          (input_mod_factor == 0) ? (1ULL << 32) : input_mod_factor * modulus;
+      if (bound > (1ULL << 32)) {
+        continue;
+      }
+      std::uniform_int_distribution<uint64_t> distrib(0, bound - 1);
+      size_t length = 173;
+      std::vector<uint32_t> op(length);
+      for (size_t i = 0; i < length; ++i) {
+        op[i] = static_cast<uint32_t>(distrib(gen));
+      }
+
+      std::vector<uint32_t> result(length);
+      EltwiseReduceMod(result.data(), op.data(), length, modulus,
+                       input_mod_factor, output_mod_factor);
+      for (size_t i = 0; i < length; ++i) {
+        ASSERT_LT(result[i], output_mod_factor * modulus);
+        ASSERT_EQ(result[i] % modulus, op[i] % modulus);
+      }
+    }
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
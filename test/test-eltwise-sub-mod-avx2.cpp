@@ -0,0 +1,91 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "eltwise/eltwise-sub-mod-avx2.hpp"
+#include "eltwise/eltwise-sub-mod-internal.hpp"
+#include "hexl/eltwise/eltwise-sub-mod.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+// Checks AVX2 and native implementations match
+TEST(EltwiseSubMod, vector_vector_avx2_native_match) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+
+  for (size_t bits = 1; bits <= 62; ++bits) {
+    uint64_t modulus = 1ULL << bits;
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+
+    for (size_t trial = 0; trial < 10; ++trial) {
+      std::vector<uint64_t> op1(length, 0);
+      std::vector<uint64_t> op2(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+      }
+      op1[length - 1] = modulus - 1;
+      op2[length - 1] = modulus - 1;
+
+      std::vector<uint64_t> out_native(length, 0);
+      std::vector<uint64_t> out_avx2(length, 0);
+      EltwiseSubModNative(out_native.data(), op1.data(), op2.data(), length,
+                         modulus);
+      EltwiseSubModAVX2(out_avx2.data(), op1.data(), op2.data(), length,
+                        modulus);
+
+      ASSERT_EQ(out_native, out_avx2);
+    }
+  }
+}
+
+TEST(EltwiseSubMod, vector_scalar_avx2_native_match) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  size_t length = 173;
+
+  for (size_t bits = 1; bits <= 62; ++bits) {
+    uint64_t modulus = 1ULL << bits;
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+
+    for (size_t trial = 0; trial < 10; ++trial) {
+      std::vector<uint64_t> op1(length, 0);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+      }
+      uint64_t op2 = distrib(gen);
+
+      std::vector<uint64_t> out_native(length, 0);
+      std::vector<uint64_t> out_avx2(length, 0);
+      EltwiseSubModNative(out_native.data(), op1.data(), op2, length, modulus);
+      EltwiseSubModAVX2(out_avx2.data(), op1.data(), op2, length, modulus);
+
+      ASSERT_EQ(out_native, out_avx2);
+    }
+  }
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -109,5 +109,47 @@ TEST(EltwiseSubMod, vector_scalar_native_big) {
   CheckEqual(op1, exp_out);
 }
 
+TEST(EltwiseSubMod, vector_vector_u32) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t modulus : {uint64_t(10), uint64_t((1ULL << 31) - 1)}) {
+    std::uniform_int_distribution<uint32_t> distrib(
+        0, static_cast<uint32_t>(modulus - 1));
+    for (size_t length : {1, 16, 173}) {
+      std::vector<uint32_t> op1(length);
+      std::vector<uint32_t> op2(length);
+      std::vector<uint32_t> exp_out(length);
+      for (size_t i = 0; i < length; ++i) {
+        op1[i] = distrib(gen);
+        op2[i] = distrib(gen);
+        exp_out[i] = static_cast<uint32_t>(
+            (uint64_t(op1[i]) + modulus - op2[i]) % modulus);
+      }
+      std::vector<uint32_t> result(length);
+      EltwiseSubMod(result.data(), op1.data(), op2.data(), length, modulus);
+      ASSERT_EQ(result, exp_out);
+
+      EltwiseSubModNative(op1.data(), op1.data(), op2.data(), length, modulus);
+      ASSERT_EQ(op1, exp_out);
+    }
+  }
+}
+
+TEST(EltwiseSubMod, vector_scalar_u32) {
+  std::vector<uint32_t> op1{1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8};
+  uint32_t op2{3};
+  std::vector<uint32_t> exp_out{8, 9, 0, 1, 2, 3, 4, 5, 6,
+                                8, 9, 0, 1, 2, 3, 4, 5};
+  uint64_t modulus = 10;
+
+  std::vector<uint32_t> result(op1.size());
+  EltwiseSubMod(result.data(), op1.data(), op2, op1.size(), modulus);
+  AssertEqual(result, exp_out);
+
+  EltwiseSubModNative(op1.data(), op1.data(), op2, op1.size(), modulus);
+  AssertEqual(op1, exp_out);
+}
+
 }  // namespace hexl
 }  // namespace intel
@@ -0,0 +1,148 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/ntt/goldilocks-ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/goldilocks-ntt-internal.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+std::vector<uint64_t> RandomGoldilocksVector(uint64_t n) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, kGoldilocksModulus - 1);
+
+  std::vector<uint64_t> values(n);
+  for (auto& value : values) {
+    value = distrib(gen);
+  }
+  return values;
+}
+
+}  // namespace
+
+class GoldilocksNTTTest
+    : public ::testing::TestWithParam<std::tuple<uint64_t, NTT::Mode>> {};
+
+// Compares against a direct evaluation at the roots of unity
+TEST_P(GoldilocksNTTTest, Naive) {
+  uint64_t N = std::get<0>(GetParam());
+  NTT::Mode mode = std::get<1>(GetParam());
+  GoldilocksNTT ntt(N, mode);
+
+  std::vector<uint64_t> input = RandomGoldilocksVector(N);
+  std::vector<uint64_t> result(N);
+  ntt.ComputeForward(result.data(), input.data(), NTT::Ordering::kNatural);
+
+  uint64_t root = ntt.GetRootOfUnity();
+  for (size_t i = 0; i < N; ++i) {
+    // Evaluation point root^(2i + 1) for negacyclic, root^i for cyclic
+    uint64_t point = (mode == NTT::Mode::kNegacyclic)
+                         ? PowModGoldilocks(root, 2 * i + 1)
+                         : PowModGoldilocks(root, i);
+    uint64_t expected = 0;
+    uint64_t point_power = 1;
+    for (size_t j = 0; j < N; ++j) {
+      expected = AddModGoldilocks(
+          expected, MultiplyModGoldilocks(input[j], point_power));
+      point_power = MultiplyModGoldilocks(point_power, point);
+    }
+    ASSERT_EQ(expected, result[i]) << "i " << i;
+  }
+
+  std::vector<uint64_t> inverse(N);
+  ntt.ComputeInverse(inverse.data(), result.data(), NTT::Ordering::kNatural);
+  AssertEqual(input, inverse);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    GoldilocksNTT, GoldilocksNTTTest,
+    ::testing::Combine(::testing::Values(1, 2, 4, 8, 16, 32, 128),
+                       ::testing::Values(NTT::Mode::kNegacyclic,
+                                         NTT::Mode::kCyclic)));
+
+TEST(GoldilocksNTT, RoundTrip) {
+  for (uint64_t N = 1; N <= (1 << 14); N <<= 1) {
+    for (NTT::Mode mode : {NTT::Mode::kNegacyclic, NTT::Mode::kCyclic}) {
+      GoldilocksNTT ntt(N, mode);
+      std::vector<uint64_t> input = RandomGoldilocksVector(N);
+      input[0] = kGoldilocksModulus - 1;
+
+      std::vector<uint64_t> data = input;
+      ntt.ComputeForward(data.data(), data.data());
+      ntt.ComputeInverse(data.data(), data.data());
+      AssertEqual(input, data);
+    }
+  }
+}
+
+TEST(GoldilocksNTT, PolyMulNegacyclic) {
+  uint64_t N = 64;
+  GoldilocksNTT ntt(N);
+
+  std::vector<uint64_t> a = RandomGoldilocksVector(N);
+  std::vector<uint64_t> b = RandomGoldilocksVector(N);
+
+  // Schoolbook multiplication modulo X^N + 1
+  std::vector<uint64_t> expected(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = 0; j < N; ++j) {
+      uint64_t prod = MultiplyModGoldilocks(a[i], b[j]);
+      size_t k = (i + j) % N;
+      expected[k] = (i + j < N) ? AddModGoldilocks(expected[k], prod)
+                                : SubModGoldilocks(expected[k], prod);
+    }
+  }
+
+  std::vector<uint64_t> a_ntt(N);
+  std::vector<uint64_t> b_ntt(N);
+  ntt.ComputeForward(a_ntt.data(), a.data());
+  ntt.ComputeForward(b_ntt.data(), b.data());
+  std::vector<uint64_t> prod(N);
+  for (size_t i = 0; i < N; ++i) {
+    prod[i] = MultiplyModGoldilocks(a_ntt[i], b_ntt[i]);
+  }
+  ntt.ComputeInverse(prod.data(), prod.data());
+  AssertEqual(expected, prod);
+}
+
+TEST(GoldilocksNTT, Native) {
+  uint64_t N = 1024;
+  GoldilocksNTT ntt(N);
+
+  std::vector<uint64_t> input = RandomGoldilocksVector(N);
+  std::vector<uint64_t> expected(N);
+  ntt.ComputeForward(expected.data(), input.data());
+
+  std::vector<uint64_t> native = input;
+  ForwardTransformToBitReverseGoldilocks(native.data(), N,
+                                         ntt.GetRootOfUnityPowers().data());
+  AssertEqual(expected, native);
+}
+
+#ifdef HEXL_DEBUG
+TEST(GoldilocksNTT, BadInput) {
+  EXPECT_ANY_THROW(GoldilocksNTT(3));
+  EXPECT_ANY_THROW(GoldilocksNTT(1ULL << 32));
+  EXPECT_ANY_THROW(GoldilocksNTT(8, NTT::Mode::kTwisted));
+
+  GoldilocksNTT ntt(8);
+  std::vector<uint64_t> input(8, kGoldilocksModulus);
+  std::vector<uint64_t> result(8);
+  EXPECT_ANY_THROW(ntt.ComputeForward(result.data(), input.data()));
+  EXPECT_ANY_THROW(ntt.ComputeInverse(result.data(), input.data()));
+}
+#endif
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,171 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/fwd-ntt-avx2.hpp"
+#include "ntt/inv-ntt-avx2.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "test-util.hpp"
+#include "util/cpu-features.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_HAS_AVX256
+
+namespace {
+
+#ifdef HEXL_DEBUG
+const size_t s_num_trials = 1;
+#else
+const size_t s_num_trials = 20;
+#endif
+
+// Checks the AVX2 and native forward NTT implementations match on random
+// inputs in [0, input_mod_factor * q)
+template <int BitShift>
+void CheckFwdNTTAVX2(uint64_t modulus_bits, uint64_t input_mod_factor) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (size_t N = 8; N <= 65536; N *= 2) {
+    uint64_t modulus = GeneratePrimes(1, modulus_bits, N)[0];
+    std::uniform_int_distribution<uint64_t> distrib(
+        0, input_mod_factor * modulus - 1);
+
+    NTT ntt(N, modulus);
+    const uint64_t* precon_root_of_unity_powers =
+        (BitShift == 32) ? ntt.GetPrecon32RootOfUnityPowers().data()
+                         : ntt.GetPrecon64RootOfUnityPowers().data();
+
+    for (size_t trial = 0; trial < s_num_trials; ++trial) {
+      std::vector<uint64_t> input(N, 0);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = distrib(gen);
+      }
+      std::vector<uint64_t> input_avx = input;
+      std::vector<uint64_t> input_avx_lazy = input;
+
+      ForwardTransformToBitReverse64(
+          input.data(), input.data(), N, modulus,
+          ntt.GetRootOfUnityPowers().data(),
+          ntt.GetPrecon64RootOfUnityPowers().data(), input_mod_factor, 1);
+
+      ForwardTransformToBitReverseAVX2<BitShift>(
+          input_avx.data(), input_avx.data(), N, modulus,
+          ntt.GetRootOfUnityPowers().data(), precon_root_of_unity_powers,
+          input_mod_factor, 1);
+
+      // Compute lazy
+      ForwardTransformToBitReverseAVX2<BitShift>(
+          input_avx_lazy.data(), input_avx_lazy.data(), N, modulus,
+          ntt.GetRootOfUnityPowers().data(), precon_root_of_unity_powers,
+          input_mod_factor, 4);
+      for (auto& elem : input_avx_lazy) {
+        ASSERT_LT(elem, 4 * modulus);
+        elem = elem % modulus;
+      }
+
+      ASSERT_EQ(input, input_avx);
+      ASSERT_EQ(input, input_avx_lazy);
+    }
+  }
+}
+
+// Checks the AVX2 and native inverse NTT implementations match on random
+// inputs in [0, input_mod_factor * q)
+template <int BitShift>
+void CheckInvNTTAVX2(uint64_t modulus_bits, uint64_t input_mod_factor) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (size_t N = 8; N <= 65536; N *= 2) {
+    uint64_t modulus = GeneratePrimes(1, modulus_bits, N)[0];
+    std::uniform_int_distribution<uint64_t> distrib(
+        0, input_mod_factor * modulus - 1);
+
+    NTT ntt(N, modulus);
+    const uint64_t* precon_inv_root_of_unity_powers =
+        (BitShift == 32) ? ntt.GetPrecon32InvRootOfUnityPowers().data()
+                         : ntt.GetPrecon64InvRootOfUnityPowers().data();
+
+    for (size_t trial = 0; trial < s_num_trials; ++trial) {
+      std::vector<uint64_t> input(N, 0);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = distrib(gen);
+      }
+      std::vector<uint64_t> input_avx = input;
+      std::vector<uint64_t> input_avx_lazy = input;
+
+      InverseTransformFromBitReverse64(
+          input.data(), input.data(), N, modulus,
+          ntt.GetInvRootOfUnityPowers().data(),
+          ntt.GetPrecon64InvRootOfUnityPowers().data(), input_mod_factor, 1);
+
+      InverseTransformFromBitReverseAVX2<BitShift>(
+          input_avx.data(), input_avx.data(), N, modulus,
+          ntt.GetInvRootOfUnityPowers().data(), precon_inv_root_of_unity_powers,
+          input_mod_factor, 1);
+
+      // Compute lazy
+      InverseTransformFromBitReverseAVX2<BitShift>(
+          input_avx_lazy.data(), input_avx_lazy.data(), N, modulus,
+          ntt.GetInvRootOfUnityPowers().data(),
+          precon_inv_root_of_unity_powers, input_mod_factor, 2);
+      for (auto& elem : input_avx_lazy) {
+        ASSERT_LT(elem, 2 * modulus);
+        elem = elem % modulus;
+      }
+
+      ASSERT_EQ(input, input_avx);
+      ASSERT_EQ(input, input_avx_lazy);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(NTT, FwdNTT_AVX2_32) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  CheckFwdNTTAVX2<32>(27, 1);
+  CheckFwdNTTAVX2<32>(29, 4);
+}
+
+TEST(NTT, FwdNTT_AVX2_64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  CheckFwdNTTAVX2<64>(27, 2);
+  CheckFwdNTTAVX2<64>(55, 4);
+  CheckFwdNTTAVX2<64>(61, 4);
+}
+
+TEST(NTT, InvNTT_AVX2_32) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  CheckInvNTTAVX2<32>(27, 1);
+  CheckInvNTTAVX2<32>(29, 2);
+}
+
+TEST(NTT, InvNTT_AVX2_64) {
+  if (!has_avx2) {
+    GTEST_SKIP();
+  }
+  CheckInvNTTAVX2<64>(27, 2);
+  CheckInvNTTAVX2<64>(55, 1);
+  CheckInvNTTAVX2<64>(61, 2);
+}
+
+#endif  // HEXL_HAS_AVX256
+
+}  // namespace hexl
+}  // namespace intel
@@ -9,14 +9,19 @@
 #include <vector>
 
 #include "hexl/logging/logging.hpp"
+#include "hexl/ntt/goldilocks-ntt.hpp"
 #include "hexl/ntt/ntt.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "ntt/fwd-ntt-avx512.hpp"
+#include "ntt/goldilocks-ntt-avx512.hpp"
+#include "ntt/goldilocks-ntt-internal.hpp"
 #include "ntt/inv-ntt-avx512.hpp"
 #include "ntt/ntt-avx512-util.hpp"
 #include "ntt/ntt-internal.hpp"
+#include "ntt/ntt32-avx512.hpp"
 #include "test-util.hpp"
 #include "util/cpu-features.hpp"
+#include "util/thread-pool.hpp"
 
 namespace intel {
 namespace hexl {
@@ -60,13 +65,13 @@ TEST_P(NTTModulusTest, IFMAModuli) {
   NTT ntt_ifma(N, modulus);
 
   ForwardTransformToBitReverseAVX512<52>(
-      input_ifma.data(), N, ntt_ifma.GetModulus(),
+      input_ifma.data(), input_ifma.data(), N, ntt_ifma.GetModulus(),
       ntt_ifma.GetAVX512RootOfUnityPowers().data(),
       ntt_ifma.GetAVX512Precon52RootOfUnityPowers().data(), 2, 1);
 
   // Compute lazy
   ForwardTransformToBitReverseAVX512<52>(
-      input_ifma_lazy.data(), N, ntt_ifma.GetModulus(),
+      input_ifma_lazy.data(), input_ifma_lazy.data(), N, ntt_ifma.GetModulus(),
       ntt_ifma.GetAVX512RootOfUnityPowers().data(),
       ntt_ifma.GetAVX512Precon52RootOfUnityPowers().data(), 2, 4);
   for (auto& elem : input_ifma_lazy) {
@@ -232,7 +237,192 @@ TEST(NTT, WriteInvInterleavedT4) {
   AssertEqual(exp, out);
 }
 
+TEST(NTT, FwdDeinterleavedT1) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  std::vector<uint64_t> arg{0, 1, 2,  3,  4,  5,  6,  7,
+                            8, 9, 10, 11, 12, 13, 14, 15};
+  __m512i v1 = _mm512_loadu_si512(&arg[0]);
+  __m512i v2 = _mm512_loadu_si512(&arg[8]);
+
+  // Shuffling in registers round-trips like loading and writing memory
+  __m512i out1;
+  __m512i out2;
+  FwdInterleavedT1(v1, v2, &out1, &out2);
+  FwdDeinterleavedT1(out1, out2, &out1, &out2);
+
+  std::vector<uint64_t> exp(16, 0);
+  LoadFwdInterleavedT1(arg.data(), &v1, &v2);
+  WriteFwdInterleavedT1(v1, v2, reinterpret_cast<__m512i*>(&exp[0]));
+
+  AssertEqual(ExtractValues(out1), std::vector<uint64_t>(&exp[0], &exp[8]));
+  AssertEqual(ExtractValues(out2), std::vector<uint64_t>(&exp[8], &exp[16]));
+}
+
+TEST(NTT, InvDeinterleavedT4) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+
+  __m512i arg1 = _mm512_set_epi64(15, 14, 13, 12, 11, 10, 9, 8);
+  __m512i arg2 = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+  __m512i out1;
+  __m512i out2;
+
+  InvDeinterleavedT4(arg1, arg2, &out1, &out2);
+
+  std::vector<uint64_t> exp1{8, 9, 10, 11, 0, 1, 2, 3};
+  std::vector<uint64_t> exp2{12, 13, 14, 15, 4, 5, 6, 7};
+  AssertEqual(ExtractValues(out1), exp1);
+  AssertEqual(ExtractValues(out2), exp2);
+}
+
+// Checks the AVX512 NTTs match the native NTTs on transforms small enough to
+// be computed mostly in registers
+TEST(NTT, SmallNTT_AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (size_t N = 16; N <= 256; N *= 2) {
+    uint64_t modulus = GeneratePrimes(1, 55, N)[0];
+    NTT ntt(N, modulus);
+
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      for (uint64_t output_mod_factor : {1, 4}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N, 0);
+        for (size_t i = 0; i < N; ++i) {
+          input[i] = distrib(gen);
+        }
+        std::vector<uint64_t> expected = input;
+        std::vector<uint64_t> output = input;
+
+        ForwardTransformToBitReverse64(
+            expected.data(), expected.data(), N, modulus,
+            ntt.GetRootOfUnityPowers().data(),
+            ntt.GetPrecon64RootOfUnityPowers().data(), input_mod_factor, 1);
+        ForwardTransformToBitReverseAVX512<64>(
+            output.data(), output.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(),
+            ntt.GetAVX512Precon64RootOfUnityPowers().data(), input_mod_factor,
+            output_mod_factor);
+        for (auto& elem : output) {
+          elem %= modulus;
+        }
+        ASSERT_EQ(expected, output);
+      }
+    }
+
+    for (uint64_t input_mod_factor : {1, 2}) {
+      for (uint64_t output_mod_factor : {1, 2}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N, 0);
+        for (size_t i = 0; i < N; ++i) {
+          input[i] = distrib(gen);
+        }
+        std::vector<uint64_t> expected = input;
+        std::vector<uint64_t> output = input;
+
+        InverseTransformFromBitReverse64(
+            expected.data(), expected.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(),
+            ntt.GetPrecon64InvRootOfUnityPowers().data(), input_mod_factor, 1);
+        InverseTransformFromBitReverseAVX512<64>(
+            output.data(), output.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(),
+            ntt.GetPrecon64InvRootOfUnityPowers().data(), input_mod_factor,
+            output_mod_factor);
+        for (auto& elem : output) {
+          elem %= modulus;
+        }
+        ASSERT_EQ(expected, output);
+      }
+    }
+  }
+}
+
 // Checks AVX512 and native forward NTT implementations match
+// Checks the 32-bit AVX512 transforms on 32-bit coefficients match the
+// native transforms
+TEST(NTT, NTT32_AVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {32, 64, 128, 1024, 1 << 13}) {
+    for (uint64_t bits : {17, 29}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      NTT ntt(N, modulus);
+      auto narrow = [](const AlignedVector64<uint64_t>& values) {
+        return std::vector<uint32_t>(values.begin(), values.end());
+      };
+      std::vector<uint32_t> root_of_unity_powers =
+          narrow(ntt.GetRootOfUnityPowers());
+      std::vector<uint32_t> precon_root_of_unity_powers =
+          narrow(ntt.GetPrecon32RootOfUnityPowers());
+      std::vector<uint32_t> inv_root_of_unity_powers =
+          narrow(ntt.GetInvRootOfUnityPowers());
+      std::vector<uint32_t> precon_inv_root_of_unity_powers =
+          narrow(ntt.GetPrecon32InvRootOfUnityPowers());
+
+      for (uint64_t input_mod_factor : {1, 2, 4}) {
+        for (uint64_t output_mod_factor : {1, 4}) {
+          std::uniform_int_distribution<uint32_t> distrib(
+              0, static_cast<uint32_t>(input_mod_factor * modulus - 1));
+          std::vector<uint32_t> expected(N);
+          for (size_t i = 0; i < N; ++i) {
+            expected[i] = distrib(gen);
+          }
+          std::vector<uint32_t> output = expected;
+
+          ForwardTransformToBitReverse32(
+              expected.data(), expected.data(), N, modulus,
+              root_of_unity_powers.data(), precon_root_of_unity_powers.data(),
+              input_mod_factor, output_mod_factor);
+          ForwardTransformToBitReverse32AVX512(
+              output.data(), output.data(), N, modulus,
+              root_of_unity_powers.data(), precon_root_of_unity_powers.data(),
+              input_mod_factor, output_mod_factor);
+          AssertEqual(output, expected);
+        }
+      }
+
+      for (uint64_t input_mod_factor : {1, 2}) {
+        for (uint64_t output_mod_factor : {1, 2}) {
+          std::uniform_int_distribution<uint32_t> distrib(
+              0, static_cast<uint32_t>(input_mod_factor * modulus - 1));
+          std::vector<uint32_t> expected(N);
+          for (size_t i = 0; i < N; ++i) {
+            expected[i] = distrib(gen);
+          }
+          std::vector<uint32_t> output = expected;
+
+          InverseTransformFromBitReverse32(
+              expected.data(), expected.data(), N, modulus,
+              inv_root_of_unity_powers.data(),
+              precon_inv_root_of_unity_powers.data(), input_mod_factor,
+              output_mod_factor);
+          InverseTransformFromBitReverse32AVX512(
+              output.data(), output.data(), N, modulus,
+              inv_root_of_unity_powers.data(),
+              precon_inv_root_of_unity_powers.data(), input_mod_factor,
+              output_mod_factor);
+          AssertEqual(output, expected);
+        }
+      }
+    }
+  }
+}
+
 TEST(NTT, FwdNTT_AVX512_32) {
   if (!has_avx512dq) {
     GTEST_SKIP();
@@ -261,17 +451,18 @@ TEST(NTT, FwdNTT_AVX512_32) {
       std::vector<std::uint64_t> input_avx_lazy = input;
 
       ForwardTransformToBitReverse64(
-          input.data(), N, modulus, ntt.GetRootOfUnityPowers().data(),
+          input.data(), input.data(), N, modulus,
+          ntt.GetRootOfUnityPowers().data(),
           ntt.GetPrecon64RootOfUnityPowers().data(), 2, 1);
 
       ForwardTransformToBitReverseAVX512<32>(
-          input_avx.data(), N, ntt.GetModulus(),
+          input_avx.data(), input_avx.data(), N, ntt.GetModulus(),
           ntt.GetAVX512RootOfUnityPowers().data(),
           ntt.GetAVX512Precon32RootOfUnityPowers().data(), 2, 1);
 
       // Compute lazy
       ForwardTransformToBitReverseAVX512<32>(
-          input_avx_lazy.data(), N, ntt.GetModulus(),
+          input_avx_lazy.data(), input_avx_lazy.data(), N, ntt.GetModulus(),
           ntt.GetAVX512RootOfUnityPowers().data(),
           ntt.GetAVX512Precon32RootOfUnityPowers().data(), 2, 4);
       for (auto& elem : input_avx_lazy) {
@@ -313,17 +504,18 @@ TEST(NTT, FwdNTT_AVX512_64) {
       std::vector<std::uint64_t> input_avx_lazy = input;
 
       ForwardTransformToBitReverse64(
-          input.data(), N, modulus, ntt.GetRootOfUnityPowers().data(),
+          input.data(), input.data(), N, modulus,
+          ntt.GetRootOfUnityPowers().data(),
           ntt.GetPrecon64RootOfUnityPowers().data(), 2, 1);
 
       ForwardTransformToBitReverseAVX512<64>(
-          input_avx.data(), N, ntt.GetModulus(),
+          input_avx.data(), input_avx.data(), N, ntt.GetModulus(),
           ntt.GetAVX512RootOfUnityPowers().data(),
           ntt.GetAVX512Precon64RootOfUnityPowers().data(), 2, 1);
 
       // Compute lazy
       ForwardTransformToBitReverseAVX512<64>(
-          input_avx_lazy.data(), N, ntt.GetModulus(),
+          input_avx_lazy.data(), input_avx_lazy.data(), N, ntt.GetModulus(),
           ntt.GetAVX512RootOfUnityPowers().data(),
           ntt.GetAVX512Precon64RootOfUnityPowers().data(), 2, 4);
       for (auto& elem : input_avx_lazy) {
@@ -365,17 +557,18 @@ TEST(NTT, InvNTT_AVX512_32) {
       std::vector<std::uint64_t> input_avx_lazy = input;
 
       InverseTransformFromBitReverse64(
-          input.data(), N, modulus, ntt.GetInvRootOfUnityPowers().data(),
+          input.data(), input.data(), N, modulus,
+          ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1);
 
       InverseTransformFromBitReverseAVX512<32>(
-          input_avx.data(), N, ntt.GetModulus(),
+          input_avx.data(), input_avx.data(), N, ntt.GetModulus(),
           ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon32InvRootOfUnityPowers().data(), 1, 1);
 
       // Compute lazy
       InverseTransformFromBitReverseAVX512<32>(
-          input_avx_lazy.data(), N, ntt.GetModulus(),
+          input_avx_lazy.data(), input_avx_lazy.data(), N, ntt.GetModulus(),
           ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon32InvRootOfUnityPowers().data(), 1, 2);
       for (auto& elem : input_avx_lazy) {
@@ -417,17 +610,18 @@ TEST(NTT, InvNTT_AVX512_64) {
       std::vector<std::uint64_t> input_avx_lazy = input;
 
       InverseTransformFromBitReverse64(
-          input.data(), N, modulus, ntt.GetInvRootOfUnityPowers().data(),
+          input.data(), input.data(), N, modulus,
+          ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1);
 
       InverseTransformFromBitReverseAVX512<64>(
-          input_avx.data(), N, ntt.GetModulus(),
+          input_avx.data(), input_avx.data(), N, ntt.GetModulus(),
           ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1);
 
       // Compute lazy
       InverseTransformFromBitReverseAVX512<64>(
-          input_avx_lazy.data(), N, ntt.GetModulus(),
+          input_avx_lazy.data(), input_avx_lazy.data(), N, ntt.GetModulus(),
           ntt.GetInvRootOfUnityPowers().data(),
           ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 2);
       for (auto& elem : input_avx_lazy) {
@@ -439,6 +633,248 @@ TEST(NTT, InvNTT_AVX512_64) {
     }
   }
 }
+
+// Parameters = (number of threads, modulus bits)
+class NTTAVX512ParallelTest
+    : public ::testing::TestWithParam<std::tuple<size_t, size_t>> {};
+
+// Checks multi-threaded and single-threaded AVX512 NTT implementations match
+TEST_P(NTTAVX512ParallelTest, FwdInv) {
+  size_t num_threads = std::get<0>(GetParam());
+  size_t modulus_bits = std::get<1>(GetParam());
+  if (!has_avx512dq || (modulus_bits == 49 && !has_avx512ifma)) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  ThreadPool thread_pool(num_threads);
+
+  for (size_t N = 1024; N <= 65536; N *= 4) {
+    uint64_t modulus = GeneratePrimes(1, modulus_bits, N)[0];
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+
+    NTT ntt(N, modulus);
+
+    std::vector<std::uint64_t> input(N, 0);
+    for (size_t i = 0; i < N; ++i) {
+      input[i] = distrib(gen);
+    }
+
+    for (uint64_t output_mod_factor : {1, 4}) {
+      std::vector<std::uint64_t> fwd = input;
+      std::vector<std::uint64_t> fwd_parallel = input;
+      if (modulus_bits == 27) {
+        const uint64_t* precon =
+            ntt.GetAVX512Precon32RootOfUnityPowers().data();
+        ForwardTransformToBitReverseAVX512<32>(
+            fwd.data(), fwd.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor);
+        ForwardTransformToBitReverseAVX512Parallel<32>(
+            fwd_parallel.data(), fwd_parallel.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor, &thread_pool);
+#ifdef HEXL_HAS_AVX512IFMA
+      } else if (modulus_bits == 49) {
+        const uint64_t* precon =
+            ntt.GetAVX512Precon52RootOfUnityPowers().data();
+        ForwardTransformToBitReverseAVX512<52>(
+            fwd.data(), fwd.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor);
+        ForwardTransformToBitReverseAVX512Parallel<52>(
+            fwd_parallel.data(), fwd_parallel.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor, &thread_pool);
+#endif
+      } else {
+        const uint64_t* precon =
+            ntt.GetAVX512Precon64RootOfUnityPowers().data();
+        ForwardTransformToBitReverseAVX512<64>(
+            fwd.data(), fwd.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor);
+        ForwardTransformToBitReverseAVX512Parallel<64>(
+            fwd_parallel.data(), fwd_parallel.data(), N, modulus,
+            ntt.GetAVX512RootOfUnityPowers().data(), precon, 2,
+            output_mod_factor, &thread_pool);
+      }
+      ASSERT_EQ(fwd, fwd_parallel);
+    }
+
+    for (uint64_t output_mod_factor : {1, 2}) {
+      std::vector<std::uint64_t> inv = input;
+      std::vector<std::uint64_t> inv_parallel = input;
+      if (modulus_bits == 27) {
+        const uint64_t* precon = ntt.GetPrecon32InvRootOfUnityPowers().data();
+        InverseTransformFromBitReverseAVX512<32>(
+            inv.data(), inv.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1, output_mod_factor);
+        InverseTransformFromBitReverseAVX512Parallel<32>(
+            inv_parallel.data(), inv_parallel.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1,
+            output_mod_factor, &thread_pool);
+#ifdef HEXL_HAS_AVX512IFMA
+      } else if (modulus_bits == 49) {
+        const uint64_t* precon = ntt.GetPrecon52InvRootOfUnityPowers().data();
+        InverseTransformFromBitReverseAVX512<52>(
+            inv.data(), inv.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1, output_mod_factor);
+        InverseTransformFromBitReverseAVX512Parallel<52>(
+            inv_parallel.data(), inv_parallel.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1,
+            output_mod_factor, &thread_pool);
+#endif
+      } else {
+        const uint64_t* precon = ntt.GetPrecon64InvRootOfUnityPowers().data();
+        InverseTransformFromBitReverseAVX512<64>(
+            inv.data(), inv.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1, output_mod_factor);
+        InverseTransformFromBitReverseAVX512Parallel<64>(
+            inv_parallel.data(), inv_parallel.data(), N, modulus,
+            ntt.GetInvRootOfUnityPowers().data(), precon, 1,
+            output_mod_factor, &thread_pool);
+      }
+      ASSERT_EQ(inv, inv_parallel);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NTT, NTTAVX512ParallelTest,
+    ::testing::Combine(::testing::Values(1, 2, 3, 4, 8, 32),
+                       ::testing::Values(27, 49, 55)));
+
+// Parameters = (number of threads, degree)
+class NTTAVX512FourStepTest
+    : public ::testing::TestWithParam<std::tuple<size_t, size_t>> {};
+
+// Checks the four-step AVX512 NTT matches the AVX512 NTT for each valid
+// block size
+TEST_P(NTTAVX512FourStepTest, FwdInv) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+  size_t num_threads = std::get<0>(GetParam());
+  size_t N = std::get<1>(GetParam());
+
+  std::unique_ptr<ThreadPool> thread_pool;
+  if (num_threads > 0) {
+    thread_pool.reset(new ThreadPool(num_threads));
+  }
+
+  uint64_t modulus = GeneratePrimes(1, 55, N)[0];
+  NTT ntt(N, modulus);
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+  std::vector<uint64_t> input(N);
+  for (size_t i = 0; i < N; ++i) {
+    input[i] = distrib(gen);
+  }
+
+  for (size_t block_size = N; block_size * block_size >= 8 * N;
+       block_size /= 2) {
+    std::vector<uint64_t> fwd(N);
+    std::vector<uint64_t> fwd_four_step(N);
+    ForwardTransformToBitReverseAVX512<64>(
+        fwd.data(), input.data(), N, modulus,
+        ntt.GetAVX512RootOfUnityPowers().data(),
+        ntt.GetAVX512Precon64RootOfUnityPowers().data(), 2, 1);
+    ForwardTransformToBitReverseAVX512FourStep<64>(
+        fwd_four_step.data(), input.data(), N, modulus,
+        ntt.GetAVX512RootOfUnityPowers().data(),
+        ntt.GetAVX512Precon64RootOfUnityPowers().data(), 2, 1, block_size,
+        thread_pool.get());
+    ASSERT_EQ(fwd, fwd_four_step) << "block_size " << block_size;
+
+    std::vector<uint64_t> inv(N);
+    std::vector<uint64_t> inv_four_step(N);
+    InverseTransformFromBitReverseAVX512<64>(
+        inv.data(), input.data(), N, modulus,
+        ntt.GetInvRootOfUnityPowers().data(),
+        ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1);
+    InverseTransformFromBitReverseAVX512FourStep<64>(
+        inv_four_step.data(), input.data(), N, modulus,
+        ntt.GetInvRootOfUnityPowers().data(),
+        ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1, block_size,
+        thread_pool.get());
+    ASSERT_EQ(inv, inv_four_step) << "block_size " << block_size;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(NTT, NTTAVX512FourStepTest,
+                         ::testing::Combine(::testing::Values(0, 4),
+                                            ::testing::Values(1024, 65536)));
+
+// Checks transforms above 2^20, which take the four-step path, match the
+// native NTT
+TEST(NTT, FourStepLargeDegree) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+  size_t N = 1 << 21;
+  uint64_t modulus = GeneratePrimes(1, 55, N)[0];
+  NTT ntt(N, modulus);
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+  std::vector<uint64_t> input(N);
+  for (size_t i = 0; i < N; ++i) {
+    input[i] = distrib(gen);
+  }
+
+  std::vector<uint64_t> fwd(N);
+  std::vector<uint64_t> fwd_native(N);
+  ntt.ComputeForward(fwd.data(), input.data(), 1, 1);
+  ForwardTransformToBitReverse64(
+      fwd_native.data(), input.data(), N, modulus,
+      ntt.GetRootOfUnityPowers().data(),
+      ntt.GetPrecon64RootOfUnityPowers().data(), 1, 1);
+  ASSERT_EQ(fwd, fwd_native);
+
+  std::vector<uint64_t> inv(N);
+  ntt.ComputeInverse(inv.data(), fwd.data(), 1, 1);
+  ASSERT_EQ(inv, input);
+}
+
+TEST(NTT, GoldilocksAVX512) {
+  if (!has_avx512dq) {
+    GTEST_SKIP();
+  }
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, kGoldilocksModulus - 1);
+
+  for (uint64_t N = 1; N <= (1 << 12); N <<= 1) {
+    for (NTT::Mode mode : {NTT::Mode::kNegacyclic, NTT::Mode::kCyclic}) {
+      GoldilocksNTT ntt(N, mode);
+      std::vector<uint64_t> input(N);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = distrib(gen);
+      }
+
+      std::vector<uint64_t> fwd_native = input;
+      std::vector<uint64_t> fwd_avx512 = input;
+      ForwardTransformToBitReverseGoldilocks(
+          fwd_native.data(), N, ntt.GetRootOfUnityPowers().data());
+      ForwardTransformToBitReverseGoldilocksAVX512(
+          fwd_avx512.data(), N, ntt.GetRootOfUnityPowers().data());
+      ASSERT_EQ(fwd_native, fwd_avx512);
+
+      uint64_t inv_n = PowModGoldilocks(N, kGoldilocksModulus - 2);
+      std::vector<uint64_t> inv_native = fwd_native;
+      std::vector<uint64_t> inv_avx512 = fwd_native;
+      InverseTransformFromBitReverseGoldilocks(
+          inv_native.data(), N, ntt.GetInvRootOfUnityPowers().data(), inv_n);
+      InverseTransformFromBitReverseGoldilocksAVX512(
+          inv_avx512.data(), N, ntt.GetInvRootOfUnityPowers().data(), inv_n);
+      ASSERT_EQ(inv_native, inv_avx512);
+      ASSERT_EQ(inv_native, input);
+    }
+  }
+}
 #endif
 
 }  // namespace hexl
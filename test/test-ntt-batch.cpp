@@ -0,0 +1,117 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+// Parameters are the degree, the modulus bits and the batch size
+class NTTBatchTest : public ::testing::TestWithParam<
+                         std::tuple<uint64_t, uint64_t, uint64_t>> {};
+
+// Checks each polynomial of the batched transforms matches the transform of
+// that polynomial alone, both in-place and out-of-place
+TEST_P(NTTBatchTest, MatchSingle) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t modulus = GeneratePrimes(1, std::get<1>(GetParam()), N)[0];
+  uint64_t batch_size = std::get<2>(GetParam());
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  NTT ntt(N, modulus);
+
+  for (auto order : {NTT::Ordering::kBitReversed, NTT::Ordering::kNatural}) {
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      for (uint64_t output_mod_factor : {1, 4}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N * batch_size);
+        for (auto& value : input) {
+          value = distrib(gen);
+        }
+        std::vector<uint64_t> output(N * batch_size);
+        ntt.ComputeForwardBatch(output.data(), input.data(), batch_size,
+                                input_mod_factor, output_mod_factor, order);
+
+        std::vector<uint64_t> expected = input;
+        for (size_t b = 0; b < batch_size; ++b) {
+          ntt.ComputeForward(expected.data() + b * N, expected.data() + b * N,
+                             input_mod_factor, 1, order);
+        }
+        for (size_t i = 0; i < N * batch_size; ++i) {
+          ASSERT_LT(output[i], output_mod_factor * modulus);
+          ASSERT_EQ(output[i] % modulus, expected[i]) << i;
+        }
+
+        ntt.ComputeForwardBatch(input.data(), input.data(), batch_size,
+                                input_mod_factor, output_mod_factor, order);
+        AssertEqual(input, output);
+      }
+    }
+
+    for (uint64_t input_mod_factor : {1, 2}) {
+      for (uint64_t output_mod_factor : {1, 2}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N * batch_size);
+        for (auto& value : input) {
+          value = distrib(gen);
+        }
+        std::vector<uint64_t> output(N * batch_size);
+        ntt.ComputeInverseBatch(output.data(), input.data(), batch_size,
+                                input_mod_factor, output_mod_factor, order);
+
+        std::vector<uint64_t> expected = input;
+        for (size_t b = 0; b < batch_size; ++b) {
+          ntt.ComputeInverse(expected.data() + b * N, expected.data() + b * N,
+                             input_mod_factor, 1, order);
+        }
+        for (size_t i = 0; i < N * batch_size; ++i) {
+          ASSERT_LT(output[i], output_mod_factor * modulus);
+          ASSERT_EQ(output[i] % modulus, expected[i]) << i;
+        }
+
+        ntt.ComputeInverseBatch(input.data(), input.data(), batch_size,
+                                input_mod_factor, output_mod_factor, order);
+        AssertEqual(input, output);
+      }
+    }
+  }
+}
+
+#ifdef HEXL_DEBUG
+TEST(NTTBatch, BadInput) {
+  uint64_t N = 8;
+  uint64_t modulus = GeneratePrimes(1, 30, N)[0];
+  NTT ntt(N, modulus);
+  std::vector<uint64_t> input(N * 4, 1);
+
+  EXPECT_ANY_THROW(
+      ntt.ComputeForwardBatch(input.data(), input.data(), 0, 1, 1));
+  EXPECT_ANY_THROW(ntt.ComputeForwardBatch(nullptr, input.data(), 4, 1, 1));
+  EXPECT_ANY_THROW(
+      ntt.ComputeInverseBatch(input.data(), input.data(), 4, 4, 1));
+
+  input[3 * N] = modulus;
+  EXPECT_ANY_THROW(
+      ntt.ComputeForwardBatch(input.data(), input.data(), 4, 1, 1));
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(
+    NTT, NTTBatchTest,
+    ::testing::Combine(::testing::Values(1, 2, 4, 8, 16, 32),
+                       ::testing::Values(27, 50, 61),
+                       ::testing::Values(1, 5, 8, 19)));
+
+}  // namespace hexl
+}  // namespace intel
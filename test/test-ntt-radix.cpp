@@ -0,0 +1,150 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-radix.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+// Parameters are the degree, the modulus bits and the radix
+class NTTRadixTest : public ::testing::TestWithParam<
+                         std::tuple<uint64_t, uint64_t, uint64_t>> {};
+
+// Checks the radix-4 and radix-8 transforms match the radix-2 transforms,
+// computing the former out-of-place
+TEST_P(NTTRadixTest, NativeMatch) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t modulus = GeneratePrimes(1, std::get<1>(GetParam()), N)[0];
+  uint64_t radix = std::get<2>(GetParam());
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  NTT ntt(N, modulus);
+  const uint64_t* root_of_unity_powers = ntt.GetRootOfUnityPowers().data();
+  const uint64_t* precon_root_of_unity_powers =
+      ntt.GetPrecon64RootOfUnityPowers().data();
+  const uint64_t* inv_root_of_unity_powers =
+      ntt.GetInvRootOfUnityPowers().data();
+  const uint64_t* precon_inv_root_of_unity_powers =
+      ntt.GetPrecon64InvRootOfUnityPowers().data();
+
+  for (uint64_t input_mod_factor : {1, 2, 4}) {
+    for (uint64_t output_mod_factor : {1, 4}) {
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      std::vector<uint64_t> input(N, 0);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = distrib(gen);
+      }
+      std::vector<uint64_t> expected = input;
+      std::vector<uint64_t> output(N, 0);
+
+      ForwardTransformToBitReverse64(
+          expected.data(), expected.data(), N, modulus, root_of_unity_powers,
+          precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      if (radix == 4) {
+        ForwardTransformToBitReverseRadix<2>(
+            output.data(), input.data(), N, modulus, root_of_unity_powers,
+            precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      } else {
+        ForwardTransformToBitReverseRadix<3>(
+            output.data(), input.data(), N, modulus, root_of_unity_powers,
+            precon_root_of_unity_powers, input_mod_factor, output_mod_factor);
+      }
+      // Intermediate values may differ by multiples of q
+      if (output_mod_factor == 4) {
+        for (size_t i = 0; i < N; ++i) {
+          expected[i] %= modulus;
+          output[i] %= modulus;
+        }
+      }
+      ASSERT_EQ(expected, output);
+    }
+  }
+
+  for (uint64_t input_mod_factor : {1, 2}) {
+    for (uint64_t output_mod_factor : {1, 2}) {
+      std::uniform_int_distribution<uint64_t> distrib(
+          0, input_mod_factor * modulus - 1);
+      std::vector<uint64_t> input(N, 0);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = distrib(gen);
+      }
+      std::vector<uint64_t> expected = input;
+      std::vector<uint64_t> output(N, 0);
+
+      InverseTransformFromBitReverse64(
+          expected.data(), expected.data(), N, modulus,
+          inv_root_of_unity_powers, precon_inv_root_of_unity_powers,
+          input_mod_factor, output_mod_factor);
+      if (radix == 4) {
+        InverseTransformFromBitReverseRadix<2>(
+            output.data(), input.data(), N, modulus, inv_root_of_unity_powers,
+            precon_inv_root_of_unity_powers, input_mod_factor,
+            output_mod_factor);
+      } else {
+        InverseTransformFromBitReverseRadix<3>(
+            output.data(), input.data(), N, modulus, inv_root_of_unity_powers,
+            precon_inv_root_of_unity_powers, input_mod_factor,
+            output_mod_factor);
+      }
+      if (output_mod_factor == 2) {
+        for (size_t i = 0; i < N; ++i) {
+          expected[i] %= modulus;
+          output[i] %= modulus;
+        }
+      }
+      ASSERT_EQ(expected, output);
+    }
+  }
+}
+
+// Checks the NTT object computes the same transforms with each native radix
+TEST_P(NTTRadixTest, SetNativeRadix) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t modulus = GeneratePrimes(1, std::get<1>(GetParam()), N)[0];
+  uint64_t radix = std::get<2>(GetParam());
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+  std::vector<uint64_t> input(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    input[i] = distrib(gen);
+  }
+
+  NTT ntt(N, modulus);
+  ntt.SetNativeRadix(radix);
+  EXPECT_EQ(ntt.GetNativeRadix(), radix);
+
+  std::vector<uint64_t> expected = input;
+  ReferenceForwardTransformToBitReverse(expected.data(), N, modulus,
+                                        ntt.GetRootOfUnityPowers().data());
+
+  std::vector<uint64_t> output(N, 0);
+  ntt.ComputeForward(output.data(), input.data(), 1, 1);
+  ASSERT_EQ(expected, output);
+
+  ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+  ASSERT_EQ(input, output);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    NTT, NTTRadixTest,
+    ::testing::Combine(::testing::Values(2, 4, 8, 16, 32, 64, 128, 256, 1024,
+                                         4096, 1 << 13),
+                       ::testing::Values(30, 50, 61), ::testing::Values(4, 8)));
+
+}  // namespace hexl
+}  // namespace intel
@@ -0,0 +1,177 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-internal.hpp"
+#include "ntt/ntt-strided.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+namespace {
+
+// Returns column j of a batch stored with the given stride
+std::vector<uint64_t> GetColumn(const std::vector<uint64_t>& batch, size_t n,
+                                size_t stride, size_t j) {
+  std::vector<uint64_t> column(n);
+  for (size_t i = 0; i < n; ++i) {
+    column[i] = batch[i * stride + j];
+  }
+  return column;
+}
+
+}  // namespace
+
+// Parameters are the degree, the modulus bits and the batch size
+class NTTStridedTest : public ::testing::TestWithParam<
+                           std::tuple<uint64_t, uint64_t, uint64_t>> {};
+
+// Checks each column of the strided transforms matches the transforms of
+// contiguous polynomials, and the padding between rows is untouched
+TEST_P(NTTStridedTest, MatchColumns) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t modulus = GeneratePrimes(1, std::get<1>(GetParam()), N)[0];
+  uint64_t batch_size = std::get<2>(GetParam());
+  uint64_t stride = batch_size + 3;
+  const uint64_t padding = 0xdeadbeef;
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  NTT ntt(N, modulus);
+
+  for (auto order : {NTT::Ordering::kBitReversed, NTT::Ordering::kNatural}) {
+    for (uint64_t input_mod_factor : {1, 2, 4}) {
+      for (uint64_t output_mod_factor : {1, 4}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N * stride, padding);
+        for (size_t i = 0; i < N; ++i) {
+          for (size_t j = 0; j < batch_size; ++j) {
+            input[i * stride + j] = distrib(gen);
+          }
+        }
+        std::vector<uint64_t> output(N * stride, padding);
+        ntt.ComputeForwardStrided(output.data(), input.data(), batch_size,
+                                  stride, input_mod_factor, output_mod_factor,
+                                  order);
+
+        for (size_t j = 0; j < stride; ++j) {
+          std::vector<uint64_t> column = GetColumn(output, N, stride, j);
+          if (j >= batch_size) {
+            AssertEqual(column, std::vector<uint64_t>(N, padding));
+            continue;
+          }
+          std::vector<uint64_t> expected = GetColumn(input, N, stride, j);
+          ntt.ComputeForward(expected.data(), expected.data(),
+                             input_mod_factor, 1, order);
+          for (size_t i = 0; i < N; ++i) {
+            ASSERT_LT(column[i], output_mod_factor * modulus);
+            ASSERT_EQ(column[i] % modulus, expected[i]) << i << ", " << j;
+          }
+        }
+      }
+    }
+
+    for (uint64_t input_mod_factor : {1, 2}) {
+      for (uint64_t output_mod_factor : {1, 2}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N * stride, padding);
+        for (size_t i = 0; i < N; ++i) {
+          for (size_t j = 0; j < batch_size; ++j) {
+            input[i * stride + j] = distrib(gen);
+          }
+        }
+        std::vector<uint64_t> output(N * stride, padding);
+        ntt.ComputeInverseStrided(output.data(), input.data(), batch_size,
+                                  stride, input_mod_factor, output_mod_factor,
+                                  order);
+
+        for (size_t j = 0; j < stride; ++j) {
+          std::vector<uint64_t> column = GetColumn(output, N, stride, j);
+          if (j >= batch_size) {
+            AssertEqual(column, std::vector<uint64_t>(N, padding));
+            continue;
+          }
+          std::vector<uint64_t> expected = GetColumn(input, N, stride, j);
+          ntt.ComputeInverse(expected.data(), expected.data(),
+                             input_mod_factor, 1, order);
+          for (size_t i = 0; i < N; ++i) {
+            ASSERT_LT(column[i], output_mod_factor * modulus);
+            ASSERT_EQ(column[i] % modulus, expected[i]) << i << ", " << j;
+          }
+        }
+      }
+    }
+  }
+}
+
+// Checks the in-place round trip, and the native kernels against the NTT
+// object, which may dispatch to AVX512
+TEST_P(NTTStridedTest, NativeMatch) {
+  uint64_t N = std::get<0>(GetParam());
+  uint64_t modulus = GeneratePrimes(1, std::get<1>(GetParam()), N)[0];
+  uint64_t batch_size = std::get<2>(GetParam());
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+  std::vector<uint64_t> input(N * batch_size);
+  for (auto& value : input) {
+    value = distrib(gen);
+  }
+  NTT ntt(N, modulus);
+
+  std::vector<uint64_t> expected = input;
+  ntt.ComputeForwardStrided(expected.data(), expected.data(), batch_size,
+                            batch_size, 1, 1);
+  std::vector<uint64_t> output(N * batch_size);
+  ForwardTransformToBitReverseStrided64(
+      output.data(), input.data(), N, batch_size, batch_size, modulus,
+      ntt.GetRootOfUnityPowers().data(),
+      ntt.GetPrecon64RootOfUnityPowers().data(), 1, 1);
+  AssertEqual(output, expected);
+
+  ntt.ComputeInverseStrided(expected.data(), expected.data(), batch_size,
+                            batch_size, 1, 1);
+  AssertEqual(expected, input);
+  InverseTransformFromBitReverseStrided64(
+      output.data(), output.data(), N, batch_size, batch_size, modulus,
+      ntt.GetInvRootOfUnityPowers().data(),
+      ntt.GetPrecon64InvRootOfUnityPowers().data(), 1, 1);
+  AssertEqual(output, input);
+}
+
+#ifdef HEXL_DEBUG
+TEST(NTTStrided, BadInput) {
+  uint64_t N = 8;
+  NTT ntt(N, GeneratePrimes(1, 30, N)[0]);
+  std::vector<uint64_t> input(N * 4, 1);
+
+  EXPECT_ANY_THROW(
+      ntt.ComputeForwardStrided(input.data(), input.data(), 0, 4, 1, 1));
+  EXPECT_ANY_THROW(
+      ntt.ComputeForwardStrided(input.data(), input.data(), 4, 3, 1, 1));
+  EXPECT_ANY_THROW(
+      ntt.ComputeInverseStrided(input.data(), input.data(), 4, 3, 1, 1));
+  EXPECT_ANY_THROW(
+      ntt.ComputeInverseStrided(nullptr, input.data(), 4, 4, 1, 1));
+}
+#endif
+
+INSTANTIATE_TEST_SUITE_P(
+    NTT, NTTStridedTest,
+    ::testing::Combine(::testing::Values(1, 2, 16, 64, 1024),
+                       ::testing::Values(27, 50, 61),
+                       ::testing::Values(1, 3, 8, 13)));
+
+}  // namespace hexl
+}  // namespace intel
@@ -3,14 +3,24 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+#include <map>
 #include <memory>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
+#include "hexl/eltwise/eltwise-mult-mod.hpp"
+#include "hexl/eltwise/eltwise-reduce-mod.hpp"
 #include "hexl/logging/logging.hpp"
+#include "hexl/ntt/bit-reverse.hpp"
 #include "hexl/ntt/ntt.hpp"
 #include "hexl/number-theory/number-theory.hpp"
+#include "ntt/ntt-cache.hpp"
 #include "ntt/ntt-internal.hpp"
 #include "test-util.hpp"
 #include "util/cpu-features.hpp"
@@ -227,6 +237,785 @@ TEST(NTT, root_of_unity2) {
   EXPECT_EQ(ntt.GetInvRootOfUnityPower(0), ntt.GetInvRootOfUnityPowers()[0]);
 }
 
+// Checks the pre-computed tables against the straightforward computation
+TEST(NTT, PreconTables) {
+  for (uint64_t N : {2, 8, 1024}) {
+    for (uint64_t bits : {30, 49, 60}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      NTT ntt(N, modulus);
+      uint64_t w = ntt.GetMinimalRootOfUnity();
+
+      std::vector<uint64_t> exp_roots(N);
+      for (size_t i = 0; i < N; ++i) {
+        exp_roots[ReverseBits(i, Log2(N))] = PowMod(w, i, modulus);
+      }
+      std::vector<uint64_t> exp_inv_roots{1};
+      for (size_t m = N / 2; m > 0; m >>= 1) {
+        for (size_t i = 0; i < m; ++i) {
+          exp_inv_roots.push_back(InverseMod(exp_roots[m + i], modulus));
+        }
+      }
+      for (size_t i = 0; i < N; ++i) {
+        ASSERT_EQ(ntt.GetRootOfUnityPower(i), exp_roots[i]);
+        ASSERT_EQ(ntt.GetInvRootOfUnityPower(i), exp_inv_roots[i]);
+      }
+
+      auto check_precon = [&](const AlignedVector64<uint64_t>& values,
+                              const AlignedVector64<uint64_t>& precon,
+                              uint64_t bit_shift) {
+        ASSERT_EQ(values.size(), precon.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          ASSERT_EQ(precon[i],
+                    MultiplyFactor(values[i], bit_shift, modulus)
+                        .BarrettFactor());
+        }
+      };
+      check_precon(ntt.GetRootOfUnityPowers(),
+                   ntt.GetPrecon32RootOfUnityPowers(), 32);
+      check_precon(ntt.GetRootOfUnityPowers(),
+                   ntt.GetPrecon64RootOfUnityPowers(), 64);
+      check_precon(ntt.GetAVX512RootOfUnityPowers(),
+                   ntt.GetAVX512Precon52RootOfUnityPowers(), 52);
+      check_precon(ntt.GetInvRootOfUnityPowers(),
+                   ntt.GetPrecon64InvRootOfUnityPowers(), 64);
+    }
+  }
+}
+
+TEST(NTT, SharedTables) {
+  uint64_t N = 512;
+  uint64_t modulus = GeneratePrimes(1, 40, N)[0];
+
+  NTT::ResetCacheStats();
+  size_t resident_bytes = NTT::GetCacheStats().resident_bytes;
+  {
+    NTT ntt1(N, modulus);
+    NTT ntt2(N, modulus);
+    NTT ntt3 = ntt1;
+
+    EXPECT_EQ(ntt1.GetRootOfUnityPowers().data(),
+              ntt2.GetRootOfUnityPowers().data());
+    EXPECT_EQ(ntt1.GetInvRootOfUnityPowers().data(),
+              ntt3.GetInvRootOfUnityPowers().data());
+
+    NTT::CacheStats stats = NTT::GetCacheStats();
+    EXPECT_EQ(stats.misses, 1ULL);
+    EXPECT_EQ(stats.hits, 1ULL);
+    EXPECT_GT(stats.resident_bytes, resident_bytes);
+
+    // Different root of unity
+    uint64_t root_of_unity = PowMod(ntt1.GetMinimalRootOfUnity(), 3, modulus);
+    NTT ntt4(N, modulus, root_of_unity);
+    EXPECT_NE(ntt1.GetRootOfUnityPowers().data(),
+              ntt4.GetRootOfUnityPowers().data());
+
+    // Custom allocators don't use the cache
+    std::shared_ptr<AllocatorBase> alloc_ptr =
+        std::make_shared<MallocStrategy>();
+    NTT ntt5(N, modulus, alloc_ptr);
+    EXPECT_NE(ntt1.GetRootOfUnityPowers().data(),
+              ntt5.GetRootOfUnityPowers().data());
+    EXPECT_EQ(ntt1.GetRootOfUnityPowers(), ntt5.GetRootOfUnityPowers());
+  }
+  // Tables are released with the last NTT object using them
+  EXPECT_EQ(NTT::GetCacheStats().resident_bytes, resident_bytes);
+}
+
+TEST(NTT, CachedMinimalRoot) {
+  uint64_t N = 1024;
+  uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+  NTTTableCache& cache = NTTTableCache::GetInstance();
+
+  NTT ntt(N, modulus);
+  EXPECT_EQ(ntt.GetMinimalRootOfUnity(), MinimalPrimitiveRoot(2 * N, modulus));
+  EXPECT_EQ(cache.MinimalPrimitiveRoot(2 * N, modulus),
+            ntt.GetMinimalRootOfUnity());
+
+  NTT cyclic = NTT::CreateCyclic(N, modulus);
+  EXPECT_EQ(cyclic.GetMinimalRootOfUnity(), MinimalPrimitiveRoot(N, modulus));
+  EXPECT_EQ(cache.MinimalPrimitiveRoot(N, modulus),
+            cyclic.GetMinimalRootOfUnity());
+}
+
+TEST(NTT, MemoryFootprint) {
+  uint64_t N = 256;
+  uint64_t modulus = GeneratePrimes(1, 45, N)[0];
+  std::vector<uint64_t> input(N, 1);
+
+  NTT ntt(N, modulus);
+  std::map<std::string, size_t> footprint = ntt.GetMemoryFootprint();
+  EXPECT_EQ(footprint.size(), 15ULL);
+  for (const auto& table : footprint) {
+    EXPECT_EQ(table.second, 0ULL) << table.first;
+  }
+
+  // Only the tables used by the selected implementation are computed
+  ntt.ComputeForward(input.data(), input.data(), 1, 1);
+  ntt.ComputeInverse(input.data(), input.data(), 1, 1);
+  footprint = ntt.GetMemoryFootprint();
+  EXPECT_GE(footprint["RootOfUnityPowers"], N * sizeof(uint64_t));
+  EXPECT_GE(footprint["InvRootOfUnityPowers"], N * sizeof(uint64_t));
+  EXPECT_EQ(footprint["Precon32RootOfUnityPowers"], 0ULL);
+
+  size_t num_computed = 0;
+  for (const auto& table : footprint) {
+    num_computed += (table.second > 0);
+  }
+  EXPECT_LE(num_computed, 5ULL);
+
+  // Getters compute tables on demand
+  EXPECT_EQ(ntt.GetPrecon32RootOfUnityPowers().size(), N);
+  EXPECT_GE(ntt.GetMemoryFootprint()["Precon32RootOfUnityPowers"],
+            N * sizeof(uint64_t));
+}
+
+TEST(NTT, NaturalOrder) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {2, 8, 64, 1024, 4096}) {
+    uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+    std::vector<uint64_t> input(N);
+    for (auto& value : input) {
+      value = distrib(gen);
+    }
+    NTT ntt(N, modulus);
+
+    std::vector<uint64_t> expected(N);
+    ntt.ComputeForward(expected.data(), input.data(), 1, 1);
+    BitReversePermuteInPlace(expected.data(), N);
+
+    std::vector<uint64_t> natural(N);
+    ntt.ComputeForward(natural.data(), input.data(), 1, 1,
+                       NTT::Ordering::kNatural);
+    AssertEqual(natural, expected);
+
+    // Out-of-place and in-place inverse transforms of natural-order input
+    std::vector<uint64_t> result(N);
+    ntt.ComputeInverse(result.data(), natural.data(), 1, 1,
+                       NTT::Ordering::kNatural);
+    AssertEqual(result, input);
+    ntt.ComputeInverse(natural.data(), natural.data(), 1, 1,
+                       NTT::Ordering::kNatural);
+    AssertEqual(natural, input);
+  }
+}
+
+// Out-of-place transforms leave the operand untouched and match in-place
+TEST(NTT, OutOfPlace) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {1, 2, 8, 16, 32, 64, 1024, 4096, 1 << 15}) {
+    for (uint64_t bits : {27, 49, 61}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> input(N);
+      for (auto& value : input) {
+        value = distrib(gen);
+      }
+      NTT ntt(N, modulus);
+      if (N >= 1 << 15) {
+        ntt.SetNumThreads(4);
+      }
+
+      for (auto order :
+           {NTT::Ordering::kBitReversed, NTT::Ordering::kNatural}) {
+        std::vector<uint64_t> expected = input;
+        ntt.ComputeForward(expected.data(), expected.data(), 1, 1, order);
+        std::vector<uint64_t> operand = input;
+        std::vector<uint64_t> result(N);
+        ntt.ComputeForward(result.data(), operand.data(), 1, 1, order);
+        AssertEqual(operand, input);
+        AssertEqual(result, expected);
+
+        operand = expected;
+        ntt.ComputeInverse(result.data(), operand.data(), 1, 1, order);
+        AssertEqual(operand, expected);
+        AssertEqual(result, input);
+      }
+
+      if (modulus < NTT::s_max_fwd_32_modulus) {
+        std::vector<uint32_t> input32(input.begin(), input.end());
+        std::vector<uint32_t> expected32 = input32;
+        ntt.ComputeForward(expected32.data(), expected32.data(), 1, 1);
+        std::vector<uint32_t> operand32 = input32;
+        std::vector<uint32_t> result32(N);
+        ntt.ComputeForward(result32.data(), operand32.data(), 1, 1);
+        AssertEqual(operand32, input32);
+        AssertEqual(result32, expected32);
+
+        operand32 = expected32;
+        ntt.ComputeInverse(result32.data(), operand32.data(), 1, 1);
+        AssertEqual(operand32, expected32);
+        AssertEqual(result32, input32);
+      }
+    }
+  }
+}
+
+namespace {
+
+// Returns a prime q of bit_size bits with q == 1 mod n, but q != 1 mod 2n,
+// which only supports cyclic and twisted transforms of degree n
+uint64_t GenerateCyclicPrime(size_t bit_size, uint64_t n) {
+  uint64_t k = ((1ULL << (bit_size - 1)) / n) | 1;
+  while (!IsPrime(k * n + 1)) {
+    k += 2;
+  }
+  return k * n + 1;
+}
+
+// Returns the evaluations of input at twist * root^ReverseBits(i, log2(N))
+std::vector<uint64_t> ReferenceTwistedNTT(const std::vector<uint64_t>& input,
+                                          uint64_t modulus, uint64_t root,
+                                          uint64_t twist) {
+  uint64_t N = input.size();
+  std::vector<uint64_t> output(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    uint64_t x = MultiplyMod(twist, PowMod(root, ReverseBits(i, Log2(N)),
+                                           modulus),
+                             modulus);
+    uint64_t x_pow = 1;
+    for (size_t j = 0; j < N; ++j) {
+      output[i] = AddUIntMod(output[i],
+                             MultiplyMod(input[j], x_pow, modulus), modulus);
+      x_pow = MultiplyMod(x_pow, x, modulus);
+    }
+  }
+  return output;
+}
+
+// Returns a * b mod (X^N - wrap), with N the size of a and b
+std::vector<uint64_t> ReferencePolyMulMod(const std::vector<uint64_t>& a,
+                                          const std::vector<uint64_t>& b,
+                                          uint64_t modulus, uint64_t wrap) {
+  uint64_t N = a.size();
+  std::vector<uint64_t> output(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = 0; j < N; ++j) {
+      uint64_t product = MultiplyMod(a[i], b[j], modulus);
+      if (i + j >= N) {
+        product = MultiplyMod(product, wrap, modulus);
+      }
+      uint64_t& out = output[(i + j) % N];
+      out = AddUIntMod(out, product, modulus);
+    }
+  }
+  return output;
+}
+
+}  // namespace
+
+TEST(NTT, Cyclic) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  // Moduli select the native, 32-bit, IFMA and 64-bit implementations
+  for (uint64_t N : {2, 8, 64, 512}) {
+    for (size_t bits : {28, 45, 55}) {
+      uint64_t modulus = GenerateCyclicPrime(bits, N);
+      NTT ntt = NTT::CreateCyclic(N, modulus);
+      EXPECT_EQ(ntt.GetMode(), NTT::Mode::kCyclic);
+      EXPECT_EQ(ntt.GetTwist(), 1ULL);
+      uint64_t root = ntt.GetMinimalRootOfUnity();
+      EXPECT_TRUE(IsPrimitiveRoot(root, N, modulus));
+
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> a(N);
+      std::vector<uint64_t> b(N);
+      for (size_t i = 0; i < N; ++i) {
+        a[i] = distrib(gen);
+        b[i] = distrib(gen);
+      }
+
+      std::vector<uint64_t> a_ntt(N);
+      std::vector<uint64_t> b_ntt(N);
+      ntt.ComputeForward(a_ntt.data(), a.data(), 1, 1);
+      ntt.ComputeForward(b_ntt.data(), b.data(), 1, 1);
+      AssertEqual(a_ntt, ReferenceTwistedNTT(a, modulus, root, 1));
+
+      // Pointwise products of the transforms give the cyclic convolution
+      std::vector<uint64_t> expected(N, 0);
+      for (size_t i = 0; i < N; ++i) {
+        for (size_t j = 0; j < N; ++j) {
+          uint64_t& out = expected[(i + j) % N];
+          out = AddUIntMod(out, MultiplyMod(a[i], b[j], modulus), modulus);
+        }
+        a_ntt[i] = MultiplyMod(a_ntt[i], b_ntt[i], modulus);
+      }
+      std::vector<uint64_t> product(N);
+      ntt.ComputeInverse(product.data(), a_ntt.data(), 1, 1);
+      AssertEqual(product, expected);
+    }
+  }
+}
+
+TEST(NTT, Twisted) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {2, 8, 64, 512}) {
+    for (size_t bits : {28, 45, 55}) {
+      uint64_t modulus = GenerateCyclicPrime(bits, N);
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      uint64_t twist = distrib(gen) | 1;
+      NTT ntt = NTT::CreateTwisted(N, modulus, twist);
+      EXPECT_EQ(ntt.GetMode(), NTT::Mode::kTwisted);
+      EXPECT_EQ(ntt.GetTwist(), twist);
+
+      std::vector<uint64_t> input(N);
+      for (auto& value : input) {
+        value = distrib(gen);
+      }
+      std::vector<uint64_t> output(N);
+      ntt.ComputeForward(output.data(), input.data(), 1, 1);
+      AssertEqual(output,
+                  ReferenceTwistedNTT(input, modulus,
+                                      ntt.GetMinimalRootOfUnity(), twist));
+
+      ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+      AssertEqual(output, input);
+    }
+  }
+
+  // Twisting by a 2N'th root of unity is the negacyclic transform
+  uint64_t N = 1024;
+  uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+  NTT negacyclic(N, modulus);
+  uint64_t psi = negacyclic.GetMinimalRootOfUnity();
+  NTT twisted = NTT::CreateTwisted(N, modulus, psi,
+                                   MultiplyMod(psi, psi, modulus));
+  EXPECT_EQ(twisted.GetRootOfUnityPowers(),
+            negacyclic.GetRootOfUnityPowers());
+  EXPECT_EQ(twisted.GetInvRootOfUnityPowers(),
+            negacyclic.GetInvRootOfUnityPowers());
+}
+
+TEST(NTT, PolyMulMod) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  // Degrees above 4096 take the fused path on AVX512. Moduli select the
+  // 32-bit, IFMA and 64-bit implementations, and the largest modulus doesn't
+  // allow lazy reduction to [0, 4q).
+  for (uint64_t N : {16, 1024, 2048, 16384, 1 << 18}) {
+    for (size_t bits : {28, 45, 55, 61}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      NTT ntt(N, modulus);
+
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> a(N);
+      std::vector<uint64_t> b(N);
+      for (size_t i = 0; i < N; ++i) {
+        a[i] = distrib(gen);
+        b[i] = distrib(gen);
+      }
+
+      std::vector<uint64_t> b_ntt(N);
+      std::vector<uint64_t> expected(N);
+      ntt.ComputeForward(expected.data(), a.data(), 1, 1);
+      ntt.ComputeForward(b_ntt.data(), b.data(), 1, 1);
+      EltwiseMultMod(expected.data(), expected.data(), b_ntt.data(), N,
+                     modulus, 1);
+      ntt.ComputeInverse(expected.data(), expected.data(), 1, 1);
+      if (N <= 2048) {
+        AssertEqual(expected, ReferencePolyMulMod(a, b, modulus, modulus - 1));
+      }
+
+      std::vector<uint64_t> result(N);
+      ntt.PolyMulMod(result.data(), a.data(), b.data());
+      AssertEqual(result, expected);
+      ntt.PolyMulModNTT(result.data(), a.data(), b_ntt.data());
+      AssertEqual(result, expected);
+
+      // In-place
+      result = a;
+      ntt.PolyMulMod(result.data(), result.data(), b.data());
+      AssertEqual(result, expected);
+      result = b;
+      ntt.PolyMulMod(result.data(), a.data(), result.data());
+      AssertEqual(result, expected);
+      result = b_ntt;
+      ntt.PolyMulModNTT(result.data(), a.data(), result.data());
+      AssertEqual(result, expected);
+
+      // Squaring, with both operands aliasing the result
+      std::vector<uint64_t> square(N);
+      ntt.PolyMulMod(square.data(), a.data(), a.data());
+      result = a;
+      ntt.PolyMulMod(result.data(), result.data(), result.data());
+      AssertEqual(result, square);
+    }
+  }
+}
+
+// Checks polynomial multiplication computed in Montgomery form matches
+TEST(NTT, PolyMulModMontgomery) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {16, 4096}) {
+    for (size_t bits : {28, 55, 61}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      NTT ntt(N, modulus);
+
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> a(N);
+      std::vector<uint64_t> b(N);
+      for (size_t i = 0; i < N; ++i) {
+        a[i] = distrib(gen);
+        b[i] = distrib(gen);
+      }
+      std::vector<uint64_t> expected(N);
+      ntt.PolyMulMod(expected.data(), a.data(), b.data());
+
+      EltwiseToMontgomery(a.data(), a.data(), N, modulus);
+      EltwiseToMontgomery(b.data(), b.data(), N, modulus);
+      ntt.ComputeForward(a.data(), a.data(), 1, 1);
+      ntt.ComputeForward(b.data(), b.data(), 1, 1);
+      EltwiseMultModMontgomery(a.data(), a.data(), b.data(), N, modulus);
+      ntt.ComputeInverse(a.data(), a.data(), 1, 1);
+      EltwiseFromMontgomery(a.data(), a.data(), N, modulus);
+      AssertEqual(a, expected);
+    }
+  }
+}
+
+TEST(NTT, PolyMulModCyclicTwisted) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {1024, 8192}) {
+    for (size_t bits : {28, 45, 55}) {
+      uint64_t modulus = GenerateCyclicPrime(bits, N);
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint64_t> a(N);
+      std::vector<uint64_t> b(N);
+      for (size_t i = 0; i < N; ++i) {
+        a[i] = distrib(gen);
+        b[i] = distrib(gen);
+      }
+
+      // Twisted transforms multiply modulo X^N - twist^N
+      uint64_t twist = distrib(gen) | 1;
+      NTT cyclic = NTT::CreateCyclic(N, modulus);
+      NTT twisted = NTT::CreateTwisted(N, modulus, twist);
+      for (NTT* ntt : {&cyclic, &twisted}) {
+        std::vector<uint64_t> expected(N);
+        std::vector<uint64_t> b_ntt(N);
+        ntt->ComputeForward(expected.data(), a.data(), 1, 1);
+        ntt->ComputeForward(b_ntt.data(), b.data(), 1, 1);
+        EltwiseMultMod(expected.data(), expected.data(), b_ntt.data(), N,
+                       modulus, 1);
+        ntt->ComputeInverse(expected.data(), expected.data(), 1, 1);
+        if (N <= 1024) {
+          uint64_t wrap = PowMod(ntt->GetTwist(), N, modulus);
+          AssertEqual(expected, ReferencePolyMulMod(a, b, modulus, wrap));
+        }
+
+        std::vector<uint64_t> result(N);
+        ntt->PolyMulMod(result.data(), a.data(), b.data());
+        AssertEqual(result, expected);
+      }
+    }
+  }
+}
+
+TEST(NTT, SaveLoadTables) {
+  std::string filename = "hexl-test-ntt-tables.bin";
+  std::vector<std::tuple<uint64_t, uint64_t>> params{
+      {1024, GeneratePrimes(1, 50, 1024)[0]},
+      {64, GeneratePrimes(1, 30, 64)[0]}};
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  std::vector<std::vector<uint64_t>> inputs;
+  std::vector<std::vector<uint64_t>> fwd_outputs;
+  std::vector<AlignedVector64<uint64_t>> precon_roots;
+  {
+    std::vector<NTT> ntts;
+    for (const auto& param : params) {
+      uint64_t N = std::get<0>(param);
+      uint64_t modulus = std::get<1>(param);
+      ntts.emplace_back(N, modulus);
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      inputs.emplace_back(N);
+      for (auto& value : inputs.back()) {
+        value = distrib(gen);
+      }
+      fwd_outputs.emplace_back(N);
+      ntts.back().ComputeForward(fwd_outputs.back().data(),
+                                 inputs.back().data(), 1, 1);
+      precon_roots.push_back(ntts.back().GetPrecon64RootOfUnityPowers());
+    }
+    NTT::SaveTables(filename, ntts);
+  }
+
+  std::vector<NTT> loaded = NTT::LoadTables(filename);
+  ASSERT_EQ(loaded.size(), params.size());
+  for (size_t i = 0; i < params.size(); ++i) {
+    uint64_t N = std::get<0>(params[i]);
+    EXPECT_EQ(loaded[i].GetDegree(), N);
+    EXPECT_EQ(loaded[i].GetModulus(), std::get<1>(params[i]));
+    EXPECT_EQ(loaded[i].GetPrecon64RootOfUnityPowers(), precon_roots[i]);
+
+    std::vector<uint64_t> output(N);
+    loaded[i].ComputeForward(output.data(), inputs[i].data(), 1, 1);
+    AssertEqual(output, fwd_outputs[i]);
+    loaded[i].ComputeInverse(output.data(), output.data(), 1, 1);
+    AssertEqual(output, inputs[i]);
+  }
+
+  // NTT objects with the same parameters share the loaded tables
+  NTT::ResetCacheStats();
+  NTT ntt(std::get<0>(params[0]), std::get<1>(params[0]));
+  EXPECT_EQ(NTT::GetCacheStats().hits, 1ULL);
+
+  // The mode and twist are stored with the tables
+  uint64_t N = 64;
+  uint64_t modulus = GenerateCyclicPrime(40, N);
+  NTT twisted = NTT::CreateTwisted(N, modulus, 3);
+  NTT::SaveTables(filename, {twisted});
+  loaded = NTT::LoadTables(filename);
+  ASSERT_EQ(loaded.size(), 1ULL);
+  EXPECT_EQ(loaded[0].GetMode(), NTT::Mode::kTwisted);
+  EXPECT_EQ(loaded[0].GetTwist(), 3ULL);
+  EXPECT_EQ(loaded[0].GetMinimalRootOfUnity(),
+            twisted.GetMinimalRootOfUnity());
+  EXPECT_EQ(loaded[0].GetRootOfUnityPowers(), twisted.GetRootOfUnityPowers());
+
+  // Tables not read by the dispatched transforms are not computed
+  N = 1024;
+  modulus = GeneratePrimes(1, 60, N)[0];
+  std::shared_ptr<AllocatorBase> alloc_ptr =
+      std::make_shared<MallocStrategy>();
+  NTT large_modulus(N, modulus, alloc_ptr);
+  NTT::SaveTables(filename, {large_modulus});
+  std::map<std::string, size_t> footprint =
+      large_modulus.GetMemoryFootprint();
+  EXPECT_EQ(footprint["RootOfUnityPowersU32"], 0ULL);
+  EXPECT_EQ(footprint["InvRootOfUnityPowersU32"], 0ULL);
+  loaded = NTT::LoadTables(filename);
+  ASSERT_EQ(loaded.size(), 1ULL);
+  EXPECT_EQ(loaded[0].GetInvRootOfUnityPowers(),
+            large_modulus.GetInvRootOfUnityPowers());
+
+  std::remove(filename.c_str());
+}
+
+TEST(NTT, LoadTablesInvalid) {
+  std::string filename = "hexl-test-ntt-tables-invalid.bin";
+  EXPECT_THROW(NTT::LoadTables(filename), std::runtime_error);
+
+  uint64_t N = 64;
+  NTT::SaveTables(filename, {NTT(N, GeneratePrimes(1, 30, N)[0])});
+  EXPECT_EQ(NTT::LoadTables(filename).size(), 1ULL);
+
+  auto overwrite_word = [&](size_t index, uint64_t value) {
+    std::fstream file(filename,
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(index * sizeof(uint64_t)));
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  // Unsupported version
+  overwrite_word(2, NTT::s_tables_file_version + 1);
+  EXPECT_THROW(NTT::LoadTables(filename), std::runtime_error);
+
+  // Bad magic
+  overwrite_word(0, 0);
+  EXPECT_THROW(NTT::LoadTables(filename), std::runtime_error);
+
+  std::remove(filename.c_str());
+}
+
+TEST(NTT, SharedTablesThreads) {
+  uint64_t N = 1024;
+  uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+  size_t num_threads = 8;
+
+  NTT ntt(N, modulus);
+  std::vector<const uint64_t*> tables(num_threads, nullptr);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i] {
+      NTT thread_ntt(N, modulus);
+      tables[i] = thread_ntt.GetRootOfUnityPowers().data();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < num_threads; ++i) {
+    EXPECT_EQ(tables[i], ntt.GetRootOfUnityPowers().data());
+  }
+}
+
+TEST(NTT, NumThreads) {
+  uint64_t N = 1ULL << 15;
+  uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+
+  std::vector<uint64_t> input(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    input[i] = distrib(gen);
+  }
+
+  NTT ntt(N, modulus);
+  EXPECT_EQ(ntt.GetNumThreads(), 1ULL);
+  std::vector<uint64_t> exp_output(N, 0);
+  ntt.ComputeForward(exp_output.data(), input.data(), 1, 1);
+
+  ntt.SetNumThreads(4);
+  EXPECT_EQ(ntt.GetNumThreads(), 4ULL);
+  std::vector<uint64_t> output(N, 0);
+  ntt.ComputeForward(output.data(), input.data(), 1, 1);
+  AssertEqual(output, exp_output);
+
+  ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+  AssertEqual(output, input);
+
+  ntt.SetNumThreads(1);
+  EXPECT_EQ(ntt.GetNumThreads(), 1ULL);
+}
+
+TEST(NTT, BaseNTTSize) {
+  uint64_t N = 1ULL << 13;
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t bits : {27, 49, 55}) {
+    uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+    std::vector<uint64_t> input(N, 0);
+    for (size_t i = 0; i < N; ++i) {
+      input[i] = distrib(gen);
+    }
+
+    NTT ntt(N, modulus);
+    EXPECT_EQ(ntt.GetBaseNTTSize(), size_t(NTT::s_default_base_ntt_size));
+    std::vector<uint64_t> exp_output(N, 0);
+    ntt.ComputeForward(exp_output.data(), input.data(), 1, 1);
+
+    for (size_t base_ntt_size : {16, 64, 256, 4096, 1 << 13}) {
+      ntt.SetBaseNTTSize(base_ntt_size);
+      EXPECT_EQ(ntt.GetBaseNTTSize(), base_ntt_size);
+      std::vector<uint64_t> output(N, 0);
+      ntt.ComputeForward(output.data(), input.data(), 1, 1);
+      AssertEqual(output, exp_output);
+
+      ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+      AssertEqual(output, input);
+    }
+  }
+
+#ifdef HEXL_DEBUG
+  NTT ntt(N, GeneratePrimes(1, 50, N)[0]);
+  EXPECT_ANY_THROW(ntt.SetBaseNTTSize(8));
+  EXPECT_ANY_THROW(ntt.SetBaseNTTSize(1000));
+#endif
+}
+
+TEST(NTT, TuneBaseNTTSize) {
+  uint64_t N = 1ULL << 12;
+  uint64_t modulus = GeneratePrimes(1, 50, N)[0];
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+  std::vector<uint64_t> input(N, 0);
+  for (size_t i = 0; i < N; ++i) {
+    input[i] = distrib(gen);
+  }
+
+  NTT ntt(N, modulus);
+  std::vector<uint64_t> exp_output(N, 0);
+  ntt.ComputeForward(exp_output.data(), input.data(), 1, 1);
+
+  size_t base_ntt_size = ntt.TuneBaseNTTSize();
+  EXPECT_EQ(ntt.GetBaseNTTSize(), base_ntt_size);
+  EXPECT_TRUE(IsPowerOfTwo(base_ntt_size));
+  EXPECT_GE(base_ntt_size, 16ULL);
+
+  std::vector<uint64_t> output(N, 0);
+  ntt.ComputeForward(output.data(), input.data(), 1, 1);
+  AssertEqual(output, exp_output);
+  ntt.ComputeInverse(output.data(), output.data(), 1, 1);
+  AssertEqual(output, input);
+
+  // A second NTT with the same parameters reuses the cached size
+  NTT ntt2(N, GeneratePrimes(2, 50, N)[1]);
+  EXPECT_EQ(ntt2.TuneBaseNTTSize(), base_ntt_size);
+}
+
+// Checks the 32-bit transforms match the 64-bit transforms
+TEST(NTT, U32) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t N : {2, 8, 16, 32, 64, 1024, 4096}) {
+    for (uint64_t bits : {17, 25, 29}) {
+      uint64_t modulus = GeneratePrimes(1, bits, N)[0];
+      NTT ntt(N, modulus);
+
+      for (uint64_t input_mod_factor : {1, 2, 4}) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * modulus - 1);
+        std::vector<uint64_t> input(N);
+        for (size_t i = 0; i < N; ++i) {
+          input[i] = distrib(gen);
+        }
+        std::vector<uint32_t> input32(input.begin(), input.end());
+
+        for (uint64_t output_mod_factor : {1, 4}) {
+          std::vector<uint64_t> expected(N);
+          ntt.ComputeForward(expected.data(), input.data(), input_mod_factor,
+                             output_mod_factor);
+          std::vector<uint32_t> output(N);
+          ntt.ComputeForward(output.data(), input32.data(), input_mod_factor,
+                             output_mod_factor);
+          for (size_t i = 0; i < N; ++i) {
+            ASSERT_EQ(output[i] % modulus, expected[i] % modulus) << i;
+            ASSERT_LT(output[i], output_mod_factor * modulus) << i;
+          }
+        }
+      }
+
+      std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+      std::vector<uint32_t> input(N);
+      for (size_t i = 0; i < N; ++i) {
+        input[i] = static_cast<uint32_t>(distrib(gen));
+      }
+      for (auto order :
+           {NTT::Ordering::kBitReversed, NTT::Ordering::kNatural}) {
+        std::vector<uint32_t> output(N);
+        ntt.ComputeForward(output.data(), input.data(), 1, 1, order);
+        ntt.ComputeInverse(output.data(), output.data(), 1, 1, order);
+        AssertEqual(output, input);
+        ntt.ComputeForward(output.data(), input.data(), 2, 1, order);
+        ntt.ComputeInverse(output.data(), output.data(), 2, 2, order);
+        for (size_t i = 0; i < N; ++i) {
+          ASSERT_EQ(output[i] % modulus, input[i]) << i;
+        }
+      }
+    }
+  }
+
+#ifdef HEXL_DEBUG
+  uint64_t N = 64;
+  NTT ntt(N, GeneratePrimes(1, 30, N)[0]);
+  std::vector<uint32_t> input(N, 1);
+  EXPECT_ANY_THROW(ntt.ComputeForward(input.data(), input.data(), 1, 1));
+#endif
+}
+
 // Parameters = (degree, modulus, input, expected_output)
 class NTTAPITest
     : public ::testing::TestWithParam<std::tuple<
@@ -1,9 +1,11 @@
 // Copyright (C) 2020-2021 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <random>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "hexl/number-theory/double-word.hpp"
 #include "hexl/number-theory/number-theory.hpp"
 #include "hexl/util/compiler.hpp"
 
@@ -326,6 +328,20 @@ TEST(NumberTheory, GeneratePrimes) {
   }
 }
 
+TEST(NumberTheory, GeneratePrimesSpecialForm) {
+  for (int bit_size = 40; bit_size < 62; ++bit_size) {
+    std::vector<uint64_t> primes = GeneratePrimes(3, bit_size, 1024, true);
+    ASSERT_EQ(primes.size(), 3);
+    for (const auto& prime : primes) {
+      ASSERT_EQ(prime % 2048, 1);
+      ASSERT_TRUE(IsPrime(prime));
+      ASSERT_TRUE(prime <= (1ULL << (bit_size + 1)));
+      ASSERT_TRUE(prime >= (1ULL << bit_size));
+      ASSERT_TRUE(SpecialFormModulus(prime).IsSpecialForm());
+    }
+  }
+}
+
 TEST(NumberTheory, AddUInt64) {
   uint64_t result;
   EXPECT_EQ(0, AddUInt64(1, 0, &result));
@@ -420,9 +436,272 @@ TEST(NumberTheory, MSB) {
   EXPECT_EQ(40ULL, MSB((1ULL << 40) + 1));
   EXPECT_EQ(40ULL, MSB(1ULL << 40));
   EXPECT_EQ(39ULL, MSB((1ULL << 40) - 1));
+  EXPECT_EQ(60ULL, MSB((1ULL << 61) - 1));
+  EXPECT_EQ(63ULL, MSB(~0ULL));
   EXPECT_EQ(8ULL, MSB(256));
   EXPECT_EQ(0ULL, MSB(1));
 }
 
+TEST(NumberTheory, Montgomery) {
+  for (uint64_t modulus : {uint64_t(3), uint64_t(769),
+                           uint64_t(1152921504606844417),
+                           uint64_t((1ULL << 62) - 57)}) {
+    uint64_t neg_inv_modulus = MontgomeryNegInverse(modulus);
+    EXPECT_EQ(0ULL, modulus * neg_inv_modulus + 1);
+
+    for (uint64_t x : {uint64_t(0), uint64_t(1), uint64_t(2), modulus / 2,
+                       modulus - 1}) {
+      uint64_t x_mont = ToMontgomery(x, modulus);
+      EXPECT_EQ(x, FromMontgomery(x_mont, modulus, neg_inv_modulus));
+      for (uint64_t y : {uint64_t(0), uint64_t(1), modulus / 3, modulus - 1}) {
+        uint64_t y_mont = ToMontgomery(y, modulus);
+        uint64_t prod_mont =
+            MontgomeryMultiply(x_mont, y_mont, modulus, neg_inv_modulus);
+        EXPECT_EQ(ToMontgomery(MultiplyMod(x, y, modulus), modulus),
+                  prod_mont);
+      }
+    }
+  }
+}
+
+// Reduces x_hi * 2^64 + x_lo modulo the Goldilocks prime one bit at a time
+uint64_t ReduceGoldilocksReference(uint64_t x_hi, uint64_t x_lo) {
+  uint64_t r = 0;
+  for (int bit = 127; bit >= 0; --bit) {
+    uint64_t b = (bit >= 64) ? (x_hi >> (bit - 64)) & 1 : (x_lo >> bit) & 1;
+    bool overflow = (r >> 63) != 0;
+    r = (r << 1) | b;
+    if (overflow || r >= kGoldilocksModulus) {
+      r -= kGoldilocksModulus;
+    }
+  }
+  return r;
+}
+
+TEST(NumberTheory, Goldilocks) {
+  const uint64_t p = kGoldilocksModulus;
+  std::vector<uint64_t> values{0,
+                               1,
+                               2,
+                               0xFFFFFFFFULL,
+                               1ULL << 32,
+                               1ULL << 63,
+                               p - 2,
+                               p - 1,
+                               p,
+                               p + 1,
+                               0xFFFFFFFFFFFFFFFFULL};
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+  for (size_t i = 0; i < 20; ++i) {
+    values.push_back(distrib(gen));
+  }
+
+  for (uint64_t x : values) {
+    for (uint64_t y : values) {
+      ASSERT_EQ(ReduceGoldilocksReference(x, y), ReduceGoldilocks(x, y));
+
+      uint64_t prod_hi;
+      uint64_t prod_lo;
+      MultiplyUInt64(x, y, &prod_hi, &prod_lo);
+      ASSERT_EQ(ReduceGoldilocksReference(prod_hi, prod_lo),
+                MultiplyModGoldilocks(x, y));
+
+      if (x < p && y < p) {
+        uint64_t sum_lo;
+        uint64_t sum_hi = AddUInt64(x, y, &sum_lo);
+        ASSERT_EQ(ReduceGoldilocksReference(sum_hi, sum_lo),
+                  AddModGoldilocks(x, y));
+        ASSERT_EQ(x, AddModGoldilocks(SubModGoldilocks(x, y), y));
+      }
+    }
+  }
+
+  EXPECT_EQ(1ULL, PowModGoldilocks(7, p - 1));
+  EXPECT_EQ(p - 1, PowModGoldilocks(7, (p - 1) / 2));
+  EXPECT_EQ(p - 1, PowModGoldilocks(2, 96));
+  EXPECT_EQ(0xFFFFFFFFULL, PowModGoldilocks(2, 64));
+}
+
+TEST(NumberTheory, SpecialFormModulus) {
+  // 2^60 - 2^18 + 1
+  SpecialFormModulus q1(0xffffffffffc0001ULL);
+  ASSERT_TRUE(q1.IsSpecialForm());
+  EXPECT_EQ(60, q1.K());
+  EXPECT_EQ(1, q1.C());
+  EXPECT_EQ(18, q1.M());
+
+  // 2^61 - 1
+  SpecialFormModulus q2((1ULL << 61) - 1);
+  ASSERT_TRUE(q2.IsSpecialForm());
+  EXPECT_EQ(61, q2.K());
+  EXPECT_EQ(1, q2.C());
+  EXPECT_EQ(1, q2.M());
+
+  // 2^50 - 27 = 2^50 - 7 * 2^2 + 1
+  SpecialFormModulus q3((1ULL << 50) - 27);
+  ASSERT_TRUE(q3.IsSpecialForm());
+  EXPECT_EQ(50, q3.K());
+  EXPECT_EQ(7, q3.C());
+  EXPECT_EQ(2, q3.M());
+
+  // c = 29 is too large for k = 62
+  EXPECT_FALSE(SpecialFormModulus((1ULL << 62) - 57).IsSpecialForm());
+  // d = 2^61 - q is too large
+  EXPECT_FALSE(SpecialFormModulus(1152921504606877697ULL).IsSpecialForm());
+  EXPECT_FALSE(SpecialFormModulus((1ULL << 40) + 1).IsSpecialForm());
+  // Even moduli
+  EXPECT_FALSE(SpecialFormModulus(1ULL << 40).IsSpecialForm());
+  EXPECT_FALSE(SpecialFormModulus((1ULL << 40) - 2).IsSpecialForm());
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::vector<uint64_t> moduli{0xffffffffffc0001ULL, (1ULL << 61) - 1,
+                               (1ULL << 50) - 27, (1ULL << 62) - 3,
+                               (1ULL << 20) - 3};
+  for (size_t bit_size = 30; bit_size < 62; ++bit_size) {
+    moduli.push_back(GeneratePrimes(1, bit_size, 1, true)[0]);
+  }
+  for (uint64_t modulus : moduli) {
+    SpecialFormModulus special_modulus(modulus);
+    ASSERT_TRUE(special_modulus.IsSpecialForm()) << modulus;
+
+    std::uniform_int_distribution<uint64_t> distrib(0, modulus - 1);
+    std::vector<uint64_t> values{0, 1, 2, modulus - 2, modulus - 1};
+    for (size_t i = 0; i < 20; ++i) {
+      values.push_back(distrib(gen));
+    }
+    for (uint64_t x : values) {
+      for (uint64_t y : values) {
+        ASSERT_EQ(MultiplyMod(x, y, modulus),
+                  MultiplyModSpecialForm(x, y, special_modulus))
+            << x << " * " << y << " mod " << modulus;
+      }
+    }
+  }
+}
+
+// Computes x * y mod q by double-and-add, independent of Barrett reduction
+DoubleWord MultiplyModDoubleWordReference(DoubleWord x, DoubleWord y,
+                                          const DoubleWordModulus& modulus) {
+  DoubleWord r{0, 0};
+  for (int bit = 127; bit >= 0; --bit) {
+    r = AddModDoubleWord(r, r, modulus);
+    uint64_t b = (bit >= 64) ? (y.hi >> (bit - 64)) & 1 : (y.lo >> bit) & 1;
+    if (b) {
+      r = AddModDoubleWord(r, x, modulus);
+    }
+  }
+  return r;
+}
+
+TEST(NumberTheory, DoubleWord) {
+  DoubleWord x{0xFFFFFFFFFFFFFFFFULL, 0x123456789ULL};
+  DoubleWord y{0x8000000000000001ULL, 0xFFFFFFFFFFFFFFFFULL};
+  unsigned char carry;
+  DoubleWord sum = AddDoubleWord(x, y, &carry);
+  EXPECT_EQ((DoubleWord{0x8000000000000000ULL, 0x123456789ULL}), sum);
+  EXPECT_EQ(1, carry);
+  EXPECT_EQ(x, SubDoubleWord(sum, y));
+  EXPECT_EQ((DoubleWord{0x9FFFFFFFFFFFFFFFULL, 0x12345678ULL}),
+            ShiftRightDoubleWord(x, 4));
+  EXPECT_EQ((DoubleWord{0, 0xFFFFFFFFFFFFFFFFULL}),
+            ShiftLeftDoubleWord(x, 64));
+  EXPECT_EQ((DoubleWord{0x1, 0}), ShiftRightDoubleWord(y, 127));
+
+  // (2^128 - 1)^2 = 2^256 - 2^129 + 1
+  DoubleWord max{0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL};
+  DoubleWord prod_hi, prod_lo;
+  MultiplyDoubleWord(max, max, &prod_hi, &prod_lo);
+  EXPECT_EQ((DoubleWord{0xFFFFFFFFFFFFFFFEULL, 0xFFFFFFFFFFFFFFFFULL}),
+            prod_hi);
+  EXPECT_EQ((DoubleWord{1, 0}), prod_lo);
+  EXPECT_EQ(prod_lo, MultiplyDoubleWordLo(max, max));
+}
+
+TEST(NumberTheory, DoubleWordModulus) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<uint64_t> distrib;
+
+  // 2^107 - 1, 2^89 - 1, a 125-bit prime, and small and single-word moduli
+  std::vector<DoubleWord> moduli{
+      DoubleWord{0xFFFFFFFFFFFFFFFFULL, (1ULL << 43) - 1},
+      DoubleWord{0xFFFFFFFFFFFFFFFFULL, (1ULL << 25) - 1},
+      GeneratePrimesDoubleWord(1, 124, 1024)[0], DoubleWord{3, 0},
+      DoubleWord{(1ULL << 61) - 1, 0}, DoubleWord{0xFFFFFFFFFFFFFFC5ULL, 0}};
+
+  for (const auto& q : moduli) {
+    DoubleWordModulus modulus(q);
+    EXPECT_EQ((DoubleWord{0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL}),
+              MultiplyDoubleWordLo(q, modulus.NegInverse()));
+
+    std::vector<DoubleWord> values{DoubleWord{0, 0}, DoubleWord{1, 0},
+                                   SubDoubleWord(q, DoubleWord{1, 0}),
+                                   ShiftRightDoubleWord(q, 1)};
+    for (size_t i = 0; i < 20; ++i) {
+      DoubleWord value{distrib(gen), distrib(gen)};
+      // Reduce below q with a shift and a subtraction
+      value = ShiftRightDoubleWord(value, 128 - modulus.BitLength());
+      if (value >= q) {
+        value = SubDoubleWord(value, q);
+      }
+      values.push_back(value);
+    }
+
+    const DoubleWord r128 =
+        PowModDoubleWord(DoubleWord{2, 0}, DoubleWord{128, 0}, modulus);
+    for (const auto& a : values) {
+      for (const auto& b : values) {
+        DoubleWord expected = MultiplyModDoubleWordReference(a, b, modulus);
+        ASSERT_EQ(expected, MultiplyModDoubleWord(a, b, modulus))
+            << "q " << q << " a " << a << " b " << b;
+        // Montgomery multiplication by b * 2^128 mod q multiplies by b
+        DoubleWord b_mont = MultiplyModDoubleWord(b, r128, modulus);
+        ASSERT_EQ(expected, MontgomeryMultiplyDoubleWord(a, b_mont, modulus));
+        ASSERT_EQ(a, SubModDoubleWord(AddModDoubleWord(a, b, modulus), b,
+                                      modulus));
+      }
+    }
+  }
+}
+
+TEST(NumberTheory, DoubleWordPrimes) {
+  EXPECT_TRUE(IsPrimeDoubleWord(DoubleWord{0xFFFFFFFFFFFFFFFFULL,
+                                           (1ULL << 43) - 1}));
+  EXPECT_TRUE(IsPrimeDoubleWord(DoubleWord{(1ULL << 61) - 1, 0}));
+  EXPECT_FALSE(IsPrimeDoubleWord(DoubleWord{1ULL << 61, 0}));
+  // (2^61 - 1) * (2^31 - 1) and (2^61 - 1)^2
+  DoubleWord p61{(1ULL << 61) - 1, 0};
+  EXPECT_FALSE(IsPrimeDoubleWord(
+      MultiplyDoubleWordLo(p61, DoubleWord{(1ULL << 31) - 1, 0})));
+  EXPECT_FALSE(IsPrimeDoubleWord(MultiplyDoubleWordLo(p61, p61)));
+
+  for (size_t bit_size : {65, 100, 110, 125}) {
+    for (size_t ntt_size : {1, 2, 1024, 65536}) {
+      std::vector<DoubleWord> primes =
+          GeneratePrimesDoubleWord(3, bit_size, ntt_size);
+      ASSERT_EQ(3, primes.size());
+      for (const auto& prime : primes) {
+        EXPECT_TRUE(IsPrimeDoubleWord(prime));
+        EXPECT_EQ(1, prime.lo % (2 * ntt_size));
+        EXPECT_EQ(bit_size + 1, DoubleWordModulus(prime).BitLength());
+
+        DoubleWordModulus modulus(prime);
+        DoubleWord x{0x123456789ABCDEFULL, 0x42};
+        EXPECT_EQ((DoubleWord{1, 0}),
+                  MultiplyModDoubleWord(x, InverseModDoubleWord(x, modulus),
+                                        modulus));
+
+        DoubleWord root =
+            GeneratePrimitiveRootDoubleWord(2 * ntt_size, modulus);
+        EXPECT_EQ(SubDoubleWord(prime, DoubleWord{1, 0}),
+                  PowModDoubleWord(root, DoubleWord{ntt_size, 0}, modulus));
+      }
+    }
+  }
+}
+
 }  // namespace hexl
 }  // namespace intel
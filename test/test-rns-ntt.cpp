@@ -0,0 +1,188 @@
+// Copyright (C) 2020-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "hexl/logging/logging.hpp"
+#include "hexl/ntt/ntt.hpp"
+#include "hexl/ntt/rns-ntt.hpp"
+#include "hexl/number-theory/number-theory.hpp"
+#include "test-util.hpp"
+
+namespace intel {
+namespace hexl {
+
+#ifdef HEXL_DEBUG
+TEST(RNSNTT, bad_input) {
+  uint64_t N = 8;
+  std::vector<uint64_t> moduli{769, 7681};
+  std::vector<uint64_t> input(N * moduli.size(), 1);
+
+  EXPECT_ANY_THROW(RNSNTT(N, {}));
+
+  RNSNTT rns_ntt(N, moduli);
+  EXPECT_ANY_THROW(rns_ntt.ComputeForward(input.data(), nullptr, 1, 1));
+  EXPECT_ANY_THROW(rns_ntt.ComputeForward(nullptr, input.data(), 1, 1));
+  EXPECT_ANY_THROW(rns_ntt.ComputeInverse(input.data(), nullptr, 1, 1));
+  EXPECT_ANY_THROW(rns_ntt.ComputeInverse(nullptr, input.data(), 1, 1));
+  EXPECT_ANY_THROW(rns_ntt.SetNumInterleavedRows(3));
+
+  // Second row exceeds its modulus
+  input[N] = 7681;
+  EXPECT_ANY_THROW(rns_ntt.ComputeForward(input.data(), input.data(), 1, 1));
+}
+#endif
+
+TEST(RNSNTT, Getters) {
+  uint64_t N = 16;
+  std::vector<uint64_t> moduli = GeneratePrimes(3, 30, N);
+  RNSNTT rns_ntt(N, moduli);
+
+  EXPECT_EQ(rns_ntt.GetDegree(), N);
+  EXPECT_EQ(rns_ntt.GetNumModuli(), moduli.size());
+  EXPECT_EQ(rns_ntt.GetModuli(), moduli);
+  EXPECT_EQ(rns_ntt.GetNumInterleavedRows(), 1ULL);
+  rns_ntt.SetNumInterleavedRows(4);
+  EXPECT_EQ(rns_ntt.GetNumInterleavedRows(), 4ULL);
+  for (size_t i = 0; i < moduli.size(); ++i) {
+    EXPECT_EQ(rns_ntt.GetNTT(i).GetModulus(), moduli[i]);
+    EXPECT_EQ(rns_ntt.GetNTT(i).GetDegree(), N);
+  }
+}
+
+// Parameters = (degree, number of moduli, modulus bits)
+class RNSNTTTest
+    : public ::testing::TestWithParam<std::tuple<uint64_t, size_t, size_t>> {
+};
+
+// Checks the batched transforms match row-by-row NTT transforms
+TEST_P(RNSNTTTest, Random) {
+  uint64_t N = std::get<0>(GetParam());
+  size_t num_moduli = std::get<1>(GetParam());
+  size_t modulus_bits = std::get<2>(GetParam());
+
+  std::vector<uint64_t> moduli = GeneratePrimes(num_moduli, modulus_bits, N);
+  RNSNTT rns_ntt(N, moduli);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  std::vector<uint64_t> input(N * num_moduli);
+  for (size_t i = 0; i < num_moduli; ++i) {
+    std::uniform_int_distribution<uint64_t> distrib(0, moduli[i] - 1);
+    for (size_t j = 0; j < N; ++j) {
+      input[i * N + j] = distrib(gen);
+    }
+  }
+
+  std::vector<uint64_t> exp_output = input;
+  for (size_t i = 0; i < num_moduli; ++i) {
+    NTT ntt(N, moduli[i]);
+    ntt.ComputeForward(&exp_output[i * N], &exp_output[i * N], 1, 1);
+  }
+
+  // Out-of-place forward
+  std::vector<uint64_t> output(N * num_moduli, 0);
+  rns_ntt.ComputeForward(output.data(), input.data(), 1, 1);
+  AssertEqual(output, exp_output);
+
+  // In-place forward
+  std::vector<uint64_t> in_place = input;
+  rns_ntt.ComputeForward(in_place.data(), in_place.data(), 1, 1);
+  AssertEqual(in_place, exp_output);
+
+  // Out-of-place inverse
+  std::vector<uint64_t> round_trip(N * num_moduli, 0);
+  rns_ntt.ComputeInverse(round_trip.data(), output.data(), 1, 1);
+  AssertEqual(round_trip, input);
+
+  // In-place lazy inverse
+  rns_ntt.ComputeInverse(in_place.data(), in_place.data(), 1, 2);
+  for (size_t i = 0; i < num_moduli; ++i) {
+    for (size_t j = 0; j < N; ++j) {
+      in_place[i * N + j] %= moduli[i];
+    }
+  }
+  AssertEqual(in_place, input);
+}
+
+// Checks the interleaved transforms of rows of different kernels, with lazy
+// mod factors, match row-by-row NTT transforms
+TEST(RNSNTT, Interleaved) {
+  uint64_t N = 2048;
+  std::vector<uint64_t> moduli = GeneratePrimes(3, 30, N);
+  for (uint64_t modulus : GeneratePrimes(3, 49, N)) {
+    moduli.push_back(modulus);
+  }
+  moduli.push_back(GeneratePrimes(1, 60, N)[0]);
+  moduli.push_back(GeneratePrimes(1, 31, N)[0]);
+  size_t num_moduli = moduli.size();
+
+  RNSNTT rns_ntt(N, moduli);
+  // Splits the 49-bit rows
+  rns_ntt.GetNTT(4).SetBaseNTTSize(256);
+
+  std::random_device rd;
+  std::mt19937 gen(rd());
+
+  for (uint64_t input_mod_factor : {1, 2, 4}) {
+    for (uint64_t output_mod_factor : {1, 4}) {
+      std::vector<uint64_t> input(N * num_moduli);
+      for (size_t i = 0; i < num_moduli; ++i) {
+        std::uniform_int_distribution<uint64_t> distrib(
+            0, input_mod_factor * moduli[i] - 1);
+        for (size_t j = 0; j < N; ++j) {
+          input[i * N + j] = distrib(gen);
+        }
+      }
+      // The inverse takes input_mod_factor 1 or 2, and output_mod_factor 1
+      // or 2
+      uint64_t inv_output_mod_factor = (output_mod_factor == 1) ? 1 : 2;
+
+      for (auto order :
+           {NTT::Ordering::kBitReversed, NTT::Ordering::kNatural}) {
+        std::vector<uint64_t> exp_fwd(N * num_moduli);
+        std::vector<uint64_t> exp_inv(N * num_moduli);
+        for (size_t i = 0; i < num_moduli; ++i) {
+          NTT ntt(N, moduli[i]);
+          ntt.ComputeForward(&exp_fwd[i * N], &input[i * N], input_mod_factor,
+                             output_mod_factor, order);
+          if (input_mod_factor <= 2) {
+            ntt.ComputeInverse(&exp_inv[i * N], &input[i * N],
+                               input_mod_factor, inv_output_mod_factor, order);
+          }
+        }
+
+        for (size_t num_rows : {1, 2, 4}) {
+          rns_ntt.SetNumInterleavedRows(num_rows);
+          std::vector<uint64_t> output(N * num_moduli);
+          rns_ntt.ComputeForward(output.data(), input.data(),
+                                 input_mod_factor, output_mod_factor, order);
+          AssertEqual(output, exp_fwd);
+
+          if (input_mod_factor <= 2) {
+            rns_ntt.ComputeInverse(output.data(), input.data(),
+                                   input_mod_factor, inv_output_mod_factor,
+                                   order);
+            AssertEqual(output, exp_inv);
+          }
+        }
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    RNSNTT, RNSNTTTest,
+    ::testing::Values(std::make_tuple(8, 1, 30), std::make_tuple(16, 3, 30),
+                      std::make_tuple(1024, 4, 30),
+                      std::make_tuple(1024, 4, 49),
+                      std::make_tuple(4096, 5, 60),
+                      std::make_tuple(8192, 7, 45)));
+
+}  // namespace hexl
+}  // namespace intel